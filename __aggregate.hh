@@ -0,0 +1,623 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+/*
+    __aggregate synopsis (C++17, extension)
+
+namespace std
+{
+
+// Number of members of an aggregate without base classes, up to
+// __aggregate_max_fields.
+template <class T> inline constexpr size_t __aggregate_field_count_v;
+
+template <class T> using __aggregate_member_types_t = __type_list<M0, M1, ...>;
+
+template <class T, class F> constexpr decltype(auto) __aggregate_apply(T& t, F&& f);  // f(t.m0, t.m1, ...)
+template <size_t I, class T> constexpr auto& __aggregate_get(T& t);
+
+template <class T> struct __aggregate_layout
+{
+    static constexpr size_t __field_count;
+    static constexpr size_t __size;
+    static constexpr size_t __alignment;
+    static constexpr size_t __member_bytes;      // sum of the member sizes
+    static constexpr size_t __padding;           // __size - __member_bytes
+    static constexpr __layout_order<N> __suggested_order;
+    static constexpr size_t __reordered_size;    // size with members in __suggested_order
+    static constexpr size_t __reordered_padding;
+    static constexpr bool   __is_optimal;        // no reordering is smaller
+
+    static constexpr __layout_summary __summary() noexcept;
+};
+
+struct __layout_summary
+{
+    size_t __size, __alignment, __field_count, __padding, __reordered_size;
+};
+
+template <class... T> struct __layout_report
+{
+    static constexpr __layout_summary __entries[sizeof...(T)];
+    static constexpr size_t __total_padding;
+    static constexpr size_t __total_savings;     // sum of __size - __reordered_size
+};
+
+}  // std
+
+*/
+
+#include "__config.hh"
+#include "cstddef.hh"
+#include "type_traits.hh"
+#include "utility.hh"
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#pragma GCC system_header
+#endif
+
+#if _LIBCPP_STD_VER > 14
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+// __aggregate_field_count
+
+// Converts to an lvalue of any type, so it also initializes reference
+// members. Only ever used in unevaluated operands.
+struct __any_init {
+  template <class _Tp> operator _Tp &() const;
+};
+
+// Converts to a prvalue of any class type and nothing else, so that {this}
+// picks the move (or copy) constructor of a class member whose other
+// constructors make {__any_init} ambiguous, or that is move-only.
+struct __any_class_init {
+  template <class _Tp, class = enable_if_t<is_class_v<_Tp>>> operator _Tp() const;
+};
+
+// Initializes any member but an array, unbraced: an lvalue for references,
+// else a prvalue, which needs no copy or move constructor.
+struct __any_member_init {
+  template <class _Tp> operator _Tp &() const &;
+  template <class _Tp> operator _Tp() const &&;
+};
+
+inline constexpr size_t __aggregate_max_fields = 24;
+
+// The members are found one at a time, each given its own braced probe, so
+// that none is spread over the elements of an array member or the members
+// of a nested aggregate: {__any_init} where it works, else
+// {__any_class_init}. A probe for member k is tried with up to
+// __aggregate_max_fields + 1 - k unbraced initializers after it, as the
+// members after k may not be omittable (references, classes without a
+// default constructor).
+template <class _Tp, class _Probes, class _Next, class _Tail, class = void>
+struct __is_aggregate_initializable_from : false_type {};
+
+template <class _Tp, class... _Pp, class _Next, size_t... _It>
+struct __is_aggregate_initializable_from<
+    _Tp, __type_list<_Pp...>, _Next, __index_sequence<_It...>,
+    void_t<decltype(_Tp{{_Pp()}..., {_Next()}, ((void)_It, __any_member_init())...})>> : true_type {};
+
+// _Next = void: only the unbraced initializers after the probes.
+template <class _Tp, class... _Pp, size_t... _It>
+struct __is_aggregate_initializable_from<
+    _Tp, __type_list<_Pp...>, void, __index_sequence<_It...>,
+    void_t<decltype(_Tp{{_Pp()}..., ((void)_It, __any_member_init())...})>> : true_type {};
+
+// Whether some tail length in [_Jp, _Last] works; stops at the first.
+template <class _Tp, class _Probes, class _Next, size_t _Jp, size_t _Last>
+constexpr bool __aggregate_probe_fits() {
+  if constexpr (__is_aggregate_initializable_from<_Tp, _Probes, _Next, __make_index_sequence<_Jp>>::value)
+    return true;
+  else if constexpr (_Jp == _Last)
+    return false;
+  else
+    return _VSTD::__aggregate_probe_fits<_Tp, _Probes, _Next, _Jp + 1, _Last>();
+}
+
+template <class _Tp, class... _Pp> constexpr size_t __aggregate_count_from(__type_list<_Pp...>) {
+  constexpr size_t __k    = sizeof...(_Pp);
+  constexpr size_t __last = __aggregate_max_fields + 1 - __k;
+  if constexpr (__k > __aggregate_max_fields)
+    return __k;
+  else if constexpr (_VSTD::__aggregate_probe_fits<_Tp, __type_list<_Pp...>, __any_init, 0, __last>())
+    return _VSTD::__aggregate_count_from<_Tp>(__type_list<_Pp..., __any_init>());
+  else if constexpr (_VSTD::__aggregate_probe_fits<_Tp, __type_list<_Pp...>, __any_class_init, 0, __last>())
+    return _VSTD::__aggregate_count_from<_Tp>(__type_list<_Pp..., __any_class_init>());
+  else {
+    // Neither probe fits member k; if an unbraced initializer does, member k
+    // is there and the count would be short.
+    static_assert(!_VSTD::__aggregate_probe_fits<_Tp, __type_list<_Pp...>, void, 1, __last>(),
+                  "__aggregate_field_count cannot count a member that neither probe initializes, such as one of a "
+                  "class with a constructor from another class type");
+    return __k;
+  }
+}
+
+template <class _Tp> constexpr size_t __aggregate_field_count() {
+  static_assert(is_aggregate_v<_Tp> && !is_array_v<_Tp>, "__aggregate_field_count requires a non-array aggregate");
+  constexpr size_t __n = _VSTD::__aggregate_count_from<_Tp>(__type_list<>());
+  static_assert(__n <= __aggregate_max_fields, "aggregate has more members than __aggregate_max_fields");
+  return __n;
+}
+
+template <class _Tp> inline constexpr size_t __aggregate_field_count_v = _VSTD::__aggregate_field_count<_Tp>();
+
+// __aggregate_binder
+
+// One specialization per member count, each decomposing the aggregate with a
+// structured binding. Generated; keep in sync with __aggregate_max_fields.
+template <size_t _Np> struct __aggregate_binder;
+
+template <> struct __aggregate_binder<0> {
+  template <class _Tp, class _Fn> static constexpr decltype(auto) __apply(_Tp &, _Fn &&__f) { return __f(); }
+  template <class _Tp> static __type_list<> __types(_Tp &);
+};
+
+template <> struct __aggregate_binder<1> {
+  template <class _Tp, class _Fn> static constexpr decltype(auto) __apply(_Tp &__t, _Fn &&__f) {
+    auto &[__m0] = __t;
+    return __f(__m0);
+  }
+  template <class _Tp> static auto __types(_Tp &__t) {
+    auto &[__m0] = __t;
+    return __type_list<decltype(__m0)>();
+  }
+};
+
+template <> struct __aggregate_binder<2> {
+  template <class _Tp, class _Fn> static constexpr decltype(auto) __apply(_Tp &__t, _Fn &&__f) {
+    auto &[__m0, __m1] = __t;
+    return __f(__m0, __m1);
+  }
+  template <class _Tp> static auto __types(_Tp &__t) {
+    auto &[__m0, __m1] = __t;
+    return __type_list<decltype(__m0), decltype(__m1)>();
+  }
+};
+
+template <> struct __aggregate_binder<3> {
+  template <class _Tp, class _Fn> static constexpr decltype(auto) __apply(_Tp &__t, _Fn &&__f) {
+    auto &[__m0, __m1, __m2] = __t;
+    return __f(__m0, __m1, __m2);
+  }
+  template <class _Tp> static auto __types(_Tp &__t) {
+    auto &[__m0, __m1, __m2] = __t;
+    return __type_list<decltype(__m0), decltype(__m1), decltype(__m2)>();
+  }
+};
+
+template <> struct __aggregate_binder<4> {
+  template <class _Tp, class _Fn> static constexpr decltype(auto) __apply(_Tp &__t, _Fn &&__f) {
+    auto &[__m0, __m1, __m2, __m3] = __t;
+    return __f(__m0, __m1, __m2, __m3);
+  }
+  template <class _Tp> static auto __types(_Tp &__t) {
+    auto &[__m0, __m1, __m2, __m3] = __t;
+    return __type_list<decltype(__m0), decltype(__m1), decltype(__m2), decltype(__m3)>();
+  }
+};
+
+template <> struct __aggregate_binder<5> {
+  template <class _Tp, class _Fn> static constexpr decltype(auto) __apply(_Tp &__t, _Fn &&__f) {
+    auto &[__m0, __m1, __m2, __m3, __m4] = __t;
+    return __f(__m0, __m1, __m2, __m3, __m4);
+  }
+  template <class _Tp> static auto __types(_Tp &__t) {
+    auto &[__m0, __m1, __m2, __m3, __m4] = __t;
+    return __type_list<decltype(__m0), decltype(__m1), decltype(__m2), decltype(__m3), decltype(__m4)>();
+  }
+};
+
+template <> struct __aggregate_binder<6> {
+  template <class _Tp, class _Fn> static constexpr decltype(auto) __apply(_Tp &__t, _Fn &&__f) {
+    auto &[__m0, __m1, __m2, __m3, __m4, __m5] = __t;
+    return __f(__m0, __m1, __m2, __m3, __m4, __m5);
+  }
+  template <class _Tp> static auto __types(_Tp &__t) {
+    auto &[__m0, __m1, __m2, __m3, __m4, __m5] = __t;
+    return __type_list<decltype(__m0), decltype(__m1), decltype(__m2), decltype(__m3), decltype(__m4),
+                       decltype(__m5)>();
+  }
+};
+
+template <> struct __aggregate_binder<7> {
+  template <class _Tp, class _Fn> static constexpr decltype(auto) __apply(_Tp &__t, _Fn &&__f) {
+    auto &[__m0, __m1, __m2, __m3, __m4, __m5, __m6] = __t;
+    return __f(__m0, __m1, __m2, __m3, __m4, __m5, __m6);
+  }
+  template <class _Tp> static auto __types(_Tp &__t) {
+    auto &[__m0, __m1, __m2, __m3, __m4, __m5, __m6] = __t;
+    return __type_list<decltype(__m0), decltype(__m1), decltype(__m2), decltype(__m3), decltype(__m4), decltype(__m5),
+                       decltype(__m6)>();
+  }
+};
+
+template <> struct __aggregate_binder<8> {
+  template <class _Tp, class _Fn> static constexpr decltype(auto) __apply(_Tp &__t, _Fn &&__f) {
+    auto &[__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7] = __t;
+    return __f(__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7);
+  }
+  template <class _Tp> static auto __types(_Tp &__t) {
+    auto &[__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7] = __t;
+    return __type_list<decltype(__m0), decltype(__m1), decltype(__m2), decltype(__m3), decltype(__m4), decltype(__m5),
+                       decltype(__m6), decltype(__m7)>();
+  }
+};
+
+template <> struct __aggregate_binder<9> {
+  template <class _Tp, class _Fn> static constexpr decltype(auto) __apply(_Tp &__t, _Fn &&__f) {
+    auto &[__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8] = __t;
+    return __f(__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8);
+  }
+  template <class _Tp> static auto __types(_Tp &__t) {
+    auto &[__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8] = __t;
+    return __type_list<decltype(__m0), decltype(__m1), decltype(__m2), decltype(__m3), decltype(__m4), decltype(__m5),
+                       decltype(__m6), decltype(__m7), decltype(__m8)>();
+  }
+};
+
+template <> struct __aggregate_binder<10> {
+  template <class _Tp, class _Fn> static constexpr decltype(auto) __apply(_Tp &__t, _Fn &&__f) {
+    auto &[__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9] = __t;
+    return __f(__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9);
+  }
+  template <class _Tp> static auto __types(_Tp &__t) {
+    auto &[__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9] = __t;
+    return __type_list<decltype(__m0), decltype(__m1), decltype(__m2), decltype(__m3), decltype(__m4), decltype(__m5),
+                       decltype(__m6), decltype(__m7), decltype(__m8), decltype(__m9)>();
+  }
+};
+
+template <> struct __aggregate_binder<11> {
+  template <class _Tp, class _Fn> static constexpr decltype(auto) __apply(_Tp &__t, _Fn &&__f) {
+    auto &[__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9, __m10] = __t;
+    return __f(__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9, __m10);
+  }
+  template <class _Tp> static auto __types(_Tp &__t) {
+    auto &[__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9, __m10] = __t;
+    return __type_list<decltype(__m0), decltype(__m1), decltype(__m2), decltype(__m3), decltype(__m4), decltype(__m5),
+                       decltype(__m6), decltype(__m7), decltype(__m8), decltype(__m9), decltype(__m10)>();
+  }
+};
+
+template <> struct __aggregate_binder<12> {
+  template <class _Tp, class _Fn> static constexpr decltype(auto) __apply(_Tp &__t, _Fn &&__f) {
+    auto &[__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9, __m10, __m11] = __t;
+    return __f(__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9, __m10, __m11);
+  }
+  template <class _Tp> static auto __types(_Tp &__t) {
+    auto &[__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9, __m10, __m11] = __t;
+    return __type_list<decltype(__m0), decltype(__m1), decltype(__m2), decltype(__m3), decltype(__m4), decltype(__m5),
+                       decltype(__m6), decltype(__m7), decltype(__m8), decltype(__m9), decltype(__m10),
+                       decltype(__m11)>();
+  }
+};
+
+template <> struct __aggregate_binder<13> {
+  template <class _Tp, class _Fn> static constexpr decltype(auto) __apply(_Tp &__t, _Fn &&__f) {
+    auto &[__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9, __m10, __m11, __m12] = __t;
+    return __f(__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9, __m10, __m11, __m12);
+  }
+  template <class _Tp> static auto __types(_Tp &__t) {
+    auto &[__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9, __m10, __m11, __m12] = __t;
+    return __type_list<decltype(__m0), decltype(__m1), decltype(__m2), decltype(__m3), decltype(__m4), decltype(__m5),
+                       decltype(__m6), decltype(__m7), decltype(__m8), decltype(__m9), decltype(__m10), decltype(__m11),
+                       decltype(__m12)>();
+  }
+};
+
+template <> struct __aggregate_binder<14> {
+  template <class _Tp, class _Fn> static constexpr decltype(auto) __apply(_Tp &__t, _Fn &&__f) {
+    auto &[__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9, __m10, __m11, __m12, __m13] = __t;
+    return __f(__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9, __m10, __m11, __m12, __m13);
+  }
+  template <class _Tp> static auto __types(_Tp &__t) {
+    auto &[__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9, __m10, __m11, __m12, __m13] = __t;
+    return __type_list<decltype(__m0), decltype(__m1), decltype(__m2), decltype(__m3), decltype(__m4), decltype(__m5),
+                       decltype(__m6), decltype(__m7), decltype(__m8), decltype(__m9), decltype(__m10), decltype(__m11),
+                       decltype(__m12), decltype(__m13)>();
+  }
+};
+
+template <> struct __aggregate_binder<15> {
+  template <class _Tp, class _Fn> static constexpr decltype(auto) __apply(_Tp &__t, _Fn &&__f) {
+    auto &[__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9, __m10, __m11, __m12, __m13, __m14] = __t;
+    return __f(__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9, __m10, __m11, __m12, __m13, __m14);
+  }
+  template <class _Tp> static auto __types(_Tp &__t) {
+    auto &[__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9, __m10, __m11, __m12, __m13, __m14] = __t;
+    return __type_list<decltype(__m0), decltype(__m1), decltype(__m2), decltype(__m3), decltype(__m4), decltype(__m5),
+                       decltype(__m6), decltype(__m7), decltype(__m8), decltype(__m9), decltype(__m10), decltype(__m11),
+                       decltype(__m12), decltype(__m13), decltype(__m14)>();
+  }
+};
+
+template <> struct __aggregate_binder<16> {
+  template <class _Tp, class _Fn> static constexpr decltype(auto) __apply(_Tp &__t, _Fn &&__f) {
+    auto &[__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9, __m10, __m11, __m12, __m13, __m14, __m15] = __t;
+    return __f(__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9, __m10, __m11, __m12, __m13, __m14, __m15);
+  }
+  template <class _Tp> static auto __types(_Tp &__t) {
+    auto &[__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9, __m10, __m11, __m12, __m13, __m14, __m15] = __t;
+    return __type_list<decltype(__m0), decltype(__m1), decltype(__m2), decltype(__m3), decltype(__m4), decltype(__m5),
+                       decltype(__m6), decltype(__m7), decltype(__m8), decltype(__m9), decltype(__m10), decltype(__m11),
+                       decltype(__m12), decltype(__m13), decltype(__m14), decltype(__m15)>();
+  }
+};
+
+template <> struct __aggregate_binder<17> {
+  template <class _Tp, class _Fn> static constexpr decltype(auto) __apply(_Tp &__t, _Fn &&__f) {
+    auto &[__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9, __m10, __m11, __m12, __m13, __m14, __m15,
+           __m16] = __t;
+    return __f(__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9, __m10, __m11, __m12, __m13, __m14, __m15,
+               __m16);
+  }
+  template <class _Tp> static auto __types(_Tp &__t) {
+    auto &[__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9, __m10, __m11, __m12, __m13, __m14, __m15,
+           __m16] = __t;
+    return __type_list<decltype(__m0), decltype(__m1), decltype(__m2), decltype(__m3), decltype(__m4), decltype(__m5),
+                       decltype(__m6), decltype(__m7), decltype(__m8), decltype(__m9), decltype(__m10), decltype(__m11),
+                       decltype(__m12), decltype(__m13), decltype(__m14), decltype(__m15), decltype(__m16)>();
+  }
+};
+
+template <> struct __aggregate_binder<18> {
+  template <class _Tp, class _Fn> static constexpr decltype(auto) __apply(_Tp &__t, _Fn &&__f) {
+    auto &[__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9, __m10, __m11, __m12, __m13, __m14, __m15, __m16,
+           __m17] = __t;
+    return __f(__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9, __m10, __m11, __m12, __m13, __m14, __m15,
+               __m16, __m17);
+  }
+  template <class _Tp> static auto __types(_Tp &__t) {
+    auto &[__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9, __m10, __m11, __m12, __m13, __m14, __m15, __m16,
+           __m17] = __t;
+    return __type_list<decltype(__m0), decltype(__m1), decltype(__m2), decltype(__m3), decltype(__m4), decltype(__m5),
+                       decltype(__m6), decltype(__m7), decltype(__m8), decltype(__m9), decltype(__m10), decltype(__m11),
+                       decltype(__m12), decltype(__m13), decltype(__m14), decltype(__m15), decltype(__m16),
+                       decltype(__m17)>();
+  }
+};
+
+template <> struct __aggregate_binder<19> {
+  template <class _Tp, class _Fn> static constexpr decltype(auto) __apply(_Tp &__t, _Fn &&__f) {
+    auto &[__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9, __m10, __m11, __m12, __m13, __m14, __m15, __m16,
+           __m17, __m18] = __t;
+    return __f(__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9, __m10, __m11, __m12, __m13, __m14, __m15,
+               __m16, __m17, __m18);
+  }
+  template <class _Tp> static auto __types(_Tp &__t) {
+    auto &[__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9, __m10, __m11, __m12, __m13, __m14, __m15, __m16,
+           __m17, __m18] = __t;
+    return __type_list<decltype(__m0), decltype(__m1), decltype(__m2), decltype(__m3), decltype(__m4), decltype(__m5),
+                       decltype(__m6), decltype(__m7), decltype(__m8), decltype(__m9), decltype(__m10), decltype(__m11),
+                       decltype(__m12), decltype(__m13), decltype(__m14), decltype(__m15), decltype(__m16),
+                       decltype(__m17), decltype(__m18)>();
+  }
+};
+
+template <> struct __aggregate_binder<20> {
+  template <class _Tp, class _Fn> static constexpr decltype(auto) __apply(_Tp &__t, _Fn &&__f) {
+    auto &[__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9, __m10, __m11, __m12, __m13, __m14, __m15, __m16,
+           __m17, __m18, __m19] = __t;
+    return __f(__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9, __m10, __m11, __m12, __m13, __m14, __m15,
+               __m16, __m17, __m18, __m19);
+  }
+  template <class _Tp> static auto __types(_Tp &__t) {
+    auto &[__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9, __m10, __m11, __m12, __m13, __m14, __m15, __m16,
+           __m17, __m18, __m19] = __t;
+    return __type_list<decltype(__m0), decltype(__m1), decltype(__m2), decltype(__m3), decltype(__m4), decltype(__m5),
+                       decltype(__m6), decltype(__m7), decltype(__m8), decltype(__m9), decltype(__m10), decltype(__m11),
+                       decltype(__m12), decltype(__m13), decltype(__m14), decltype(__m15), decltype(__m16),
+                       decltype(__m17), decltype(__m18), decltype(__m19)>();
+  }
+};
+
+template <> struct __aggregate_binder<21> {
+  template <class _Tp, class _Fn> static constexpr decltype(auto) __apply(_Tp &__t, _Fn &&__f) {
+    auto &[__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9, __m10, __m11, __m12, __m13, __m14, __m15, __m16,
+           __m17, __m18, __m19, __m20] = __t;
+    return __f(__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9, __m10, __m11, __m12, __m13, __m14, __m15,
+               __m16, __m17, __m18, __m19, __m20);
+  }
+  template <class _Tp> static auto __types(_Tp &__t) {
+    auto &[__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9, __m10, __m11, __m12, __m13, __m14, __m15, __m16,
+           __m17, __m18, __m19, __m20] = __t;
+    return __type_list<decltype(__m0), decltype(__m1), decltype(__m2), decltype(__m3), decltype(__m4), decltype(__m5),
+                       decltype(__m6), decltype(__m7), decltype(__m8), decltype(__m9), decltype(__m10), decltype(__m11),
+                       decltype(__m12), decltype(__m13), decltype(__m14), decltype(__m15), decltype(__m16),
+                       decltype(__m17), decltype(__m18), decltype(__m19), decltype(__m20)>();
+  }
+};
+
+template <> struct __aggregate_binder<22> {
+  template <class _Tp, class _Fn> static constexpr decltype(auto) __apply(_Tp &__t, _Fn &&__f) {
+    auto &[__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9, __m10, __m11, __m12, __m13, __m14, __m15, __m16,
+           __m17, __m18, __m19, __m20, __m21] = __t;
+    return __f(__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9, __m10, __m11, __m12, __m13, __m14, __m15,
+               __m16, __m17, __m18, __m19, __m20, __m21);
+  }
+  template <class _Tp> static auto __types(_Tp &__t) {
+    auto &[__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9, __m10, __m11, __m12, __m13, __m14, __m15, __m16,
+           __m17, __m18, __m19, __m20, __m21] = __t;
+    return __type_list<decltype(__m0), decltype(__m1), decltype(__m2), decltype(__m3), decltype(__m4), decltype(__m5),
+                       decltype(__m6), decltype(__m7), decltype(__m8), decltype(__m9), decltype(__m10), decltype(__m11),
+                       decltype(__m12), decltype(__m13), decltype(__m14), decltype(__m15), decltype(__m16),
+                       decltype(__m17), decltype(__m18), decltype(__m19), decltype(__m20), decltype(__m21)>();
+  }
+};
+
+template <> struct __aggregate_binder<23> {
+  template <class _Tp, class _Fn> static constexpr decltype(auto) __apply(_Tp &__t, _Fn &&__f) {
+    auto &[__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9, __m10, __m11, __m12, __m13, __m14, __m15, __m16,
+           __m17, __m18, __m19, __m20, __m21, __m22] = __t;
+    return __f(__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9, __m10, __m11, __m12, __m13, __m14, __m15,
+               __m16, __m17, __m18, __m19, __m20, __m21, __m22);
+  }
+  template <class _Tp> static auto __types(_Tp &__t) {
+    auto &[__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9, __m10, __m11, __m12, __m13, __m14, __m15, __m16,
+           __m17, __m18, __m19, __m20, __m21, __m22] = __t;
+    return __type_list<decltype(__m0), decltype(__m1), decltype(__m2), decltype(__m3), decltype(__m4), decltype(__m5),
+                       decltype(__m6), decltype(__m7), decltype(__m8), decltype(__m9), decltype(__m10), decltype(__m11),
+                       decltype(__m12), decltype(__m13), decltype(__m14), decltype(__m15), decltype(__m16),
+                       decltype(__m17), decltype(__m18), decltype(__m19), decltype(__m20), decltype(__m21),
+                       decltype(__m22)>();
+  }
+};
+
+template <> struct __aggregate_binder<24> {
+  template <class _Tp, class _Fn> static constexpr decltype(auto) __apply(_Tp &__t, _Fn &&__f) {
+    auto &[__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9, __m10, __m11, __m12, __m13, __m14, __m15, __m16,
+           __m17, __m18, __m19, __m20, __m21, __m22, __m23] = __t;
+    return __f(__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9, __m10, __m11, __m12, __m13, __m14, __m15,
+               __m16, __m17, __m18, __m19, __m20, __m21, __m22, __m23);
+  }
+  template <class _Tp> static auto __types(_Tp &__t) {
+    auto &[__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7, __m8, __m9, __m10, __m11, __m12, __m13, __m14, __m15, __m16,
+           __m17, __m18, __m19, __m20, __m21, __m22, __m23] = __t;
+    return __type_list<decltype(__m0), decltype(__m1), decltype(__m2), decltype(__m3), decltype(__m4), decltype(__m5),
+                       decltype(__m6), decltype(__m7), decltype(__m8), decltype(__m9), decltype(__m10), decltype(__m11),
+                       decltype(__m12), decltype(__m13), decltype(__m14), decltype(__m15), decltype(__m16),
+                       decltype(__m17), decltype(__m18), decltype(__m19), decltype(__m20), decltype(__m21),
+                       decltype(__m22), decltype(__m23)>();
+  }
+};
+
+// __aggregate_apply, __aggregate_get, __aggregate_member_types_t
+
+template <class _Tp, class _Fn> constexpr decltype(auto) __aggregate_apply(_Tp &__t, _Fn &&__f) {
+  return __aggregate_binder<__aggregate_field_count_v<remove_cv_t<_Tp>>>::__apply(__t, _VSTD::forward<_Fn>(__f));
+}
+
+template <size_t _Ip, class _Tp> struct __indexed_ref { _Tp &__ref_; };
+
+template <class _Seq, class... _Tp> struct __indexed_refs;
+template <size_t... _Ip, class... _Tp>
+struct __indexed_refs<__index_sequence<_Ip...>, _Tp...> : __indexed_ref<_Ip, _Tp>... {};
+
+template <size_t _Ip, class _Tp> constexpr _Tp &__get_indexed_ref(const __indexed_ref<_Ip, _Tp> &__r) noexcept {
+  return __r.__ref_;
+}
+
+template <size_t _Ip, class _Tp> constexpr auto &__aggregate_get(_Tp &__t) {
+  static_assert(_Ip < __aggregate_field_count_v<remove_cv_t<_Tp>>, "__aggregate_get index out of range");
+  return _VSTD::__aggregate_apply(__t, [](auto &...__m) -> auto & {
+    return _VSTD::__get_indexed_ref<_Ip>(
+        __indexed_refs<__make_index_sequence<sizeof...(__m)>, remove_reference_t<decltype(__m)>...>{{__m}...});
+  });
+}
+
+template <class _Tp>
+using __aggregate_member_types_t =
+    decltype(__aggregate_binder<__aggregate_field_count_v<_Tp>>::__types(_VSTD::declval<_Tp &>()));
+
+// __aggregate_layout
+
+// A reference member occupies a pointer, whatever it refers to.
+template <class _Tp> struct __layout_member_size : integral_constant<size_t, sizeof(_Tp)> {};
+template <class _Tp> struct __layout_member_size<_Tp &> : integral_constant<size_t, sizeof(void *)> {};
+template <class _Tp> struct __layout_member_size<_Tp &&> : integral_constant<size_t, sizeof(void *)> {};
+
+template <class _Tp> struct __layout_member_align : integral_constant<size_t, alignment_of<_Tp>::value> {};
+template <class _Tp> struct __layout_member_align<_Tp &> : integral_constant<size_t, alignof(void *)> {};
+template <class _Tp> struct __layout_member_align<_Tp &&> : integral_constant<size_t, alignof(void *)> {};
+
+template <size_t _Np> struct __layout_order {
+  size_t __index_[_Np == 0 ? 1 : _Np];
+
+  constexpr size_t operator[](size_t __i) const noexcept { return __index_[__i]; }
+  static constexpr size_t size() noexcept { return _Np; }
+};
+
+constexpr size_t __layout_align_up(size_t __n, size_t __a) noexcept { return (__n + __a - 1) / __a * __a; }
+
+// Stable sort of member indices by descending alignment. Placing members from
+// the strictest alignment down never needs padding between them, because
+// every size is a multiple of its own alignment.
+template <size_t _Np>
+constexpr __layout_order<_Np> __layout_sort_by_alignment(const size_t (&__align)[_Np == 0 ? 1 : _Np]) noexcept {
+  __layout_order<_Np> __r{};
+  for (size_t __i = 0; __i != _Np; ++__i)
+    __r.__index_[__i] = __i;
+  for (size_t __i = 1; __i < _Np; ++__i)
+    for (size_t __j = __i; __j > 0 && __align[__r.__index_[__j - 1]] < __align[__r.__index_[__j]]; --__j) {
+      size_t __t             = __r.__index_[__j];
+      __r.__index_[__j]      = __r.__index_[__j - 1];
+      __r.__index_[__j - 1]  = __t;
+    }
+  return __r;
+}
+
+template <size_t _Np>
+constexpr size_t __layout_size_in_order(const size_t (&__size)[_Np == 0 ? 1 : _Np],
+                                        const size_t (&__align)[_Np == 0 ? 1 : _Np], const __layout_order<_Np> &__order,
+                                        size_t __struct_align) noexcept {
+  size_t __off = 0;
+  for (size_t __i = 0; __i != _Np; ++__i) {
+    const size_t __m = __order[__i];
+    __off            = _VSTD::__layout_align_up(__off, __align[__m]) + __size[__m];
+  }
+  return _VSTD::__layout_align_up(__off == 0 ? 1 : __off, __struct_align);
+}
+
+struct __layout_summary {
+  size_t __size;
+  size_t __alignment;
+  size_t __field_count;
+  size_t __padding;
+  size_t __reordered_size;
+};
+
+template <class _Tp, class _Members = __aggregate_member_types_t<_Tp>> struct __aggregate_layout;
+
+// Padding is counted at this level only: padding inside a member of class
+// type is part of that member's size. Bit-field members are not supported.
+template <class _Tp, class... _Mp> struct __aggregate_layout<_Tp, __type_list<_Mp...>> {
+  static_assert(is_aggregate_v<_Tp>, "__aggregate_layout requires an aggregate type");
+
+private:
+  static constexpr size_t __sizes_[sizeof...(_Mp) == 0 ? 1 : sizeof...(_Mp)]  = {__layout_member_size<_Mp>::value...};
+  static constexpr size_t __aligns_[sizeof...(_Mp) == 0 ? 1 : sizeof...(_Mp)] = {__layout_member_align<_Mp>::value...};
+
+public:
+  static constexpr size_t __field_count  = sizeof...(_Mp);
+  static constexpr size_t __size         = sizeof(_Tp);
+  static constexpr size_t __alignment    = alignof(_Tp);
+  static constexpr size_t __member_bytes = (size_t(0) + ... + __layout_member_size<_Mp>::value);
+  static constexpr size_t __padding      = __size > __member_bytes ? __size - __member_bytes : 0;
+
+  static constexpr __layout_order<sizeof...(_Mp)> __suggested_order =
+      _VSTD::__layout_sort_by_alignment<sizeof...(_Mp)>(__aligns_);
+  static constexpr size_t __reordered_size =
+      _VSTD::__layout_size_in_order<sizeof...(_Mp)>(__sizes_, __aligns_, __suggested_order, __alignment);
+  static constexpr size_t __reordered_padding = __reordered_size - __member_bytes;
+  static constexpr bool __is_optimal          = __size <= __reordered_size;
+
+  static constexpr __layout_summary __summary() noexcept {
+    return {__size, __alignment, __field_count, __padding, __reordered_size};
+  }
+};
+
+// __layout_report
+
+template <class... _Tp> struct __layout_report {
+  static_assert(sizeof...(_Tp) != 0, "__layout_report requires at least one type");
+
+  static constexpr __layout_summary __entries[sizeof...(_Tp)] = {__aggregate_layout<_Tp>::__summary()...};
+  static constexpr size_t __total_padding                     = (size_t(0) + ... + __aggregate_layout<_Tp>::__padding);
+  static constexpr size_t __total_savings =
+      (size_t(0) + ... + (__aggregate_layout<_Tp>::__size - __aggregate_layout<_Tp>::__reordered_size));
+};
+
+_LIBCPP_END_NAMESPACE_STD
+
+#endif // _LIBCPP_STD_VER > 14
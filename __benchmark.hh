@@ -0,0 +1,297 @@
+// -*- C++ -*-
+//===--------------------------- __benchmark ------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+/*
+    __benchmark synopsis (extension, C++17)
+
+namespace std
+{
+
+// Compiler barriers: the value is taken to be read (and, for an lvalue,
+// written), and all of memory to be read and written.
+template <class T> void __do_not_optimize(const T& value) noexcept;
+template <class T> void __do_not_optimize(T& value) noexcept;
+void __clobber_memory() noexcept;
+
+struct __benchmark_options
+{
+    unsigned long long __min_sample_ns = 1000000;   // each sample runs at least this long
+    size_t __samples = 31;                          // at most __benchmark_max_samples
+};
+
+inline constexpr size_t __benchmark_max_samples = 256;
+
+// Per iteration, in nanoseconds, or in cycles if __cycle_frequency() is 0.
+struct __benchmark_stats
+{
+    const char* __name;
+    unsigned long long __iterations;   // per sample
+    size_t __samples;
+    bool __cycles;                     // the figures are in cycles, not nanoseconds
+    double __min, __median, __mad, __p90, __p99, __max, __mean;
+};
+
+// Finds the iteration count that fills a sample, then times the samples.
+template <class F>
+    __benchmark_stats __run_benchmark(const char* name, F&& f, const __benchmark_options& = {});
+
+// Reporters: each writes into [first, last) and returns the end, or nullptr
+// if it did not fit. Names are escaped as each format requires.
+char* __benchmark_csv_header(char* first, char* last) noexcept;
+char* __benchmark_csv_row(char* first, char* last, const __benchmark_stats& s) noexcept;
+char* __benchmark_json(char* first, char* last, const __benchmark_stats* s, size_t n) noexcept;
+
+}  // std
+
+    Times come from __cycle_count(), converted at __cycle_frequency(), which
+    measures the counter briefly where the CPU does not report it; call
+    __calibrate_cycle_counter first for a longer measurement.
+    Nothing allocates, so the harness runs in freestanding builds.
+
+*/
+
+#include "__config.hh"
+#include "__trace.hh"
+#include "charconv.hh"
+#include "cstddef.hh"
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#pragma GCC system_header
+#endif
+
+#if _LIBCPP_STD_VER > 14
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+// Barriers
+
+template <class _Tp> inline _LIBCPP_INLINE_VISIBILITY void __do_not_optimize(const _Tp &__v) noexcept {
+  __asm__ __volatile__("" : : "r,m"(__v) : "memory");
+}
+
+template <class _Tp> inline _LIBCPP_INLINE_VISIBILITY void __do_not_optimize(_Tp &__v) noexcept {
+#if defined(_LIBCPP_COMPILER_CLANG)
+  __asm__ __volatile__("" : "+r,m"(__v) : : "memory");
+#else
+  __asm__ __volatile__("" : "+m,r"(__v) : : "memory");
+#endif
+}
+
+inline _LIBCPP_INLINE_VISIBILITY void __clobber_memory() noexcept { __asm__ __volatile__("" : : : "memory"); }
+
+// Running
+
+struct _LIBCPP_TYPE_VIS __benchmark_options {
+  unsigned long long __min_sample_ns = 1000000;
+  size_t __samples                   = 31;
+};
+
+_LIBCPP_INLINE_VAR constexpr size_t __benchmark_max_samples = 256;
+
+struct _LIBCPP_TYPE_VIS __benchmark_stats {
+  const char *__name;
+  unsigned long long __iterations;
+  size_t __samples;
+  bool __cycles;
+  double __min, __median, __mad, __p90, __p99, __max, __mean;
+};
+
+template <class _Fn>
+inline _LIBCPP_INLINE_VISIBILITY unsigned long long __benchmark_batch(_Fn &__f, unsigned long long __n) {
+  const unsigned long long __begin = _VSTD::__cycle_count();
+  for (unsigned long long __i = __n; __i != 0; --__i)
+    __f();
+  return _VSTD::__cycle_count() - __begin;
+}
+
+// The __q quantile of sorted __x, interpolating between ranks.
+inline _LIBCPP_INLINE_VISIBILITY double __benchmark_quantile(const double *__x, size_t __n, double __q) noexcept {
+  const double __r = __q * static_cast<double>(__n - 1);
+  const size_t __i = static_cast<size_t>(__r);
+  const double __f = __r - static_cast<double>(__i);
+  return __i + 1 < __n ? __x[__i] + (__x[__i + 1] - __x[__i]) * __f : __x[__n - 1];
+}
+
+inline _LIBCPP_INLINE_VISIBILITY void __benchmark_sort(double *__x, size_t __n) noexcept {
+  for (size_t __i = 1; __i < __n; ++__i) {
+    const double __v = __x[__i];
+    size_t __j       = __i;
+    for (; __j != 0 && __v < __x[__j - 1]; --__j)
+      __x[__j] = __x[__j - 1];
+    __x[__j] = __v;
+  }
+}
+
+template <class _Fn>
+inline _LIBCPP_INLINE_VISIBILITY __benchmark_stats __run_benchmark(const char *__name, _Fn &&__f,
+                                                                   const __benchmark_options &__opt = {}) {
+  const unsigned long long __hz     = _VSTD::__cycle_frequency();
+  const unsigned long long __target = __hz != 0 ? __opt.__min_sample_ns / 1000 * (__hz / 1000000)
+                                                      + __opt.__min_sample_ns % 1000 * __hz / 1000000000
+                                                : __opt.__min_sample_ns;
+  const size_t __samples            = __opt.__samples == 0                         ? 1
+                                      : __opt.__samples > __benchmark_max_samples ? __benchmark_max_samples
+                                                                                   : __opt.__samples;
+
+  // Grow the batch from one iteration, by the shortfall but at most tenfold,
+  // until one batch takes a sample's worth of time.
+  unsigned long long __n = 1;
+  for (;;) {
+    const unsigned long long __t = _VSTD::__benchmark_batch(__f, __n);
+    if (__t >= __target)
+      break;
+    unsigned long long __next = __t == 0 ? __n * 10 : __n * 11 / 10 * __target / __t + 1;
+    if (__next > __n * 10)
+      __next = __n * 10;
+    __n = __next;
+  }
+
+  const double __unit = __hz != 0 ? 1e9 / static_cast<double>(__hz) : 1.0;
+  double __x[__benchmark_max_samples];
+  double __sum = 0;
+  for (size_t __i = 0; __i != __samples; ++__i) {
+    __x[__i] = static_cast<double>(_VSTD::__benchmark_batch(__f, __n)) * __unit / static_cast<double>(__n);
+    __sum += __x[__i];
+  }
+  _VSTD::__benchmark_sort(__x, __samples);
+
+  __benchmark_stats __s;
+  __s.__name       = __name;
+  __s.__iterations = __n;
+  __s.__samples    = __samples;
+  __s.__cycles     = __hz == 0;
+  __s.__min        = __x[0];
+  __s.__median     = _VSTD::__benchmark_quantile(__x, __samples, 0.5);
+  __s.__p90        = _VSTD::__benchmark_quantile(__x, __samples, 0.9);
+  __s.__p99        = _VSTD::__benchmark_quantile(__x, __samples, 0.99);
+  __s.__max        = __x[__samples - 1];
+  __s.__mean       = __sum / static_cast<double>(__samples);
+  for (size_t __i = 0; __i != __samples; ++__i)
+    __x[__i] = __x[__i] < __s.__median ? __s.__median - __x[__i] : __x[__i] - __s.__median;
+  _VSTD::__benchmark_sort(__x, __samples);
+  __s.__mad = _VSTD::__benchmark_quantile(__x, __samples, 0.5);
+  return __s;
+}
+
+// Reporting
+
+inline _LIBCPP_INLINE_VISIBILITY char *__benchmark_put(char *__p, char *__last, const char *__s) noexcept {
+  for (; __p != nullptr && *__s != 0; ++__s, ++__p) {
+    if (__p == __last)
+      return nullptr;
+    *__p = *__s;
+  }
+  return __p;
+}
+
+// Two decimals, rounded.
+inline _LIBCPP_INLINE_VISIBILITY char *__benchmark_put(char *__p, char *__last, double __v) noexcept {
+  if (__p == nullptr)
+    return nullptr;
+  const unsigned long long __c = static_cast<unsigned long long>(__v * 100 + 0.5);
+  const to_chars_result __r    = _VSTD::to_chars(__p, __last, __c / 100);
+  if (__r.ec != errc() || __last - __r.ptr < 3)
+    return nullptr;
+  __r.ptr[0] = '.';
+  __r.ptr[1] = static_cast<char>('0' + __c / 10 % 10);
+  __r.ptr[2] = static_cast<char>('0' + __c % 10);
+  return __r.ptr + 3;
+}
+
+inline _LIBCPP_INLINE_VISIBILITY char *__benchmark_put(char *__p, char *__last, unsigned long long __v) noexcept {
+  if (__p == nullptr)
+    return nullptr;
+  const to_chars_result __r = _VSTD::to_chars(__p, __last, __v);
+  return __r.ec == errc() ? __r.ptr : nullptr;
+}
+
+inline _LIBCPP_INLINE_VISIBILITY char *__benchmark_put_char(char *__p, char *__last, char __c) noexcept {
+  if (__p == nullptr || __p == __last)
+    return nullptr;
+  *__p = __c;
+  return __p + 1;
+}
+
+// A name inside a CSV field: quotes are doubled.
+inline _LIBCPP_INLINE_VISIBILITY char *__benchmark_put_csv(char *__p, char *__last, const char *__s) noexcept {
+  for (; *__s != 0; ++__s) {
+    if (*__s == '"')
+      __p = _VSTD::__benchmark_put_char(__p, __last, '"');
+    __p = _VSTD::__benchmark_put_char(__p, __last, *__s);
+  }
+  return __p;
+}
+
+// A name inside a JSON string: quotes and backslashes are escaped, and
+// control characters written as \u00XX.
+inline _LIBCPP_INLINE_VISIBILITY char *__benchmark_put_json(char *__p, char *__last, const char *__s) noexcept {
+  for (; *__s != 0; ++__s) {
+    const unsigned char __c = static_cast<unsigned char>(*__s);
+    if (__c < 0x20) {
+      __p = _VSTD::__benchmark_put(__p, __last, "\\u00");
+      __p = _VSTD::__benchmark_put_char(__p, __last, "0123456789abcdef"[__c >> 4]);
+      __p = _VSTD::__benchmark_put_char(__p, __last, "0123456789abcdef"[__c & 15]);
+      continue;
+    }
+    if (__c == '"' || __c == '\\')
+      __p = _VSTD::__benchmark_put_char(__p, __last, '\\');
+    __p = _VSTD::__benchmark_put_char(__p, __last, *__s);
+  }
+  return __p;
+}
+
+inline _LIBCPP_INLINE_VISIBILITY char *__benchmark_csv_header(char *__first, char *__last) noexcept {
+  return _VSTD::__benchmark_put(__first, __last, "name,unit,iterations,samples,min,median,mad,p90,p99,max,mean\n");
+}
+
+inline _LIBCPP_INLINE_VISIBILITY char *__benchmark_csv_row(char *__first, char *__last,
+                                                           const __benchmark_stats &__s) noexcept {
+  char *__p = _VSTD::__benchmark_put(__first, __last, "\"");
+  __p       = _VSTD::__benchmark_put_csv(__p, __last, __s.__name);
+  __p       = _VSTD::__benchmark_put(__p, __last, __s.__cycles ? "\",cycles," : "\",ns,");
+  __p       = _VSTD::__benchmark_put(__p, __last, __s.__iterations);
+  __p       = _VSTD::__benchmark_put(__p, __last, ",");
+  __p       = _VSTD::__benchmark_put(__p, __last, static_cast<unsigned long long>(__s.__samples));
+  const double __v[] = {__s.__min, __s.__median, __s.__mad, __s.__p90, __s.__p99, __s.__max, __s.__mean};
+  for (size_t __k = 0; __k != 7; ++__k) {
+    __p = _VSTD::__benchmark_put(__p, __last, ",");
+    __p = _VSTD::__benchmark_put(__p, __last, __v[__k]);
+  }
+  return _VSTD::__benchmark_put(__p, __last, "\n");
+}
+
+inline _LIBCPP_INLINE_VISIBILITY char *__benchmark_json(char *__first, char *__last, const __benchmark_stats *__s,
+                                                        size_t __n) noexcept {
+  static constexpr const char *__keys[] = {",\"min\":", ",\"median\":", ",\"mad\":", ",\"p90\":",
+                                           ",\"p99\":", ",\"max\":",    ",\"mean\":"};
+  char *__p = _VSTD::__benchmark_put(__first, __last, "{\"benchmarks\":[");
+  for (size_t __i = 0; __i != __n; ++__i) {
+    const __benchmark_stats &__b = __s[__i];
+    __p = _VSTD::__benchmark_put(__p, __last, __i == 0 ? "{\"name\":\"" : ",{\"name\":\"");
+    __p = _VSTD::__benchmark_put_json(__p, __last, __b.__name);
+    __p = _VSTD::__benchmark_put(__p, __last, __b.__cycles ? "\",\"unit\":\"cycles\"" : "\",\"unit\":\"ns\"");
+    __p = _VSTD::__benchmark_put(__p, __last, ",\"iterations\":");
+    __p = _VSTD::__benchmark_put(__p, __last, __b.__iterations);
+    __p = _VSTD::__benchmark_put(__p, __last, ",\"samples\":");
+    __p = _VSTD::__benchmark_put(__p, __last, static_cast<unsigned long long>(__b.__samples));
+    const double __v[] = {__b.__min, __b.__median, __b.__mad, __b.__p90, __b.__p99, __b.__max, __b.__mean};
+    for (size_t __k = 0; __k != 7; ++__k) {
+      __p = _VSTD::__benchmark_put(__p, __last, __keys[__k]);
+      __p = _VSTD::__benchmark_put(__p, __last, __v[__k]);
+    }
+    __p = _VSTD::__benchmark_put(__p, __last, "}");
+  }
+  return _VSTD::__benchmark_put(__p, __last, "]}\n");
+}
+
+_LIBCPP_END_NAMESPACE_STD
+
+#endif // _LIBCPP_STD_VER > 14
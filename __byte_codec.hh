@@ -0,0 +1,453 @@
+// -*- C++ -*-
+//===-------------------------- __byte_codec ------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+/*
+    __byte_codec synopsis (extension, C++17)
+
+namespace std
+{
+
+// Base64 (RFC 4648, standard alphabet) and hexadecimal text from and to
+// bytes. CharT is any one-byte character-like type (_IsCharLikeType). The
+// caller provides the output buffers; nothing allocates.
+
+constexpr size_t __base64_encoded_size(size_t n) noexcept;       // with padding
+constexpr size_t __base64_max_decoded_size(size_t n) noexcept;
+constexpr size_t __hex_encoded_size(size_t n) noexcept;
+constexpr size_t __hex_max_decoded_size(size_t n) noexcept;
+
+// Return the number of characters written.
+template <class CharT> size_t __base64_encode(const byte* src, size_t n, CharT* dst) noexcept;
+template <class CharT> size_t __hex_encode(const byte* src, size_t n, CharT* dst, bool uppercase = false) noexcept;
+
+// Decoding stops at the first character that makes the input invalid: __in
+// is the number of characters consumed (n on success, otherwise the offset
+// of that character) and __out the number of bytes written. Base64 input may
+// omit the padding; non-canonical encodings (nonzero unused bits) are
+// rejected. Hex digits may be of either case.
+struct __codec_result { size_t __in; size_t __out; };
+
+template <class CharT> __codec_result __base64_decode(const CharT* src, size_t n, byte* dst) noexcept;
+template <class CharT> __codec_result __hex_decode(const CharT* src, size_t n, byte* dst) noexcept;
+
+}  // std
+
+*/
+
+#include "__config.hh"
+#include "cstddef.hh"
+#include "type_traits.hh"
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#pragma GCC system_header
+#endif
+
+#if _LIBCPP_STD_VER > 14
+
+#if defined(__AVX2__) || defined(__SSSE3__)
+#define _LIBCPP_HAS_BYTE_CODEC_SIMD
+#include <immintrin.h>
+#endif
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+template <class _CharT>
+using __enable_if_byte_char _LIBCPP_NODEBUG_TYPE =
+    _EnableIf<_IsCharLikeType<_CharT>::value && sizeof(_CharT) == 1, int>;
+
+struct __codec_result {
+  size_t __in;
+  size_t __out;
+};
+
+inline _LIBCPP_INLINE_VISIBILITY constexpr size_t __base64_encoded_size(size_t __n) noexcept {
+  return (__n + 2) / 3 * 4;
+}
+
+inline _LIBCPP_INLINE_VISIBILITY constexpr size_t __base64_max_decoded_size(size_t __n) noexcept {
+  return __n / 4 * 3 + (__n % 4 > 1 ? __n % 4 - 1 : 0);
+}
+
+inline _LIBCPP_INLINE_VISIBILITY constexpr size_t __hex_encoded_size(size_t __n) noexcept { return 2 * __n; }
+
+inline _LIBCPP_INLINE_VISIBILITY constexpr size_t __hex_max_decoded_size(size_t __n) noexcept { return __n / 2; }
+
+// Tables for the scalar code
+
+inline constexpr char __base64_alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+inline constexpr char __hex_digits[]      = "0123456789abcdef0123456789ABCDEF";
+
+// Character to value, 0xff for characters outside the alphabet.
+struct __byte_codec_decode_table {
+  unsigned char __v_[256];
+};
+
+inline constexpr __byte_codec_decode_table __base64_make_decode_table() noexcept {
+  __byte_codec_decode_table __t{};
+  for (int __i = 0; __i != 256; ++__i)
+    __t.__v_[__i] = 0xff;
+  for (int __i = 0; __i != 64; ++__i)
+    __t.__v_[static_cast<unsigned char>(__base64_alphabet[__i])] = static_cast<unsigned char>(__i);
+  return __t;
+}
+
+inline constexpr __byte_codec_decode_table __hex_make_decode_table() noexcept {
+  __byte_codec_decode_table __t{};
+  for (int __i = 0; __i != 256; ++__i)
+    __t.__v_[__i] = 0xff;
+  for (int __i = 0; __i != 16; ++__i) {
+    __t.__v_[static_cast<unsigned char>(__hex_digits[__i])]      = static_cast<unsigned char>(__i);
+    __t.__v_[static_cast<unsigned char>(__hex_digits[16 + __i])] = static_cast<unsigned char>(__i);
+  }
+  return __t;
+}
+
+inline constexpr __byte_codec_decode_table __base64_decode_table = _VSTD::__base64_make_decode_table();
+inline constexpr __byte_codec_decode_table __hex_decode_table    = _VSTD::__hex_make_decode_table();
+
+#ifdef _LIBCPP_HAS_BYTE_CODEC_SIMD
+
+// The kernels work on 16-byte lanes, one for SSSE3 and two for AVX2, and
+// only use lane-wise instructions except in __load12 and __store12.
+#if defined(__AVX2__)
+struct __byte_codec_simd {
+  typedef __m256i __v;
+  static const size_t __width = 32;
+
+  static _LIBCPP_INLINE_VISIBILITY __v __load(const unsigned char *__p) noexcept {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(__p));
+  }
+  static _LIBCPP_INLINE_VISIBILITY void __store(unsigned char *__p, __v __a) noexcept {
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(__p), __a);
+  }
+  // 12 bytes into each lane, reading 28.
+  static _LIBCPP_INLINE_VISIBILITY __v __load12(const unsigned char *__p) noexcept {
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(__p))),
+                                   _mm_loadu_si128(reinterpret_cast<const __m128i *>(__p + 12)), 1);
+  }
+  // The low 12 bytes of each lane, writing exactly 24.
+  static _LIBCPP_INLINE_VISIBILITY void __store12(unsigned char *__p, __v __a) noexcept {
+    __a = _mm256_permutevar8x32_epi32(__a, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(__p), _mm256_castsi256_si128(__a));
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(__p + 16), _mm256_extracti128_si256(__a, 1));
+  }
+  // __width / 2 bytes zero-extended to 16 bits.
+  static _LIBCPP_INLINE_VISIBILITY __v __load_widen(const unsigned char *__p) noexcept {
+    return _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(__p)));
+  }
+  // The low bytes of the 16-bit elements of __a and __b, writing __width.
+  static _LIBCPP_INLINE_VISIBILITY void __store_narrow(unsigned char *__p, __v __a, __v __b) noexcept {
+    __store(__p, _mm256_permute4x64_epi64(_mm256_packus_epi16(__a, __b), 0xd8));
+  }
+  static _LIBCPP_INLINE_VISIBILITY __v __lanes(__m128i __a) noexcept { return _mm256_broadcastsi128_si256(__a); }
+  static _LIBCPP_INLINE_VISIBILITY __v __set1_8(char __c) noexcept { return _mm256_set1_epi8(__c); }
+  static _LIBCPP_INLINE_VISIBILITY __v __set1_16(short __c) noexcept { return _mm256_set1_epi16(__c); }
+  static _LIBCPP_INLINE_VISIBILITY __v __set1_32(int __c) noexcept { return _mm256_set1_epi32(__c); }
+  static _LIBCPP_INLINE_VISIBILITY __v __and(__v __a, __v __b) noexcept { return _mm256_and_si256(__a, __b); }
+  static _LIBCPP_INLINE_VISIBILITY __v __or(__v __a, __v __b) noexcept { return _mm256_or_si256(__a, __b); }
+  static _LIBCPP_INLINE_VISIBILITY __v __add8(__v __a, __v __b) noexcept { return _mm256_add_epi8(__a, __b); }
+  static _LIBCPP_INLINE_VISIBILITY __v __sub8(__v __a, __v __b) noexcept { return _mm256_sub_epi8(__a, __b); }
+  static _LIBCPP_INLINE_VISIBILITY __v __subs_u8(__v __a, __v __b) noexcept { return _mm256_subs_epu8(__a, __b); }
+  static _LIBCPP_INLINE_VISIBILITY __v __min_u8(__v __a, __v __b) noexcept { return _mm256_min_epu8(__a, __b); }
+  static _LIBCPP_INLINE_VISIBILITY __v __cmpeq8(__v __a, __v __b) noexcept { return _mm256_cmpeq_epi8(__a, __b); }
+  static _LIBCPP_INLINE_VISIBILITY __v __cmpgt8(__v __a, __v __b) noexcept { return _mm256_cmpgt_epi8(__a, __b); }
+  static _LIBCPP_INLINE_VISIBILITY __v __blend8(__v __a, __v __b, __v __m) noexcept {
+    return _mm256_blendv_epi8(__a, __b, __m);
+  }
+  static _LIBCPP_INLINE_VISIBILITY __v __shuffle(__v __t, __v __i) noexcept { return _mm256_shuffle_epi8(__t, __i); }
+  static _LIBCPP_INLINE_VISIBILITY __v __srli16(__v __a, int __s) noexcept { return _mm256_srli_epi16(__a, __s); }
+  static _LIBCPP_INLINE_VISIBILITY __v __slli16(__v __a, int __s) noexcept { return _mm256_slli_epi16(__a, __s); }
+  static _LIBCPP_INLINE_VISIBILITY __v __srli32(__v __a, int __s) noexcept { return _mm256_srli_epi32(__a, __s); }
+  static _LIBCPP_INLINE_VISIBILITY __v __mulhi_u16(__v __a, __v __b) noexcept { return _mm256_mulhi_epu16(__a, __b); }
+  static _LIBCPP_INLINE_VISIBILITY __v __mullo16(__v __a, __v __b) noexcept { return _mm256_mullo_epi16(__a, __b); }
+  static _LIBCPP_INLINE_VISIBILITY __v __maddubs(__v __a, __v __b) noexcept { return _mm256_maddubs_epi16(__a, __b); }
+  static _LIBCPP_INLINE_VISIBILITY __v __madd16(__v __a, __v __b) noexcept { return _mm256_madd_epi16(__a, __b); }
+  // Whether every byte of __a has its top bit set.
+  static _LIBCPP_INLINE_VISIBILITY bool __all(__v __a) noexcept { return _mm256_movemask_epi8(__a) == -1; }
+  static _LIBCPP_INLINE_VISIBILITY bool __none(__v __a) noexcept { return _mm256_testz_si256(__a, __a); }
+};
+#else
+struct __byte_codec_simd {
+  typedef __m128i __v;
+  static const size_t __width = 16;
+
+  static _LIBCPP_INLINE_VISIBILITY __v __load(const unsigned char *__p) noexcept {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(__p));
+  }
+  static _LIBCPP_INLINE_VISIBILITY void __store(unsigned char *__p, __v __a) noexcept {
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(__p), __a);
+  }
+  static _LIBCPP_INLINE_VISIBILITY __v __load12(const unsigned char *__p) noexcept { return __load(__p); }
+  static _LIBCPP_INLINE_VISIBILITY void __store12(unsigned char *__p, __v __a) noexcept {
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(__p), __a);
+    const int __hi = _mm_cvtsi128_si32(_mm_srli_si128(__a, 8));
+    __builtin_memcpy(__p + 8, &__hi, 4);
+  }
+  static _LIBCPP_INLINE_VISIBILITY __v __load_widen(const unsigned char *__p) noexcept {
+    return _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(__p)), _mm_setzero_si128());
+  }
+  static _LIBCPP_INLINE_VISIBILITY void __store_narrow(unsigned char *__p, __v __a, __v __b) noexcept {
+    __store(__p, _mm_packus_epi16(__a, __b));
+  }
+  static _LIBCPP_INLINE_VISIBILITY __v __lanes(__m128i __a) noexcept { return __a; }
+  static _LIBCPP_INLINE_VISIBILITY __v __set1_8(char __c) noexcept { return _mm_set1_epi8(__c); }
+  static _LIBCPP_INLINE_VISIBILITY __v __set1_16(short __c) noexcept { return _mm_set1_epi16(__c); }
+  static _LIBCPP_INLINE_VISIBILITY __v __set1_32(int __c) noexcept { return _mm_set1_epi32(__c); }
+  static _LIBCPP_INLINE_VISIBILITY __v __and(__v __a, __v __b) noexcept { return _mm_and_si128(__a, __b); }
+  static _LIBCPP_INLINE_VISIBILITY __v __or(__v __a, __v __b) noexcept { return _mm_or_si128(__a, __b); }
+  static _LIBCPP_INLINE_VISIBILITY __v __add8(__v __a, __v __b) noexcept { return _mm_add_epi8(__a, __b); }
+  static _LIBCPP_INLINE_VISIBILITY __v __sub8(__v __a, __v __b) noexcept { return _mm_sub_epi8(__a, __b); }
+  static _LIBCPP_INLINE_VISIBILITY __v __subs_u8(__v __a, __v __b) noexcept { return _mm_subs_epu8(__a, __b); }
+  static _LIBCPP_INLINE_VISIBILITY __v __min_u8(__v __a, __v __b) noexcept { return _mm_min_epu8(__a, __b); }
+  static _LIBCPP_INLINE_VISIBILITY __v __cmpeq8(__v __a, __v __b) noexcept { return _mm_cmpeq_epi8(__a, __b); }
+  static _LIBCPP_INLINE_VISIBILITY __v __cmpgt8(__v __a, __v __b) noexcept { return _mm_cmpgt_epi8(__a, __b); }
+  // SSSE3 has no PBLENDVB.
+  static _LIBCPP_INLINE_VISIBILITY __v __blend8(__v __a, __v __b, __v __m) noexcept {
+    return _mm_or_si128(_mm_andnot_si128(__m, __a), _mm_and_si128(__m, __b));
+  }
+  static _LIBCPP_INLINE_VISIBILITY __v __shuffle(__v __t, __v __i) noexcept { return _mm_shuffle_epi8(__t, __i); }
+  static _LIBCPP_INLINE_VISIBILITY __v __srli16(__v __a, int __s) noexcept { return _mm_srli_epi16(__a, __s); }
+  static _LIBCPP_INLINE_VISIBILITY __v __slli16(__v __a, int __s) noexcept { return _mm_slli_epi16(__a, __s); }
+  static _LIBCPP_INLINE_VISIBILITY __v __srli32(__v __a, int __s) noexcept { return _mm_srli_epi32(__a, __s); }
+  static _LIBCPP_INLINE_VISIBILITY __v __mulhi_u16(__v __a, __v __b) noexcept { return _mm_mulhi_epu16(__a, __b); }
+  static _LIBCPP_INLINE_VISIBILITY __v __mullo16(__v __a, __v __b) noexcept { return _mm_mullo_epi16(__a, __b); }
+  static _LIBCPP_INLINE_VISIBILITY __v __maddubs(__v __a, __v __b) noexcept { return _mm_maddubs_epi16(__a, __b); }
+  static _LIBCPP_INLINE_VISIBILITY __v __madd16(__v __a, __v __b) noexcept { return _mm_madd_epi16(__a, __b); }
+  static _LIBCPP_INLINE_VISIBILITY bool __all(__v __a) noexcept { return _mm_movemask_epi8(__a) == 0xffff; }
+  static _LIBCPP_INLINE_VISIBILITY bool __none(__v __a) noexcept {
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(__a, _mm_setzero_si128())) == 0xffff;
+  }
+};
+#endif
+
+// Base64 after Muła and Lemire, "Faster Base64 Encoding and Decoding Using
+// AVX2 Instructions" (2018).
+
+// Encodes 3 * __width / 4 bytes into __width characters.
+inline _LIBCPP_INLINE_VISIBILITY void __base64_encode_block(const unsigned char *__src, unsigned char *__dst) noexcept {
+  typedef __byte_codec_simd _Vt;
+  typedef _Vt::__v __v;
+  // Spread each group of three bytes over a 32-bit lane as b1 b0 b2 b1, so
+  // that the four 6-bit indices can be moved into place with two
+  // multiplications.
+  __v __in = _Vt::__shuffle(_Vt::__load12(__src),
+                            _Vt::__lanes(_mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10)));
+  const __v __t0  = _Vt::__mulhi_u16(_Vt::__and(__in, _Vt::__set1_32(0x0fc0fc00)), _Vt::__set1_32(0x04000040));
+  const __v __t1  = _Vt::__mullo16(_Vt::__and(__in, _Vt::__set1_32(0x003f03f0)), _Vt::__set1_32(0x01000010));
+  const __v __idx = _Vt::__or(__t0, __t1);
+  // Map the index ranges 0-25, 26-51, 52-61, 62 and 63 to one of 14 table
+  // slots, and add the offset found there.
+  __v __slot = _Vt::__subs_u8(__idx, _Vt::__set1_8(51));
+  __slot     = _Vt::__or(__slot, _Vt::__and(_Vt::__cmpgt8(_Vt::__set1_8(26), __idx), _Vt::__set1_8(13)));
+  const __v __offsets = _Vt::__lanes(_mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                                   '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+                                                   '/' - 63, 'A', 0, 0));
+  _Vt::__store(__dst, _Vt::__add8(_Vt::__shuffle(__offsets, __slot), __idx));
+}
+
+// Decodes __width characters into 3 * __width / 4 bytes. Returns false,
+// without writing anything, if any character is outside the alphabet.
+inline _LIBCPP_INLINE_VISIBILITY bool __base64_decode_block(const unsigned char *__src, unsigned char *__dst) noexcept {
+  typedef __byte_codec_simd _Vt;
+  typedef _Vt::__v __v;
+  const __v __in    = _Vt::__load(__src);
+  const __v __nib   = _Vt::__set1_8(0x0f);
+  const __v __hi    = _Vt::__and(_Vt::__srli32(__in, 4), __nib);
+  const __v __lo    = _Vt::__and(__in, __nib);
+  // Each character class sets a bit in the table for its low nibble and in
+  // the one for its high nibble; the two share a bit exactly for invalid
+  // characters. Bytes from 0x80 up hit 0x10, which every low entry has.
+  const __v __lut_lo = _Vt::__lanes(
+      _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a));
+  const __v __lut_hi = _Vt::__lanes(
+      _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10));
+  if (!_Vt::__none(_Vt::__and(_Vt::__shuffle(__lut_lo, __lo), _Vt::__shuffle(__lut_hi, __hi))))
+    return false;
+  // Within the alphabet the high nibble determines the offset, except that
+  // '/' and '+' share one; '/' is moved to the slot below.
+  const __v __lut_roll =
+      _Vt::__lanes(_mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0));
+  const __v __slash = _Vt::__cmpeq8(__in, _Vt::__set1_8(0x2f));
+  const __v __val   = _Vt::__add8(__in, _Vt::__shuffle(__lut_roll, _Vt::__add8(__slash, __hi)));
+  // Pack four 6-bit values into 24 bits per 32-bit lane, then drop the
+  // fourth byte of each and restore the byte order.
+  const __v __ab_bc = _Vt::__maddubs(__val, _Vt::__set1_32(0x01400140));
+  const __v __abc   = _Vt::__madd16(__ab_bc, _Vt::__set1_32(0x00011000));
+  _Vt::__store12(__dst, _Vt::__shuffle(__abc, _Vt::__lanes(_mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1,
+                                                                          -1, -1, -1))));
+  return true;
+}
+
+// Encodes __width / 2 bytes into __width characters.
+inline _LIBCPP_INLINE_VISIBILITY void __hex_encode_block(const unsigned char *__src, unsigned char *__dst,
+                                                         const unsigned char *__digits) noexcept {
+  typedef __byte_codec_simd _Vt;
+  typedef _Vt::__v __v;
+  // Each 16-bit element becomes the high nibble then the low one.
+  const __v __w   = _Vt::__load_widen(__src);
+  const __v __nib = _Vt::__or(_Vt::__srli16(__w, 4), _Vt::__slli16(_Vt::__and(__w, _Vt::__set1_16(0x0f)), 8));
+  const __v __lut = _Vt::__lanes(_mm_loadu_si128(reinterpret_cast<const __m128i *>(__digits)));
+  _Vt::__store(__dst, _Vt::__shuffle(__lut, __nib));
+}
+
+// The values of the hex digits in __in, paired up into 16-bit elements;
+// clears __ok if any is not a hex digit.
+inline _LIBCPP_INLINE_VISIBILITY __byte_codec_simd::__v __hex_decode_values(__byte_codec_simd::__v __in,
+                                                                            bool &__ok) noexcept {
+  typedef __byte_codec_simd _Vt;
+  typedef _Vt::__v __v;
+  // Unsigned range checks: x <= k exactly when min(x, k) == x.
+  const __v __d       = _Vt::__sub8(__in, _Vt::__set1_8('0'));
+  const __v __is_d    = _Vt::__cmpeq8(_Vt::__min_u8(__d, _Vt::__set1_8(9)), __d);
+  const __v __l       = _Vt::__sub8(_Vt::__or(__in, _Vt::__set1_8(0x20)), _Vt::__set1_8('a'));
+  const __v __is_l    = _Vt::__cmpeq8(_Vt::__min_u8(__l, _Vt::__set1_8(5)), __l);
+  __ok = __ok && _Vt::__all(_Vt::__or(__is_d, __is_l));
+  // Pairs of digits to 16-bit elements holding hi * 16 + lo.
+  return _Vt::__maddubs(_Vt::__blend8(_Vt::__add8(__l, _Vt::__set1_8(10)), __d, __is_d), _Vt::__set1_16(0x0110));
+}
+
+// Decodes 2 * __width characters into __width bytes. Returns false, without
+// writing anything, if any is not a hex digit.
+inline _LIBCPP_INLINE_VISIBILITY bool __hex_decode_block(const unsigned char *__src, unsigned char *__dst) noexcept {
+  typedef __byte_codec_simd _Vt;
+  bool __ok         = true;
+  const _Vt::__v __a = _VSTD::__hex_decode_values(_Vt::__load(__src), __ok);
+  const _Vt::__v __b = _VSTD::__hex_decode_values(_Vt::__load(__src + _Vt::__width), __ok);
+  if (!__ok)
+    return false;
+  _Vt::__store_narrow(__dst, __a, __b);
+  return true;
+}
+
+#endif // _LIBCPP_HAS_BYTE_CODEC_SIMD
+
+// Base64
+
+template <class _CharT, __enable_if_byte_char<_CharT> = 0>
+inline _LIBCPP_INLINE_VISIBILITY size_t __base64_encode(const byte *__src, size_t __n, _CharT *__dst) noexcept {
+  const unsigned char *__s = reinterpret_cast<const unsigned char *>(__src);
+  unsigned char *__d       = reinterpret_cast<unsigned char *>(__dst);
+  size_t __i = 0, __o = 0;
+#ifdef _LIBCPP_HAS_BYTE_CODEC_SIMD
+  // __load12 reads 4 bytes past the 3 * __width / 4 it encodes.
+  for (const size_t __in = __byte_codec_simd::__width / 4 * 3; __n - __i >= __in + 4;
+       __i += __in, __o += __byte_codec_simd::__width)
+    _VSTD::__base64_encode_block(__s + __i, __d + __o);
+#endif
+  for (; __n - __i >= 3; __i += 3, __o += 4) {
+    const unsigned __w = (unsigned(__s[__i]) << 16) | (unsigned(__s[__i + 1]) << 8) | __s[__i + 2];
+    __d[__o]     = static_cast<unsigned char>(__base64_alphabet[__w >> 18]);
+    __d[__o + 1] = static_cast<unsigned char>(__base64_alphabet[(__w >> 12) & 0x3f]);
+    __d[__o + 2] = static_cast<unsigned char>(__base64_alphabet[(__w >> 6) & 0x3f]);
+    __d[__o + 3] = static_cast<unsigned char>(__base64_alphabet[__w & 0x3f]);
+  }
+  if (__i != __n) {
+    const unsigned __w = (unsigned(__s[__i]) << 16) | (__n - __i == 2 ? unsigned(__s[__i + 1]) << 8 : 0);
+    __d[__o]     = static_cast<unsigned char>(__base64_alphabet[__w >> 18]);
+    __d[__o + 1] = static_cast<unsigned char>(__base64_alphabet[(__w >> 12) & 0x3f]);
+    __d[__o + 2] = __n - __i == 2 ? static_cast<unsigned char>(__base64_alphabet[(__w >> 6) & 0x3f]) : '=';
+    __d[__o + 3] = '=';
+    __o += 4;
+  }
+  return __o;
+}
+
+template <class _CharT, __enable_if_byte_char<_CharT> = 0>
+inline _LIBCPP_INLINE_VISIBILITY __codec_result __base64_decode(const _CharT *__src, size_t __n,
+                                                                byte *__dst) noexcept {
+  const unsigned char *__s = reinterpret_cast<const unsigned char *>(__src);
+  unsigned char *__d       = reinterpret_cast<unsigned char *>(__dst);
+  const unsigned char *__t = __base64_decode_table.__v_;
+  size_t __i = 0, __o = 0;
+#ifdef _LIBCPP_HAS_BYTE_CODEC_SIMD
+  // A block that fails is decoded again below to find the bad character.
+  const size_t __block = __byte_codec_simd::__width;
+  for (; __n - __i >= __block; __i += __block, __o += __block / 4 * 3)
+    if (!_VSTD::__base64_decode_block(__s + __i, __d + __o))
+      break;
+#endif
+  // Whole groups of four, except the last, which may be padded or short.
+  for (; __n - __i > 4; __i += 4, __o += 3) {
+    const unsigned __a = __t[__s[__i]], __b = __t[__s[__i + 1]], __c = __t[__s[__i + 2]], __e = __t[__s[__i + 3]];
+    if (((__a | __b | __c | __e) & 0x80) != 0) {
+      const size_t __k = __a == 0xff ? 0 : __b == 0xff ? 1 : __c == 0xff ? 2 : 3;
+      return __codec_result{__i + __k, __o};
+    }
+    const unsigned __w = (__a << 18) | (__b << 12) | (__c << 6) | __e;
+    __d[__o]     = static_cast<unsigned char>(__w >> 16);
+    __d[__o + 1] = static_cast<unsigned char>(__w >> 8);
+    __d[__o + 2] = static_cast<unsigned char>(__w);
+  }
+  size_t __k = __n - __i;
+  if (__k == 0)
+    return __codec_result{__n, __o};
+  if (__k == 4 && __s[__i + 3] == '=')
+    __k = __s[__i + 2] == '=' ? 2 : 3;
+  unsigned __v[4] = {0, 0, 0, 0};
+  for (size_t __j = 0; __j != __k; ++__j)
+    if ((__v[__j] = __t[__s[__i + __j]]) == 0xff)
+      return __codec_result{__i + __j, __o};
+  // A single character holds only six bits, and the bits that do not make
+  // up a whole byte must be zero.
+  if (__k == 1 || (__k == 2 && (__v[1] & 0x0f) != 0) || (__k == 3 && (__v[2] & 0x03) != 0))
+    return __codec_result{__i + __k - 1, __o};
+  const unsigned __w = (__v[0] << 18) | (__v[1] << 12) | (__v[2] << 6) | __v[3];
+  for (size_t __j = 0; __j != __k - 1; ++__j)
+    __d[__o++] = static_cast<unsigned char>(__w >> (16 - 8 * __j));
+  return __codec_result{__n, __o};
+}
+
+// Hexadecimal
+
+template <class _CharT, __enable_if_byte_char<_CharT> = 0>
+inline _LIBCPP_INLINE_VISIBILITY size_t __hex_encode(const byte *__src, size_t __n, _CharT *__dst,
+                                                     bool __uppercase = false) noexcept {
+  const unsigned char *__s      = reinterpret_cast<const unsigned char *>(__src);
+  unsigned char *__d            = reinterpret_cast<unsigned char *>(__dst);
+  const unsigned char *__digits = reinterpret_cast<const unsigned char *>(__hex_digits) + (__uppercase ? 16 : 0);
+  size_t __i = 0;
+#ifdef _LIBCPP_HAS_BYTE_CODEC_SIMD
+  for (; __n - __i >= __byte_codec_simd::__width / 2; __i += __byte_codec_simd::__width / 2)
+    _VSTD::__hex_encode_block(__s + __i, __d + 2 * __i, __digits);
+#endif
+  for (; __i != __n; ++__i) {
+    __d[2 * __i]     = __digits[__s[__i] >> 4];
+    __d[2 * __i + 1] = __digits[__s[__i] & 0x0f];
+  }
+  return 2 * __n;
+}
+
+template <class _CharT, __enable_if_byte_char<_CharT> = 0>
+inline _LIBCPP_INLINE_VISIBILITY __codec_result __hex_decode(const _CharT *__src, size_t __n, byte *__dst) noexcept {
+  const unsigned char *__s = reinterpret_cast<const unsigned char *>(__src);
+  unsigned char *__d       = reinterpret_cast<unsigned char *>(__dst);
+  const unsigned char *__t = __hex_decode_table.__v_;
+  size_t __i = 0;
+#ifdef _LIBCPP_HAS_BYTE_CODEC_SIMD
+  for (; __n - __i >= 2 * __byte_codec_simd::__width; __i += 2 * __byte_codec_simd::__width)
+    if (!_VSTD::__hex_decode_block(__s + __i, __d + __i / 2))
+      break;
+#endif
+  for (; __n - __i >= 2; __i += 2) {
+    const unsigned __hi = __t[__s[__i]], __lo = __t[__s[__i + 1]];
+    if (__hi == 0xff || __lo == 0xff)
+      return __codec_result{__hi == 0xff ? __i : __i + 1, __i / 2};
+    __d[__i / 2] = static_cast<unsigned char>((__hi << 4) | __lo);
+  }
+  // An odd digit out.
+  if (__i != __n)
+    return __codec_result{__i, __i / 2};
+  return __codec_result{__n, __n / 2};
+}
+
+_LIBCPP_END_NAMESPACE_STD
+
+#endif // _LIBCPP_STD_VER > 14
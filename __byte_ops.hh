@@ -0,0 +1,186 @@
+// -*- C++ -*-
+//===--------------------------- __byte_ops -------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+/*
+    __byte_ops synopsis (extension, C++17)
+
+namespace std
+{
+
+// The std::byte operators applied element-wise to ranges of __n bytes. __dst
+// may be the same range as a source, but must not otherwise overlap one.
+// All are constexpr in C++20.
+
+void __byte_and(byte* dst, const byte* a, const byte* b, size_t n) noexcept;  // dst[i] = a[i] & b[i]
+void __byte_or (byte* dst, const byte* a, const byte* b, size_t n) noexcept;  // dst[i] = a[i] | b[i]
+void __byte_xor(byte* dst, const byte* a, const byte* b, size_t n) noexcept;  // dst[i] = a[i] ^ b[i]
+void __byte_not(byte* dst, const byte* src, size_t n) noexcept;               // dst[i] = ~src[i]
+void __byte_shift_left (byte* dst, const byte* src, size_t n, unsigned shift) noexcept;  // src[i] << shift
+void __byte_shift_right(byte* dst, const byte* src, size_t n, unsigned shift) noexcept;  // src[i] >> shift
+void __byte_fill(byte* dst, size_t n, byte value) noexcept;
+
+}  // std
+
+*/
+
+#include "__config.hh"
+#include "cstddef.hh"
+#include "type_traits.hh"
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#pragma GCC system_header
+#endif
+
+#if _LIBCPP_STD_VER > 14
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+// Element operations, written once for std::byte, unsigned char, integer
+// words and the generic vector types.
+
+struct __bit_and_op {
+  template <class _Vp> _LIBCPP_INLINE_VISIBILITY constexpr _Vp operator()(_Vp __a, _Vp __b) const noexcept {
+    return static_cast<_Vp>(__a & __b);
+  }
+};
+struct __bit_or_op {
+  template <class _Vp> _LIBCPP_INLINE_VISIBILITY constexpr _Vp operator()(_Vp __a, _Vp __b) const noexcept {
+    return static_cast<_Vp>(__a | __b);
+  }
+};
+struct __bit_xor_op {
+  template <class _Vp> _LIBCPP_INLINE_VISIBILITY constexpr _Vp operator()(_Vp __a, _Vp __b) const noexcept {
+    return static_cast<_Vp>(__a ^ __b);
+  }
+};
+struct __bit_and_not_op {
+  template <class _Vp> _LIBCPP_INLINE_VISIBILITY constexpr _Vp operator()(_Vp __a, _Vp __b) const noexcept {
+    return static_cast<_Vp>(__a & ~__b);
+  }
+};
+struct __bit_not_op {
+  template <class _Vp> _LIBCPP_INLINE_VISIBILITY constexpr _Vp operator()(_Vp __a, _Vp) const noexcept {
+    return static_cast<_Vp>(~__a);
+  }
+};
+// The shifts are only used on byte-sized elements, with __s_ < 8.
+struct __bit_shl_op {
+  unsigned __s_;
+  template <class _Vp> _LIBCPP_INLINE_VISIBILITY constexpr _Vp operator()(_Vp __a, _Vp) const noexcept {
+    return static_cast<_Vp>(__a << __s_);
+  }
+};
+struct __bit_shr_op {
+  unsigned __s_;
+  template <class _Vp> _LIBCPP_INLINE_VISIBILITY constexpr _Vp operator()(_Vp __a, _Vp) const noexcept {
+    return static_cast<_Vp>(__a >> __s_);
+  }
+};
+
+// __byte_transform
+
+// As wide as the target's vector registers; GCC and Clang lower the generic
+// vector operations to SSE2, AVX2 or AVX-512 instructions. x86 has no 8-bit
+// vector shift, so those become a 16-bit shift and a mask.
+#if defined(__AVX512BW__)
+typedef unsigned char __byte_vector __attribute__((__vector_size__(64)));
+#elif defined(__AVX__)
+typedef unsigned char __byte_vector __attribute__((__vector_size__(32)));
+#else
+typedef unsigned char __byte_vector __attribute__((__vector_size__(16)));
+#endif
+
+// __dst[__i] = __op(__a[__i], __b[__i]). Bytes are handled one at a time up
+// to the first vector boundary of __dst, so the main loop stores aligned
+// vectors (the sources are loaded unaligned), then one at a time again for
+// the tail.
+template <class _Op>
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 void
+__byte_transform(byte *__dst, const byte *__a, const byte *__b, size_t __n, _Op __op) noexcept {
+  if (__libcpp_is_constant_evaluated()) {
+    for (size_t __i = 0; __i != __n; ++__i)
+      __dst[__i] = __op(__a[__i], __b[__i]);
+    return;
+  }
+  unsigned char *__d        = reinterpret_cast<unsigned char *>(__dst);
+  const unsigned char *__pa = reinterpret_cast<const unsigned char *>(__a);
+  const unsigned char *__pb = reinterpret_cast<const unsigned char *>(__b);
+  const size_t __w          = sizeof(__byte_vector);
+
+  size_t __head = static_cast<size_t>(-reinterpret_cast<__UINTPTR_TYPE__>(__d)) & (__w - 1);
+  if (__head > __n)
+    __head = __n;
+  size_t __i = 0;
+  for (; __i != __head; ++__i)
+    __d[__i] = __op(__pa[__i], __pb[__i]);
+  for (; __n - __i >= __w; __i += __w) {
+    __byte_vector __va, __vb;
+    __builtin_memcpy(&__va, __pa + __i, __w);
+    __builtin_memcpy(&__vb, __pb + __i, __w);
+    __va = __op(__va, __vb);
+    __builtin_memcpy(__builtin_assume_aligned(__d + __i, sizeof(__byte_vector)), &__va, __w);
+  }
+  for (; __i != __n; ++__i)
+    __d[__i] = __op(__pa[__i], __pb[__i]);
+}
+
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 void __byte_and(byte *__dst, const byte *__a,
+                                                                              const byte *__b, size_t __n) noexcept {
+  _VSTD::__byte_transform(__dst, __a, __b, __n, __bit_and_op());
+}
+
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 void __byte_or(byte *__dst, const byte *__a,
+                                                                             const byte *__b, size_t __n) noexcept {
+  _VSTD::__byte_transform(__dst, __a, __b, __n, __bit_or_op());
+}
+
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 void __byte_xor(byte *__dst, const byte *__a,
+                                                                              const byte *__b, size_t __n) noexcept {
+  _VSTD::__byte_transform(__dst, __a, __b, __n, __bit_xor_op());
+}
+
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 void __byte_not(byte *__dst, const byte *__src,
+                                                                              size_t __n) noexcept {
+  _VSTD::__byte_transform(__dst, __src, __src, __n, __bit_not_op());
+}
+
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 void __byte_fill(byte *__dst, size_t __n,
+                                                                               byte __value) noexcept {
+  if (__libcpp_is_constant_evaluated()) {
+    for (size_t __i = 0; __i != __n; ++__i)
+      __dst[__i] = __value;
+    return;
+  }
+  // The C library's memset already does aligned vector stores and picks the
+  // widest (or rep stosb) at run time, which a header cannot improve on.
+  __builtin_memset(__dst, static_cast<unsigned char>(__value), __n);
+}
+
+// Like byte << __shift, shifting by 8 or more yields zero.
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 void
+__byte_shift_left(byte *__dst, const byte *__src, size_t __n, unsigned __shift) noexcept {
+  if (__shift >= 8)
+    _VSTD::__byte_fill(__dst, __n, byte{0});
+  else
+    _VSTD::__byte_transform(__dst, __src, __src, __n, __bit_shl_op{__shift});
+}
+
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 void
+__byte_shift_right(byte *__dst, const byte *__src, size_t __n, unsigned __shift) noexcept {
+  if (__shift >= 8)
+    _VSTD::__byte_fill(__dst, __n, byte{0});
+  else
+    _VSTD::__byte_transform(__dst, __src, __src, __n, __bit_shr_op{__shift});
+}
+
+_LIBCPP_END_NAMESPACE_STD
+
+#endif // _LIBCPP_STD_VER > 14
@@ -0,0 +1,303 @@
+// -*- C++ -*-
+//===--------------------------- __checksum -------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+/*
+    __checksum synopsis (extension, C++17)
+
+namespace std
+{
+
+// CRC-32C (Castagnoli, as in iSCSI, ext4 and SSE4.2). Passing a previous
+// result as crc continues it: __crc32c(ab) == __crc32c(b, __crc32c(a)).
+unsigned __crc32c(const byte* p, size_t n, unsigned crc = 0) noexcept;                      // constexpr in C++20
+
+// XXH64: the 64-bit xxHash, bit-compatible with the reference implementation.
+unsigned long long __xxhash64(const byte* p, size_t n, unsigned long long seed = 0) noexcept; // constexpr in C++20
+
+}  // std
+
+*/
+
+#include "__config.hh"
+#include "cstddef.hh"
+#include "type_traits.hh"
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#pragma GCC system_header
+#endif
+
+#if _LIBCPP_STD_VER > 14
+
+#if defined(__x86_64__) && (defined(_LIBCPP_COMPILER_GCC) || defined(_LIBCPP_COMPILER_CLANG))
+#define _LIBCPP_HAS_CRC32C_X86
+#include <immintrin.h>
+#endif
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+// Little-endian loads that also work in constant evaluation, where the bytes
+// are assembled one at a time.
+template <class _Byte>
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 unsigned long long
+__checksum_load64(const _Byte *__p) noexcept {
+  if (!__libcpp_is_constant_evaluated()) {
+    unsigned long long __v;
+    __builtin_memcpy(&__v, __p, sizeof(__v));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    __v = __builtin_bswap64(__v);
+#endif
+    return __v;
+  }
+  unsigned long long __v = 0;
+  for (int __i = 0; __i != 8; ++__i)
+    __v |= static_cast<unsigned long long>(static_cast<unsigned char>(__p[__i])) << (8 * __i);
+  return __v;
+}
+
+template <class _Byte>
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 unsigned __checksum_load32(const _Byte *__p) noexcept {
+  if (!__libcpp_is_constant_evaluated()) {
+    unsigned __v;
+    __builtin_memcpy(&__v, __p, sizeof(__v));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    __v = __builtin_bswap32(__v);
+#endif
+    return __v;
+  }
+  unsigned __v = 0;
+  for (int __i = 0; __i != 4; ++__i)
+    __v |= static_cast<unsigned>(static_cast<unsigned char>(__p[__i])) << (8 * __i);
+  return __v;
+}
+
+// CRC-32C
+
+static_assert(sizeof(unsigned) * __CHAR_BIT__ == 32, "__crc32c assumes a 32-bit unsigned int");
+
+// The polynomial 0x1EDC6F41, bit-reversed: the CRC works on reflected bits,
+// so bit 31 of the state is the coefficient of x^0.
+static constexpr unsigned __crc32c_poly = 0x82f63b78u;
+
+// Slicing-by-8 tables: __t_[0] advances the state by one byte, __t_[__k] by
+// one byte followed by __k zero bytes.
+struct __crc32c_tables {
+  unsigned __t_[8][256];
+};
+
+inline constexpr __crc32c_tables __crc32c_make_tables() noexcept {
+  __crc32c_tables __r{};
+  for (unsigned __i = 0; __i != 256; ++__i) {
+    unsigned __c = __i;
+    for (int __k = 0; __k != 8; ++__k)
+      __c = (__c >> 1) ^ ((__c & 1) ? __crc32c_poly : 0);
+    __r.__t_[0][__i] = __c;
+  }
+  for (int __s = 1; __s != 8; ++__s)
+    for (unsigned __i = 0; __i != 256; ++__i)
+      __r.__t_[__s][__i] = (__r.__t_[__s - 1][__i] >> 8) ^ __r.__t_[0][__r.__t_[__s - 1][__i] & 0xff];
+  return __r;
+}
+
+inline constexpr __crc32c_tables __crc32c_table = _VSTD::__crc32c_make_tables();
+
+// x^(8 * __bytes - 33) mod P, reflected. A carry-less product with this
+// constant followed by a CRC of the 64-bit result multiplies by x^33, so
+// the two together append __bytes zero bytes to a CRC state.
+inline constexpr unsigned __crc32c_shift_constant(size_t __bytes) noexcept {
+  unsigned __v = 0x80000000u;
+  for (size_t __i = 0, __e = 8 * __bytes - 33; __i != __e; ++__i)
+    __v = (__v >> 1) ^ ((__v & 1) ? __crc32c_poly : 0);
+  return __v;
+}
+
+// The implementations work on the raw state, without the initial and final
+// inversions.
+struct __crc32c_impl {
+  typedef unsigned long long __u64;
+
+  template <class _Byte>
+  static _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 unsigned __software(const _Byte *__p, size_t __n,
+                                                                                     unsigned __c) noexcept {
+    const auto &__t = __crc32c_table.__t_;
+    for (; __n >= 8; __n -= 8, __p += 8) {
+      const __u64 __w = _VSTD::__checksum_load64(__p) ^ __c;
+      __c = __t[7][__w & 0xff] ^ __t[6][(__w >> 8) & 0xff] ^ __t[5][(__w >> 16) & 0xff] ^ __t[4][(__w >> 24) & 0xff] ^
+            __t[3][(__w >> 32) & 0xff] ^ __t[2][(__w >> 40) & 0xff] ^ __t[1][(__w >> 48) & 0xff] ^ __t[0][__w >> 56];
+    }
+    for (; __n != 0; --__n, ++__p)
+      __c = (__c >> 8) ^ __t[0][(__c ^ static_cast<unsigned char>(*__p)) & 0xff];
+    return __c;
+  }
+
+  static unsigned __software_entry(const unsigned char *__p, size_t __n, unsigned __c) noexcept {
+    return __software(__p, __n, __c);
+  }
+
+#ifdef _LIBCPP_HAS_CRC32C_X86
+  __attribute__((__target__("sse4.2"))) static unsigned __sse42(const unsigned char *__p, size_t __n,
+                                                                unsigned __c) noexcept {
+    for (; __n != 0 && (reinterpret_cast<__UINTPTR_TYPE__>(__p) & 7) != 0; --__n, ++__p)
+      __c = _mm_crc32_u8(__c, *__p);
+    __u64 __c64 = __c;
+    for (; __n >= 8; __n -= 8, __p += 8)
+      __c64 = _mm_crc32_u64(__c64, _VSTD::__checksum_load64(__p));
+    __c = static_cast<unsigned>(__c64);
+    for (; __n != 0; --__n, ++__p)
+      __c = _mm_crc32_u8(__c, *__p);
+    return __c;
+  }
+
+  // The CRC instruction has a latency of three cycles and a throughput of
+  // one, so a single dependency chain runs at a third of the possible speed.
+  // Three adjacent blocks of _Lp bytes are checksummed side by side, the
+  // first continuing __c and the others starting from zero, and the three
+  // results are then joined by shifting the first two over the bytes that
+  // follow them, using a PCLMULQDQ fold.
+  template <size_t _Lp>
+  __attribute__((__target__("sse4.2,pclmul"))) static _LIBCPP_INLINE_VISIBILITY unsigned
+  __sse42_3way(const unsigned char *&__p, size_t &__n, unsigned __c) noexcept {
+    constexpr unsigned __k1 = _VSTD::__crc32c_shift_constant(_Lp);
+    constexpr unsigned __k2 = _VSTD::__crc32c_shift_constant(2 * _Lp);
+    for (; __n >= 3 * _Lp; __n -= 3 * _Lp, __p += 3 * _Lp) {
+      __u64 __c0 = __c, __c1 = 0, __c2 = 0;
+      for (size_t __i = 0; __i != _Lp; __i += 8) {
+        __c0 = _mm_crc32_u64(__c0, _VSTD::__checksum_load64(__p + __i));
+        __c1 = _mm_crc32_u64(__c1, _VSTD::__checksum_load64(__p + _Lp + __i));
+        __c2 = _mm_crc32_u64(__c2, _VSTD::__checksum_load64(__p + 2 * _Lp + __i));
+      }
+      const __m128i __a = _mm_clmulepi64_si128(_mm_cvtsi32_si128(static_cast<int>(__c0)),
+                                               _mm_cvtsi32_si128(static_cast<int>(__k2)), 0x00);
+      const __m128i __b = _mm_clmulepi64_si128(_mm_cvtsi32_si128(static_cast<int>(__c1)),
+                                               _mm_cvtsi32_si128(static_cast<int>(__k1)), 0x00);
+      __c = static_cast<unsigned>(_mm_crc32_u64(0, static_cast<__u64>(_mm_cvtsi128_si64(_mm_xor_si128(__a, __b))))) ^
+            static_cast<unsigned>(__c2);
+    }
+    return __c;
+  }
+
+  __attribute__((__target__("sse4.2,pclmul"))) static unsigned __sse42_pclmul(const unsigned char *__p, size_t __n,
+                                                                              unsigned __c) noexcept {
+    __c = __sse42_3way<1024>(__p, __n, __c);
+    __c = __sse42_3way<128>(__p, __n, __c);
+    return __sse42(__p, __n, __c);
+  }
+#endif // _LIBCPP_HAS_CRC32C_X86
+
+  typedef unsigned (*__fn)(const unsigned char *, size_t, unsigned) noexcept;
+
+  // Picks the implementation for this CPU on the first call and stores it
+  // in __dispatch, so every later call is a single indirect call. The
+  // pointer starts out constant-initialized to this function, so there is
+  // no static initialization order to get wrong.
+  static unsigned __resolve(const unsigned char *__p, size_t __n, unsigned __c) noexcept;
+  static __fn __dispatch;
+};
+
+inline unsigned __crc32c_impl::__resolve(const unsigned char *__p, size_t __n, unsigned __c) noexcept {
+  __fn __f = &__crc32c_impl::__software_entry;
+#ifdef _LIBCPP_HAS_CRC32C_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("sse4.2"))
+    __f = __builtin_cpu_supports("pclmul") ? &__crc32c_impl::__sse42_pclmul : &__crc32c_impl::__sse42;
+#endif
+  __atomic_store_n(&__dispatch, __f, __ATOMIC_RELAXED);
+  return __f(__p, __n, __c);
+}
+
+inline __crc32c_impl::__fn __crc32c_impl::__dispatch = &__crc32c_impl::__resolve;
+
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 unsigned __crc32c(const byte *__p, size_t __n,
+                                                                                unsigned __crc = 0) noexcept {
+  if (__libcpp_is_constant_evaluated())
+    return ~__crc32c_impl::__software(__p, __n, ~__crc);
+  const unsigned char *__q = reinterpret_cast<const unsigned char *>(__p);
+#if defined(_LIBCPP_HAS_CRC32C_X86) && defined(__SSE4_2__) && defined(__PCLMUL__)
+  return ~__crc32c_impl::__sse42_pclmul(__q, __n, ~__crc);
+#elif defined(_LIBCPP_HAS_CRC32C_X86) && defined(__SSE4_2__)
+  return ~__crc32c_impl::__sse42(__q, __n, ~__crc);
+#else
+  return ~__atomic_load_n(&__crc32c_impl::__dispatch, __ATOMIC_RELAXED)(__q, __n, ~__crc);
+#endif
+}
+
+// XXH64
+
+struct __xxhash64_impl {
+  typedef unsigned long long __u64;
+
+  static constexpr __u64 __p1 = 0x9e3779b185ebca87ull;
+  static constexpr __u64 __p2 = 0xc2b2ae3d27d4eb4full;
+  static constexpr __u64 __p3 = 0x165667b19e3779f9ull;
+  static constexpr __u64 __p4 = 0x85ebca77c2b2ae63ull;
+  static constexpr __u64 __p5 = 0x27d4eb2f165667c5ull;
+
+  static _LIBCPP_INLINE_VISIBILITY constexpr __u64 __rotl(__u64 __x, int __r) noexcept {
+    return (__x << __r) | (__x >> (64 - __r));
+  }
+
+  static _LIBCPP_INLINE_VISIBILITY constexpr __u64 __round(__u64 __acc, __u64 __in) noexcept {
+    return __rotl(__acc + __in * __p2, 31) * __p1;
+  }
+
+  static _LIBCPP_INLINE_VISIBILITY constexpr __u64 __merge(__u64 __h, __u64 __v) noexcept {
+    return (__h ^ __round(0, __v)) * __p1 + __p4;
+  }
+
+  // Four independent accumulators over 32-byte stripes, then the tail eight,
+  // four and one byte at a time.
+  template <class _Byte>
+  static _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 __u64 __hash(const _Byte *__p, size_t __n,
+                                                                             __u64 __seed) noexcept {
+    __u64 __h;
+    size_t __i = __n;
+    if (__i >= 32) {
+      __u64 __v1 = __seed + __p1 + __p2, __v2 = __seed + __p2, __v3 = __seed, __v4 = __seed - __p1;
+      do {
+        __v1 = __round(__v1, _VSTD::__checksum_load64(__p));
+        __v2 = __round(__v2, _VSTD::__checksum_load64(__p + 8));
+        __v3 = __round(__v3, _VSTD::__checksum_load64(__p + 16));
+        __v4 = __round(__v4, _VSTD::__checksum_load64(__p + 24));
+        __p += 32;
+        __i -= 32;
+      } while (__i >= 32);
+      __h = __rotl(__v1, 1) + __rotl(__v2, 7) + __rotl(__v3, 12) + __rotl(__v4, 18);
+      __h = __merge(__merge(__merge(__merge(__h, __v1), __v2), __v3), __v4);
+    } else
+      __h = __seed + __p5;
+    __h += __n;
+    for (; __i >= 8; __i -= 8, __p += 8)
+      __h = __rotl(__h ^ __round(0, _VSTD::__checksum_load64(__p)), 27) * __p1 + __p4;
+    if (__i >= 4) {
+      __h = __rotl(__h ^ (__u64(_VSTD::__checksum_load32(__p)) * __p1), 23) * __p2 + __p3;
+      __p += 4;
+      __i -= 4;
+    }
+    for (; __i != 0; --__i, ++__p)
+      __h = __rotl(__h ^ (static_cast<unsigned char>(*__p) * __p5), 11) * __p1;
+    __h ^= __h >> 33;
+    __h *= __p2;
+    __h ^= __h >> 29;
+    __h *= __p3;
+    __h ^= __h >> 32;
+    return __h;
+  }
+};
+
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 unsigned long long
+__xxhash64(const byte *__p, size_t __n, unsigned long long __seed = 0) noexcept {
+  if (__libcpp_is_constant_evaluated())
+    return __xxhash64_impl::__hash(__p, __n, __seed);
+  return __xxhash64_impl::__hash(reinterpret_cast<const unsigned char *>(__p), __n, __seed);
+}
+
+_LIBCPP_END_NAMESPACE_STD
+
+#endif // _LIBCPP_STD_VER > 14
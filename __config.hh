@@ -54,6 +54,10 @@
 #define __has_declspec_attribute(__x) 0
 #endif
 
+#ifndef __has_builtin
+#define __has_builtin(__x) 0
+#endif
+
 #define __has_keyword(__x) !(__is_identifier(__x))
 
 #if defined(__clang__)
@@ -83,8 +87,67 @@
 
 #elif defined(_LIBCPP_COMPILER_GCC)
 
+// GCC has no exclude_from_explicit_instantiation, so _LIBCPP_INLINE_VISIBILITY
+// falls back to this; forcing it would inline every function in the headers.
+#define _LIBCPP_ALWAYS_INLINE
+
 #endif // _LIBCPP_COMPILER_[CLANG|GCC|MSVC|IBM]
 
+// Opt-in: small forwarding functions on hot paths (swap, __invoke) that should
+// leave no call frame behind, even without optimization.
+#if __has_attribute(__always_inline__)
+#define _LIBCPP_FORCE_INLINE __attribute__((__always_inline__))
+#else
+#define _LIBCPP_FORCE_INLINE
+#endif
+
+// Code generation hints for hot paths. None of these change the meaning of a
+// correct program; they only tell the optimizer what the programmer knows.
+
+#if __has_builtin(__builtin_expect) || defined(_LIBCPP_COMPILER_GCC)
+#define _LIBCPP_LIKELY(__x)   __builtin_expect(!!(__x), 1)
+#define _LIBCPP_UNLIKELY(__x) __builtin_expect(!!(__x), 0)
+#else
+#define _LIBCPP_LIKELY(__x)   (__x)
+#define _LIBCPP_UNLIKELY(__x) (__x)
+#endif
+
+// _LIBCPP_ASSUME(cond) is a statement; `cond` must not have side effects since
+// some implementations evaluate it.
+#if __has_builtin(__builtin_assume)
+#define _LIBCPP_ASSUME(__x) __builtin_assume(__x)
+#elif __has_attribute(__assume__)
+#define _LIBCPP_ASSUME(__x) __attribute__((__assume__(__x)))
+#elif defined(_LIBCPP_COMPILER_GCC)
+#define _LIBCPP_ASSUME(__x) ((__x) ? (void)0 : __builtin_unreachable())
+#else
+#define _LIBCPP_ASSUME(__x) ((void)0)
+#endif
+
+#if __has_attribute(__hot__)
+#define _LIBCPP_HOT __attribute__((__hot__))
+#else
+#define _LIBCPP_HOT
+#endif
+
+#if __has_attribute(__cold__)
+#define _LIBCPP_COLD __attribute__((__cold__))
+#else
+#define _LIBCPP_COLD
+#endif
+
+#if __has_attribute(__flatten__)
+#define _LIBCPP_FLATTEN __attribute__((__flatten__))
+#else
+#define _LIBCPP_FLATTEN
+#endif
+
+#if defined(_LIBCPP_COMPILER_CLANG) || defined(_LIBCPP_COMPILER_GCC)
+#define _LIBCPP_RESTRICT __restrict
+#else
+#define _LIBCPP_RESTRICT
+#endif
+
 #ifndef _LIBCPP_HIDDEN
 #if !defined(_LIBCPP_DISABLE_VISIBILITY_ANNOTATIONS)
 #define _LIBCPP_HIDDEN __attribute__((__visibility__("hidden")))
@@ -101,6 +164,22 @@
 #endif
 #endif
 
+#ifndef _LIBCPP_TYPE_VIS
+#if !defined(_LIBCPP_DISABLE_VISIBILITY_ANNOTATIONS)
+#define _LIBCPP_TYPE_VIS __attribute__((__visibility__("default")))
+#else
+#define _LIBCPP_TYPE_VIS
+#endif
+#endif
+
+#ifndef _LIBCPP_ENUM_VIS
+#if !defined(_LIBCPP_DISABLE_VISIBILITY_ANNOTATIONS) && __has_attribute(__type_visibility__)
+#define _LIBCPP_ENUM_VIS __attribute__((__type_visibility__("default")))
+#else
+#define _LIBCPP_ENUM_VIS
+#endif
+#endif
+
 #ifndef _LIBCPP_TEMPLATE_VIS
 #if !defined(_LIBCPP_DISABLE_VISIBILITY_ANNOTATIONS)
 #if __has_attribute(__type_visibility__)
@@ -168,6 +247,12 @@ _LIBCPP_BEGIN_NAMESPACE_STD _LIBCPP_END_NAMESPACE_STD
 #define _LIBCPP_SUPPRESS_DEPRECATED_POP
 #endif
 
+#if _LIBCPP_STD_VER > 11 && !defined(_LIBCPP_HAS_NO_CXX14_CONSTEXPR)
+#define _LIBCPP_CONSTEXPR_AFTER_CXX11 constexpr
+#else
+#define _LIBCPP_CONSTEXPR_AFTER_CXX11
+#endif
+
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_CXX14_CONSTEXPR)
 #define _LIBCPP_CONSTEXPR_AFTER_CXX14 constexpr
 #else
@@ -186,6 +271,30 @@ _LIBCPP_BEGIN_NAMESPACE_STD _LIBCPP_END_NAMESPACE_STD
 #define _LIBCPP_INLINE_VAR
 #endif
 
+#if defined(__cpp_consteval) && __cpp_consteval >= 201811L
+#define _LIBCPP_CONSTEVAL consteval
+#else
+#define _LIBCPP_CONSTEVAL constexpr
+#endif
+
+// The instrumentation in __trace.hh is compiled in only on request; without
+// it __scoped_timer and __trace_scope are empty.
+#if !defined(_LIBCPP_ENABLE_INSTRUMENTATION)
+#define _LIBCPP_HAS_NO_INSTRUMENTATION
+#endif
+
+#if __has_keyword(__has_unique_object_representations) || _GNUC_VER >= 700
+#define _LIBCPP_HAS_UNIQUE_OBJECT_REPRESENTATIONS
+#endif
+
+#if !defined(__cpp_aligned_new) || __cpp_aligned_new < 201606L
+#define _LIBCPP_HAS_NO_ALIGNED_ALLOCATION
+#endif
+
+#if !defined(__cpp_sized_deallocation) || __cpp_sized_deallocation < 201309L
+#define _LIBCPP_HAS_NO_SIZED_DEALLOCATION
+#endif
+
 #ifndef _LIBCPP_NODEBUG_TYPE
 #if __has_attribute(__nodebug__) && (defined(_LIBCPP_CLANG_VER) && _LIBCPP_CLANG_VER >= 900)
 #define _LIBCPP_NODEBUG_TYPE __attribute__((nodebug))
@@ -0,0 +1,45 @@
+// -*- C++ -*-
+//===---------------------------- __errc ----------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+/*
+    __errc synopsis
+
+namespace std
+{
+
+enum class errc
+{
+    invalid_argument,       // EINVAL
+    result_out_of_range,    // ERANGE
+    value_too_large,        // EOVERFLOW
+};
+
+}  // std
+
+*/
+
+#include "__config.hh"
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#pragma GCC system_header
+#endif
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+// Only the conditions reported by this library are listed. There is no
+// <errno.h> to take the values from; they are those of Linux.
+enum class errc {
+  invalid_argument    = 22,
+  result_out_of_range = 34,
+  value_too_large     = 75
+};
+
+_LIBCPP_END_NAMESPACE_STD
@@ -0,0 +1,272 @@
+// -*- C++ -*-
+//===------------------------- __hdr_histogram ----------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+/*
+    __hdr_histogram synopsis (extension, C++20)
+
+namespace std
+{
+
+// Counts of integer values (latencies, sizes) in log-linear buckets: each
+// power of two is split into 2^Precision buckets, so a bucket is within a
+// factor of 1 + 2^-Precision of the values in it, and values below
+// 2^(Precision+1) are counted exactly. The memory is fixed: __buckets
+// counters. Negative values are counted as 0.
+template <class T = unsigned long long, int Precision = 7>
+class __hdr_histogram
+{
+public:
+    typedef T value_type;
+    static constexpr size_t __buckets;
+
+    static constexpr size_t __bucket_of(T v) noexcept;
+    static constexpr T __bucket_lowest(size_t i) noexcept;
+    static constexpr T __bucket_highest(size_t i) noexcept;
+
+    // Wait-free: one relaxed atomic add. From any thread.
+    void __record(T v, unsigned long long n = 1) noexcept;
+    // A relaxed load and store, no locked instruction: only when this thread
+    // is the only one recording into the histogram, as with a shard of its own.
+    void __record_local(T v, unsigned long long n = 1) noexcept;
+
+    unsigned long long __count(size_t i) const noexcept;
+    unsigned long long __total() const noexcept;
+    void __add(const __hdr_histogram& h) noexcept;     // adds h's counts into this
+    void __reset() noexcept;
+
+    // The highest value in the bucket that holds the p-th percentile
+    // (0 <= p <= 100), or 0 if nothing was recorded.
+    T __percentile(double p) const noexcept;
+    void __percentiles(const double* p, T* out, size_t n) const noexcept;   // p ascending
+};
+
+// Shards on their own cache lines, merged when read.
+template <class Histogram, size_t N>
+class __sharded_hdr_histogram
+{
+public:
+    typedef typename Histogram::value_type value_type;
+
+    Histogram& __shard(size_t i) noexcept;                       // i % N
+    // Into shard i % N, as Histogram::__record and __record_local; the second
+    // only where this thread is the one recording into that shard.
+    void __record(size_t i, value_type v, unsigned long long n = 1) noexcept;
+    void __record_local(size_t i, value_type v, unsigned long long n = 1) noexcept;
+
+    unsigned long long __count(size_t bucket) const noexcept;   // over all shards
+    unsigned long long __total() const noexcept;
+    void __merge_into(Histogram& h) const noexcept;
+    void __reset() noexcept;
+    value_type __percentile(double p) const noexcept;
+    void __percentiles(const double* p, value_type* out, size_t n) const noexcept;
+};
+
+}  // std
+
+    Reads use relaxed loads, so while other threads record, a read sees
+    each counter at some recent value, not one instant across all of them.
+
+*/
+
+#include "__atomic_support.hh"
+#include "__config.hh"
+#include "bit.hh"
+#include "cstddef.hh"
+#include "type_traits.hh"
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#pragma GCC system_header
+#endif
+
+#if _LIBCPP_STD_VER > 17
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+// The rank of the p-th percentile of __total values, from 1.
+inline _LIBCPP_INLINE_VISIBILITY unsigned long long __hdr_rank(double __p, unsigned long long __total) noexcept {
+  if (!(__p > 0))
+    return 1;
+  if (__p >= 100)
+    return __total;
+  const double __r             = __p / 100 * static_cast<double>(__total);
+  const unsigned long long __k = static_cast<unsigned long long>(__r);
+  return __k < __r || __k == 0 ? __k + 1 : __k;
+}
+
+// One pass over the buckets of __src for every percentile in __p.
+template <class _Hist, class _Src>
+inline _LIBCPP_INLINE_VISIBILITY void __hdr_percentiles(const _Src &__src, const double *__p,
+                                                        typename _Hist::value_type *__out, size_t __n) noexcept {
+  const unsigned long long __total = __src.__total();
+  size_t __i                       = 0;
+  size_t __last                    = 0; // the last bucket with a count
+  unsigned long long __seen        = 0;
+  for (size_t __k = 0; __k != __n; ++__k) {
+    if (__total == 0) {
+      __out[__k] = 0;
+      continue;
+    }
+    // Counts read while others record may add up to less than __total;
+    // then the rank is not reached and the last bucket seen stands.
+    const unsigned long long __rank = _VSTD::__hdr_rank(__p[__k], __total);
+    for (; __seen < __rank && __i != _Hist::__buckets; ++__i)
+      if (const unsigned long long __c = __src.__count(__i)) {
+        __seen += __c;
+        __last = __i;
+      }
+    __out[__k] = _Hist::__bucket_highest(__last);
+  }
+}
+
+template <class _Tp = unsigned long long, int _Precision = 7> class _LIBCPP_TEMPLATE_VIS __hdr_histogram {
+  static_assert(is_integral<_Tp>::value && !_IsSame<_Tp, bool>::value,
+                "__hdr_histogram: the values must be integers");
+  typedef make_unsigned_t<_Tp> __unsigned_type;
+  static constexpr int __digits = static_cast<int>(sizeof(_Tp) * __CHAR_BIT__) - (is_signed<_Tp>::value ? 1 : 0);
+  static_assert(_Precision >= 1 && _Precision < __digits, "__hdr_histogram: the precision is out of range");
+
+public:
+  typedef _Tp value_type;
+  static constexpr size_t __buckets = static_cast<size_t>(__digits - _Precision + 1) << _Precision;
+
+private:
+  unsigned long long __counts_[__buckets] = {};
+
+public:
+  // Within [2^k, 2^(k+1)), for k > _Precision, a bucket spans 2^(k-_Precision)
+  // values: the shift is how far the value is past the exact range.
+  _LIBCPP_INLINE_VISIBILITY static constexpr size_t __bucket_of(_Tp __v) noexcept {
+    __unsigned_type __u;
+    if constexpr (is_signed<_Tp>::value)
+      __u = __v < 0 ? 0 : static_cast<__unsigned_type>(__v);
+    else
+      __u = __v;
+    const int __msb   = static_cast<int>(sizeof(_Tp) * __CHAR_BIT__) - 1 -
+                      _VSTD::countl_zero(static_cast<__unsigned_type>(__u | (__unsigned_type(1) << _Precision)));
+    const int __shift = __msb - _Precision;
+    return (static_cast<size_t>(__shift) << _Precision) + static_cast<size_t>(__u >> __shift);
+  }
+
+  _LIBCPP_INLINE_VISIBILITY static constexpr _Tp __bucket_lowest(size_t __i) noexcept {
+    const size_t __h  = __i >> _Precision;
+    const int __shift = __h != 0 ? static_cast<int>(__h) - 1 : 0;
+    return static_cast<_Tp>(static_cast<__unsigned_type>(__i - (static_cast<size_t>(__shift) << _Precision))
+                            << __shift);
+  }
+
+  _LIBCPP_INLINE_VISIBILITY static constexpr _Tp __bucket_highest(size_t __i) noexcept {
+    const size_t __h  = __i >> _Precision;
+    const int __shift = __h != 0 ? static_cast<int>(__h) - 1 : 0;
+    return static_cast<_Tp>(static_cast<__unsigned_type>(__bucket_lowest(__i)) +
+                            ((__unsigned_type(1) << __shift) - 1));
+  }
+
+  _LIBCPP_INLINE_VISIBILITY void __record(_Tp __v, unsigned long long __n = 1) noexcept {
+    _VSTD::__libcpp_atomic_add(&__counts_[__bucket_of(__v)], __n, _AO_Relaxed);
+  }
+
+  _LIBCPP_INLINE_VISIBILITY void __record_local(_Tp __v, unsigned long long __n = 1) noexcept {
+    unsigned long long *const __c = &__counts_[__bucket_of(__v)];
+    _VSTD::__libcpp_relaxed_store(__c, _VSTD::__libcpp_relaxed_load(__c) + __n);
+  }
+
+  _LIBCPP_INLINE_VISIBILITY unsigned long long __count(size_t __i) const noexcept {
+    return _VSTD::__libcpp_relaxed_load(&__counts_[__i]);
+  }
+
+  _LIBCPP_INLINE_VISIBILITY unsigned long long __total() const noexcept {
+    unsigned long long __t = 0;
+    for (size_t __i = 0; __i != __buckets; ++__i)
+      __t += __count(__i);
+    return __t;
+  }
+
+  _LIBCPP_INLINE_VISIBILITY void __add(const __hdr_histogram &__h) noexcept {
+    for (size_t __i = 0; __i != __buckets; ++__i)
+      if (const unsigned long long __c = __h.__count(__i))
+        _VSTD::__libcpp_atomic_add(&__counts_[__i], __c, _AO_Relaxed);
+  }
+
+  _LIBCPP_INLINE_VISIBILITY void __reset() noexcept {
+    for (size_t __i = 0; __i != __buckets; ++__i)
+      _VSTD::__libcpp_relaxed_store(&__counts_[__i], 0ull);
+  }
+
+  _LIBCPP_INLINE_VISIBILITY _Tp __percentile(double __p) const noexcept {
+    _Tp __r;
+    _VSTD::__hdr_percentiles<__hdr_histogram>(*this, &__p, &__r, 1);
+    return __r;
+  }
+
+  _LIBCPP_INLINE_VISIBILITY void __percentiles(const double *__p, _Tp *__out, size_t __n) const noexcept {
+    _VSTD::__hdr_percentiles<__hdr_histogram>(*this, __p, __out, __n);
+  }
+};
+
+template <class _Hist, size_t _Np> class _LIBCPP_TEMPLATE_VIS __sharded_hdr_histogram {
+  static_assert(_Np >= 1, "__sharded_hdr_histogram: there must be a shard");
+
+  struct alignas(64) __padded {
+    _Hist __h_;
+  };
+  __padded __shards_[_Np];
+
+public:
+  typedef typename _Hist::value_type value_type;
+
+  _LIBCPP_INLINE_VISIBILITY _Hist &__shard(size_t __i) noexcept { return __shards_[__i % _Np].__h_; }
+
+  _LIBCPP_INLINE_VISIBILITY void __record(size_t __i, value_type __v, unsigned long long __n = 1) noexcept {
+    __shard(__i).__record(__v, __n);
+  }
+
+  _LIBCPP_INLINE_VISIBILITY void __record_local(size_t __i, value_type __v, unsigned long long __n = 1) noexcept {
+    __shard(__i).__record_local(__v, __n);
+  }
+
+  _LIBCPP_INLINE_VISIBILITY unsigned long long __count(size_t __bucket) const noexcept {
+    unsigned long long __c = 0;
+    for (size_t __s = 0; __s != _Np; ++__s)
+      __c += __shards_[__s].__h_.__count(__bucket);
+    return __c;
+  }
+
+  _LIBCPP_INLINE_VISIBILITY unsigned long long __total() const noexcept {
+    unsigned long long __t = 0;
+    for (size_t __s = 0; __s != _Np; ++__s)
+      __t += __shards_[__s].__h_.__total();
+    return __t;
+  }
+
+  _LIBCPP_INLINE_VISIBILITY void __merge_into(_Hist &__h) const noexcept {
+    for (size_t __s = 0; __s != _Np; ++__s)
+      __h.__add(__shards_[__s].__h_);
+  }
+
+  _LIBCPP_INLINE_VISIBILITY void __reset() noexcept {
+    for (size_t __s = 0; __s != _Np; ++__s)
+      __shards_[__s].__h_.__reset();
+  }
+
+  _LIBCPP_INLINE_VISIBILITY value_type __percentile(double __p) const noexcept {
+    value_type __r;
+    _VSTD::__hdr_percentiles<_Hist>(*this, &__p, &__r, 1);
+    return __r;
+  }
+
+  _LIBCPP_INLINE_VISIBILITY void __percentiles(const double *__p, value_type *__out, size_t __n) const noexcept {
+    _VSTD::__hdr_percentiles<_Hist>(*this, __p, __out, __n);
+  }
+};
+
+_LIBCPP_END_NAMESPACE_STD
+
+#endif // _LIBCPP_STD_VER > 17
@@ -0,0 +1,295 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+/*
+    __packed_tuple synopsis (C++17, extension)
+
+namespace std
+{
+
+// A tuple whose elements are stored in descending order of alignment, so no
+// padding is needed between them. Indices are still declaration order.
+template <class... T>
+class __packed_tuple
+{
+public:
+    using __types = __type_list<T...>;
+    static constexpr __packed_tuple_order<sizeof...(T)> __storage_order;  // storage slot -> element index
+
+    constexpr __packed_tuple();
+    template <class... U>
+        constexpr explicit(see below) __packed_tuple(U&&... u);  // sizeof...(U) == sizeof...(T) != 0
+    __packed_tuple(const __packed_tuple&) = default;
+    __packed_tuple(__packed_tuple&&) = default;
+    __packed_tuple& operator=(const __packed_tuple&) = default;
+    __packed_tuple& operator=(__packed_tuple&&) = default;
+
+    void swap(__packed_tuple&);
+};
+
+template <size_t I, class... T>
+    constexpr T_I& get(__packed_tuple<T...>&) noexcept;
+template <size_t I, class... T>
+    constexpr const T_I& get(const __packed_tuple<T...>&) noexcept;
+template <size_t I, class... T>
+    constexpr T_I&& get(__packed_tuple<T...>&&) noexcept;
+
+template <class... T, class... U>
+    constexpr bool operator==(const __packed_tuple<T...>&, const __packed_tuple<U...>&);
+template <class... T, class... U>
+    constexpr bool operator!=(const __packed_tuple<T...>&, const __packed_tuple<U...>&);
+
+template <class... T>
+    void swap(__packed_tuple<T...>&, __packed_tuple<T...>&);
+
+}  // std
+
+*/
+
+#include "__config.hh"
+#include "cstddef.hh"
+#include "type_traits.hh"
+#include "utility.hh"
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#pragma GCC system_header
+#endif
+
+#if _LIBCPP_STD_VER > 14
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+template <class... _Tp> class __packed_tuple;
+
+template <size_t _Ip, class... _Tp> constexpr auto &get(__packed_tuple<_Tp...> &) noexcept;
+template <size_t _Ip, class... _Tp> constexpr const auto &get(const __packed_tuple<_Tp...> &) noexcept;
+
+// __packed_tuple_order
+
+template <size_t _Np> struct __packed_tuple_order {
+  size_t __index_[_Np == 0 ? 1 : _Np];
+
+  constexpr size_t operator[](size_t __i) const noexcept { return __index_[__i]; }
+  static constexpr size_t size() noexcept { return _Np; }
+};
+
+// Stable sort of element indices by descending alignment. Element sizes are
+// multiples of their alignment, so laying the elements out in this order
+// leaves no padding between them.
+template <class... _Tp> constexpr __packed_tuple_order<sizeof...(_Tp)> __packed_tuple_sort() noexcept {
+  constexpr size_t __n                     = sizeof...(_Tp);
+  const size_t __align[__n == 0 ? 1 : __n] = {alignment_of<_Tp>::value...};
+  __packed_tuple_order<__n> __r{};
+  for (size_t __i = 0; __i != __n; ++__i)
+    __r.__index_[__i] = __i;
+  for (size_t __i = 1; __i < __n; ++__i)
+    for (size_t __j = __i; __j > 0 && __align[__r.__index_[__j - 1]] < __align[__r.__index_[__j]]; --__j) {
+      size_t __t            = __r.__index_[__j];
+      __r.__index_[__j]     = __r.__index_[__j - 1];
+      __r.__index_[__j - 1] = __t;
+    }
+  return __r;
+}
+
+struct __packed_tuple_args_tag {};
+
+// __packed_tuple_leaf
+
+// Leaves are keyed on the declaration index, so get<I> is a static_cast to a
+// unique base whatever slot the element was stored in. Empty non-final
+// element types are inherited from to take the empty base optimization.
+template <size_t _Ip, class _Hp, bool = is_empty_v<_Hp> && !is_final_v<_Hp>> class __packed_tuple_leaf {
+  _Hp __value_;
+
+public:
+  constexpr __packed_tuple_leaf() noexcept(is_nothrow_default_constructible_v<_Hp>) : __value_() {}
+
+  template <class _Up>
+  constexpr __packed_tuple_leaf(__packed_tuple_args_tag, _Up &&__u) noexcept(is_nothrow_constructible_v<_Hp, _Up>)
+      : __value_(_VSTD::forward<_Up>(__u)) {}
+
+  constexpr _Hp &get() noexcept { return __value_; }
+  constexpr const _Hp &get() const noexcept { return __value_; }
+};
+
+template <size_t _Ip, class _Hp> class __packed_tuple_leaf<_Ip, _Hp, true> : private _Hp {
+public:
+  constexpr __packed_tuple_leaf() noexcept(is_nothrow_default_constructible_v<_Hp>) : _Hp() {}
+
+  template <class _Up>
+  constexpr __packed_tuple_leaf(__packed_tuple_args_tag, _Up &&__u) noexcept(is_nothrow_constructible_v<_Hp, _Up>)
+      : _Hp(_VSTD::forward<_Up>(__u)) {}
+
+  constexpr _Hp &get() noexcept { return static_cast<_Hp &>(*this); }
+  constexpr const _Hp &get() const noexcept { return static_cast<const _Hp &>(*this); }
+};
+
+// __packed_tuple_args
+
+// The constructor arguments, indexable by declaration index while the leaves
+// are initialized in storage order.
+template <size_t _Ip, class _Up> struct __packed_tuple_arg { _Up &&__arg_; };
+
+template <class _Seq, class... _Up> struct __packed_tuple_args;
+template <size_t... _Ip, class... _Up>
+struct __packed_tuple_args<__index_sequence<_Ip...>, _Up...> : __packed_tuple_arg<_Ip, _Up>... {};
+
+template <size_t _Ip, class _Up>
+constexpr _Up &&__packed_tuple_get_arg(const __packed_tuple_arg<_Ip, _Up> &__a) noexcept {
+  return _VSTD::forward<_Up>(__a.__arg_);
+}
+
+// __packed_tuple_storage
+
+template <class _Seq, class... _Tp> class __packed_tuple_storage;
+
+// The language leaves the layout of base classes unspecified; the Itanium C++
+// ABI, which GCC and Clang follow outside Windows, lays out non-virtual bases
+// in the order they are listed, which here is storage order. __packed_tuple
+// checks that the elements then sit back to back.
+template <size_t... _Sp, class... _Tp>
+class __packed_tuple_storage<__index_sequence<_Sp...>, _Tp...>
+    : public __packed_tuple_leaf<__packed_tuple_sort<_Tp...>()[_Sp],
+                                 __type_pack_element_t<__packed_tuple_sort<_Tp...>()[_Sp], _Tp...>>... {
+  static constexpr __packed_tuple_order<sizeof...(_Tp)> __order_ = __packed_tuple_sort<_Tp...>();
+
+public:
+  constexpr __packed_tuple_storage() = default;
+
+  template <class _Args>
+  constexpr __packed_tuple_storage(__packed_tuple_args_tag __tag, const _Args &__args)
+      : __packed_tuple_leaf<__order_[_Sp], __type_pack_element_t<__order_[_Sp], _Tp...>>(
+            __tag, _VSTD::__packed_tuple_get_arg<__order_[_Sp]>(__args))... {}
+};
+
+// The size of elements stored back to back in descending order of alignment:
+// each starts where the one before it ends, and only the end is padded.
+template <class... _Tp> constexpr size_t __packed_tuple_size() noexcept {
+  const size_t __size = (0 + ... + sizeof(_Tp));
+  size_t __align      = 1;
+  ((__align = alignment_of<_Tp>::value > __align ? alignment_of<_Tp>::value : __align), ...);
+  return (__size + __align - 1) / __align * __align;
+}
+
+// __packed_tuple
+
+template <class... _Tp> class _LIBCPP_TEMPLATE_VIS __packed_tuple {
+  typedef __packed_tuple_storage<__make_index_sequence<sizeof...(_Tp)>, _Tp...> _Storage;
+
+  _Storage __storage_;
+
+  // Empty elements take no room or a byte depending on the empty base
+  // optimization, so only tuples without them are checked.
+  static_assert(sizeof...(_Tp) == 0 || (is_empty_v<_Tp> || ...) ||
+                    sizeof(_Storage) == _VSTD::__packed_tuple_size<_Tp...>(),
+                "__packed_tuple relies on the Itanium C++ ABI laying out base classes in declaration order");
+
+  template <size_t _Ip, class... _Up> friend constexpr auto &get(__packed_tuple<_Up...> &) noexcept;
+  template <size_t _Ip, class... _Up> friend constexpr const auto &get(const __packed_tuple<_Up...> &) noexcept;
+
+  template <class... _Up>
+  using _EnableIfConstructible =
+      _EnableIf<sizeof...(_Up) == sizeof...(_Tp) && sizeof...(_Up) != 0 &&
+                !(sizeof...(_Up) == 1 && _And<is_same<__uncvref_t<_Up>, __packed_tuple>...>::value) &&
+                _And<is_constructible<_Tp, _Up>...>::value>;
+
+public:
+  using __types = __type_list<_Tp...>;
+
+  static constexpr __packed_tuple_order<sizeof...(_Tp)> __storage_order = __packed_tuple_sort<_Tp...>();
+
+  template <class _Dep = __type_list<_Tp...>,
+            class     = _EnableIf<_And<is_same<_Dep, __type_list<_Tp...>>, is_default_constructible<_Tp>...>::value>>
+  constexpr __packed_tuple() noexcept(_And<is_nothrow_default_constructible<_Tp>...>::value) : __storage_() {}
+
+  template <class... _Up, class = _EnableIfConstructible<_Up...>,
+            _EnableIf<_And<is_convertible<_Up, _Tp>...>::value, int> = 0>
+  constexpr __packed_tuple(_Up &&...__u) noexcept(_And<is_nothrow_constructible<_Tp, _Up>...>::value)
+      : __storage_(__packed_tuple_args_tag(),
+                   __packed_tuple_args<__make_index_sequence<sizeof...(_Up)>, _Up...>{{_VSTD::forward<_Up>(__u)}...}) {}
+
+  template <class... _Up, class = _EnableIfConstructible<_Up...>,
+            _EnableIf<!_And<is_convertible<_Up, _Tp>...>::value, int> = 0>
+  constexpr explicit __packed_tuple(_Up &&...__u) noexcept(_And<is_nothrow_constructible<_Tp, _Up>...>::value)
+      : __storage_(__packed_tuple_args_tag(),
+                   __packed_tuple_args<__make_index_sequence<sizeof...(_Up)>, _Up...>{{_VSTD::forward<_Up>(__u)}...}) {}
+
+  __packed_tuple(const __packed_tuple &) = default;
+  __packed_tuple(__packed_tuple &&)      = default;
+  __packed_tuple &operator=(const __packed_tuple &) = default;
+  __packed_tuple &operator=(__packed_tuple &&) = default;
+
+  void swap(__packed_tuple &__other) noexcept(_And<__is_nothrow_swappable<_Tp>...>::value) {
+    __swap_imp(__other, __make_index_sequence<sizeof...(_Tp)>());
+  }
+
+private:
+  template <size_t... _Ip> void __swap_imp(__packed_tuple &__other, __index_sequence<_Ip...>) {
+    using _VSTD::swap;
+    (swap(_VSTD::get<_Ip>(*this), _VSTD::get<_Ip>(__other)), ...);
+  }
+};
+
+// get
+
+template <size_t _Ip, class... _Tp>
+inline _LIBCPP_INLINE_VISIBILITY constexpr auto &get(__packed_tuple<_Tp...> &__t) noexcept {
+  static_assert(_Ip < sizeof...(_Tp), "__packed_tuple index out of range");
+  typedef __packed_tuple_leaf<_Ip, __type_pack_element_t<_Ip, _Tp...>> _Leaf;
+  return static_cast<_Leaf &>(__t.__storage_).get();
+}
+
+template <size_t _Ip, class... _Tp>
+inline _LIBCPP_INLINE_VISIBILITY constexpr const auto &get(const __packed_tuple<_Tp...> &__t) noexcept {
+  static_assert(_Ip < sizeof...(_Tp), "__packed_tuple index out of range");
+  typedef __packed_tuple_leaf<_Ip, __type_pack_element_t<_Ip, _Tp...>> _Leaf;
+  return static_cast<const _Leaf &>(__t.__storage_).get();
+}
+
+template <size_t _Ip, class... _Tp>
+inline _LIBCPP_INLINE_VISIBILITY constexpr __type_pack_element_t<_Ip, _Tp...> &&
+get(__packed_tuple<_Tp...> &&__t) noexcept {
+  return static_cast<__type_pack_element_t<_Ip, _Tp...> &&>(_VSTD::get<_Ip>(__t));
+}
+
+// operator==, operator!=
+
+template <class... _Tp, class... _Up, size_t... _Ip>
+inline _LIBCPP_INLINE_VISIBILITY constexpr bool __packed_tuple_equal(const __packed_tuple<_Tp...> &__x,
+                                                                     const __packed_tuple<_Up...> &__y,
+                                                                     __index_sequence<_Ip...>) {
+  return (true && ... && bool(_VSTD::get<_Ip>(__x) == _VSTD::get<_Ip>(__y)));
+}
+
+template <class... _Tp, class... _Up>
+inline _LIBCPP_INLINE_VISIBILITY constexpr bool operator==(const __packed_tuple<_Tp...> &__x,
+                                                           const __packed_tuple<_Up...> &__y) {
+  static_assert(sizeof...(_Tp) == sizeof...(_Up), "Can't compare __packed_tuples of different sizes");
+  return _VSTD::__packed_tuple_equal(__x, __y, __make_index_sequence<sizeof...(_Tp)>());
+}
+
+template <class... _Tp, class... _Up>
+inline _LIBCPP_INLINE_VISIBILITY constexpr bool operator!=(const __packed_tuple<_Tp...> &__x,
+                                                           const __packed_tuple<_Up...> &__y) {
+  return !(__x == __y);
+}
+
+// swap
+
+template <class... _Tp>
+inline _LIBCPP_INLINE_VISIBILITY _EnableIf<_And<__is_swappable<_Tp>...>::value>
+swap(__packed_tuple<_Tp...> &__x, __packed_tuple<_Tp...> &__y) noexcept(noexcept(__x.swap(__y))) {
+  __x.swap(__y);
+}
+
+_LIBCPP_END_NAMESPACE_STD
+
+#endif // _LIBCPP_STD_VER > 14
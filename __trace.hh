@@ -0,0 +1,430 @@
+// -*- C++ -*-
+//===---------------------------- __trace ---------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+/*
+    __trace synopsis (extension, C++17)
+
+namespace std
+{
+
+// The cycle counter: rdtsc on x86, cntvct_el0 on AArch64, 0 elsewhere. Reads
+// are not serializing.
+unsigned long long __cycle_count() noexcept;
+
+// Counts per second: set by the calls below, or read from the CPU where it
+// says (cntfrq_el0; CPUID leaf 15h), or else measured against the monotonic
+// clock for 2 ms on first use; 0 if none of these is there.
+unsigned long long __cycle_frequency() noexcept;
+void __set_cycle_frequency(unsigned long long hz) noexcept;
+template <class Clock>   // unsigned long long now_ns()
+    unsigned long long __calibrate_cycle_counter(Clock now_ns, unsigned long long span_ns = 10000000);
+
+// Cycles to nanoseconds at __cycle_frequency(); cycles as they are if it is 0.
+unsigned long long __cycles_to_ns(unsigned long long cycles) noexcept;
+
+// Adds the cycles spent in its scope to cycles.
+class __scoped_timer
+{
+public:
+    explicit __scoped_timer(unsigned long long& cycles) noexcept;
+    ~__scoped_timer();
+};
+
+struct __trace_event { const char* __name; unsigned long long __begin, __end; };   // cycles
+
+// A single-producer single-consumer ring of events: one per traced thread.
+template <size_t N>   // a power of two
+class __trace_ring
+{
+public:
+    bool __record(const char* name, unsigned long long begin, unsigned long long end) noexcept;  // false if dropped
+    template <class F> size_t __consume(F&& f);  // bool f(const __trace_event&), oldest first; stops
+                                                 // at the first false and leaves that event
+    size_t __dropped() const noexcept;
+};
+
+// Records the cycles spent in its scope as one event.
+template <size_t N>
+class __trace_scope
+{
+public:
+    __trace_scope(__trace_ring<N>& ring, const char* name) noexcept;
+    ~__trace_scope();
+};
+
+// Chrome trace JSON, which chrome://tracing and Perfetto load: complete
+// ("ph":"X") events in microseconds since base.
+class __chrome_trace_writer
+{
+public:
+    __chrome_trace_writer(char* first, char* last, unsigned long long base = 0) noexcept;
+    template <size_t N> bool __append(__trace_ring<N>& ring, unsigned tid) noexcept;   // false if out of room;
+                                                                                      // the rest stay in ring
+    char* __finish() noexcept;   // the end of the document, or nullptr if not even an empty one fit
+};
+
+}  // std
+
+    Unless _LIBCPP_ENABLE_INSTRUMENTATION is defined, __scoped_timer and
+    __trace_scope do nothing and read no counter, so they can stay in hot
+    paths. The counters, rings and writer are always there.
+
+*/
+
+#include "__atomic_support.hh"
+#include "__config.hh"
+#include "charconv.hh"
+#include "cstddef.hh"
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#pragma GCC system_header
+#endif
+
+#if _LIBCPP_STD_VER > 14
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(_LIBCPP_COMPILER_GCC) || defined(_LIBCPP_COMPILER_CLANG))
+#define _LIBCPP_HAS_CYCLE_COUNTER_X86
+#include <cpuid.h>
+#elif defined(__aarch64__) && (defined(_LIBCPP_COMPILER_GCC) || defined(_LIBCPP_COMPILER_CLANG))
+#define _LIBCPP_HAS_CYCLE_COUNTER_ARM64
+#endif
+
+#if (defined(_LIBCPP_HAS_CYCLE_COUNTER_X86) || defined(_LIBCPP_HAS_CYCLE_COUNTER_ARM64)) && __STDC_HOSTED__ &&       \
+    __has_include(<time.h>)
+#include <time.h>
+#if defined(CLOCK_MONOTONIC)
+#define _LIBCPP_HAS_CYCLE_CALIBRATION
+#endif
+#endif
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+// Cycle counter
+
+inline _LIBCPP_INLINE_VISIBILITY unsigned long long __cycle_count() noexcept {
+#if defined(_LIBCPP_HAS_CYCLE_COUNTER_X86)
+  return __builtin_ia32_rdtsc();
+#elif defined(_LIBCPP_HAS_CYCLE_COUNTER_ARM64)
+  unsigned long long __v;
+  __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(__v));
+  return __v;
+#else
+  return 0;
+#endif
+}
+
+struct __cycle_clock {
+  // What the CPU reports, or 0. Only some x86 parts fill in leaf 15h, and
+  // hypervisors often leave it empty.
+  static unsigned long long __detect() noexcept {
+#if defined(_LIBCPP_HAS_CYCLE_COUNTER_X86)
+    if (__get_cpuid_max(0, nullptr) < 0x15)
+      return 0;
+    unsigned __den, __num, __crystal, __d;
+    __cpuid(0x15, __den, __num, __crystal, __d);
+    if (__den == 0 || __num == 0 || __crystal == 0)
+      return 0;
+    return static_cast<unsigned long long>(__crystal) * __num / __den;
+#elif defined(_LIBCPP_HAS_CYCLE_COUNTER_ARM64)
+    unsigned long long __v;
+    __asm__ __volatile__("mrs %0, cntfrq_el0" : "=r"(__v));
+    return __v;
+#else
+    return 0;
+#endif
+  }
+
+  static unsigned long long __hz;
+  static bool __probed;
+};
+
+inline unsigned long long __cycle_clock::__hz = 0;
+inline bool __cycle_clock::__probed           = false;
+
+inline _LIBCPP_INLINE_VISIBILITY void __set_cycle_frequency(unsigned long long __hz) noexcept {
+  _VSTD::__libcpp_relaxed_store(&__cycle_clock::__hz, __hz);
+  _VSTD::__libcpp_atomic_store(&__cycle_clock::__probed, true, _AO_Release);
+}
+
+// Counts cycles against a reference clock for at least __span_ns.
+template <class _Clock>
+inline _LIBCPP_INLINE_VISIBILITY unsigned long long __calibrate_cycle_counter(_Clock __now_ns,
+                                                                              unsigned long long __span_ns = 10000000) {
+  const unsigned long long __t0 = __now_ns();
+  const unsigned long long __c0 = _VSTD::__cycle_count();
+  unsigned long long __t1, __c1;
+  do {
+    __t1 = __now_ns();
+    __c1 = _VSTD::__cycle_count();
+  } while (__t1 - __t0 < __span_ns);
+  const __charconv_u128 __p = _VSTD::__charconv_mul64(__c1 - __c0, 1000000000);
+  // (__p / (__t1 - __t0)), the quotient fitting in 64 bits for any real span.
+  const unsigned long long __d = __t1 - __t0;
+  unsigned long long __q = 0, __r = __p.__hi % __d;
+  for (int __i = 63; __i >= 0; --__i) {
+    const bool __top = __r >> 63;
+    __r              = (__r << 1) | ((__p.__lo >> __i) & 1);
+    if (__top || __r >= __d) {
+      __r -= __d;
+      __q |= 1ull << __i;
+    }
+  }
+  _VSTD::__set_cycle_frequency(__q);
+  return __q;
+}
+
+#if defined(_LIBCPP_HAS_CYCLE_CALIBRATION)
+struct __monotonic_clock_ns {
+  _LIBCPP_INLINE_VISIBILITY unsigned long long operator()() const noexcept {
+    timespec __ts;
+    clock_gettime(CLOCK_MONOTONIC, &__ts);
+    return static_cast<unsigned long long>(__ts.tv_sec) * 1000000000ull + static_cast<unsigned long long>(__ts.tv_nsec);
+  }
+};
+#endif
+
+inline _LIBCPP_INLINE_VISIBILITY unsigned long long __cycle_frequency() noexcept {
+  if (!_VSTD::__libcpp_atomic_load(&__cycle_clock::__probed, _AO_Acquire)) {
+    const unsigned long long __hz = __cycle_clock::__detect();
+#if defined(_LIBCPP_HAS_CYCLE_CALIBRATION)
+    // Short, as it runs once in whatever first converts a time; the error
+    // is a clock read or two in 2 ms.
+    if (__hz == 0)
+      return _VSTD::__calibrate_cycle_counter(__monotonic_clock_ns(), 2000000);
+#endif
+    _VSTD::__set_cycle_frequency(__hz);
+  }
+  return _VSTD::__libcpp_relaxed_load(&__cycle_clock::__hz);
+}
+
+// Nanoseconds per cycle in 32.32 fixed point, or 0 to take cycles as they are.
+inline _LIBCPP_INLINE_VISIBILITY unsigned long long __cycle_ns_scale() noexcept {
+  const unsigned long long __hz = _VSTD::__cycle_frequency();
+  return __hz != 0 ? (1000000000ull << 32) / __hz : 0;
+}
+
+inline _LIBCPP_INLINE_VISIBILITY unsigned long long __cycles_to_ns(unsigned long long __c,
+                                                                   unsigned long long __scale) noexcept {
+  if (__scale == 0)
+    return __c;
+  const __charconv_u128 __p = _VSTD::__charconv_mul64(__c, __scale);
+  return (__p.__hi << 32) | (__p.__lo >> 32);
+}
+
+inline _LIBCPP_INLINE_VISIBILITY unsigned long long __cycles_to_ns(unsigned long long __c) noexcept {
+  return _VSTD::__cycles_to_ns(__c, _VSTD::__cycle_ns_scale());
+}
+
+// Scoped timers
+
+#ifndef _LIBCPP_HAS_NO_INSTRUMENTATION
+class _LIBCPP_TYPE_VIS __scoped_timer {
+  unsigned long long &__cycles_;
+  unsigned long long __begin_;
+
+public:
+  _LIBCPP_INLINE_VISIBILITY explicit __scoped_timer(unsigned long long &__cycles) noexcept
+      : __cycles_(__cycles), __begin_(_VSTD::__cycle_count()) {}
+  __scoped_timer(const __scoped_timer &)            = delete;
+  __scoped_timer &operator=(const __scoped_timer &) = delete;
+  _LIBCPP_INLINE_VISIBILITY ~__scoped_timer() { __cycles_ += _VSTD::__cycle_count() - __begin_; }
+};
+#else
+class _LIBCPP_TYPE_VIS __scoped_timer {
+public:
+  _LIBCPP_INLINE_VISIBILITY explicit __scoped_timer(unsigned long long &) noexcept {}
+  __scoped_timer(const __scoped_timer &)            = delete;
+  __scoped_timer &operator=(const __scoped_timer &) = delete;
+};
+#endif // _LIBCPP_HAS_NO_INSTRUMENTATION
+
+// Trace events
+
+struct _LIBCPP_TYPE_VIS __trace_event {
+  const char *__name;
+  unsigned long long __begin;
+  unsigned long long __end;
+};
+
+template <size_t _Np> class _LIBCPP_TEMPLATE_VIS __trace_ring {
+  static_assert(_Np >= 2 && (_Np & (_Np - 1)) == 0, "__trace_ring: the size must be a power of two");
+
+  alignas(64) size_t __head_ = 0; // written by the producer
+  size_t __tail_cache_       = 0; // the producer's last look at __tail_
+  size_t __dropped_          = 0;
+  alignas(64) size_t __tail_ = 0; // written by the consumer
+  alignas(64) __trace_event __ev_[_Np];
+
+public:
+  _LIBCPP_INLINE_VISIBILITY __trace_ring() noexcept {}
+  __trace_ring(const __trace_ring &)            = delete;
+  __trace_ring &operator=(const __trace_ring &) = delete;
+
+  _LIBCPP_INLINE_VISIBILITY bool __record(const char *__name, unsigned long long __begin,
+                                          unsigned long long __end) noexcept {
+    const size_t __h = __head_;
+    if (__h - __tail_cache_ == _Np) {
+      __tail_cache_ = _VSTD::__libcpp_atomic_load(&__tail_, _AO_Acquire);
+      if (__h - __tail_cache_ == _Np) {
+        _VSTD::__libcpp_relaxed_store(&__dropped_, __dropped_ + 1);
+        return false;
+      }
+    }
+    __ev_[__h & (_Np - 1)] = __trace_event{__name, __begin, __end};
+    _VSTD::__libcpp_atomic_store(&__head_, __h + 1, _AO_Release);
+    return true;
+  }
+
+  template <class _Fn> _LIBCPP_INLINE_VISIBILITY size_t __consume(_Fn &&__f) {
+    size_t __t       = __tail_;
+    const size_t __h = _VSTD::__libcpp_atomic_load(&__head_, _AO_Acquire);
+    const size_t __n = __t;
+    for (; __t != __h && __f(static_cast<const __trace_event &>(__ev_[__t & (_Np - 1)])); ++__t)
+      ;
+    _VSTD::__libcpp_atomic_store(&__tail_, __t, _AO_Release);
+    return __t - __n;
+  }
+
+  _LIBCPP_INLINE_VISIBILITY size_t __dropped() const noexcept { return _VSTD::__libcpp_relaxed_load(&__dropped_); }
+};
+
+#ifndef _LIBCPP_HAS_NO_INSTRUMENTATION
+template <size_t _Np> class _LIBCPP_TEMPLATE_VIS __trace_scope {
+  __trace_ring<_Np> &__ring_;
+  const char *__name_;
+  unsigned long long __begin_;
+
+public:
+  _LIBCPP_INLINE_VISIBILITY __trace_scope(__trace_ring<_Np> &__ring, const char *__name) noexcept
+      : __ring_(__ring), __name_(__name), __begin_(_VSTD::__cycle_count()) {}
+  __trace_scope(const __trace_scope &)            = delete;
+  __trace_scope &operator=(const __trace_scope &) = delete;
+  _LIBCPP_INLINE_VISIBILITY ~__trace_scope() { __ring_.__record(__name_, __begin_, _VSTD::__cycle_count()); }
+};
+#else
+template <size_t _Np> class _LIBCPP_TEMPLATE_VIS __trace_scope {
+public:
+  _LIBCPP_INLINE_VISIBILITY __trace_scope(__trace_ring<_Np> &, const char *) noexcept {}
+  __trace_scope(const __trace_scope &)            = delete;
+  __trace_scope &operator=(const __trace_scope &) = delete;
+};
+#endif // _LIBCPP_HAS_NO_INSTRUMENTATION
+
+// Chrome trace JSON
+
+class _LIBCPP_TYPE_VIS __chrome_trace_writer {
+  char *__p_;
+  char *__end_; // two short of the buffer, for the closing "]}"
+  unsigned long long __base_;
+  unsigned long long __scale_;
+  bool __first_ = true;
+
+  _LIBCPP_INLINE_VISIBILITY static char *__put(char *__p, char *__end, const char *__s) noexcept {
+    for (; *__s != 0; ++__s, ++__p) {
+      if (__p == __end)
+        return nullptr;
+      *__p = *__s;
+    }
+    return __p;
+  }
+
+  _LIBCPP_INLINE_VISIBILITY static char *__put_name(char *__p, char *__end, const char *__s) noexcept {
+    static constexpr char __hex[] = "0123456789abcdef";
+    for (; *__s != 0; ++__s) {
+      const unsigned char __c = static_cast<unsigned char>(*__s);
+      if (__c == '"' || __c == '\\' || __c < 0x20) {
+        if (__end - __p < 6)
+          return nullptr;
+        *__p++ = '\\';
+        if (__c >= 0x20)
+          *__p++ = static_cast<char>(__c);
+        else {
+          __p    = __put(__p, __end, "u00");
+          *__p++ = __hex[__c >> 4];
+          *__p++ = __hex[__c & 15];
+        }
+      } else {
+        if (__p == __end)
+          return nullptr;
+        *__p++ = static_cast<char>(__c);
+      }
+    }
+    return __p;
+  }
+
+  // Microseconds with three decimals.
+  _LIBCPP_INLINE_VISIBILITY static char *__put_us(char *__p, char *__end, unsigned long long __ns) noexcept {
+    const to_chars_result __r = _VSTD::to_chars(__p, __end, __ns / 1000);
+    if (__r.ec != errc() || __end - __r.ptr < 4)
+      return nullptr;
+    const unsigned __f = static_cast<unsigned>(__ns % 1000);
+    __r.ptr[0]         = '.';
+    __r.ptr[1]         = static_cast<char>('0' + __f / 100);
+    __r.ptr[2]         = static_cast<char>('0' + __f / 10 % 10);
+    __r.ptr[3]         = static_cast<char>('0' + __f % 10);
+    return __r.ptr + 4;
+  }
+
+  _LIBCPP_INLINE_VISIBILITY char *__put_event(char *__p, const __trace_event &__e, unsigned __tid) const noexcept {
+    const unsigned long long __b = __e.__begin - __base_;
+    const unsigned long long __d = __e.__end - __e.__begin;
+    if (!__first_ && (__p = __put(__p, __end_, ",")) == nullptr)
+      return nullptr;
+    if ((__p = __put(__p, __end_, "{\"name\":\"")) == nullptr ||
+        (__p = __put_name(__p, __end_, __e.__name != nullptr ? __e.__name : "")) == nullptr ||
+        (__p = __put(__p, __end_, "\",\"ph\":\"X\",\"ts\":")) == nullptr ||
+        (__p = __put_us(__p, __end_, _VSTD::__cycles_to_ns(__b, __scale_))) == nullptr ||
+        (__p = __put(__p, __end_, ",\"dur\":")) == nullptr ||
+        (__p = __put_us(__p, __end_, _VSTD::__cycles_to_ns(__d, __scale_))) == nullptr ||
+        (__p = __put(__p, __end_, ",\"pid\":0,\"tid\":")) == nullptr)
+      return nullptr;
+    const to_chars_result __r = _VSTD::to_chars(__p, __end_, __tid);
+    if (__r.ec != errc())
+      return nullptr;
+    return __put(__r.ptr, __end_, "}");
+  }
+
+public:
+  _LIBCPP_INLINE_VISIBILITY __chrome_trace_writer(char *__first, char *__last, unsigned long long __base = 0) noexcept
+      : __p_(nullptr), __end_(__first), __base_(__base), __scale_(_VSTD::__cycle_ns_scale()) {
+    if (__last - __first >= 2) {
+      __end_ = __last - 2;
+      __p_   = __put(__first, __end_, "{\"traceEvents\":[");
+    }
+  }
+
+  template <size_t _Np> _LIBCPP_INLINE_VISIBILITY bool __append(__trace_ring<_Np> &__ring, unsigned __tid) noexcept {
+    if (__p_ == nullptr)
+      return false;
+    bool __room = true;
+    __ring.__consume([&](const __trace_event &__e) {
+      char *const __q = __put_event(__p_, __e, __tid);
+      if (__q == nullptr)
+        return __room = false;
+      __p_     = __q;
+      __first_ = false;
+      return true;
+    });
+    return __room;
+  }
+
+  _LIBCPP_INLINE_VISIBILITY char *__finish() noexcept {
+    if (__p_ == nullptr)
+      return nullptr;
+    __p_[0] = ']';
+    __p_[1] = '}';
+    return __p_ + 2;
+  }
+};
+
+_LIBCPP_END_NAMESPACE_STD
+
+#endif // _LIBCPP_STD_VER > 14
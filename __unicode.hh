@@ -0,0 +1,955 @@
+// -*- C++ -*-
+//===---------------------------- __unicode -------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+/*
+    __unicode synopsis (extension, C++17)
+
+namespace std
+{
+
+// UTF-8 code units are char or char8_t (C8 below). All functions are
+// constexpr in C++20.
+
+// The offset of the first byte of the first ill-formed sequence (one that is
+// truncated, overlong, a surrogate or above U+10FFFF), or n if there is none.
+template <class C8> size_t __utf8_first_invalid(const C8* p, size_t n) noexcept;
+template <class C8> bool   __utf8_validate(const C8* p, size_t n) noexcept;
+
+// Transcoding stops at the first ill-formed sequence: __in is the number of
+// source code units consumed (n on success, otherwise the offset of that
+// sequence) and __out the number of code units written. The destination
+// must have room for n code units (UTF-8 to UTF-16 or UTF-32), 3 * n
+// (UTF-16 to UTF-8) or 4 * n (UTF-32 to UTF-8).
+struct __utf_result { size_t __in; size_t __out; };
+
+template <class C8> __utf_result __utf8_to_utf16(const C8* src, size_t n, char16_t* dst) noexcept;
+template <class C8> __utf_result __utf8_to_utf32(const C8* src, size_t n, char32_t* dst) noexcept;
+template <class C8> __utf_result __utf16_to_utf8(const char16_t* src, size_t n, C8* dst) noexcept;
+template <class C8> __utf_result __utf32_to_utf8(const char32_t* src, size_t n, C8* dst) noexcept;
+
+}  // std
+
+*/
+
+#include "__config.hh"
+#include "bit.hh"
+#include "cstddef.hh"
+#include "type_traits.hh"
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#pragma GCC system_header
+#endif
+
+#if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_UNICODE_CHARS)
+
+#if defined(__AVX2__) || defined(__SSSE3__)
+#define _LIBCPP_HAS_UTF8_SIMD
+#include <immintrin.h>
+#endif
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+template <class _CharT> struct __is_utf8_char : _IsSame<_CharT, char> {};
+#ifndef _LIBCPP_NO_HAS_CHAR8_T
+template <> struct __is_utf8_char<char8_t> : true_type {};
+#endif
+
+template <class _CharT>
+using __enable_if_utf8_char _LIBCPP_NODEBUG_TYPE = _EnableIf<__is_utf8_char<_CharT>::value, int>;
+
+struct __utf_result {
+  size_t __in;
+  size_t __out;
+};
+
+// Whether the __n * sizeof(_Tp) bytes at __p, read as little-endian words,
+// have none of the bits in __mask set. Used to skip runs of ASCII eight
+// bytes at a time.
+template <class _Tp>
+inline _LIBCPP_INLINE_VISIBILITY bool __utf_none_of(const _Tp *__p, size_t __n, unsigned long long __mask) noexcept {
+  unsigned long long __acc = 0;
+  for (size_t __i = 0; __i != __n * sizeof(_Tp); __i += 8) {
+    unsigned long long __w;
+    __builtin_memcpy(&__w, reinterpret_cast<const unsigned char *>(__p) + __i, 8);
+    __acc |= __w;
+  }
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  __acc = __builtin_bswap64(__acc);
+#endif
+  return (__acc & __mask) == 0;
+}
+
+// The end of the run of whole blocks of 16 code units, starting at __i,
+// none of which has a bit of __mask set.
+template <class _Tp>
+inline _LIBCPP_INLINE_VISIBILITY size_t __utf_skip_ascii(const _Tp *__p, size_t __i, size_t __n,
+                                                         unsigned long long __mask) noexcept {
+  for (; __n >= 16 && __i <= __n - 16 && _VSTD::__utf_none_of(__p + __i, 16, __mask); __i += 16)
+    ;
+  return __i;
+}
+
+// Scalar decoding and encoding, one code point at a time.
+
+// Decodes the sequence at the start of [__p, __p + __n), __n > 0. Returns
+// its length, or 0 if it is ill-formed.
+template <class _CharT>
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 size_t __utf8_decode(const _CharT *__p, size_t __n,
+                                                                                    char32_t &__cp) noexcept {
+  const unsigned __b0 = static_cast<unsigned char>(__p[0]);
+  if (__b0 < 0x80) {
+    __cp = __b0;
+    return 1;
+  }
+  // Continuation bytes, and the leads C0 and C1 that can only start an
+  // overlong encoding of ASCII.
+  if (__b0 < 0xc2)
+    return 0;
+  const size_t __len = __b0 < 0xe0 ? 2 : __b0 < 0xf0 ? 3 : __b0 < 0xf5 ? 4 : 0;
+  if (__len == 0 || __n < __len)
+    return 0;
+  char32_t __c = __b0 & (0x7f >> __len);
+  for (size_t __i = 1; __i != __len; ++__i) {
+    const unsigned __b = static_cast<unsigned char>(__p[__i]);
+    if ((__b & 0xc0) != 0x80)
+      return 0;
+    __c = (__c << 6) | (__b & 0x3f);
+  }
+  if (__len == 3 && (__c < 0x800 || (__c >= 0xd800 && __c <= 0xdfff)))
+    return 0;
+  if (__len == 4 && (__c < 0x10000 || __c > 0x10ffff))
+    return 0;
+  __cp = __c;
+  return __len;
+}
+
+// __cp must be a scalar value. Returns the number of bytes written.
+template <class _CharT>
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 size_t __utf8_encode(char32_t __cp,
+                                                                                    _CharT *__dst) noexcept {
+  if (__cp < 0x80) {
+    __dst[0] = static_cast<_CharT>(__cp);
+    return 1;
+  }
+  if (__cp < 0x800) {
+    __dst[0] = static_cast<_CharT>(0xc0 | (__cp >> 6));
+    __dst[1] = static_cast<_CharT>(0x80 | (__cp & 0x3f));
+    return 2;
+  }
+  if (__cp < 0x10000) {
+    __dst[0] = static_cast<_CharT>(0xe0 | (__cp >> 12));
+    __dst[1] = static_cast<_CharT>(0x80 | ((__cp >> 6) & 0x3f));
+    __dst[2] = static_cast<_CharT>(0x80 | (__cp & 0x3f));
+    return 3;
+  }
+  __dst[0] = static_cast<_CharT>(0xf0 | (__cp >> 18));
+  __dst[1] = static_cast<_CharT>(0x80 | ((__cp >> 12) & 0x3f));
+  __dst[2] = static_cast<_CharT>(0x80 | ((__cp >> 6) & 0x3f));
+  __dst[3] = static_cast<_CharT>(0x80 | (__cp & 0x3f));
+  return 4;
+}
+
+template <class _CharT>
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 size_t __utf8_scalar_first_invalid(const _CharT *__p,
+                                                                                                  size_t __n) noexcept {
+  size_t __i = 0;
+  while (__i != __n) {
+    if (!__libcpp_is_constant_evaluated())
+      __i = _VSTD::__utf_skip_ascii(__p, __i, __n, 0x8080808080808080ull);
+    if (__i == __n)
+      break;
+    char32_t __cp      = 0;
+    const size_t __len = _VSTD::__utf8_decode(__p + __i, __n - __i, __cp);
+    if (__len == 0)
+      return __i;
+    __i += __len;
+  }
+  return __n;
+}
+
+#ifdef _LIBCPP_HAS_UTF8_SIMD
+
+// UTF-8 validation after Keiser and Lemire, "Validating UTF-8 in less than
+// one instruction per byte" (2021). Every ill-formed two-byte pattern is
+// recognised from three nibbles: the high and low nibble of the previous
+// byte and the high nibble of the current one, each looked up (PSHUFB) in a
+// 16-entry table of error classes and ANDed. Three- and four-byte sequences
+// additionally need the bytes two and three back to demand continuations.
+
+enum : unsigned char {
+  __utf8_too_short  = 1 << 0, // 11______ 0_______, 11______ 11______
+  __utf8_too_long   = 1 << 1, // 0_______ 10______
+  __utf8_overlong_3 = 1 << 2, // 11100000 100_____
+  __utf8_too_large  = 1 << 3, // 11110100 1001____, 11110100 101_____, 11110101..11111111
+  __utf8_surrogate  = 1 << 4, // 11101101 101_____
+  __utf8_overlong_2 = 1 << 5, // 1100000_ 10______
+  __utf8_large_1000 = 1 << 6, // 11110101..11111111 1000____
+  __utf8_overlong_4 = 1 << 6, // 11110000 1000____
+  __utf8_two_conts  = 1 << 7, // 10______ 10______
+  __utf8_carry      = __utf8_too_short | __utf8_too_long | __utf8_two_conts
+};
+
+alignas(16) inline constexpr unsigned char __utf8_byte1_high[16] = {
+    // 0_______: ASCII
+    __utf8_too_long, __utf8_too_long, __utf8_too_long, __utf8_too_long, __utf8_too_long, __utf8_too_long,
+    __utf8_too_long, __utf8_too_long,
+    // 10______: continuation
+    __utf8_two_conts, __utf8_two_conts, __utf8_two_conts, __utf8_two_conts,
+    // 1100____, 1101____, 1110____, 1111____: leads
+    __utf8_too_short | __utf8_overlong_2, __utf8_too_short, __utf8_too_short | __utf8_overlong_3 | __utf8_surrogate,
+    __utf8_too_short | __utf8_too_large | __utf8_large_1000 | __utf8_overlong_4};
+
+alignas(16) inline constexpr unsigned char __utf8_byte1_low[16] = {
+    // ____0000, ____0001
+    __utf8_carry | __utf8_overlong_3 | __utf8_overlong_2 | __utf8_overlong_4, __utf8_carry | __utf8_overlong_2,
+    // ____001_
+    __utf8_carry, __utf8_carry,
+    // ____0100, ____0101 and above
+    __utf8_carry | __utf8_too_large, __utf8_carry | __utf8_too_large | __utf8_large_1000,
+    __utf8_carry | __utf8_too_large | __utf8_large_1000, __utf8_carry | __utf8_too_large | __utf8_large_1000,
+    __utf8_carry | __utf8_too_large | __utf8_large_1000, __utf8_carry | __utf8_too_large | __utf8_large_1000,
+    __utf8_carry | __utf8_too_large | __utf8_large_1000, __utf8_carry | __utf8_too_large | __utf8_large_1000,
+    __utf8_carry | __utf8_too_large | __utf8_large_1000,
+    // ____1101
+    __utf8_carry | __utf8_too_large | __utf8_large_1000 | __utf8_surrogate,
+    __utf8_carry | __utf8_too_large | __utf8_large_1000, __utf8_carry | __utf8_too_large | __utf8_large_1000};
+
+alignas(16) inline constexpr unsigned char __utf8_byte2_high[16] = {
+    // ________ 0_______
+    __utf8_too_short, __utf8_too_short, __utf8_too_short, __utf8_too_short, __utf8_too_short, __utf8_too_short,
+    __utf8_too_short, __utf8_too_short,
+    // ________ 1000____
+    __utf8_too_long | __utf8_overlong_2 | __utf8_two_conts | __utf8_overlong_3 | __utf8_large_1000 |
+        __utf8_overlong_4,
+    // ________ 1001____
+    __utf8_too_long | __utf8_overlong_2 | __utf8_two_conts | __utf8_overlong_3 | __utf8_too_large,
+    // ________ 101_____
+    __utf8_too_long | __utf8_overlong_2 | __utf8_two_conts | __utf8_surrogate | __utf8_too_large,
+    __utf8_too_long | __utf8_overlong_2 | __utf8_two_conts | __utf8_surrogate | __utf8_too_large,
+    // ________ 11______
+    __utf8_too_short, __utf8_too_short, __utf8_too_short, __utf8_too_short};
+
+// A block is incomplete if its last three bytes start a sequence longer
+// than what is left of the block: saturating subtraction of these leaves a
+// nonzero byte exactly there.
+alignas(32) inline constexpr unsigned char __utf8_incomplete_max[32] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0 - 1, 0xe0 - 1, 0xc0 - 1};
+
+#if defined(__AVX2__)
+struct __utf8_simd {
+  typedef __m256i __v;
+  static const size_t __width = 32;
+
+  static _LIBCPP_INLINE_VISIBILITY __v __load(const unsigned char *__p) noexcept {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(__p));
+  }
+  static _LIBCPP_INLINE_VISIBILITY __v __table(const unsigned char *__t) noexcept {
+    return _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i *>(__t)));
+  }
+  static _LIBCPP_INLINE_VISIBILITY __v __set1(unsigned char __c) noexcept {
+    return _mm256_set1_epi8(static_cast<char>(__c));
+  }
+  static _LIBCPP_INLINE_VISIBILITY __v __zero() noexcept { return _mm256_setzero_si256(); }
+  static _LIBCPP_INLINE_VISIBILITY __v __and(__v __a, __v __b) noexcept { return _mm256_and_si256(__a, __b); }
+  static _LIBCPP_INLINE_VISIBILITY __v __or(__v __a, __v __b) noexcept { return _mm256_or_si256(__a, __b); }
+  static _LIBCPP_INLINE_VISIBILITY __v __xor(__v __a, __v __b) noexcept { return _mm256_xor_si256(__a, __b); }
+  static _LIBCPP_INLINE_VISIBILITY __v __subs(__v __a, __v __b) noexcept { return _mm256_subs_epu8(__a, __b); }
+  static _LIBCPP_INLINE_VISIBILITY __v __lookup(__v __t, __v __i) noexcept { return _mm256_shuffle_epi8(__t, __i); }
+  static _LIBCPP_INLINE_VISIBILITY __v __high_nibbles(__v __a) noexcept {
+    return _mm256_and_si256(_mm256_srli_epi16(__a, 4), __set1(0x0f));
+  }
+  // The bytes of __prev:__cur shifted up by _Np positions.
+  template <int _Np> static _LIBCPP_INLINE_VISIBILITY __v __prev(__v __cur, __v __prev) noexcept {
+    return _mm256_alignr_epi8(__cur, _mm256_permute2x128_si256(__prev, __cur, 0x21), 16 - _Np);
+  }
+  static _LIBCPP_INLINE_VISIBILITY bool __is_ascii(__v __a) noexcept { return _mm256_movemask_epi8(__a) == 0; }
+  static _LIBCPP_INLINE_VISIBILITY bool __any(__v __a) noexcept { return !_mm256_testz_si256(__a, __a); }
+};
+#else
+struct __utf8_simd {
+  typedef __m128i __v;
+  static const size_t __width = 16;
+
+  static _LIBCPP_INLINE_VISIBILITY __v __load(const unsigned char *__p) noexcept {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(__p));
+  }
+  static _LIBCPP_INLINE_VISIBILITY __v __table(const unsigned char *__t) noexcept {
+    return _mm_load_si128(reinterpret_cast<const __m128i *>(__t));
+  }
+  static _LIBCPP_INLINE_VISIBILITY __v __set1(unsigned char __c) noexcept {
+    return _mm_set1_epi8(static_cast<char>(__c));
+  }
+  static _LIBCPP_INLINE_VISIBILITY __v __zero() noexcept { return _mm_setzero_si128(); }
+  static _LIBCPP_INLINE_VISIBILITY __v __and(__v __a, __v __b) noexcept { return _mm_and_si128(__a, __b); }
+  static _LIBCPP_INLINE_VISIBILITY __v __or(__v __a, __v __b) noexcept { return _mm_or_si128(__a, __b); }
+  static _LIBCPP_INLINE_VISIBILITY __v __xor(__v __a, __v __b) noexcept { return _mm_xor_si128(__a, __b); }
+  static _LIBCPP_INLINE_VISIBILITY __v __subs(__v __a, __v __b) noexcept { return _mm_subs_epu8(__a, __b); }
+  static _LIBCPP_INLINE_VISIBILITY __v __lookup(__v __t, __v __i) noexcept { return _mm_shuffle_epi8(__t, __i); }
+  static _LIBCPP_INLINE_VISIBILITY __v __high_nibbles(__v __a) noexcept {
+    return _mm_and_si128(_mm_srli_epi16(__a, 4), __set1(0x0f));
+  }
+  template <int _Np> static _LIBCPP_INLINE_VISIBILITY __v __prev(__v __cur, __v __prev) noexcept {
+    return _mm_alignr_epi8(__cur, __prev, 16 - _Np);
+  }
+  static _LIBCPP_INLINE_VISIBILITY bool __is_ascii(__v __a) noexcept { return _mm_movemask_epi8(__a) == 0; }
+  static _LIBCPP_INLINE_VISIBILITY bool __any(__v __a) noexcept {
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(__a, __zero())) != 0xffff;
+  }
+};
+#endif
+
+// Checks [__p, __p + __n) in 64-byte blocks and returns the offset of the
+// first block in which an error was seen (or of the first byte not covered
+// by a whole block). Everything before that offset is well-formed, except
+// that it may end in a truncated sequence.
+inline _LIBCPP_INLINE_VISIBILITY size_t __utf8_simd_valid_blocks(const unsigned char *__p, size_t __n) noexcept {
+  typedef __utf8_simd _Vt;
+  typedef _Vt::__v __v;
+  const size_t __k   = 64 / _Vt::__width;
+  const __v __t1h    = _Vt::__table(__utf8_byte1_high);
+  const __v __t1l    = _Vt::__table(__utf8_byte1_low);
+  const __v __t2h    = _Vt::__table(__utf8_byte2_high);
+  const __v __lo     = _Vt::__set1(0x0f);
+  const __v __max    = _Vt::__load(__utf8_incomplete_max + 32 - _Vt::__width);
+  __v __prev         = _Vt::__zero();
+  __v __incomplete   = _Vt::__zero();
+  size_t __i         = 0;
+  for (; __n - __i >= 64; __i += 64) {
+    __v __in[__k];
+    __v __all = _Vt::__zero();
+    for (size_t __j = 0; __j != __k; ++__j) {
+      __in[__j] = _Vt::__load(__p + __i + __j * _Vt::__width);
+      __all     = _Vt::__or(__all, __in[__j]);
+    }
+    if (_Vt::__is_ascii(__all)) {
+      // Nothing here can complete a sequence left open by the last block.
+      if (_Vt::__any(__incomplete))
+        break;
+      __prev = __in[__k - 1];
+      continue;
+    }
+    __v __err = _Vt::__zero();
+    for (size_t __j = 0; __j != __k; ++__j) {
+      const __v __cur   = __in[__j];
+      const __v __prev1 = _Vt::__prev<1>(__cur, __prev);
+      const __v __sc    = _Vt::__and(_Vt::__and(_Vt::__lookup(__t1h, _Vt::__high_nibbles(__prev1)),
+                                                _Vt::__lookup(__t1l, _Vt::__and(__prev1, __lo))),
+                                     _Vt::__lookup(__t2h, _Vt::__high_nibbles(__cur)));
+      // Bytes two or three after a three- or four-byte lead must be
+      // continuations; __sc has __utf8_two_conts (bit 7) set exactly where
+      // a continuation follows a continuation.
+      const __v __must23 = _Vt::__or(_Vt::__subs(_Vt::__prev<2>(__cur, __prev), _Vt::__set1(0xe0 - 0x80)),
+                                     _Vt::__subs(_Vt::__prev<3>(__cur, __prev), _Vt::__set1(0xf0 - 0x80)));
+      __err  = _Vt::__or(__err, _Vt::__xor(_Vt::__and(__must23, _Vt::__set1(0x80)), __sc));
+      __prev = __cur;
+    }
+    if (_Vt::__any(__err))
+      break;
+    __incomplete = _Vt::__subs(__prev, __max);
+  }
+  return __i;
+}
+
+// The length of a prefix of [__p, __p + __n) that __utf8_simd_valid_blocks
+// found well-formed, backed up to the start of the sequence that straddles
+// its end, if any.
+inline _LIBCPP_INLINE_VISIBILITY size_t __utf8_simd_valid_prefix(const unsigned char *__p, size_t __n) noexcept {
+  size_t __i = _VSTD::__utf8_simd_valid_blocks(__p, __n);
+  for (size_t __back = 1; __back <= 3 && __back <= __i; ++__back) {
+    const unsigned __b = __p[__i - __back];
+    if (__b < 0x80)
+      break;
+    if (__b >= 0xc0) {
+      __i -= __back;
+      break;
+    }
+  }
+  return __i;
+}
+
+// Transcoding after Lemire and Keiser, "Transcoding billions of Unicode
+// characters per second with SIMD instructions" (2022), in 128-bit vectors
+// whatever the width of the validation. A table indexed by where sequences
+// end in an 8-byte window of UTF-8 gives the PSHUFB that moves the bytes of
+// each sequence into a lane of its own, from which shifts and masks
+// assemble the code points; in the other direction a table indexed by the
+// encoded length of four code points gives the PSHUFB that packs their
+// bytes together. The tables are computed at compile time. Four-byte
+// sequences and surrogates are left to the scalar code.
+
+struct __utf_shuffle {
+  unsigned char __shuffle[16]; // 0x80: PSHUFB writes a zero
+  unsigned char __count;       // bytes encoded
+};
+
+struct __utf_shuffle_table {
+  __utf_shuffle __e[256];
+};
+
+struct __utf_window {
+  unsigned char __pattern;  // the entry of the shuffle table
+  unsigned char __count;    // code points decoded
+  unsigned char __consumed; // bytes decoded
+};
+
+struct __utf_window_table {
+  __utf_window __e[4096];
+};
+
+// Entry __m, for the mask __m of the bytes that end a sequence in a 12-byte
+// window: the first sequences, as many as there are lanes of __width bytes
+// in a vector, and their lengths as the digits (less one) of a number in
+// base __max_len. A mask with a longer sequence among them has __count 0.
+constexpr __utf_window_table __utf8_decode_windows(size_t __width, size_t __max_len) noexcept {
+  __utf_window_table __t = {};
+  for (unsigned __m = 0; __m != 4096; ++__m) {
+    size_t __start = 0, __n = 0, __pattern = 0, __digit = 1;
+    for (size_t __j = 0; __j != 12 && __n != 16 / __width; ++__j) {
+      if (!((__m >> __j) & 1))
+        continue;
+      const size_t __len = __j + 1 - __start;
+      if (__len > __max_len) {
+        __start = __n = __pattern = 0;
+        break;
+      }
+      __pattern += (__len - 1) * __digit;
+      __digit *= __max_len;
+      ++__n;
+      __start = __j + 1;
+    }
+    __t.__e[__m] = __utf_window{static_cast<unsigned char>(__pattern), static_cast<unsigned char>(__n),
+                                static_cast<unsigned char>(__start)};
+  }
+  return __t;
+}
+
+// Entry __p, for the pattern __p of __utf8_decode_windows: each sequence to
+// a lane of __width bytes, with its last byte lowest.
+constexpr __utf_shuffle_table __utf8_decode_shuffles(size_t __width, size_t __max_len) noexcept {
+  __utf_shuffle_table __t = {};
+  for (unsigned __p = 0; __p != 256; ++__p) {
+    __utf_shuffle &__e = __t.__e[__p];
+    for (size_t __k = 0; __k != 16; ++__k)
+      __e.__shuffle[__k] = 0x80;
+    size_t __start = 0;
+    for (size_t __k = 0, __digits = __p; __k != 16 / __width; ++__k, __digits /= __max_len) {
+      const size_t __len = __digits % __max_len + 1;
+      for (size_t __b = 0; __b != __len; ++__b)
+        __e.__shuffle[__k * __width + __b] = static_cast<unsigned char>(__start + __len - 1 - __b);
+      __start += __len;
+    }
+  }
+  return __t;
+}
+
+// Entry __m, for the encoded length less one of each lane of __width bytes
+// (one bit per 16-bit lane, two per 32-bit lane; lead byte lowest): the
+// bytes of the lanes packed.
+constexpr __utf_shuffle_table __utf8_encode_shuffles(size_t __width) noexcept {
+  __utf_shuffle_table __t = {};
+  const size_t __bits     = __width / 2;
+  for (unsigned __m = 0; __m != 256; ++__m) {
+    __utf_shuffle &__e = __t.__e[__m];
+    for (size_t __k = 0; __k != 16; ++__k)
+      __e.__shuffle[__k] = 0x80;
+    size_t __o = 0;
+    for (size_t __k = 0; __k != 16 / __width; ++__k) {
+      const size_t __len = ((__m >> (__bits * __k)) & ((1u << __bits) - 1)) + 1;
+      for (size_t __b = 0; __b != __len && __len != 4; ++__b)
+        __e.__shuffle[__o++] = static_cast<unsigned char>(__width * __k + __b);
+    }
+    __e.__count = static_cast<unsigned char>(__o);
+  }
+  return __t;
+}
+
+inline constexpr __utf_window_table __utf8_16bit_windows  = _VSTD::__utf8_decode_windows(2, 2);
+inline constexpr __utf_window_table __utf8_32bit_windows  = _VSTD::__utf8_decode_windows(4, 3);
+inline constexpr __utf_shuffle_table __utf8_to_16bit_lanes = _VSTD::__utf8_decode_shuffles(2, 2);
+inline constexpr __utf_shuffle_table __utf8_to_32bit_lanes = _VSTD::__utf8_decode_shuffles(4, 3);
+inline constexpr __utf_shuffle_table __utf8_from_16bit_lanes = _VSTD::__utf8_encode_shuffles(2);
+inline constexpr __utf_shuffle_table __utf8_from_32bit_lanes = _VSTD::__utf8_encode_shuffles(4);
+
+// abcd -> 0a0b0c0d
+inline _LIBCPP_INLINE_VISIBILITY unsigned __utf_spread4(unsigned __x) noexcept {
+  return (__x & 1) | ((__x & 2) << 1) | ((__x & 4) << 2) | ((__x & 8) << 3);
+}
+
+// Stores of 16 ASCII bytes, 8 code points in 16-bit lanes or 4 in 32-bit
+// lanes, as UTF-16 or UTF-32.
+inline _LIBCPP_INLINE_VISIBILITY void __utf_store_ascii(char16_t *__d, __m128i __v) noexcept {
+  const __m128i __z = _mm_setzero_si128();
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(__d), _mm_unpacklo_epi8(__v, __z));
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(__d + 8), _mm_unpackhi_epi8(__v, __z));
+}
+inline _LIBCPP_INLINE_VISIBILITY void __utf_store_16bit(char16_t *__d, __m128i __v) noexcept {
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(__d), __v);
+}
+inline _LIBCPP_INLINE_VISIBILITY void __utf_store_32bit(char16_t *__d, __m128i __v) noexcept {
+  _mm_storel_epi64(reinterpret_cast<__m128i *>(__d),
+                   _mm_shuffle_epi8(__v, _mm_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1)));
+}
+inline _LIBCPP_INLINE_VISIBILITY void __utf_store_16bit(char32_t *__d, __m128i __v) noexcept {
+  const __m128i __z = _mm_setzero_si128();
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(__d), _mm_unpacklo_epi16(__v, __z));
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(__d + 4), _mm_unpackhi_epi16(__v, __z));
+}
+inline _LIBCPP_INLINE_VISIBILITY void __utf_store_ascii(char32_t *__d, __m128i __v) noexcept {
+  const __m128i __z = _mm_setzero_si128();
+  _VSTD::__utf_store_16bit(__d, _mm_unpacklo_epi8(__v, __z));
+  _VSTD::__utf_store_16bit(__d + 8, _mm_unpackhi_epi8(__v, __z));
+}
+inline _LIBCPP_INLINE_VISIBILITY void __utf_store_32bit(char32_t *__d, __m128i __v) noexcept {
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(__d), __v);
+}
+
+inline _LIBCPP_INLINE_VISIBILITY size_t __utf_put(char16_t *__d, char32_t __cp) noexcept {
+  if (__cp < 0x10000) {
+    __d[0] = static_cast<char16_t>(__cp);
+    return 1;
+  }
+  __d[0] = static_cast<char16_t>(0xd7c0 + (__cp >> 10));
+  __d[1] = static_cast<char16_t>(0xdc00 + (__cp & 0x3ff));
+  return 2;
+}
+inline _LIBCPP_INLINE_VISIBILITY size_t __utf_put(char32_t *__d, char32_t __cp) noexcept {
+  __d[0] = __cp;
+  return 1;
+}
+
+// Decodes one window: the sequences that end at the bits of __ends (within
+// the first 12 bytes of __in, none longer than three bytes) go to lanes of
+// 16 bits if none is longer than two, of 32 otherwise. Returns the number
+// of code units written and sets __consumed to the bytes decoded.
+template <class _Out>
+inline _LIBCPP_INLINE_VISIBILITY size_t __utf8_simd_decode_window(__m128i __in, unsigned __ends, bool __three,
+                                                                  _Out *__dst, size_t &__consumed) noexcept {
+  if (!__three) {
+    const __utf_window __w = __utf8_16bit_windows.__e[__ends];
+    // 110abcde 10fghijk -> 00000abc defghijk, 0abcdefg -> itself.
+    const __m128i __v = _mm_shuffle_epi8(
+        __in, _mm_loadu_si128(reinterpret_cast<const __m128i *>(__utf8_to_16bit_lanes.__e[__w.__pattern].__shuffle)));
+    _VSTD::__utf_store_16bit(__dst, _mm_or_si128(_mm_and_si128(__v, _mm_set1_epi16(0x7f)),
+                                                 _mm_and_si128(_mm_srli_epi16(__v, 2), _mm_set1_epi16(0x7c0))));
+    __consumed = __w.__consumed;
+    return __w.__count;
+  }
+  const __utf_window __w = __utf8_32bit_windows.__e[__ends];
+  // 1110abcd 10efghij 10klmnop -> abcdefgh ijklmnop; the lead of a two-byte
+  // sequence, 110_____, keeps its five bits under 0x3f too.
+  const __m128i __v = _mm_shuffle_epi8(
+      __in, _mm_loadu_si128(reinterpret_cast<const __m128i *>(__utf8_to_32bit_lanes.__e[__w.__pattern].__shuffle)));
+  _VSTD::__utf_store_32bit(__dst, _mm_or_si128(_mm_or_si128(_mm_and_si128(__v, _mm_set1_epi32(0x7f)),
+                                                            _mm_and_si128(_mm_srli_epi32(__v, 2), _mm_set1_epi32(0xfc0))),
+                                               _mm_and_si128(_mm_srli_epi32(__v, 4), _mm_set1_epi32(0xf000))));
+  __consumed = __w.__consumed;
+  return __w.__count;
+}
+
+// Decodes [__p, __p + __n), which must be well-formed and complete, and
+// returns the number of code units written. A step reads 16 bytes and
+// writes at most 16 code units, never more than the bytes it starts from.
+//
+// The masks of a 64-byte block are computed at once, so that each window
+// depends on the one before only through its offset into them, not through
+// a load and a move mask of its own bytes as well. The last bytes of the
+// region, fewer than a block and its overhang, go window by window.
+template <class _Out>
+inline _LIBCPP_INLINE_VISIBILITY size_t __utf8_simd_decode(const unsigned char *__p, size_t __n, _Out *__dst) noexcept {
+  typedef unsigned long long _Mask;
+  size_t __i = 0, __o = 0;
+  // Continuations are 0x80 to 0xbf, below -64 as signed; leads of three- and
+  // four-byte sequences are 0xe0 and 0xf0 and up, above -33 and -17 (as are
+  // ASCII bytes, which __high takes out).
+  const __m128i __c0 = _mm_set1_epi8(-64), __c3 = _mm_set1_epi8(-33), __c4 = _mm_set1_epi8(-17);
+  while (__n - __i >= 72) {
+    __m128i __in[4];
+    _Mask __high = 0, __cont = 0, __lead3 = 0, __lead4 = 0;
+    for (int __k = 0; __k != 4; ++__k) {
+      __in[__k] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(__p + __i + 16 * __k));
+      __high |= static_cast<_Mask>(static_cast<unsigned>(_mm_movemask_epi8(__in[__k]))) << (16 * __k);
+      __cont |= static_cast<_Mask>(static_cast<unsigned>(_mm_movemask_epi8(_mm_cmplt_epi8(__in[__k], __c0))))
+                << (16 * __k);
+      __lead3 |= static_cast<_Mask>(static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpgt_epi8(__in[__k], __c3))))
+                 << (16 * __k);
+      __lead4 |= static_cast<_Mask>(static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpgt_epi8(__in[__k], __c4))))
+                 << (16 * __k);
+    }
+    if (__high == 0) {
+      for (int __k = 0; __k != 4; ++__k)
+        _VSTD::__utf_store_ascii(__dst + __o + 16 * __k, __in[__k]);
+      __i += 64;
+      __o += 64;
+      continue;
+    }
+    // A byte ends a sequence when the next one is not a continuation. The
+    // windows, at offsets below 52, see bits 0 to 62 of the masks.
+    const _Mask __ends = ~(__cont >> 1);
+    __lead3 &= __high;
+    __lead4 &= __high;
+    size_t __pos = 0;
+    while (__pos < 52) {
+      const unsigned char *const __w = __p + __i + __pos;
+      if (__pos <= 48 && ((__high >> __pos) & 0xffff) == 0) {
+        _VSTD::__utf_store_ascii(__dst + __o, _mm_loadu_si128(reinterpret_cast<const __m128i *>(__w)));
+        __pos += 16;
+        __o += 16;
+        continue;
+      }
+      // Up to the first four-byte sequence, which is decoded on its own.
+      const unsigned __l4 = static_cast<unsigned>(__lead4 >> __pos) & 0xfff;
+      if (__l4 & 1) {
+        char32_t __cp = 0;
+        __pos += _VSTD::__utf8_decode(__w, 4, __cp);
+        __o += _VSTD::__utf_put(__dst + __o, __cp);
+        continue;
+      }
+      const unsigned __limit = __l4 ? (1u << _VSTD::__libcpp_ctz(__l4)) - 1 : 0xfff;
+      size_t __consumed;
+      __o += _VSTD::__utf8_simd_decode_window(_mm_loadu_si128(reinterpret_cast<const __m128i *>(__w)),
+                                              static_cast<unsigned>(__ends >> __pos) & __limit,
+                                              (static_cast<unsigned>(__lead3 >> __pos) & __limit) != 0, __dst + __o,
+                                              __consumed);
+      __pos += __consumed;
+    }
+    __i += __pos;
+  }
+  while (__i != __n) {
+    if (__n - __i >= 16) {
+      const __m128i __in    = _mm_loadu_si128(reinterpret_cast<const __m128i *>(__p + __i));
+      const unsigned __high = static_cast<unsigned>(_mm_movemask_epi8(__in));
+      const unsigned __l4   = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpgt_epi8(__in, __c4))) & __high & 0xfff;
+      if (!(__l4 & 1)) {
+        const unsigned __limit = __l4 ? (1u << _VSTD::__libcpp_ctz(__l4)) - 1 : 0xfff;
+        const unsigned __ends =
+            ~(static_cast<unsigned>(_mm_movemask_epi8(_mm_cmplt_epi8(__in, __c0))) >> 1) & __limit;
+        const unsigned __l3 = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpgt_epi8(__in, __c3))) & __high;
+        size_t __consumed;
+        __o += _VSTD::__utf8_simd_decode_window(__in, __ends, (__l3 & __limit) != 0, __dst + __o, __consumed);
+        __i += __consumed;
+        continue;
+      }
+    }
+    // A four-byte sequence, or the last few bytes.
+    char32_t __cp = 0;
+    __i += _VSTD::__utf8_decode(__p + __i, __n - __i, __cp);
+    __o += _VSTD::__utf_put(__dst + __o, __cp);
+  }
+  return __o;
+}
+
+// Validates [__p, __p + __n) in chunks of at most 4 KB, each decoded while
+// it is still in L1, until a chunk has no valid prefix: an error, or fewer
+// than 64 bytes left. The caller's scalar loop goes on from there.
+template <class _Out>
+inline _LIBCPP_INLINE_VISIBILITY __utf_result __utf8_simd_transcode(const unsigned char *__p, size_t __n,
+                                                                    _Out *__dst) noexcept {
+  size_t __i = 0, __o = 0;
+  for (;;) {
+    const size_t __v = _VSTD::__utf8_simd_valid_prefix(__p + __i, __n - __i < 4096 ? __n - __i : 4096);
+    if (__v == 0)
+      break;
+    __o += _VSTD::__utf8_simd_decode(__p + __i, __v, __dst + __o);
+    __i += __v;
+  }
+  return __utf_result{__i, __o};
+}
+
+// Encodes the eight code points in the 16-bit lanes of __c, each below
+// U+0800. Stores 16 bytes and returns how many of them are the encoding.
+inline _LIBCPP_INLINE_VISIBILITY size_t __utf8_simd_encode8(__m128i __c, unsigned char *__dst) noexcept {
+  const __m128i __two = _mm_or_si128(
+      _mm_or_si128(_mm_srli_epi16(__c, 6), _mm_set1_epi16(0xc0)),
+      _mm_slli_epi16(_mm_or_si128(_mm_and_si128(__c, _mm_set1_epi16(0x3f)), _mm_set1_epi16(0x80)), 8));
+  const __m128i __is1 = _mm_cmplt_epi16(__c, _mm_set1_epi16(0x80));
+  const __m128i __enc = _mm_or_si128(_mm_and_si128(__is1, __c), _mm_andnot_si128(__is1, __two));
+  const unsigned __m  = ~static_cast<unsigned>(_mm_movemask_epi8(_mm_packs_epi16(__is1, __is1))) & 0xff;
+  const __utf_shuffle &__e = __utf8_from_16bit_lanes.__e[__m];
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(__dst),
+                   _mm_shuffle_epi8(__enc, _mm_loadu_si128(reinterpret_cast<const __m128i *>(__e.__shuffle))));
+  return __e.__count;
+}
+
+// Encodes the four code points in the 32-bit lanes of __c, each below
+// U+10000 and not a surrogate. Stores 16 bytes and returns how many of them
+// are the encoding.
+inline _LIBCPP_INLINE_VISIBILITY size_t __utf8_simd_encode4(__m128i __c, unsigned char *__dst) noexcept {
+  const __m128i __six  = _mm_set1_epi32(0x3f);
+  const __m128i __cont = _mm_set1_epi32(0x80);
+  const __m128i __last = _mm_or_si128(_mm_and_si128(__c, __six), __cont);
+  const __m128i __mid  = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(__c, 6), __six), __cont);
+  const __m128i __two  = _mm_or_si128(_mm_or_si128(_mm_srli_epi32(__c, 6), _mm_set1_epi32(0xc0)), _mm_slli_epi32(__last, 8));
+  const __m128i __three =
+      _mm_or_si128(_mm_or_si128(_mm_srli_epi32(__c, 12), _mm_set1_epi32(0xe0)),
+                   _mm_or_si128(_mm_slli_epi32(__mid, 8), _mm_slli_epi32(__last, 16)));
+  const __m128i __is1 = _mm_cmplt_epi32(__c, _mm_set1_epi32(0x80));
+  const __m128i __is2 = _mm_cmplt_epi32(__c, _mm_set1_epi32(0x800));
+  const __m128i __enc = _mm_or_si128(_mm_and_si128(__is1, __c),
+                                     _mm_andnot_si128(__is1, _mm_or_si128(_mm_and_si128(__is2, __two),
+                                                                          _mm_andnot_si128(__is2, __three))));
+  // The length less one is the number of the two tests that fail, put in
+  // two bits per lane.
+  const unsigned __n1 = ~static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(__is1))) & 0xf;
+  const unsigned __n2 = ~static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(__is2))) & 0xf;
+  const unsigned __m  = _VSTD::__utf_spread4(__n1) + _VSTD::__utf_spread4(__n2);
+  const __utf_shuffle &__e = __utf8_from_32bit_lanes.__e[__m];
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(__dst),
+                   _mm_shuffle_epi8(__enc, _mm_loadu_si128(reinterpret_cast<const __m128i *>(__e.__shuffle))));
+  return __e.__count;
+}
+
+// Encodes while at least 12 code units are left (so that the 16-byte stores
+// stay within the 3 * n bytes of the destination) and the next 8 have no
+// unpaired surrogate: 8 at a time below U+0800, 4 at a time above, and 8
+// one at a time where there are surrogates, so that text with a pair every
+// few code units stays in this loop.
+inline _LIBCPP_INLINE_VISIBILITY __utf_result __utf16_simd_to_utf8(const char16_t *__p, size_t __n,
+                                                                   unsigned char *__dst) noexcept {
+  const __m128i __z = _mm_setzero_si128();
+  size_t __i = 0, __o = 0;
+  while (__n - __i >= 12) {
+    const __m128i __in = _mm_loadu_si128(reinterpret_cast<const __m128i *>(__p + __i));
+    if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(__in, _mm_set1_epi16(static_cast<short>(0xff80))), __z)) ==
+        0xffff) {
+      _mm_storel_epi64(reinterpret_cast<__m128i *>(__dst + __o), _mm_packus_epi16(__in, __in));
+      __i += 8;
+      __o += 8;
+      continue;
+    }
+    const __m128i __top = _mm_and_si128(__in, _mm_set1_epi16(static_cast<short>(0xf800)));
+    if (_mm_movemask_epi8(_mm_cmpeq_epi16(__top, __z)) == 0xffff) {
+      __o += _VSTD::__utf8_simd_encode8(__in, __dst + __o);
+      __i += 8;
+      continue;
+    }
+    if (_mm_movemask_epi8(_mm_cmpeq_epi16(__top, _mm_set1_epi16(static_cast<short>(0xd800)))) != 0) {
+      for (const size_t __e = __i + 8; __i < __e;) {
+        char32_t __cp = __p[__i];
+        if (__cp >= 0xd800 && __cp <= 0xdfff) {
+          if (__cp >= 0xdc00 || __p[__i + 1] < 0xdc00 || __p[__i + 1] > 0xdfff)
+            return __utf_result{__i, __o};
+          __cp = 0x10000 + ((__cp - 0xd800) << 10) + (__p[++__i] - 0xdc00);
+        }
+        __o += _VSTD::__utf8_encode(__cp, __dst + __o);
+        ++__i;
+      }
+      continue;
+    }
+    __o += _VSTD::__utf8_simd_encode4(_mm_unpacklo_epi16(__in, __z), __dst + __o);
+    __o += _VSTD::__utf8_simd_encode4(_mm_unpackhi_epi16(__in, __z), __dst + __o);
+    __i += 8;
+  }
+  return __utf_result{__i, __o};
+}
+
+// Encodes while at least 8 code points are left and valid: 8 at a time
+// below U+0800, 4 at a time below U+10000, and 4 one at a time where there
+// are supplementary ones.
+inline _LIBCPP_INLINE_VISIBILITY __utf_result __utf32_simd_to_utf8(const char32_t *__p, size_t __n,
+                                                                   unsigned char *__dst) noexcept {
+  const __m128i __z = _mm_setzero_si128();
+  size_t __i = 0, __o = 0;
+  while (__n - __i >= 8) {
+    const __m128i __a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(__p + __i));
+    const __m128i __b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(__p + __i + 4));
+    const __m128i __ab = _mm_or_si128(__a, __b);
+    if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(__ab, _mm_set1_epi32(~0x7f)), __z)) == 0xffff) {
+      _mm_storel_epi64(reinterpret_cast<__m128i *>(__dst + __o), _mm_packus_epi16(_mm_packs_epi32(__a, __b), __z));
+      __i += 8;
+      __o += 8;
+      continue;
+    }
+    if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(__ab, _mm_set1_epi32(~0x7ff)), __z)) == 0xffff) {
+      __o += _VSTD::__utf8_simd_encode8(_mm_packs_epi32(__a, __b), __dst + __o);
+      __i += 8;
+      continue;
+    }
+    const __m128i __bad = _mm_or_si128(
+        _mm_cmpeq_epi32(_mm_cmpeq_epi32(_mm_srli_epi32(__a, 16), __z), __z),
+        _mm_cmpeq_epi32(_mm_and_si128(__a, _mm_set1_epi32(0xf800)), _mm_set1_epi32(0xd800)));
+    if (_mm_movemask_epi8(__bad) != 0) {
+      for (const size_t __e = __i + 4; __i != __e; ++__i) {
+        const char32_t __cp = __p[__i];
+        if (__cp > 0x10ffff || (__cp >= 0xd800 && __cp <= 0xdfff))
+          return __utf_result{__i, __o};
+        __o += _VSTD::__utf8_encode(__cp, __dst + __o);
+      }
+      continue;
+    }
+    __o += _VSTD::__utf8_simd_encode4(__a, __dst + __o);
+    __i += 4;
+  }
+  return __utf_result{__i, __o};
+}
+
+#endif // _LIBCPP_HAS_UTF8_SIMD
+
+template <class _CharT, __enable_if_utf8_char<_CharT> = 0>
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 size_t __utf8_first_invalid(const _CharT *__p,
+                                                                                           size_t __n) noexcept {
+#ifdef _LIBCPP_HAS_UTF8_SIMD
+  if (!__libcpp_is_constant_evaluated()) {
+    const size_t __i = _VSTD::__utf8_simd_valid_prefix(reinterpret_cast<const unsigned char *>(__p), __n);
+    return __i + _VSTD::__utf8_scalar_first_invalid(__p + __i, __n - __i);
+  }
+#endif
+  return _VSTD::__utf8_scalar_first_invalid(__p, __n);
+}
+
+template <class _CharT, __enable_if_utf8_char<_CharT> = 0>
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 bool __utf8_validate(const _CharT *__p,
+                                                                                   size_t __n) noexcept {
+  return _VSTD::__utf8_first_invalid(__p, __n) == __n;
+}
+
+// Transcoding. With the vector kernels each loop hands them as much as they
+// take and decodes or encodes one code point at a time where they stop;
+// without, it copies runs of ASCII 16 code units at a time and decodes or
+// encodes the rest one code point at a time.
+
+template <class _CharT, __enable_if_utf8_char<_CharT> = 0>
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 __utf_result
+__utf8_to_utf16(const _CharT *__src, size_t __n, char16_t *__dst) noexcept {
+  size_t __i = 0, __o = 0;
+#ifdef _LIBCPP_HAS_UTF8_SIMD
+  size_t __scalar = 0; // the end of a stretch the kernel could not take
+#endif
+  while (__i != __n) {
+    if (!__libcpp_is_constant_evaluated()) {
+#ifdef _LIBCPP_HAS_UTF8_SIMD
+      if (__i >= __scalar) {
+        const __utf_result __r =
+            _VSTD::__utf8_simd_transcode(reinterpret_cast<const unsigned char *>(__src + __i), __n - __i, __dst + __o);
+        __i += __r.__in;
+        __o += __r.__out;
+        if (__r.__in == 0)
+          __scalar = __i + 64;
+      }
+#else
+      for (const size_t __e = _VSTD::__utf_skip_ascii(__src, __i, __n, 0x8080808080808080ull); __i != __e; ++__i, ++__o)
+        __dst[__o] = static_cast<unsigned char>(__src[__i]);
+#endif
+    }
+    if (__i == __n)
+      break;
+    char32_t __cp      = 0;
+    const size_t __len = _VSTD::__utf8_decode(__src + __i, __n - __i, __cp);
+    if (__len == 0)
+      break;
+    if (__cp < 0x10000)
+      __dst[__o++] = static_cast<char16_t>(__cp);
+    else {
+      __dst[__o++] = static_cast<char16_t>(0xd7c0 + (__cp >> 10));
+      __dst[__o++] = static_cast<char16_t>(0xdc00 + (__cp & 0x3ff));
+    }
+    __i += __len;
+  }
+  return __utf_result{__i, __o};
+}
+
+template <class _CharT, __enable_if_utf8_char<_CharT> = 0>
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 __utf_result
+__utf8_to_utf32(const _CharT *__src, size_t __n, char32_t *__dst) noexcept {
+  size_t __i = 0, __o = 0;
+#ifdef _LIBCPP_HAS_UTF8_SIMD
+  size_t __scalar = 0; // the end of a stretch the kernel could not take
+#endif
+  while (__i != __n) {
+    if (!__libcpp_is_constant_evaluated()) {
+#ifdef _LIBCPP_HAS_UTF8_SIMD
+      if (__i >= __scalar) {
+        const __utf_result __r =
+            _VSTD::__utf8_simd_transcode(reinterpret_cast<const unsigned char *>(__src + __i), __n - __i, __dst + __o);
+        __i += __r.__in;
+        __o += __r.__out;
+        if (__r.__in == 0)
+          __scalar = __i + 64;
+      }
+#else
+      for (const size_t __e = _VSTD::__utf_skip_ascii(__src, __i, __n, 0x8080808080808080ull); __i != __e; ++__i, ++__o)
+        __dst[__o] = static_cast<unsigned char>(__src[__i]);
+#endif
+    }
+    if (__i == __n)
+      break;
+    const size_t __len = _VSTD::__utf8_decode(__src + __i, __n - __i, __dst[__o]);
+    if (__len == 0)
+      break;
+    ++__o;
+    __i += __len;
+  }
+  return __utf_result{__i, __o};
+}
+
+template <class _CharT, __enable_if_utf8_char<_CharT> = 0>
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 __utf_result
+__utf16_to_utf8(const char16_t *__src, size_t __n, _CharT *__dst) noexcept {
+  size_t __i = 0, __o = 0;
+  while (__i != __n) {
+    if (!__libcpp_is_constant_evaluated()) {
+#ifdef _LIBCPP_HAS_UTF8_SIMD
+      const __utf_result __r =
+          _VSTD::__utf16_simd_to_utf8(__src + __i, __n - __i, reinterpret_cast<unsigned char *>(__dst + __o));
+      __i += __r.__in;
+      __o += __r.__out;
+#else
+      for (const size_t __e = _VSTD::__utf_skip_ascii(__src, __i, __n, 0xff80ff80ff80ff80ull); __i != __e; ++__i, ++__o)
+        __dst[__o] = static_cast<_CharT>(__src[__i]);
+#endif
+    }
+    if (__i == __n)
+      break;
+    char32_t __cp = __src[__i];
+    size_t __len  = 1;
+    if (__cp >= 0xd800 && __cp <= 0xdfff) {
+      // A high surrogate followed by a low one; anything else is unpaired.
+      if (__cp >= 0xdc00 || __n - __i < 2 || __src[__i + 1] < 0xdc00 || __src[__i + 1] > 0xdfff)
+        break;
+      __cp  = 0x10000 + ((__cp - 0xd800) << 10) + (__src[__i + 1] - 0xdc00);
+      __len = 2;
+    }
+    __o += _VSTD::__utf8_encode(__cp, __dst + __o);
+    __i += __len;
+  }
+  return __utf_result{__i, __o};
+}
+
+template <class _CharT, __enable_if_utf8_char<_CharT> = 0>
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 __utf_result
+__utf32_to_utf8(const char32_t *__src, size_t __n, _CharT *__dst) noexcept {
+  size_t __i = 0, __o = 0;
+  while (__i != __n) {
+    if (!__libcpp_is_constant_evaluated()) {
+#ifdef _LIBCPP_HAS_UTF8_SIMD
+      const __utf_result __r =
+          _VSTD::__utf32_simd_to_utf8(__src + __i, __n - __i, reinterpret_cast<unsigned char *>(__dst + __o));
+      __i += __r.__in;
+      __o += __r.__out;
+#else
+      for (const size_t __e = _VSTD::__utf_skip_ascii(__src, __i, __n, 0xffffff80ffffff80ull); __i != __e; ++__i, ++__o)
+        __dst[__o] = static_cast<_CharT>(__src[__i]);
+#endif
+    }
+    if (__i == __n)
+      break;
+    const char32_t __cp = __src[__i];
+    if (__cp > 0x10ffff || (__cp >= 0xd800 && __cp <= 0xdfff))
+      break;
+    __o += _VSTD::__utf8_encode(__cp, __dst + __o);
+    ++__i;
+  }
+  return __utf_result{__i, __o};
+}
+
+_LIBCPP_END_NAMESPACE_STD
+
+#endif // _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_UNICODE_CHARS)
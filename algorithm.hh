@@ -0,0 +1,270 @@
+// -*- C++ -*-
+//===-------------------------- algorithm ---------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+/*
+    algorithm synopsis
+
+namespace std
+{
+
+template <class InputIterator1, class InputIterator2>
+    constexpr bool      // constexpr in C++20
+    equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2);
+
+template <class InputIterator1, class InputIterator2>
+    constexpr bool      // constexpr in C++20
+    equal(InputIterator1 first1, InputIterator1 last1,
+          InputIterator2 first2, InputIterator2 last2); // **C++14**
+
+template <class InputIterator1, class InputIterator2, class BinaryPredicate>
+    constexpr bool      // constexpr in C++20
+    equal(InputIterator1 first1, InputIterator1 last1,
+          InputIterator2 first2, BinaryPredicate pred);
+
+template <class InputIterator1, class InputIterator2, class BinaryPredicate>
+    constexpr bool      // constexpr in C++20
+    equal(InputIterator1 first1, InputIterator1 last1,
+          InputIterator2 first2, InputIterator2 last2,
+          BinaryPredicate pred); // **C++14**
+
+template <class InputIterator1, class InputIterator2>
+    constexpr bool      // constexpr in C++20
+    lexicographical_compare(InputIterator1 first1, InputIterator1 last1,
+                            InputIterator2 first2, InputIterator2 last2);
+
+template <class InputIterator1, class InputIterator2, class Compare>
+    constexpr bool      // constexpr in C++20
+    lexicographical_compare(InputIterator1 first1, InputIterator1 last1,
+                            InputIterator2 first2, InputIterator2 last2, Compare comp);
+
+// extensions
+template <class T> struct __enable_bytewise_equality : false_type {};
+template <class T> constexpr bool __object_equal(const T& x, const T& y);  // constexpr in C++20
+
+}  // std
+
+*/
+
+#include "__config.hh"
+#include "cstddef.hh"
+#include "type_traits.hh"
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#pragma GCC system_header
+#endif
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+// __is_bytewise_equality_comparable
+
+// Specialize to true_type for a class or enumeration type whose operator==
+// compares every byte of the object. A user-defined operator== may ignore some
+// members, so class types are never assumed to qualify. The opt-in is only
+// honoured when the type has unique object representations, i.e. no padding.
+template <class _Tp> struct __enable_bytewise_equality : false_type {};
+
+template <class _Tp>
+struct __is_bytewise_equality_comparable_imp
+    : _Or<is_integral<_Tp>, is_pointer<_Tp>,
+#if _LIBCPP_STD_VER > 14
+          _IsSame<_Tp, byte>,
+#endif
+#if _LIBCPP_STD_VER > 14 && defined(_LIBCPP_HAS_UNIQUE_OBJECT_REPRESENTATIONS)
+          _And<__enable_bytewise_equality<_Tp>, has_unique_object_representations<_Tp>>
+#else
+          false_type
+#endif
+          > {
+};
+
+// Whether `[__first1, __last1) == [__first2, ...)` may be decided by memcmp.
+// Floating-point types are excluded (-0.0 == 0.0, NaN != NaN), as is
+// volatile memory.
+template <class _Tp, class _Up>
+struct __is_bytewise_equality_comparable
+    : _And<_IsSame<typename remove_const<_Tp>::type, typename remove_const<_Up>::type>, _Not<is_volatile<_Tp>>,
+           __is_bytewise_equality_comparable_imp<typename remove_const<_Tp>::type>> {};
+
+// memcmp orders bytes as unsigned char, so only one-byte types with that
+// ordering may be compared lexicographically with it.
+template <class _Tp>
+struct __is_bytewise_less_comparable_imp
+    : _Or<_IsSame<_Tp, unsigned char>, _IsSame<_Tp, bool>, _BoolConstant<_IsSame<_Tp, char>::value && (char(-1) > 0)>,
+#ifndef _LIBCPP_NO_HAS_CHAR8_T
+          _IsSame<_Tp, char8_t>,
+#endif
+#if _LIBCPP_STD_VER > 14
+          _IsSame<_Tp, byte>
+#else
+          false_type
+#endif
+          > {
+};
+
+template <class _Tp, class _Up>
+struct __is_bytewise_less_comparable
+    : _And<_IsSame<typename remove_const<_Tp>::type, typename remove_const<_Up>::type>, _Not<is_volatile<_Tp>>,
+           __is_bytewise_less_comparable_imp<typename remove_const<_Tp>::type>> {};
+
+// equal
+
+template <class _InputIterator1, class _InputIterator2, class _BinaryPredicate>
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 bool
+equal(_InputIterator1 __first1, _InputIterator1 __last1, _InputIterator2 __first2, _BinaryPredicate __pred) {
+  for (; __first1 != __last1; ++__first1, (void)++__first2)
+    if (!__pred(*__first1, *__first2))
+      return false;
+  return true;
+}
+
+template <class _InputIterator1, class _InputIterator2>
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 bool __equal(_InputIterator1 __first1,
+                                                                            _InputIterator1 __last1,
+                                                                            _InputIterator2 __first2) {
+  for (; __first1 != __last1; ++__first1, (void)++__first2)
+    if (!(*__first1 == *__first2))
+      return false;
+  return true;
+}
+
+template <class _Tp, class _Up, class = _EnableIf<__is_bytewise_equality_comparable<_Tp, _Up>::value>>
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 bool __equal(_Tp *__first1, _Tp *__last1,
+                                                                            _Up *__first2) {
+  if (__libcpp_is_constant_evaluated()) {
+    for (; __first1 != __last1; ++__first1, (void)++__first2)
+      if (!(*__first1 == *__first2))
+        return false;
+    return true;
+  }
+  const size_t __n = static_cast<size_t>(__last1 - __first1);
+  return __n == 0 || __builtin_memcmp(__first1, __first2, __n * sizeof(_Tp)) == 0;
+}
+
+template <class _InputIterator1, class _InputIterator2>
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 bool equal(_InputIterator1 __first1,
+                                                                          _InputIterator1 __last1,
+                                                                          _InputIterator2 __first2) {
+  return _VSTD::__equal(__first1, __last1, __first2);
+}
+
+#if _LIBCPP_STD_VER > 11
+template <class _InputIterator1, class _InputIterator2, class _BinaryPredicate>
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 bool
+equal(_InputIterator1 __first1, _InputIterator1 __last1, _InputIterator2 __first2, _InputIterator2 __last2,
+      _BinaryPredicate __pred) {
+  for (; __first1 != __last1 && __first2 != __last2; ++__first1, (void)++__first2)
+    if (!__pred(*__first1, *__first2))
+      return false;
+  return __first1 == __last1 && __first2 == __last2;
+}
+
+template <class _InputIterator1, class _InputIterator2>
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 bool
+__equal(_InputIterator1 __first1, _InputIterator1 __last1, _InputIterator2 __first2, _InputIterator2 __last2) {
+  for (; __first1 != __last1 && __first2 != __last2; ++__first1, (void)++__first2)
+    if (!(*__first1 == *__first2))
+      return false;
+  return __first1 == __last1 && __first2 == __last2;
+}
+
+template <class _Tp, class _Up, class = _EnableIf<__is_bytewise_equality_comparable<_Tp, _Up>::value>>
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 bool __equal(_Tp *__first1, _Tp *__last1,
+                                                                            _Up *__first2, _Up *__last2) {
+  if (__last1 - __first1 != __last2 - __first2)
+    return false;
+  return _VSTD::__equal(__first1, __last1, __first2);
+}
+
+template <class _InputIterator1, class _InputIterator2>
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 bool
+equal(_InputIterator1 __first1, _InputIterator1 __last1, _InputIterator2 __first2, _InputIterator2 __last2) {
+  return _VSTD::__equal(__first1, __last1, __first2, __last2);
+}
+#endif
+
+// lexicographical_compare
+
+template <class _InputIterator1, class _InputIterator2, class _Compare>
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 bool
+lexicographical_compare(_InputIterator1 __first1, _InputIterator1 __last1, _InputIterator2 __first2,
+                        _InputIterator2 __last2, _Compare __comp) {
+  for (; __first2 != __last2; ++__first1, (void)++__first2) {
+    if (__first1 == __last1 || __comp(*__first1, *__first2))
+      return true;
+    if (__comp(*__first2, *__first1))
+      return false;
+  }
+  return false;
+}
+
+template <class _InputIterator1, class _InputIterator2>
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 bool
+__lexicographical_compare(_InputIterator1 __first1, _InputIterator1 __last1, _InputIterator2 __first2,
+                          _InputIterator2 __last2) {
+  for (; __first2 != __last2; ++__first1, (void)++__first2) {
+    if (__first1 == __last1 || *__first1 < *__first2)
+      return true;
+    if (*__first2 < *__first1)
+      return false;
+  }
+  return false;
+}
+
+template <class _Tp, class _Up, class = _EnableIf<__is_bytewise_less_comparable<_Tp, _Up>::value>>
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 bool
+__lexicographical_compare(_Tp *__first1, _Tp *__last1, _Up *__first2, _Up *__last2) {
+  if (__libcpp_is_constant_evaluated()) {
+    for (; __first2 != __last2; ++__first1, (void)++__first2) {
+      if (__first1 == __last1 || *__first1 < *__first2)
+        return true;
+      if (*__first2 < *__first1)
+        return false;
+    }
+    return false;
+  }
+  const size_t __n1 = static_cast<size_t>(__last1 - __first1);
+  const size_t __n2 = static_cast<size_t>(__last2 - __first2);
+  const size_t __n  = __n1 < __n2 ? __n1 : __n2;
+  const int __r     = __n == 0 ? 0 : __builtin_memcmp(__first1, __first2, __n);
+  return __r != 0 ? __r < 0 : __n1 < __n2;
+}
+
+template <class _InputIterator1, class _InputIterator2>
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 bool
+lexicographical_compare(_InputIterator1 __first1, _InputIterator1 __last1, _InputIterator2 __first2,
+                        _InputIterator2 __last2) {
+  return _VSTD::__lexicographical_compare(__first1, __last1, __first2, __last2);
+}
+
+// __object_equal
+
+// Compares two objects with operator==, or with memcmp when that is known to
+// give the same answer.
+template <class _Tp>
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 bool __object_equal(const _Tp &__x, const _Tp &__y,
+                                                                                   false_type) {
+  return __x == __y;
+}
+
+template <class _Tp>
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 bool __object_equal(const _Tp &__x, const _Tp &__y,
+                                                                                   true_type) {
+  if (__libcpp_is_constant_evaluated())
+    return __x == __y;
+  return __builtin_memcmp(_VSTD::addressof(__x), _VSTD::addressof(__y), sizeof(_Tp)) == 0;
+}
+
+template <class _Tp>
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 bool __object_equal(const _Tp &__x, const _Tp &__y) {
+  return _VSTD::__object_equal(__x, __y, __is_bytewise_equality_comparable<_Tp, _Tp>());
+}
+
+_LIBCPP_END_NAMESPACE_STD
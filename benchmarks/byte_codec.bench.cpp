@@ -0,0 +1,136 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// Base64 and hex encoding and decoding at 64 B, 4 KB and 1 MB of binary
+// data, against the table loops that the vector kernels replace. GB/s counts
+// the binary bytes.
+
+#include "__byte_codec.hh"
+#include "bench.h"
+
+using std::byte;
+
+__attribute__((__noinline__)) static size_t loop_base64_encode(const unsigned char *__s, size_t __n,
+                                                               unsigned char *__d) {
+  size_t __o = 0;
+  for (size_t __i = 0; __n - __i >= 3; __i += 3, __o += 4) {
+    const unsigned __w = (unsigned(__s[__i]) << 16) | (unsigned(__s[__i + 1]) << 8) | __s[__i + 2];
+    __d[__o]           = static_cast<unsigned char>(std::__base64_alphabet[__w >> 18]);
+    __d[__o + 1]       = static_cast<unsigned char>(std::__base64_alphabet[(__w >> 12) & 0x3f]);
+    __d[__o + 2]       = static_cast<unsigned char>(std::__base64_alphabet[(__w >> 6) & 0x3f]);
+    __d[__o + 3]       = static_cast<unsigned char>(std::__base64_alphabet[__w & 0x3f]);
+  }
+  return __o;
+}
+
+__attribute__((__noinline__)) static size_t loop_base64_decode(const unsigned char *__s, size_t __n,
+                                                               unsigned char *__d) {
+  const unsigned char *__t = std::__base64_decode_table.__v_;
+  size_t __o               = 0;
+  for (size_t __i = 0; __n - __i >= 4; __i += 4, __o += 3) {
+    const unsigned __a = __t[__s[__i]], __b = __t[__s[__i + 1]], __c = __t[__s[__i + 2]], __e = __t[__s[__i + 3]];
+    if (((__a | __b | __c | __e) & 0x80) != 0)
+      break;
+    const unsigned __w = (__a << 18) | (__b << 12) | (__c << 6) | __e;
+    __d[__o]           = static_cast<unsigned char>(__w >> 16);
+    __d[__o + 1]       = static_cast<unsigned char>(__w >> 8);
+    __d[__o + 2]       = static_cast<unsigned char>(__w);
+  }
+  return __o;
+}
+
+__attribute__((__noinline__)) static size_t loop_hex_decode(const unsigned char *__s, size_t __n,
+                                                            unsigned char *__d) {
+  const unsigned char *__t = std::__hex_decode_table.__v_;
+  size_t __i               = 0;
+  for (; __n - __i >= 2; __i += 2) {
+    const unsigned __hi = __t[__s[__i]], __lo = __t[__s[__i + 1]];
+    if (__hi == 0xff || __lo == 0xff)
+      break;
+    __d[__i / 2] = static_cast<unsigned char>((__hi << 4) | __lo);
+  }
+  return __i / 2;
+}
+
+static unsigned char __src[1 << 20], __dec[1 << 20];
+static unsigned char __b64[std::__base64_encoded_size(1 << 20)], __hex[std::__hex_encoded_size(1 << 20)];
+
+static void sizes(const char *__size_name, size_t __n) {
+  const byte *const __s = reinterpret_cast<const byte *>(__src);
+  byte *const __d       = reinterpret_cast<byte *>(__dec);
+  const size_t __m64    = std::__base64_encode(__s, __n, __b64);
+  const size_t __m16    = std::__hex_encode(__s, __n, __hex);
+  const double __bytes  = static_cast<double>(__n);
+
+  bench::run(
+      bench::name("base64_encode/%s", __size_name),
+      [=] {
+        size_t __r = std::__base64_encode(__s, __n, __b64);
+        std::__do_not_optimize(__r);
+        std::__clobber_memory();
+      },
+      __bytes);
+  bench::run(
+      bench::name("loop/base64_encode/%s", __size_name),
+      [=] {
+        size_t __r = loop_base64_encode(__src, __n, __b64);
+        std::__do_not_optimize(__r);
+        std::__clobber_memory();
+      },
+      __bytes);
+  bench::run(
+      bench::name("base64_decode/%s", __size_name),
+      [=] {
+        std::__codec_result __r = std::__base64_decode(__b64, __m64, __d);
+        std::__do_not_optimize(__r);
+        std::__clobber_memory();
+      },
+      __bytes);
+  bench::run(
+      bench::name("loop/base64_decode/%s", __size_name),
+      [=] {
+        size_t __r = loop_base64_decode(__b64, __m64, __dec);
+        std::__do_not_optimize(__r);
+        std::__clobber_memory();
+      },
+      __bytes);
+  bench::run(
+      bench::name("hex_encode/%s", __size_name),
+      [=] {
+        size_t __r = std::__hex_encode(__s, __n, __hex);
+        std::__do_not_optimize(__r);
+        std::__clobber_memory();
+      },
+      __bytes);
+  bench::run(
+      bench::name("hex_decode/%s", __size_name),
+      [=] {
+        std::__codec_result __r = std::__hex_decode(__hex, __m16, __d);
+        std::__do_not_optimize(__r);
+        std::__clobber_memory();
+      },
+      __bytes);
+  bench::run(
+      bench::name("loop/hex_decode/%s", __size_name),
+      [=] {
+        size_t __r = loop_hex_decode(__hex, __m16, __dec);
+        std::__do_not_optimize(__r);
+        std::__clobber_memory();
+      },
+      __bytes);
+}
+
+int main(int __argc, char **__argv) {
+  bench::init(__argc, __argv);
+  for (size_t __i = 0; __i != sizeof __src; ++__i)
+    __src[__i] = static_cast<unsigned char>(__i * 131 + 7);
+  sizes("64", 64);
+  sizes("4K", 4096);
+  sizes("1M", sizeof __src);
+  return bench::report();
+}
@@ -0,0 +1,104 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// Floating-point to_chars and from_chars, one value per iteration, against
+// snprintf("%.17g") and strtod. "random" is doubles of random bits with
+// exponents in [2^-100, 2^100], whose shortest forms run to 16 or 17 digits;
+// "short" is values printed with three decimals, as in telemetry.
+
+#include "charconv.hh"
+#include "bench.h"
+
+#include <cstdlib>
+
+static const size_t __count = 4096;
+
+struct __values {
+  double __d[__count];
+  float __f[__count];
+  char __text[__count][32]; // the shortest form of __d, NUL-terminated
+  char __ftext[__count][32];
+};
+
+static unsigned long long __state = 88172645463325252ull;
+static unsigned long long __random() {
+  __state ^= __state << 13;
+  __state ^= __state >> 7;
+  __state ^= __state << 17;
+  return __state;
+}
+
+static void __fill(__values &__v, bool __short) {
+  for (size_t __i = 0; __i != __count; ++__i) {
+    if (__short)
+      __v.__d[__i] = static_cast<double>(__random() % 10000000) / 1000;
+    else {
+      const unsigned long long __b =
+          (__random() & 0x800fffffffffffffull) | (static_cast<unsigned long long>(923 + __random() % 200) << 52);
+      std::memcpy(&__v.__d[__i], &__b, sizeof __b);
+    }
+    __v.__f[__i] = static_cast<float>(__v.__d[__i]);
+    *std::to_chars(__v.__text[__i], __v.__text[__i] + 31, __v.__d[__i]).ptr   = '\0';
+    *std::to_chars(__v.__ftext[__i], __v.__ftext[__i] + 31, __v.__f[__i]).ptr = '\0';
+  }
+}
+
+static void values(const char *__set, const __values &__v) {
+  static char __buf[64];
+  size_t __i = 0;
+
+  bench::run(bench::name("to_chars/double/%s", __set), [&] {
+    std::to_chars_result __r = std::to_chars(__buf, __buf + sizeof __buf, __v.__d[__i++ % __count]);
+    std::__do_not_optimize(__r);
+  });
+  bench::run(bench::name("snprintf/double/%s", __set), [&] {
+    int __r = std::snprintf(__buf, sizeof __buf, "%.17g", __v.__d[__i++ % __count]);
+    std::__do_not_optimize(__r);
+  });
+  bench::run(bench::name("to_chars/float/%s", __set), [&] {
+    std::to_chars_result __r = std::to_chars(__buf, __buf + sizeof __buf, __v.__f[__i++ % __count]);
+    std::__do_not_optimize(__r);
+  });
+  bench::run(bench::name("snprintf/float/%s", __set), [&] {
+    int __r = std::snprintf(__buf, sizeof __buf, "%.9g", static_cast<double>(__v.__f[__i++ % __count]));
+    std::__do_not_optimize(__r);
+  });
+  bench::run(bench::name("from_chars/double/%s", __set), [&] {
+    const char *__s = __v.__text[__i++ % __count];
+    double __d;
+    std::from_chars_result __r = std::from_chars(__s, __s + std::strlen(__s), __d);
+    std::__do_not_optimize(__r);
+    std::__do_not_optimize(__d);
+  });
+  bench::run(bench::name("strtod/double/%s", __set), [&] {
+    double __d = std::strtod(__v.__text[__i++ % __count], nullptr);
+    std::__do_not_optimize(__d);
+  });
+  bench::run(bench::name("from_chars/float/%s", __set), [&] {
+    const char *__s = __v.__ftext[__i++ % __count];
+    float __f;
+    std::from_chars_result __r = std::from_chars(__s, __s + std::strlen(__s), __f);
+    std::__do_not_optimize(__r);
+    std::__do_not_optimize(__f);
+  });
+  bench::run(bench::name("strtof/float/%s", __set), [&] {
+    float __f = std::strtof(__v.__ftext[__i++ % __count], nullptr);
+    std::__do_not_optimize(__f);
+  });
+}
+
+static __values __random_values, __short_values;
+
+int main(int __argc, char **__argv) {
+  bench::init(__argc, __argv);
+  __fill(__random_values, false);
+  __fill(__short_values, true);
+  values("random", __random_values);
+  values("short", __short_values);
+  return bench::report();
+}
@@ -0,0 +1,53 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// CRC-32C through each implementation (the slicing table, the serial SSE4.2
+// instruction, three interleaved streams folded with PCLMUL, and __crc32c as
+// dispatched at run time) and XXH64, at 64 B, 4 KB, 64 KB and 1 MB.
+
+#include "__checksum.hh"
+#include "bench.h"
+
+using std::byte;
+
+template <class _Fn> static void one(const char *__name, const char *__size_name, size_t __n, _Fn __f) {
+  bench::run(
+      bench::name("%s/%s", __name, __size_name),
+      [=] {
+        auto __r = __f();
+        std::__do_not_optimize(__r);
+      },
+      static_cast<double>(__n));
+}
+
+static void sizes(const unsigned char *__buf, const char *__size_name, size_t __n) {
+  typedef std::__crc32c_impl __impl;
+  const byte *const __b = reinterpret_cast<const byte *>(__buf);
+  one("crc32c/table", __size_name, __n, [=] { return __impl::__software_entry(__buf, __n, 0); });
+#ifdef _LIBCPP_HAS_CRC32C_X86
+  if (__builtin_cpu_supports("sse4.2")) {
+    one("crc32c/sse42", __size_name, __n, [=] { return __impl::__sse42(__buf, __n, 0); });
+    if (__builtin_cpu_supports("pclmul"))
+      one("crc32c/sse42-pclmul", __size_name, __n, [=] { return __impl::__sse42_pclmul(__buf, __n, 0); });
+  }
+#endif
+  one("crc32c", __size_name, __n, [=] { return std::__crc32c(__b, __n); });
+  one("xxhash64", __size_name, __n, [=] { return std::__xxhash64(__b, __n); });
+}
+
+int main(int __argc, char **__argv) {
+  bench::init(__argc, __argv);
+  static unsigned char __buf[1 << 20];
+  for (size_t __i = 0; __i != sizeof __buf; ++__i)
+    __buf[__i] = static_cast<unsigned char>(__i * 131 + 7);
+  sizes(__buf, "64", 64);
+  sizes(__buf, "4K", 4096);
+  sizes(__buf, "64K", 65536);
+  sizes(__buf, "1M", sizeof __buf);
+  return bench::report();
+}
@@ -0,0 +1,52 @@
+#!/bin/sh
+#===----------------------------------------------------------------------===##
+#
+# Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#
+#===----------------------------------------------------------------------===##
+#
+# Times the front end on benchmarks/*.compile.cpp, or those named as
+# arguments (invoke, conjunction, ...). Each file lists the configurations
+# to compare,
+#
+#   // VARIANT: name flags...
+#
+# and each is compiled with ${CXX:-g++} -fsyntax-only, best of ${RUNS:-5}.
+# HEADERS=dir takes the headers from another tree, such as a checkout of an
+# earlier commit, for before/after figures.
+# With GCC the memory its front end allocated (-fmem-report) follows the
+# time: unlike the time, it is the same from run to run, so it tells a real
+# change from noise on a busy machine.
+
+dir=$(cd "$(dirname "$0")" && pwd)
+root=$(dirname "$dir")
+CXX=${CXX:-g++}
+RUNS=${RUNS:-5}
+
+files=
+for a in "$@"; do files="$files $dir/$a.compile.cpp"; done
+[ -n "$files" ] || files=$(ls "$dir"/*.compile.cpp)
+
+status=0
+for f in $files; do
+  echo "# $(basename "$f" .compile.cpp)"
+  sed -n 's|^// VARIANT: *||p' "$f" | while read -r name flags; do
+    best=
+    i=0
+    while [ $i -lt "$RUNS" ]; do
+      start=$(date +%s%N)
+      # shellcheck disable=SC2086
+      $CXX -fsyntax-only -I"${HEADERS:-$root}" -I"$root/test/support" -include prelude.h $flags $CXXFLAGS "$f" || exit 1
+      t=$((($(date +%s%N) - start) / 1000000))
+      [ -z "$best" ] || [ "$t" -lt "$best" ] && best=$t
+      i=$((i + 1))
+    done
+    # shellcheck disable=SC2086
+    mem=$($CXX -fsyntax-only -fmem-report -I"${HEADERS:-$root}" -I"$root/test/support" -include prelude.h $flags \
+      $CXXFLAGS "$f" 2>&1 | sed -n 's/^Total  *\([0-9][0-9]*[kMG]\) .*/\1/p' | head -n 1)
+    printf '%-24s %6d ms %8s\n' "$name" "$best" "$mem"
+  done || status=1
+done
+exit $status
@@ -0,0 +1,49 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// conjunction and disjunction over M distinct packs of N predicates, against
+// the textbook recursive definition (-DNAIVE), which nests N deep.
+
+// VARIANT: naive/16        -std=c++17 -DNAIVE -DN=16   -DM=512
+// VARIANT: blocked/16      -std=c++17         -DN=16   -DM=512
+// VARIANT: naive/256       -std=c++17 -DNAIVE -DN=256  -DM=32 -ftemplate-depth=2000
+// VARIANT: blocked/256     -std=c++17         -DN=256  -DM=32
+// VARIANT: naive/1024      -std=c++17 -DNAIVE -DN=1024 -DM=8  -ftemplate-depth=2000
+// VARIANT: blocked/1024    -std=c++17         -DN=1024 -DM=8
+
+#include "type_traits.hh"
+#include "utility.hh"
+
+#ifdef NAIVE
+template <class...> struct conj : std::true_type {};
+template <class _B1> struct conj<_B1> : _B1 {};
+template <class _B1, class... _Bn>
+struct conj<_B1, _Bn...> : std::conditional_t<bool(_B1::value), conj<_Bn...>, _B1> {};
+
+template <class...> struct disj : std::false_type {};
+template <class _B1> struct disj<_B1> : _B1 {};
+template <class _B1, class... _Bn>
+struct disj<_B1, _Bn...> : std::conditional_t<bool(_B1::value), _B1, disj<_Bn...>> {};
+#else
+template <class... _Bn> using conj = std::conjunction<_Bn...>;
+template <class... _Bn> using disj = std::disjunction<_Bn...>;
+#endif
+
+template <int, int> struct T : std::true_type {};
+template <int, int> struct F : std::false_type {};
+
+template <int _Mp, class _Seq> struct pack;
+template <int _Mp, int... _Ip> struct pack<_Mp, std::integer_sequence<int, _Ip...>> {
+  static constexpr bool value = conj<T<_Mp, _Ip>...>::value && !disj<F<_Mp, _Ip>...>::value;
+};
+
+template <int... _Mp> constexpr bool all(std::integer_sequence<int, _Mp...>) {
+  return (pack<_Mp, std::make_integer_sequence<int, N>>::value && ...);
+}
+
+static_assert(all(std::make_integer_sequence<int, M>()), "");
@@ -0,0 +1,93 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// The std::byte operators over a buffer, against the same loops over
+// unsigned char: they should compile to the same code.
+
+#include "bench.h"
+#include "cstddef.hh"
+
+constexpr size_t N = 16384;
+static std::byte a[N], b[N];
+static unsigned char ua[N], ub[N];
+
+int main(int __argc, char **__argv) {
+  bench::init(__argc, __argv);
+  for (size_t __i = 0; __i != N; ++__i) {
+    a[__i] = b[__i] = std::byte(__i * 7);
+    ua[__i] = ub[__i] = static_cast<unsigned char>(__i * 7);
+  }
+
+  bench::run(
+      "byte/xor",
+      [] {
+        for (size_t __i = 0; __i != N; ++__i)
+          a[__i] ^= b[__i];
+        std::__clobber_memory();
+      },
+      N);
+  bench::run(
+      "uchar/xor",
+      [] {
+        for (size_t __i = 0; __i != N; ++__i)
+          ua[__i] ^= ub[__i];
+        std::__clobber_memory();
+      },
+      N);
+  bench::run(
+      "byte/and-or-not",
+      [] {
+        for (size_t __i = 0; __i != N; ++__i)
+          a[__i] = (a[__i] & b[__i]) | ~b[__i];
+        std::__clobber_memory();
+      },
+      N);
+  bench::run(
+      "uchar/and-or-not",
+      [] {
+        for (size_t __i = 0; __i != N; ++__i)
+          ua[__i] = static_cast<unsigned char>((ua[__i] & ub[__i]) | ~ub[__i]);
+        std::__clobber_memory();
+      },
+      N);
+  bench::run(
+      "byte/shift",
+      [] {
+        for (size_t __i = 0; __i != N; ++__i)
+          a[__i] = (b[__i] << 1) | (b[__i] >> 7);
+        std::__clobber_memory();
+      },
+      N);
+  bench::run(
+      "uchar/shift",
+      [] {
+        for (size_t __i = 0; __i != N; ++__i)
+          ua[__i] = static_cast<unsigned char>((ub[__i] << 1) | (ub[__i] >> 7));
+        std::__clobber_memory();
+      },
+      N);
+  bench::run(
+      "byte/to_integer-sum",
+      [] {
+        unsigned __s = 0;
+        for (size_t __i = 0; __i != N; ++__i)
+          __s += std::to_integer<unsigned>(a[__i]);
+        std::__do_not_optimize(__s);
+      },
+      N);
+  bench::run(
+      "uchar/sum",
+      [] {
+        unsigned __s = 0;
+        for (size_t __i = 0; __i != N; ++__i)
+          __s += ua[__i];
+        std::__do_not_optimize(__s);
+      },
+      N);
+  return bench::report();
+}
@@ -0,0 +1,55 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// The producer side of deferred_log into a 64 KB ring, which the same thread
+// empties whenever it is full, so that it stays in cache as it would with a
+// consumer keeping up. The plain runs give the cost per call; the /latency
+// runs time each call on its own, 256 of them, so that p99 is that of single
+// calls, and /latency/empty is what the timing itself adds to each.
+
+#include "deferred_log.hh"
+#include "bench.h"
+
+static std::log_ring<1 << 16> __ring;
+
+template <class _Fn> static void calls(const char *__name, _Fn __f) {
+  bench::run(__name, __f);
+  const std::__benchmark_options __saved = bench::options;
+  bench::options.__min_sample_ns         = 0;
+  bench::options.__samples               = std::__benchmark_max_samples;
+  for (int __warm = 0; __warm != 1000; ++__warm)
+    __f();
+  bench::run(bench::name("%s/latency", __name), __f);
+  bench::options = __saved;
+}
+
+int main(int __argc, char **__argv) {
+  bench::init(__argc, __argv);
+  unsigned __i = 0;
+  auto __drain = [] { __ring.consume([](const std::log_record &) {}); };
+
+  calls("deferred_log/int", [&] {
+    if (!std::deferred_log<"n={}">(__ring, __i++))
+      __drain();
+  });
+  calls("deferred_log/request", [&] {
+    if (!std::deferred_log<"req {} took {} us from {}">(__ring, __i++, 12.5, "client"))
+      __drain();
+  });
+  calls("deferred_log/long_string", [&] {
+    if (!std::deferred_log<"{}: {}">(__ring, __i++, "a message of sixty-four bytes, as long as a typical log text"))
+      __drain();
+  });
+
+  const std::__benchmark_options __saved = bench::options;
+  bench::options.__min_sample_ns         = 0;
+  bench::options.__samples               = std::__benchmark_max_samples;
+  bench::run("deferred_log/latency/empty", [] {});
+  bench::options = __saved;
+  return bench::report();
+}
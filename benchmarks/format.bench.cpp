@@ -0,0 +1,63 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// format_to_n against snprintf with the same line, one line per iteration,
+// into a 256-byte buffer: a request log line mixing every kind of field,
+// four integers, a timing with three decimals, and a padded string.
+
+#include "format.hh"
+#include "bench.h"
+
+static char __buf[256];
+static const char *const __users[4] = {"alpha", "beta", "gamma", "delta"};
+
+template <class _Fn> static void one(const char *__name, _Fn __f) {
+  unsigned __i = 0;
+  bench::run(__name, [&] {
+    auto __r = __f(__i++);
+    std::__do_not_optimize(__r);
+    std::__clobber_memory();
+  });
+}
+
+int main(int __argc, char **__argv) {
+  bench::init(__argc, __argv);
+
+  one("format_to_n/request", [](unsigned __i) {
+    return std::format_to_n<"[{}] req={} user={} status={:>3} bytes={:#x} t={}ms">(
+               __buf, sizeof __buf, __i & 3, __i, __users[__i & 3], 200 + (__i & 7), __i * 13u, __i * 0.25)
+        .size;
+  });
+  one("snprintf/request", [](unsigned __i) {
+    return std::snprintf(__buf, sizeof __buf, "[%u] req=%u user=%s status=%3u bytes=%#x t=%gms", __i & 3, __i,
+                         __users[__i & 3], 200 + (__i & 7), __i * 13u, __i * 0.25);
+  });
+
+  one("format_to_n/ints", [](unsigned __i) {
+    return std::format_to_n<"{} {} {} {}">(__buf, sizeof __buf, __i, -static_cast<int>(__i), __i * 1000003ull,
+                                           __i & 0xff)
+        .size;
+  });
+  one("snprintf/ints", [](unsigned __i) {
+    return std::snprintf(__buf, sizeof __buf, "%u %d %llu %u", __i, -static_cast<int>(__i), __i * 1000003ull,
+                         __i & 0xff);
+  });
+
+  one("format_to_n/fixed", [](unsigned __i) {
+    return std::format_to_n<"t={:.3f}ms">(__buf, sizeof __buf, __i * 0.0137).size;
+  });
+  one("snprintf/fixed", [](unsigned __i) { return std::snprintf(__buf, sizeof __buf, "t=%.3fms", __i * 0.0137); });
+
+  one("format_to_n/string", [](unsigned __i) {
+    return std::format_to_n<"user={:<10}|">(__buf, sizeof __buf, __users[__i & 3]).size;
+  });
+  one("snprintf/string",
+      [](unsigned __i) { return std::snprintf(__buf, sizeof __buf, "user=%-10s|", __users[__i & 3]); });
+
+  return bench::report();
+}
@@ -0,0 +1,66 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// Recording one value, spread over six decades like latencies in ns, with
+// the locked add (__record) against a plain load and store (__record_local),
+// into one histogram and into a shard of a sharded one; and reading five
+// percentiles back from a filled histogram.
+
+#include "__hdr_histogram.hh"
+#include "bench.h"
+
+typedef std::__hdr_histogram<unsigned long long, 7> Histogram;
+
+static Histogram __one;
+static std::__sharded_hdr_histogram<Histogram, 8> __sharded;
+static unsigned long long __values[4096];
+
+int main(int __argc, char **__argv) {
+  bench::init(__argc, __argv);
+
+  unsigned long long __x = 88172645463325252ull;
+  for (unsigned long long &__v : __values) {
+    __x ^= __x << 13;
+    __x ^= __x >> 7;
+    __x ^= __x << 17;
+    __v = (__x >> 40) % 1000000 >> (__x & 15);
+  }
+
+  size_t __i = 0;
+  bench::run("record", [&] {
+    __one.__record(__values[__i++ & 4095]);
+    std::__clobber_memory();
+  });
+  bench::run("record_local", [&] {
+    __one.__record_local(__values[__i++ & 4095]);
+    std::__clobber_memory();
+  });
+  bench::run("sharded/record", [&] {
+    __sharded.__record(3, __values[__i++ & 4095]);
+    std::__clobber_memory();
+  });
+  bench::run("sharded/record_local", [&] {
+    __sharded.__record_local(3, __values[__i++ & 4095]);
+    std::__clobber_memory();
+  });
+
+  static const double __p[] = {50, 90, 99, 99.9, 100};
+  unsigned long long __out[5];
+  bench::run("percentiles/5", [&] {
+    __one.__percentiles(__p, __out, 5);
+    std::__do_not_optimize(__out);
+    std::__clobber_memory();
+  });
+  bench::run("sharded/percentiles/5", [&] {
+    __sharded.__percentiles(__p, __out, 5);
+    std::__do_not_optimize(__out);
+    std::__clobber_memory();
+  });
+
+  return bench::report();
+}
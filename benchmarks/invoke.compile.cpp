@@ -0,0 +1,55 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// The result type and noexcept-ness of __invoke for N distinct callables of
+// each INVOKE bullet. Since C++17 __invoke is a single if-constexpr dispatch;
+// for the overloads over the bullets it replaced, at the same -std, take the
+// headers from a checkout of the commit before it:
+//
+//   HEADERS=/path/to/old/tree benchmarks/compile_time.sh invoke
+
+// VARIANT: c++17 -std=c++17
+// VARIANT: c++20 -std=c++20
+
+#include "type_traits.hh"
+
+#ifndef N
+#define N 1000
+#endif
+
+template <std::size_t> struct Obj {
+  int __d;
+  int f(int) const;
+};
+
+template <std::size_t> struct Fn {
+  long operator()(int, long) const;
+};
+
+template <std::size_t _Ip>
+using results = int[sizeof(typename std::__invoke_of<int (Obj<_Ip>::*)(int) const, Obj<_Ip> &, int>::type) +
+                    sizeof(typename std::__invoke_of<int (Obj<_Ip>::*)(int) const, const Obj<_Ip> *, int>::type) +
+                    sizeof(typename std::__invoke_of<int Obj<_Ip>::*, Obj<_Ip> &&>::type) +
+                    sizeof(typename std::__invoke_of<int Obj<_Ip>::*, Obj<_Ip> *>::type) +
+                    sizeof(typename std::__invoke_of<Fn<_Ip> &, int, long>::type) +
+                    noexcept(std::__invoke(std::declval<Fn<_Ip>>(), 1, 2L))];
+
+// Not std::make_index_sequence: utility.hh is newer than the old __invoke.
+template <class _Tp, _Tp...> struct seq {};
+#if __has_builtin(__make_integer_seq)
+template <std::size_t _Np> using make_seq = __make_integer_seq<seq, std::size_t, _Np>;
+#else
+template <std::size_t _Np> using make_seq = seq<std::size_t, __integer_pack(_Np)...>;
+#endif
+
+template <std::size_t... _Ip> int all(seq<std::size_t, _Ip...>) {
+  int __r[] = {sizeof(results<_Ip>)...};
+  return sizeof(__r);
+}
+
+int __x = all(make_seq<N>());
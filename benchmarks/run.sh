@@ -0,0 +1,47 @@
+#!/bin/sh
+#===----------------------------------------------------------------------===##
+#
+# Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#
+#===----------------------------------------------------------------------===##
+#
+# Builds and runs benchmarks/*.bench.cpp with ${CXX:-g++} at -std=${STD:-c++20}
+# and ${BENCH_FLAGS:--O2 -march=native}. Arguments naming a benchmark file
+# (type_traits, cstddef, ...) pick those; the others are passed to each
+# benchmark (see support/bench.h), e.g.
+#
+#   benchmarks/run.sh type_traits --quick
+#   benchmarks/run.sh format --json > format.json
+
+dir=$(cd "$(dirname "$0")" && pwd)
+root=$(dirname "$dir")
+CXX=${CXX:-g++}
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+files=
+for a in "$@"; do
+  [ -f "$dir/$a.bench.cpp" ] && files="$files $dir/$a.bench.cpp"
+done
+[ -n "$files" ] || files=$(ls "$dir"/*.bench.cpp)
+
+status=0
+for f in $files; do
+  name=$(basename "$f" .bench.cpp)
+  args=
+  for a in "$@"; do
+    [ -f "$dir/$a.bench.cpp" ] || args="$args $a"
+  done
+  # shellcheck disable=SC2086
+  if ! $CXX -std="${STD:-c++20}" ${BENCH_FLAGS:--O2 -march=native} -I"$root" -I"$dir/support" \
+      -I"$root/test/support" -include prelude.h $CXXFLAGS "$f" -o "$tmp/$name" -lm; then
+    status=1
+    continue
+  fi
+  echo "# $name" >&2
+  # shellcheck disable=SC2086
+  "$tmp/$name" $args || status=1
+done
+exit $status
@@ -0,0 +1,82 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// small_vector at N = 4, 16 and 64: filling N elements inline against the
+// same on the heap (N = 0), spilling to 4N, and inserting at the front of a
+// trivially copyable element (memmove) against a type that must be moved one
+// by one.
+
+#include "bench.h"
+#include "small_vector.hh"
+
+struct Moved {
+  int __v;
+  Moved(int __x) : __v(__x) {}
+  Moved(const Moved &__m) : __v(__m.__v) {}
+  Moved(Moved &&__m) noexcept : __v(__m.__v) {}
+  Moved &operator=(const Moved &__m) {
+    __v = __m.__v;
+    return *this;
+  }
+  Moved &operator=(Moved &&__m) noexcept {
+    __v = __m.__v;
+    return *this;
+  }
+};
+static_assert(!std::is_trivially_copyable<Moved>::value, "");
+
+template <class _Tp, size_t _Np, size_t _Cap> static void fill(const char *__what, size_t __n) {
+  bench::run(bench::name("push_back/%s/N=%zu/n=%zu%s", __what, _Np, __n, _Cap == 0 ? "/heap" : ""), [=] {
+    std::small_vector<_Tp, _Cap> __v;
+    for (size_t __i = 0; __i != __n; ++__i)
+      __v.push_back(_Tp(static_cast<int>(__i)));
+    std::__do_not_optimize(__v.data());
+    std::__clobber_memory();
+  });
+}
+
+template <class _Tp, size_t _Np> static void insert_front(const char *__what) {
+  bench::run(bench::name("insert-front/%s/N=%zu", __what, _Np), [] {
+    std::small_vector<_Tp, _Np> __v;
+    for (size_t __i = 0; __i != _Np; ++__i)
+      __v.insert(__v.begin(), _Tp(static_cast<int>(__i)));
+    std::__do_not_optimize(__v.data());
+    std::__clobber_memory();
+  });
+  bench::run(bench::name("erase-front/%s/N=%zu", __what, _Np), [] {
+    std::small_vector<_Tp, _Np> __v(_Np, _Tp(1));
+    while (!__v.empty())
+      __v.erase(__v.begin());
+    std::__do_not_optimize(__v.data());
+    std::__clobber_memory();
+  });
+}
+
+template <size_t _Np> static void sizes() {
+  fill<int, _Np, _Np>("int", _Np);
+  fill<int, _Np, 0>("int", _Np);
+  fill<int, _Np, _Np>("int", 4 * _Np);
+  fill<Moved, _Np, _Np>("moved", _Np);
+  fill<Moved, _Np, _Np>("moved", 4 * _Np);
+  insert_front<int, _Np>("int");
+  insert_front<Moved, _Np>("moved");
+  bench::run(bench::name("copy/int/N=%zu", _Np), [] {
+    static const std::small_vector<int, _Np> __src(_Np, 7);
+    std::small_vector<int, _Np> __v(__src);
+    std::__do_not_optimize(__v.data());
+    std::__clobber_memory();
+  });
+}
+
+int main(int __argc, char **__argv) {
+  bench::init(__argc, __argv);
+  sizes<4>();
+  sizes<16>();
+  sizes<64>();
+  return bench::report();
+}
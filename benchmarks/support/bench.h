@@ -0,0 +1,123 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// The driver shared by the *.bench.cpp: main calls bench::init(argc, argv),
+// times each benchmark with bench::run and returns bench::report(). Arguments:
+//
+//   --csv, --json   write the results with the __benchmark.hh reporters
+//                   instead of a table
+//   --quick         fewer and shorter samples, to check that they run
+//   text            run only the benchmarks whose name contains text
+
+#pragma once
+
+#include "__benchmark.hh"
+
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+
+namespace bench {
+
+inline unsigned long long now_ns() {
+  timespec __ts;
+  clock_gettime(CLOCK_MONOTONIC, &__ts);
+  return static_cast<unsigned long long>(__ts.tv_sec) * 1000000000ull + static_cast<unsigned long long>(__ts.tv_nsec);
+}
+
+struct result {
+  std::__benchmark_stats __stats;
+  double __bytes; // processed per iteration, for throughput; 0 if not given
+};
+
+inline result results[256];
+inline size_t count;
+inline std::__benchmark_options options;
+inline const char *filters[16];
+inline size_t nfilters;
+inline enum { table, csv, json } format = table;
+
+// Reads the arguments; call first.
+inline void init(int __argc, char **__argv) {
+  for (int __i = 1; __i < __argc; ++__i) {
+    if (std::strcmp(__argv[__i], "--csv") == 0)
+      format = csv;
+    else if (std::strcmp(__argv[__i], "--json") == 0)
+      format = json;
+    else if (std::strcmp(__argv[__i], "--quick") == 0) {
+      options.__min_sample_ns = 200000;
+      options.__samples       = 5;
+    } else if (nfilters != sizeof filters / sizeof *filters)
+      filters[nfilters++] = __argv[__i];
+  }
+  if (std::__cycle_frequency() == 0)
+    std::__calibrate_cycle_counter(now_ns);
+}
+
+inline bool selected(const char *__name) {
+  for (size_t __i = 0; __i != nfilters; ++__i)
+    if (std::strstr(__name, filters[__i]) != nullptr)
+      return true;
+  return nfilters == 0;
+}
+
+// A name built at run time, for benchmarks made in a loop or a helper; run
+// keeps the pointer, so the text lives until exit.
+template <class... _Args> const char *name(const char *__fmt, _Args... __args) {
+  static char __names[1 << 14];
+  static size_t __used;
+  char *const __p = __names + __used;
+  const int __n   = std::snprintf(__p, sizeof __names - __used, __fmt, __args...);
+  if (__n < 0 || static_cast<size_t>(__n) >= sizeof __names - __used)
+    return "(too many names)";
+  __used += static_cast<size_t>(__n) + 1;
+  return __p;
+}
+
+// Times __f; __bytes is what one call processes, for a GB/s column.
+template <class _Fn> void run(const char *__name, _Fn &&__f, double __bytes = 0) {
+  if (!selected(__name) || count == sizeof results / sizeof *results)
+    return;
+  results[count++] = result{std::__run_benchmark(__name, __f, options), __bytes};
+}
+
+inline int report() {
+  static char __buf[1 << 16];
+  char *__p = __buf;
+  char *const __last = __buf + sizeof __buf;
+  if (format == csv) {
+    __p = std::__benchmark_csv_header(__p, __last);
+    for (size_t __i = 0; __i != count; ++__i)
+      __p = std::__benchmark_csv_row(__p, __last, results[__i].__stats);
+  } else if (format == json) {
+    std::__benchmark_stats __s[sizeof results / sizeof *results];
+    for (size_t __i = 0; __i != count; ++__i)
+      __s[__i] = results[__i].__stats;
+    __p = std::__benchmark_json(__p, __last, __s, count);
+  } else {
+    std::printf("%-40s %10s %10s %10s %10s\n", "benchmark", "median", "mad", "p99", "GB/s");
+    for (size_t __i = 0; __i != count; ++__i) {
+      const std::__benchmark_stats &__s = results[__i].__stats;
+      const char *__unit                = __s.__cycles ? "cy" : "ns";
+      std::printf("%-40s %8.2f%s %8.2f%s %8.2f%s", __s.__name, __s.__median, __unit, __s.__mad, __unit, __s.__p99,
+                  __unit);
+      if (results[__i].__bytes != 0 && !__s.__cycles)
+        std::printf(" %10.2f", results[__i].__bytes / __s.__median);
+      std::printf("\n");
+    }
+    return 0;
+  }
+  if (__p == nullptr) {
+    std::fprintf(stderr, "bench: the report does not fit\n");
+    return 1;
+  }
+  std::fwrite(__buf, 1, static_cast<size_t>(__p - __buf), stdout);
+  return 0;
+}
+
+} // namespace bench
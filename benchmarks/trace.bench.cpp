@@ -0,0 +1,79 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// What instrumentation costs in the code it times: a bare counter read,
+// then an empty scope under __scoped_timer and under __trace_scope, whose
+// ring is emptied every 1024 events so that it never drops. Then the export:
+// 256 events recorded and written as Chrome trace JSON, in bytes of JSON,
+// against recording and draining the same events without writing them.
+//
+// Built with _LIBCPP_ENABLE_INSTRUMENTATION; without it both scopes are empty.
+
+#define _LIBCPP_ENABLE_INSTRUMENTATION
+
+#include "__trace.hh"
+#include "bench.h"
+
+static std::__trace_ring<1 << 12> __ring;
+static std::__trace_ring<256> __events;
+static char __json[1 << 16];
+
+static void __fill() {
+  for (unsigned long long __i = 0; __i != 256; ++__i)
+    __events.__record("request", __i * 3000, __i * 3000 + 1234);
+}
+
+int main(int __argc, char **__argv) {
+  bench::init(__argc, __argv);
+
+  bench::run("cycle_count", [] { std::__do_not_optimize(std::__cycle_count()); });
+
+  unsigned long long __cycles = 0;
+  bench::run("scoped_timer", [&] {
+    std::__scoped_timer __t(__cycles);
+    std::__clobber_memory();
+  });
+  std::__do_not_optimize(__cycles);
+
+  unsigned __n = 0;
+  bench::run("trace_scope", [&] {
+    {
+      std::__trace_scope<1 << 12> __s(__ring, "scope");
+      std::__clobber_memory();
+    }
+    if ((++__n & 1023) == 0)
+      __ring.__consume([](const std::__trace_event &) { return true; });
+  });
+  __ring.__consume([](const std::__trace_event &) { return true; });
+  if (__ring.__dropped() != 0)
+    return 1;
+
+  bench::run("trace_ring/256_events", [] {
+    __fill();
+    __events.__consume([](const std::__trace_event &__e) {
+      std::__do_not_optimize(__e);
+      return true;
+    });
+  });
+
+  std::__chrome_trace_writer __probe(__json, __json + sizeof(__json));
+  __fill();
+  __probe.__append(__events, 1);
+  const double __bytes = static_cast<double>(__probe.__finish() - __json);
+  bench::run(
+      "chrome_trace/256_events",
+      [] {
+        __fill();
+        std::__chrome_trace_writer __w(__json, __json + sizeof(__json));
+        __w.__append(__events, 1);
+        std::__do_not_optimize(__w.__finish());
+      },
+      __bytes);
+
+  return bench::report();
+}
@@ -0,0 +1,50 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// 20 traits over 1800 distinct types (36000 uses), spelled as the *_v
+// variable templates, which no longer instantiate the trait classes, and as
+// trait<T>::value (-DSPELLING_VALUE), which does.
+
+// VARIANT: _v      -std=c++17
+// VARIANT: ::value -std=c++17 -DSPELLING_VALUE
+
+#include "type_traits.hh"
+
+#ifdef SPELLING_VALUE
+#define V(__trait, _Tp) std::__trait<_Tp>::value
+#else
+#define V(__trait, _Tp) std::__trait##_v<_Tp>
+#endif
+
+template <int> struct S {
+  int __x;
+};
+
+template <class _Tp>
+constexpr int uses =
+    V(is_void, _Tp) + V(is_integral, _Tp) + V(is_floating_point, _Tp) + V(is_array, _Tp) + V(is_pointer, _Tp) +
+    V(is_lvalue_reference, _Tp) + V(is_member_pointer, _Tp) + V(is_enum, _Tp) + V(is_union, _Tp) + V(is_class, _Tp) +
+    V(is_function, _Tp) + V(is_reference, _Tp) + V(is_arithmetic, _Tp) + V(is_object, _Tp) + V(is_scalar, _Tp) +
+    V(is_const, _Tp) + V(is_volatile, _Tp) + V(is_trivially_copyable, _Tp) + V(is_empty, _Tp) + V(is_signed, _Tp);
+
+// Not std::make_integer_sequence: the figures compare with trees from before
+// utility.hh was added.
+template <class _Tp, _Tp...> struct seq {};
+#if __has_builtin(__make_integer_seq)
+template <int _Np> using make_seq = __make_integer_seq<seq, int, _Np>;
+#else
+template <int _Np> using make_seq = seq<int, __integer_pack(_Np)...>;
+#endif
+
+template <int... _Ip> constexpr int all(seq<int, _Ip...>) {
+  return (0 + ... + (uses<S<_Ip>> + uses<S<_Ip> *> + uses<const S<_Ip> &>));
+}
+
+// Per S<I>: class, object, trivially copyable; pointer, scalar, object, trivially
+// copyable; reference, lvalue reference.
+static_assert(all(make_seq<600>()) == 600 * 9, "");
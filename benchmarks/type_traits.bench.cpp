@@ -0,0 +1,103 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// swap, swap_ranges, iter_swap and __invoke, against the code they stand for.
+
+#include "bench.h"
+#include "type_traits.hh"
+
+struct Big {
+  long __v[8];
+};
+
+struct Widget {
+  int __n;
+  int get() const { return __n; }
+};
+
+template <class _Tp> static void swap_ranges_bench(const char *__name, const char *__loop_name, size_t __n) {
+  // __b is offset so that the two ranges do not alias at 4K.
+  static _Tp __a[4096], __buf[4096 + 64 / sizeof(_Tp) + 1];
+  _Tp *const __b = __buf + 64 / sizeof(_Tp) + 1;
+  bench::run(
+      __name,
+      [=] {
+        std::swap_ranges(__a, __a + __n, __b);
+        std::__clobber_memory();
+      },
+      2.0 * sizeof(_Tp) * __n);
+  bench::run(
+      __loop_name,
+      [=] {
+        for (size_t __i = 0; __i != __n; ++__i) {
+          _Tp __t  = __a[__i];
+          __a[__i] = __b[__i];
+          __b[__i] = __t;
+        }
+        std::__clobber_memory();
+      },
+      2.0 * sizeof(_Tp) * __n);
+}
+
+int main(int __argc, char **__argv) {
+  bench::init(__argc, __argv);
+
+  int __x = 1, __y = 2;
+  bench::run("swap/int", [&] {
+    std::swap(__x, __y);
+    std::__do_not_optimize(__x);
+    std::__do_not_optimize(__y);
+  });
+  Big __p = {}, __q = {};
+  bench::run("swap/64B", [&] {
+    std::swap(__p, __q);
+    std::__do_not_optimize(__p);
+    std::__do_not_optimize(__q);
+  });
+  long __l[2] = {1, 2};
+  bench::run("iter_swap/long*", [&] {
+    long *__f = __l;
+    std::__do_not_optimize(__f);
+    std::iter_swap(__f, __f + 1);
+    std::__clobber_memory();
+  });
+
+  swap_ranges_bench<char>("swap_ranges/char/4096", "loop/char/4096", 4096);
+  swap_ranges_bench<int>("swap_ranges/int/16", "loop/int/16", 16);
+  swap_ranges_bench<int>("swap_ranges/int/4096", "loop/int/4096", 4096);
+  swap_ranges_bench<Big>("swap_ranges/64B/512", "loop/64B/512", 512);
+
+  Widget __w    = {3};
+  Widget *__ptr = &__w;
+  int __r       = 0;
+  bench::run("__invoke/pmf", [&] {
+    std::__do_not_optimize(__ptr);
+    __r += std::__invoke(&Widget::get, __ptr);
+    std::__do_not_optimize(__r);
+  });
+  bench::run("direct/pmf", [&] {
+    std::__do_not_optimize(__ptr);
+    __r += __ptr->get();
+    std::__do_not_optimize(__r);
+  });
+  bench::run("__invoke/pmd", [&] {
+    std::__do_not_optimize(__ptr);
+    __r += std::__invoke(&Widget::__n, *__ptr);
+    std::__do_not_optimize(__r);
+  });
+  auto __add = [](int __a, int __b) { return __a + __b; };
+  bench::run("__invoke/lambda", [&] {
+    __r = std::__invoke(__add, __r, 1);
+    std::__do_not_optimize(__r);
+  });
+  bench::run("direct/lambda", [&] {
+    __r = __add(__r, 1);
+    std::__do_not_optimize(__r);
+  });
+  return bench::report();
+}
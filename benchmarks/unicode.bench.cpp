@@ -0,0 +1,88 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UTF-8 validation and each transcoding direction over 64 KB of text of
+// different scripts: ASCII, Latin (a fifth two-byte letters), Cyrillic (two
+// bytes and spaces), CJK (three bytes) and emoji (four bytes among ASCII).
+// The GB/s column counts UTF-8 bytes.
+
+#include "__unicode.hh"
+#include "bench.h"
+
+static unsigned long long __state = 88172645463325252ull;
+static unsigned __random() {
+  __state ^= __state << 13;
+  __state ^= __state >> 7;
+  __state ^= __state << 17;
+  return static_cast<unsigned>(__state);
+}
+
+static unsigned char __text[1 << 16];
+static char16_t __u16[1 << 16];
+static char32_t __u32[1 << 16];
+static char __back[1 << 18];
+
+template <class _Gen> static void script(const char *__script, _Gen __gen) {
+  size_t __n = 0;
+  while (__n + 4 <= sizeof __text)
+    __n += std::__utf8_encode(__gen(), __text + __n);
+  const char *const __s = reinterpret_cast<const char *>(__text);
+  const size_t __n16    = std::__utf8_to_utf16(__s, __n, __u16).__out;
+  const size_t __n32    = std::__utf8_to_utf32(__s, __n, __u32).__out;
+  const double __bytes  = static_cast<double>(__n);
+
+  bench::run(
+      bench::name("validate/%s", __script),
+      [=] {
+        bool __r = std::__utf8_validate(__s, __n);
+        std::__do_not_optimize(__r);
+      },
+      __bytes);
+  bench::run(
+      bench::name("utf8_to_utf16/%s", __script),
+      [=] {
+        std::__utf_result __r = std::__utf8_to_utf16(__s, __n, __u16);
+        std::__do_not_optimize(__r);
+        std::__clobber_memory();
+      },
+      __bytes);
+  bench::run(
+      bench::name("utf8_to_utf32/%s", __script),
+      [=] {
+        std::__utf_result __r = std::__utf8_to_utf32(__s, __n, __u32);
+        std::__do_not_optimize(__r);
+        std::__clobber_memory();
+      },
+      __bytes);
+  bench::run(
+      bench::name("utf16_to_utf8/%s", __script),
+      [=] {
+        std::__utf_result __r = std::__utf16_to_utf8(__u16, __n16, __back);
+        std::__do_not_optimize(__r);
+        std::__clobber_memory();
+      },
+      __bytes);
+  bench::run(
+      bench::name("utf32_to_utf8/%s", __script),
+      [=] {
+        std::__utf_result __r = std::__utf32_to_utf8(__u32, __n32, __back);
+        std::__do_not_optimize(__r);
+        std::__clobber_memory();
+      },
+      __bytes);
+}
+
+int main(int __argc, char **__argv) {
+  bench::init(__argc, __argv);
+  script("ascii", [] { return static_cast<char32_t>(' ' + __random() % 95); });
+  script("latin", [] { return static_cast<char32_t>(__random() % 5 ? 'a' + __random() % 26 : 0xe0 + __random() % 32); });
+  script("cyrillic", [] { return static_cast<char32_t>(__random() % 7 ? 0x430 + __random() % 32 : ' '); });
+  script("cjk", [] { return static_cast<char32_t>(0x4e00 + __random() % 0x5000); });
+  script("emoji", [] { return static_cast<char32_t>(__random() % 4 ? 'a' + __random() % 26 : 0x1f600 + __random() % 80); });
+  return bench::report();
+}
@@ -0,0 +1,203 @@
+// -*- C++ -*-
+//===------------------------------ bit -----------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+/*
+    bit synopsis
+
+namespace std
+{
+
+// [bit.pow.two], integral powers of 2
+template <class T>
+  constexpr bool has_single_bit(T x) noexcept;  // C++20
+template <class T>
+  constexpr T bit_width(T x) noexcept;          // C++20
+
+// [bit.count], counting
+template <class T>
+  constexpr int countl_zero(T x) noexcept;      // C++20
+template <class T>
+  constexpr int countl_one(T x) noexcept;       // C++20
+template <class T>
+  constexpr int countr_zero(T x) noexcept;      // C++20
+template <class T>
+  constexpr int countr_one(T x) noexcept;       // C++20
+template <class T>
+  constexpr int popcount(T x) noexcept;         // C++20
+
+// extensions
+constexpr int      __libcpp_ctz(unsigned long long x) noexcept;       // x != 0
+constexpr int      __libcpp_clz(unsigned long long x) noexcept;       // x != 0
+constexpr int      __libcpp_popcount(unsigned long long x) noexcept;
+unsigned           __libcpp_select64(unsigned long long x, unsigned k) noexcept;
+                   // index of the k-th (from 0) set bit of x; k < popcount(x)
+
+}  // std
+
+*/
+
+#include "__config.hh"
+#include "type_traits.hh"
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#pragma GCC system_header
+#endif
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR int __libcpp_ctz(unsigned __x) _NOEXCEPT {
+  return __builtin_ctz(__x);
+}
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR int __libcpp_ctz(unsigned long __x) _NOEXCEPT {
+  return __builtin_ctzl(__x);
+}
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR int __libcpp_ctz(unsigned long long __x) _NOEXCEPT {
+  return __builtin_ctzll(__x);
+}
+
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR int __libcpp_clz(unsigned __x) _NOEXCEPT {
+  return __builtin_clz(__x);
+}
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR int __libcpp_clz(unsigned long __x) _NOEXCEPT {
+  return __builtin_clzl(__x);
+}
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR int __libcpp_clz(unsigned long long __x) _NOEXCEPT {
+  return __builtin_clzll(__x);
+}
+
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR int __libcpp_popcount(unsigned __x) _NOEXCEPT {
+  return __builtin_popcount(__x);
+}
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR int __libcpp_popcount(unsigned long __x) _NOEXCEPT {
+  return __builtin_popcountl(__x);
+}
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR int __libcpp_popcount(unsigned long long __x) _NOEXCEPT {
+  return __builtin_popcountll(__x);
+}
+
+// __libcpp_select64
+
+// With BMI2, depositing 1 << __k into the set bits of __x leaves exactly the
+// selected bit. PDEP is microcoded (and slow) on AMD before Zen 3, which is
+// worth knowing when building for those targets with -mbmi2. Otherwise the
+// search narrows by halves on popcounts and finishes within a byte.
+inline _LIBCPP_INLINE_VISIBILITY unsigned __libcpp_select64(unsigned long long __x, unsigned __k) _NOEXCEPT {
+#if defined(__BMI2__) && (__has_builtin(__builtin_ia32_pdep_di) || defined(_LIBCPP_COMPILER_GCC))
+  return static_cast<unsigned>(__builtin_ctzll(__builtin_ia32_pdep_di(1ull << __k, __x)));
+#else
+  unsigned __base = 0;
+  for (unsigned __width = 32; __width >= 8; __width /= 2) {
+    const unsigned long long __low = __x & ((1ull << __width) - 1);
+    const unsigned __c             = static_cast<unsigned>(__builtin_popcountll(__low));
+    if (__k >= __c) {
+      __k -= __c;
+      __base += __width;
+      __x >>= __width;
+    } else
+      __x = __low;
+  }
+  for (; __k != 0; --__k)
+    __x &= __x - 1;
+  return __base + static_cast<unsigned>(__builtin_ctzll(__x));
+#endif
+}
+
+#if _LIBCPP_STD_VER > 17
+
+// The standard unsigned integer types (and the extended ones), but not bool
+// or the character types.
+template <class _Tp> struct __bit_is_unsigned_integer : is_unsigned<_Tp> {};
+template <> struct __bit_is_unsigned_integer<bool> : false_type {};
+template <> struct __bit_is_unsigned_integer<char> : false_type {};
+template <> struct __bit_is_unsigned_integer<wchar_t> : false_type {};
+#ifndef _LIBCPP_NO_HAS_CHAR8_T
+template <> struct __bit_is_unsigned_integer<char8_t> : false_type {};
+#endif
+#ifndef _LIBCPP_HAS_NO_UNICODE_CHARS
+template <> struct __bit_is_unsigned_integer<char16_t> : false_type {};
+template <> struct __bit_is_unsigned_integer<char32_t> : false_type {};
+#endif
+
+template <class _Tp>
+using __bit_enable_if_unsigned _LIBCPP_NODEBUG_TYPE = _EnableIf<__bit_is_unsigned_integer<_Tp>::value, int>;
+
+template <class _Tp> inline constexpr int __bit_digits = static_cast<int>(sizeof(_Tp) * __CHAR_BIT__);
+
+// The builtins only come in int, long and long long widths; narrower types
+// are widened and the extra leading zeros discounted.
+template <class _Tp> _LIBCPP_INLINE_VISIBILITY constexpr int __bit_count_lzero(_Tp __x) noexcept {
+  if (__x == 0)
+    return __bit_digits<_Tp>;
+  if constexpr (sizeof(_Tp) <= sizeof(unsigned))
+    return _VSTD::__libcpp_clz(static_cast<unsigned>(__x)) - (__bit_digits<unsigned> - __bit_digits<_Tp>);
+  else if constexpr (sizeof(_Tp) <= sizeof(unsigned long long))
+    return _VSTD::__libcpp_clz(static_cast<unsigned long long>(__x)) -
+           (__bit_digits<unsigned long long> - __bit_digits<_Tp>);
+  else {
+    const unsigned long long __hi = static_cast<unsigned long long>(__x >> 64);
+    return __hi != 0 ? _VSTD::__libcpp_clz(__hi)
+                     : 64 + _VSTD::__bit_count_lzero(static_cast<unsigned long long>(__x));
+  }
+}
+
+template <class _Tp> _LIBCPP_INLINE_VISIBILITY constexpr int __bit_count_rzero(_Tp __x) noexcept {
+  if (__x == 0)
+    return __bit_digits<_Tp>;
+  if constexpr (sizeof(_Tp) <= sizeof(unsigned long long))
+    return _VSTD::__libcpp_ctz(static_cast<unsigned long long>(__x));
+  else {
+    const unsigned long long __lo = static_cast<unsigned long long>(__x);
+    return __lo != 0 ? _VSTD::__libcpp_ctz(__lo) : 64 + _VSTD::__bit_count_rzero(static_cast<unsigned long long>(__x >> 64));
+  }
+}
+
+template <class _Tp, __bit_enable_if_unsigned<_Tp> = 0>
+_LIBCPP_INLINE_VISIBILITY constexpr int countl_zero(_Tp __x) noexcept {
+  return _VSTD::__bit_count_lzero(__x);
+}
+
+template <class _Tp, __bit_enable_if_unsigned<_Tp> = 0>
+_LIBCPP_INLINE_VISIBILITY constexpr int countl_one(_Tp __x) noexcept {
+  return _VSTD::__bit_count_lzero(static_cast<_Tp>(~__x));
+}
+
+template <class _Tp, __bit_enable_if_unsigned<_Tp> = 0>
+_LIBCPP_INLINE_VISIBILITY constexpr int countr_zero(_Tp __x) noexcept {
+  return _VSTD::__bit_count_rzero(__x);
+}
+
+template <class _Tp, __bit_enable_if_unsigned<_Tp> = 0>
+_LIBCPP_INLINE_VISIBILITY constexpr int countr_one(_Tp __x) noexcept {
+  return _VSTD::__bit_count_rzero(static_cast<_Tp>(~__x));
+}
+
+template <class _Tp, __bit_enable_if_unsigned<_Tp> = 0>
+_LIBCPP_INLINE_VISIBILITY constexpr int popcount(_Tp __x) noexcept {
+  if constexpr (sizeof(_Tp) <= sizeof(unsigned long long))
+    return _VSTD::__libcpp_popcount(static_cast<unsigned long long>(__x));
+  else
+    return _VSTD::__libcpp_popcount(static_cast<unsigned long long>(__x)) +
+           _VSTD::__libcpp_popcount(static_cast<unsigned long long>(__x >> 64));
+}
+
+template <class _Tp, __bit_enable_if_unsigned<_Tp> = 0>
+_LIBCPP_INLINE_VISIBILITY constexpr bool has_single_bit(_Tp __x) noexcept {
+  return __x != 0 && (__x & (__x - 1)) == 0;
+}
+
+template <class _Tp, __bit_enable_if_unsigned<_Tp> = 0>
+_LIBCPP_INLINE_VISIBILITY constexpr _Tp bit_width(_Tp __x) noexcept {
+  return static_cast<_Tp>(__bit_digits<_Tp> - _VSTD::__bit_count_lzero(__x));
+}
+
+#endif // _LIBCPP_STD_VER > 17
+
+_LIBCPP_END_NAMESPACE_STD
@@ -0,0 +1,679 @@
+// -*- C++ -*-
+//===---------------------------- bitmap ----------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+/*
+    bitmap synopsis (extension)
+
+namespace std
+{
+
+// Bit i of every bitmap below is bit i % 8 of byte i / 8, so a bitmap, a
+// dynamic_bitmap and a view over a std::byte buffer all agree on layout, and
+// any of them can be combined with any other of the same size.
+
+// The operations shared by all four types; x is anything convertible to
+// const_bitmap_view and must have the same size().
+//
+//     bool test(size_t pos) const;
+//     bool operator[](size_t pos) const;
+//     size_t count() const noexcept;
+//     bool all() const noexcept;  bool any() const noexcept;  bool none() const noexcept;
+//     size_t find_first() const noexcept;           // size() if none
+//     size_t find_next(size_t pos) const noexcept;  // first set bit > pos, size() if none
+//     size_t rank(size_t pos) const noexcept;       // set bits in [0, pos)
+//     size_t select(size_t k) const noexcept;       // position of the k-th set bit (from 0),
+//                                                   // size() if count() <= k
+//     size_t count_and(const_bitmap_view x) const noexcept;  // count() of *this & x
+//
+// and, for every type but const_bitmap_view:
+//
+//     reference operator[](size_t pos);
+//     D& set() noexcept;    D& set(size_t pos, bool val = true);
+//     D& reset() noexcept;  D& reset(size_t pos);
+//     D& flip() noexcept;   D& flip(size_t pos);
+//     D& operator&=(const_bitmap_view x) noexcept;
+//     D& operator|=(const_bitmap_view x) noexcept;
+//     D& operator^=(const_bitmap_view x) noexcept;
+//     D& and_not(const_bitmap_view x) noexcept;     // *this &= ~x
+
+// N bits held in the object. Not named bitset: it does not have std::bitset's
+// interface (to_ulong, to_string, the stream operators), so that name stays
+// with <bitset>.
+template <size_t N>
+class bitmap
+{
+public:
+    constexpr bitmap() noexcept;
+    constexpr bitmap(unsigned long long val) noexcept;
+
+    static constexpr size_t size() noexcept;
+    bitmap_view view() noexcept;
+    const_bitmap_view view() const noexcept;
+    operator const_bitmap_view() const noexcept;
+
+    bitmap operator~() const noexcept;
+    // the shared operations above
+};
+
+template <size_t N> bitmap<N> operator&(const bitmap<N>&, const bitmap<N>&) noexcept;
+template <size_t N> bitmap<N> operator|(const bitmap<N>&, const bitmap<N>&) noexcept;
+template <size_t N> bitmap<N> operator^(const bitmap<N>&, const bitmap<N>&) noexcept;
+
+class dynamic_bitmap
+{
+public:
+    dynamic_bitmap() noexcept;
+    explicit dynamic_bitmap(size_t n, bool val = false);
+    explicit dynamic_bitmap(const_bitmap_view x);
+    dynamic_bitmap(const dynamic_bitmap&);
+    dynamic_bitmap(dynamic_bitmap&&) noexcept;
+    dynamic_bitmap& operator=(const dynamic_bitmap&);
+    dynamic_bitmap& operator=(dynamic_bitmap&&) noexcept;
+    ~dynamic_bitmap();
+
+    size_t size() const noexcept;
+    void resize(size_t n, bool val = false);
+    void swap(dynamic_bitmap& x) noexcept;
+    bitmap_view view() noexcept;
+    const_bitmap_view view() const noexcept;
+    operator const_bitmap_view() const noexcept;
+
+    dynamic_bitmap operator~() const;
+    // the shared operations above
+};
+
+dynamic_bitmap operator&(const dynamic_bitmap&, const dynamic_bitmap&);
+dynamic_bitmap operator|(const dynamic_bitmap&, const dynamic_bitmap&);
+dynamic_bitmap operator^(const dynamic_bitmap&, const dynamic_bitmap&);
+void swap(dynamic_bitmap& x, dynamic_bitmap& y) noexcept;
+
+// Non-owning views of size() bits over (size() + 7) / 8 bytes of an existing
+// buffer, with no alignment requirement. Bits past size() in the last byte
+// are ignored by reads and preserved by writes.
+class bitmap_view
+{
+public:
+    constexpr bitmap_view(byte* data, size_t n) noexcept;
+    constexpr size_t size() const noexcept;
+    constexpr byte* data() const noexcept;
+    operator const_bitmap_view() const noexcept;
+    // the shared operations above
+};
+
+class const_bitmap_view
+{
+public:
+    constexpr const_bitmap_view(const byte* data, size_t n) noexcept;
+    constexpr size_t size() const noexcept;
+    constexpr const byte* data() const noexcept;
+    // the shared read operations above
+};
+
+bool operator==(const_bitmap_view x, const_bitmap_view y) noexcept;
+bool operator!=(const_bitmap_view x, const_bitmap_view y) noexcept;
+
+}  // std
+
+*/
+
+#include "__byte_ops.hh"
+#include "__config.hh"
+#include "bit.hh"
+#include "cstddef.hh"
+#include "new.hh"
+#include "type_traits.hh"
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#pragma GCC system_header
+#endif
+
+#if _LIBCPP_STD_VER > 14
+
+#if defined(__AVX2__) || (defined(__AVX512F__) && defined(__AVX512VPOPCNTDQ__))
+#include <immintrin.h>
+#endif
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+class _LIBCPP_TYPE_VIS bitmap_view;
+class _LIBCPP_TYPE_VIS const_bitmap_view;
+
+// Word access
+
+typedef unsigned long long __bit_word;
+static_assert(sizeof(__bit_word) * __CHAR_BIT__ == 64, "the bitmaps assume a 64-bit unsigned long long");
+
+// Word __k of a bitmap is the little-endian 64-bit value in bytes
+// [8 * __k, 8 * __k + 8), loaded without any alignment requirement.
+inline _LIBCPP_INLINE_VISIBILITY constexpr __bit_word __bitmap_to_le(__bit_word __w) noexcept {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  return __builtin_bswap64(__w);
+#else
+  return __w;
+#endif
+}
+
+inline _LIBCPP_INLINE_VISIBILITY __bit_word __bitmap_load(const unsigned char *__p) noexcept {
+  __bit_word __w;
+  __builtin_memcpy(&__w, __p, sizeof(__w));
+  return _VSTD::__bitmap_to_le(__w);
+}
+
+// The last word of a bitmap whose size is not a multiple of 64 only owns
+// (__nbits + 7) / 8 bytes, 0 < __nbits < 64. Bits at and past __nbits read as
+// zero.
+inline _LIBCPP_INLINE_VISIBILITY __bit_word __bitmap_load_partial(const unsigned char *__p, size_t __nbits) noexcept {
+  __bit_word __w = 0;
+  for (size_t __i = 0, __e = (__nbits + 7) / 8; __i != __e; ++__i)
+    __w |= static_cast<__bit_word>(__p[__i]) << (8 * __i);
+  return __w & ((__bit_word(1) << __nbits) - 1);
+}
+
+inline _LIBCPP_INLINE_VISIBILITY __bit_word __bitmap_word(const unsigned char *__p, size_t __nbits, size_t __k) noexcept {
+  return 64 * (__k + 1) <= __nbits ? _VSTD::__bitmap_load(__p + 8 * __k)
+                                   : _VSTD::__bitmap_load_partial(__p + 8 * __k, __nbits - 64 * __k);
+}
+
+// __bitmap_transform
+
+// __dst = __op(__a, __b) over __nbits bits; __dst may be __a or __b. Whole
+// bytes go through the vector byte kernel, and the last partial byte keeps
+// its bits past __nbits.
+template <class _Op>
+inline _LIBCPP_INLINE_VISIBILITY void __bitmap_transform(unsigned char *__dst, const unsigned char *__a,
+                                                         const unsigned char *__b, size_t __nbits, _Op __op) noexcept {
+  const size_t __nb = __nbits / 8;
+  _VSTD::__byte_transform(reinterpret_cast<byte *>(__dst), reinterpret_cast<const byte *>(__a),
+                          reinterpret_cast<const byte *>(__b), __nb, __op);
+  if (__nbits % 8 != 0) {
+    const unsigned __m = (1u << (__nbits % 8)) - 1;
+    __dst[__nb]        = static_cast<unsigned char>((__dst[__nb] & ~__m) | (__op(__a[__nb], __b[__nb]) & __m));
+  }
+}
+
+// Sets or clears bits [__first, __last).
+inline _LIBCPP_INLINE_VISIBILITY void __bitmap_assign_range(unsigned char *__p, size_t __first, size_t __last,
+                                                            bool __val) noexcept {
+  if (__first >= __last)
+    return;
+  size_t __fb = __first / 8;
+  const size_t __lb = __last / 8;
+  if (__fb == __lb) {
+    const unsigned __m = ((1u << (__last - __first)) - 1) << (__first % 8);
+    __p[__fb]          = static_cast<unsigned char>(__val ? __p[__fb] | __m : __p[__fb] & ~__m);
+    return;
+  }
+  if (__first % 8 != 0) {
+    const unsigned __m = (0xffu << (__first % 8)) & 0xffu;
+    __p[__fb]          = static_cast<unsigned char>(__val ? __p[__fb] | __m : __p[__fb] & ~__m);
+    ++__fb;
+  }
+  __builtin_memset(__p + __fb, __val ? 0xff : 0, __lb - __fb);
+  if (__last % 8 != 0) {
+    const unsigned __m = (1u << (__last % 8)) - 1;
+    __p[__lb]          = static_cast<unsigned char>(__val ? __p[__lb] | __m : __p[__lb] & ~__m);
+  }
+}
+
+// __bitmap_count
+
+// popcount(__op(__a, __b)) over __nbits bits. With AVX-512 VPOPCNTQ each
+// 64-byte block is one popcount; with AVX2 the nibble-table popcount of
+// Muła, Kurz and Lemire sums bytes with VPSADBW; otherwise it is one POPCNT
+// (or its emulation) per word.
+template <class _Op>
+inline _LIBCPP_INLINE_VISIBILITY size_t __bitmap_count(const unsigned char *__a, const unsigned char *__b,
+                                                       size_t __nbits, _Op __op) noexcept {
+  const size_t __full = __nbits / 64 * 8;
+  size_t __i          = 0;
+  size_t __n          = 0;
+#if defined(__AVX512F__) && defined(__AVX512VPOPCNTDQ__)
+  if (__full >= 64) {
+    __m512i __acc = _mm512_setzero_si512();
+    for (; __i + 64 <= __full; __i += 64)
+      __acc = _mm512_add_epi64(__acc, _mm512_popcnt_epi64(__op(_mm512_loadu_si512(__a + __i),
+                                                               _mm512_loadu_si512(__b + __i))));
+    long long __lanes[8];
+    _mm512_storeu_si512(__lanes, __acc);
+    for (long long __l : __lanes)
+      __n += static_cast<size_t>(__l);
+  }
+#elif defined(__AVX2__)
+  if (__full >= 32) {
+    const __m256i __lut  = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                            0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i __low  = _mm256_set1_epi8(0x0f);
+    __m256i __acc        = _mm256_setzero_si256();
+    for (; __i + 32 <= __full; __i += 32) {
+      const __m256i __v  = __op(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(__a + __i)),
+                               _mm256_loadu_si256(reinterpret_cast<const __m256i *>(__b + __i)));
+      const __m256i __lo = _mm256_shuffle_epi8(__lut, _mm256_and_si256(__v, __low));
+      const __m256i __hi = _mm256_shuffle_epi8(__lut, _mm256_and_si256(_mm256_srli_epi16(__v, 4), __low));
+      __acc = _mm256_add_epi64(__acc, _mm256_sad_epu8(_mm256_add_epi8(__lo, __hi), _mm256_setzero_si256()));
+    }
+    __n += static_cast<size_t>(_mm256_extract_epi64(__acc, 0)) + static_cast<size_t>(_mm256_extract_epi64(__acc, 1)) +
+           static_cast<size_t>(_mm256_extract_epi64(__acc, 2)) + static_cast<size_t>(_mm256_extract_epi64(__acc, 3));
+  }
+#endif
+  for (; __i != __full; __i += 8)
+    __n += static_cast<size_t>(_VSTD::__libcpp_popcount(__op(_VSTD::__bitmap_load(__a + __i),
+                                                             _VSTD::__bitmap_load(__b + __i))));
+  if (__nbits % 64 != 0)
+    __n += static_cast<size_t>(_VSTD::__libcpp_popcount(__op(_VSTD::__bitmap_load_partial(__a + __i, __nbits % 64),
+                                                             _VSTD::__bitmap_load_partial(__b + __i, __nbits % 64))));
+  return __n;
+}
+
+inline _LIBCPP_INLINE_VISIBILITY bool __bitmap_equal(const unsigned char *__a, const unsigned char *__b,
+                                                    size_t __nbits) noexcept {
+  const size_t __nb = __nbits / 8;
+  if (__nb != 0 && __builtin_memcmp(__a, __b, __nb) != 0)
+    return false;
+  return __nbits % 8 == 0 || ((__a[__nb] ^ __b[__nb]) & ((1u << (__nbits % 8)) - 1)) == 0;
+}
+
+// First set bit at or after __pos, or __nbits. Runs of zero words are
+// skipped four at a time.
+inline _LIBCPP_INLINE_VISIBILITY size_t __bitmap_find_next(const unsigned char *__p, size_t __nbits,
+                                                           size_t __pos) noexcept {
+  if (__pos >= __nbits)
+    return __nbits;
+  const size_t __nwords = (__nbits + 63) / 64;
+  const size_t __full   = __nbits / 64;
+  size_t __k            = __pos / 64;
+  __bit_word __w        = _VSTD::__bitmap_word(__p, __nbits, __k) & (~__bit_word(0) << (__pos % 64));
+  while (__w == 0) {
+    if (++__k == __nwords)
+      return __nbits;
+    for (; __k + 4 <= __full; __k += 4) {
+      const unsigned char *__q = __p + 8 * __k;
+      if ((_VSTD::__bitmap_load(__q) | _VSTD::__bitmap_load(__q + 8) | _VSTD::__bitmap_load(__q + 16) |
+           _VSTD::__bitmap_load(__q + 24)) != 0)
+        break;
+    }
+    if (__k == __nwords)
+      return __nbits;
+    __w = _VSTD::__bitmap_word(__p, __nbits, __k);
+  }
+  return 64 * __k + static_cast<size_t>(_VSTD::__libcpp_ctz(__w));
+}
+
+// Position of the set bit with __k set bits before it, or __nbits. Whole
+// cache lines are skipped with the vector popcount, then single words, and
+// the final word is resolved with __libcpp_select64.
+inline _LIBCPP_INLINE_VISIBILITY size_t __bitmap_select(const unsigned char *__p, size_t __nbits, size_t __k) noexcept {
+  size_t __i = 0;
+  for (; 64 * (__i + 8) <= __nbits; __i += 8) {
+    const size_t __c = _VSTD::__bitmap_count(__p + 8 * __i, __p + 8 * __i, 512, __bit_and_op());
+    if (__k < __c)
+      break;
+    __k -= __c;
+  }
+  for (const size_t __nwords = (__nbits + 63) / 64; __i != __nwords; ++__i) {
+    const __bit_word __w = _VSTD::__bitmap_word(__p, __nbits, __i);
+    const size_t __c     = static_cast<size_t>(_VSTD::__libcpp_popcount(__w));
+    if (__k < __c)
+      return 64 * __i + _VSTD::__libcpp_select64(__w, static_cast<unsigned>(__k));
+    __k -= __c;
+  }
+  return __nbits;
+}
+
+// __bitmap_reference
+
+class __bitmap_reference {
+  unsigned char *__p_;
+  unsigned char __mask_;
+
+public:
+  _LIBCPP_INLINE_VISIBILITY __bitmap_reference(unsigned char *__p, size_t __pos) noexcept
+      : __p_(__p + __pos / 8), __mask_(static_cast<unsigned char>(1u << (__pos % 8))) {}
+
+  _LIBCPP_INLINE_VISIBILITY operator bool() const noexcept { return (*__p_ & __mask_) != 0; }
+  _LIBCPP_INLINE_VISIBILITY bool operator~() const noexcept { return (*__p_ & __mask_) == 0; }
+
+  _LIBCPP_INLINE_VISIBILITY __bitmap_reference &operator=(bool __x) noexcept {
+    *__p_ = static_cast<unsigned char>(__x ? *__p_ | __mask_ : *__p_ & ~__mask_);
+    return *this;
+  }
+  _LIBCPP_INLINE_VISIBILITY __bitmap_reference &operator=(const __bitmap_reference &__x) noexcept {
+    return *this = static_cast<bool>(__x);
+  }
+  _LIBCPP_INLINE_VISIBILITY __bitmap_reference &flip() noexcept {
+    *__p_ = static_cast<unsigned char>(*__p_ ^ __mask_);
+    return *this;
+  }
+};
+
+// __bitmap_const_ops, __bitmap_ops
+
+// The shared operations, for a _Derived that provides size() and __bytes().
+template <class _Derived> class _LIBCPP_TEMPLATE_VIS __bitmap_const_ops {
+  _LIBCPP_INLINE_VISIBILITY const unsigned char *__b() const noexcept {
+    return static_cast<const _Derived &>(*this).__bytes();
+  }
+  _LIBCPP_INLINE_VISIBILITY size_t __n() const noexcept { return static_cast<const _Derived &>(*this).size(); }
+
+public:
+  _LIBCPP_INLINE_VISIBILITY bool test(size_t __pos) const noexcept { return (__b()[__pos / 8] >> (__pos % 8)) & 1; }
+  _LIBCPP_INLINE_VISIBILITY bool operator[](size_t __pos) const noexcept { return test(__pos); }
+
+  _LIBCPP_INLINE_VISIBILITY size_t count() const noexcept {
+    return _VSTD::__bitmap_count(__b(), __b(), __n(), __bit_and_op());
+  }
+  _LIBCPP_INLINE_VISIBILITY bool any() const noexcept { return find_first() != __n(); }
+  _LIBCPP_INLINE_VISIBILITY bool none() const noexcept { return !any(); }
+  _LIBCPP_INLINE_VISIBILITY bool all() const noexcept { return count() == __n(); }
+
+  _LIBCPP_INLINE_VISIBILITY size_t find_first() const noexcept { return _VSTD::__bitmap_find_next(__b(), __n(), 0); }
+  _LIBCPP_INLINE_VISIBILITY size_t find_next(size_t __pos) const noexcept {
+    return __pos + 1 >= __n() ? __n() : _VSTD::__bitmap_find_next(__b(), __n(), __pos + 1);
+  }
+
+  _LIBCPP_INLINE_VISIBILITY size_t rank(size_t __pos) const noexcept {
+    return _VSTD::__bitmap_count(__b(), __b(), __pos < __n() ? __pos : __n(), __bit_and_op());
+  }
+  _LIBCPP_INLINE_VISIBILITY size_t select(size_t __k) const noexcept {
+    return _VSTD::__bitmap_select(__b(), __n(), __k);
+  }
+
+  size_t count_and(const_bitmap_view __x) const noexcept;
+};
+
+template <class _Derived> class _LIBCPP_TEMPLATE_VIS __bitmap_ops : public __bitmap_const_ops<_Derived> {
+  _LIBCPP_INLINE_VISIBILITY _Derived &__self() noexcept { return static_cast<_Derived &>(*this); }
+  _LIBCPP_INLINE_VISIBILITY unsigned char *__b() noexcept { return __self().__bytes(); }
+  _LIBCPP_INLINE_VISIBILITY size_t __n() const noexcept { return static_cast<const _Derived &>(*this).size(); }
+
+  template <class _Op> _Derived &__apply(const_bitmap_view __x, _Op __op) noexcept;
+
+public:
+  typedef __bitmap_reference reference;
+
+  using __bitmap_const_ops<_Derived>::operator[];
+  _LIBCPP_INLINE_VISIBILITY reference operator[](size_t __pos) noexcept { return reference(__b(), __pos); }
+
+  _LIBCPP_INLINE_VISIBILITY _Derived &set() noexcept {
+    _VSTD::__bitmap_assign_range(__b(), 0, __n(), true);
+    return __self();
+  }
+  _LIBCPP_INLINE_VISIBILITY _Derived &set(size_t __pos, bool __val = true) noexcept {
+    reference(__b(), __pos) = __val;
+    return __self();
+  }
+  _LIBCPP_INLINE_VISIBILITY _Derived &reset() noexcept {
+    _VSTD::__bitmap_assign_range(__b(), 0, __n(), false);
+    return __self();
+  }
+  _LIBCPP_INLINE_VISIBILITY _Derived &reset(size_t __pos) noexcept { return set(__pos, false); }
+  _LIBCPP_INLINE_VISIBILITY _Derived &flip() noexcept {
+    _VSTD::__bitmap_transform(__b(), __b(), __b(), __n(), __bit_not_op());
+    return __self();
+  }
+  _LIBCPP_INLINE_VISIBILITY _Derived &flip(size_t __pos) noexcept {
+    reference(__b(), __pos).flip();
+    return __self();
+  }
+
+  _Derived &operator&=(const_bitmap_view __x) noexcept;
+  _Derived &operator|=(const_bitmap_view __x) noexcept;
+  _Derived &operator^=(const_bitmap_view __x) noexcept;
+  _Derived &and_not(const_bitmap_view __x) noexcept;
+};
+
+// const_bitmap_view, bitmap_view
+
+class _LIBCPP_TYPE_VIS const_bitmap_view : public __bitmap_const_ops<const_bitmap_view> {
+  const byte *__p_;
+  size_t __n_;
+
+public:
+  _LIBCPP_INLINE_VISIBILITY constexpr const_bitmap_view(const byte *__p, size_t __n) noexcept : __p_(__p), __n_(__n) {}
+
+  _LIBCPP_INLINE_VISIBILITY constexpr size_t size() const noexcept { return __n_; }
+  _LIBCPP_INLINE_VISIBILITY constexpr const byte *data() const noexcept { return __p_; }
+  _LIBCPP_INLINE_VISIBILITY const unsigned char *__bytes() const noexcept {
+    return reinterpret_cast<const unsigned char *>(__p_);
+  }
+};
+
+class _LIBCPP_TYPE_VIS bitmap_view : public __bitmap_ops<bitmap_view> {
+  byte *__p_;
+  size_t __n_;
+
+public:
+  _LIBCPP_INLINE_VISIBILITY constexpr bitmap_view(byte *__p, size_t __n) noexcept : __p_(__p), __n_(__n) {}
+
+  _LIBCPP_INLINE_VISIBILITY constexpr size_t size() const noexcept { return __n_; }
+  _LIBCPP_INLINE_VISIBILITY constexpr byte *data() const noexcept { return __p_; }
+  _LIBCPP_INLINE_VISIBILITY unsigned char *__bytes() const noexcept { return reinterpret_cast<unsigned char *>(__p_); }
+  _LIBCPP_INLINE_VISIBILITY operator const_bitmap_view() const noexcept { return const_bitmap_view(__p_, __n_); }
+};
+
+template <class _Derived>
+inline size_t __bitmap_const_ops<_Derived>::count_and(const_bitmap_view __x) const noexcept {
+  return _VSTD::__bitmap_count(__b(), __x.__bytes(), __n(), __bit_and_op());
+}
+
+template <class _Derived>
+template <class _Op>
+inline _Derived &__bitmap_ops<_Derived>::__apply(const_bitmap_view __x, _Op __op) noexcept {
+  _VSTD::__bitmap_transform(__b(), __b(), __x.__bytes(), __n(), __op);
+  return __self();
+}
+
+template <class _Derived>
+inline _Derived &__bitmap_ops<_Derived>::operator&=(const_bitmap_view __x) noexcept {
+  return __apply(__x, __bit_and_op());
+}
+
+template <class _Derived>
+inline _Derived &__bitmap_ops<_Derived>::operator|=(const_bitmap_view __x) noexcept {
+  return __apply(__x, __bit_or_op());
+}
+
+template <class _Derived>
+inline _Derived &__bitmap_ops<_Derived>::operator^=(const_bitmap_view __x) noexcept {
+  return __apply(__x, __bit_xor_op());
+}
+
+template <class _Derived> inline _Derived &__bitmap_ops<_Derived>::and_not(const_bitmap_view __x) noexcept {
+  return __apply(__x, __bit_and_not_op());
+}
+
+inline _LIBCPP_INLINE_VISIBILITY bool operator==(const_bitmap_view __x, const_bitmap_view __y) noexcept {
+  return __x.size() == __y.size() && _VSTD::__bitmap_equal(__x.__bytes(), __y.__bytes(), __x.size());
+}
+
+inline _LIBCPP_INLINE_VISIBILITY bool operator!=(const_bitmap_view __x, const_bitmap_view __y) noexcept {
+  return !(__x == __y);
+}
+
+// bitmap
+
+// Whole words, so the vector kernels never touch a partial word until the
+// end; the bits past _Np are kept zero.
+template <size_t _Np> class _LIBCPP_TEMPLATE_VIS bitmap : public __bitmap_ops<bitmap<_Np>> {
+  static constexpr size_t __nwords = _Np == 0 ? 1 : (_Np + 63) / 64;
+
+  __bit_word __words_[__nwords];
+
+  static constexpr __bit_word __first_word(unsigned long long __v) noexcept {
+    return _VSTD::__bitmap_to_le(_Np >= 64 ? __v : __v & ((1ull << _Np) - 1));
+  }
+
+public:
+  _LIBCPP_INLINE_VISIBILITY constexpr bitmap() noexcept : __words_{} {}
+  _LIBCPP_INLINE_VISIBILITY constexpr bitmap(unsigned long long __v) noexcept : __words_{__first_word(__v)} {}
+
+  static _LIBCPP_INLINE_VISIBILITY constexpr size_t size() noexcept { return _Np; }
+
+  _LIBCPP_INLINE_VISIBILITY unsigned char *__bytes() noexcept { return reinterpret_cast<unsigned char *>(__words_); }
+  _LIBCPP_INLINE_VISIBILITY const unsigned char *__bytes() const noexcept {
+    return reinterpret_cast<const unsigned char *>(__words_);
+  }
+
+  _LIBCPP_INLINE_VISIBILITY bitmap_view view() noexcept { return bitmap_view(reinterpret_cast<byte *>(__words_), _Np); }
+  _LIBCPP_INLINE_VISIBILITY const_bitmap_view view() const noexcept {
+    return const_bitmap_view(reinterpret_cast<const byte *>(__words_), _Np);
+  }
+  _LIBCPP_INLINE_VISIBILITY operator const_bitmap_view() const noexcept { return view(); }
+
+  _LIBCPP_INLINE_VISIBILITY bitmap operator~() const noexcept { return bitmap(*this).flip(); }
+
+  friend _LIBCPP_INLINE_VISIBILITY bitmap operator&(const bitmap &__x, const bitmap &__y) noexcept {
+    return bitmap(__x) &= __y;
+  }
+  friend _LIBCPP_INLINE_VISIBILITY bitmap operator|(const bitmap &__x, const bitmap &__y) noexcept {
+    return bitmap(__x) |= __y;
+  }
+  friend _LIBCPP_INLINE_VISIBILITY bitmap operator^(const bitmap &__x, const bitmap &__y) noexcept {
+    return bitmap(__x) ^= __y;
+  }
+};
+
+// dynamic_bitmap
+
+// Storage is whole words on a 64-byte boundary, so the 512-bit loads of the
+// AVX-512 count never split a cache line; the bits past size() are kept zero.
+class _LIBCPP_TYPE_VIS dynamic_bitmap : public __bitmap_ops<dynamic_bitmap> {
+  __bit_word *__words_;
+  size_t __size_;
+
+  static _LIBCPP_INLINE_VISIBILITY size_t __word_count(size_t __n) noexcept { return (__n + 63) / 64; }
+
+  static _LIBCPP_INLINE_VISIBILITY __bit_word *__allocate(size_t __nwords) {
+    return __nwords == 0 ? nullptr
+                         : static_cast<__bit_word *>(_VSTD::__libcpp_allocate(__nwords * sizeof(__bit_word), 64));
+  }
+  static _LIBCPP_INLINE_VISIBILITY void __deallocate(__bit_word *__p, size_t __nwords) noexcept {
+    if (__p)
+      _VSTD::__libcpp_deallocate(__p, __nwords * sizeof(__bit_word), 64);
+  }
+
+  _LIBCPP_INLINE_VISIBILITY void __copy_from(const_bitmap_view __x) {
+    __words_ = __allocate(__word_count(__x.size()));
+    __size_  = __x.size();
+    if (__words_) {
+      __words_[__word_count(__size_) - 1] = 0;
+      __builtin_memcpy(__words_, __x.__bytes(), (__size_ + 7) / 8);
+      _VSTD::__bitmap_assign_range(__bytes(), __size_, 64 * __word_count(__size_), false);
+    }
+  }
+
+public:
+  _LIBCPP_INLINE_VISIBILITY dynamic_bitmap() noexcept : __words_(nullptr), __size_(0) {}
+
+  explicit dynamic_bitmap(size_t __n, bool __val = false) : __words_(__allocate(__word_count(__n))), __size_(__n) {
+    if (__words_) {
+      __builtin_memset(__words_, 0, __word_count(__n) * sizeof(__bit_word));
+      if (__val)
+        set();
+    }
+  }
+
+  explicit dynamic_bitmap(const_bitmap_view __x) { __copy_from(__x); }
+
+  dynamic_bitmap(const dynamic_bitmap &__x) { __copy_from(__x); }
+
+  _LIBCPP_INLINE_VISIBILITY dynamic_bitmap(dynamic_bitmap &&__x) noexcept : __words_(__x.__words_), __size_(__x.__size_) {
+    __x.__words_ = nullptr;
+    __x.__size_  = 0;
+  }
+
+  dynamic_bitmap &operator=(const dynamic_bitmap &__x) {
+    if (this != &__x) {
+      if (__word_count(__size_) == __word_count(__x.__size_)) {
+        if (__words_)
+          __builtin_memcpy(__words_, __x.__words_, __word_count(__size_) * sizeof(__bit_word));
+        __size_ = __x.__size_;
+      } else
+        dynamic_bitmap(__x).swap(*this);
+    }
+    return *this;
+  }
+
+  _LIBCPP_INLINE_VISIBILITY dynamic_bitmap &operator=(dynamic_bitmap &&__x) noexcept {
+    dynamic_bitmap(_VSTD::move(__x)).swap(*this);
+    return *this;
+  }
+
+  _LIBCPP_INLINE_VISIBILITY ~dynamic_bitmap() { __deallocate(__words_, __word_count(__size_)); }
+
+  _LIBCPP_INLINE_VISIBILITY size_t size() const noexcept { return __size_; }
+
+  void resize(size_t __n, bool __val = false) {
+    const size_t __old = __size_;
+    if (__word_count(__n) != __word_count(__old)) {
+      __bit_word *__nw          = __allocate(__word_count(__n));
+      const size_t __keep_words = __word_count(__n) < __word_count(__old) ? __word_count(__n) : __word_count(__old);
+      if (__keep_words != 0)
+        __builtin_memcpy(__nw, __words_, __keep_words * sizeof(__bit_word));
+      if (__word_count(__n) > __keep_words)
+        __builtin_memset(__nw + __keep_words, 0, (__word_count(__n) - __keep_words) * sizeof(__bit_word));
+      __deallocate(__words_, __word_count(__old));
+      __words_ = __nw;
+    }
+    __size_ = __n;
+    if (__n < __old)
+      _VSTD::__bitmap_assign_range(__bytes(), __n, 64 * __word_count(__n), false);
+    else if (__val)
+      _VSTD::__bitmap_assign_range(__bytes(), __old, __n, true);
+  }
+
+  _LIBCPP_INLINE_VISIBILITY void swap(dynamic_bitmap &__x) noexcept {
+    __bit_word *__w = __words_;
+    __words_        = __x.__words_;
+    __x.__words_    = __w;
+    const size_t __s = __size_;
+    __size_         = __x.__size_;
+    __x.__size_     = __s;
+  }
+
+  _LIBCPP_INLINE_VISIBILITY unsigned char *__bytes() noexcept { return reinterpret_cast<unsigned char *>(__words_); }
+  _LIBCPP_INLINE_VISIBILITY const unsigned char *__bytes() const noexcept {
+    return reinterpret_cast<const unsigned char *>(__words_);
+  }
+
+  _LIBCPP_INLINE_VISIBILITY bitmap_view view() noexcept { return bitmap_view(reinterpret_cast<byte *>(__words_), __size_); }
+  _LIBCPP_INLINE_VISIBILITY const_bitmap_view view() const noexcept {
+    return const_bitmap_view(reinterpret_cast<const byte *>(__words_), __size_);
+  }
+  _LIBCPP_INLINE_VISIBILITY operator const_bitmap_view() const noexcept { return view(); }
+
+  _LIBCPP_INLINE_VISIBILITY dynamic_bitmap operator~() const {
+    dynamic_bitmap __r(*this);
+    __r.flip();
+    return __r;
+  }
+
+  friend _LIBCPP_INLINE_VISIBILITY dynamic_bitmap operator&(const dynamic_bitmap &__x, const dynamic_bitmap &__y) {
+    dynamic_bitmap __r(__x);
+    __r &= __y;
+    return __r;
+  }
+  friend _LIBCPP_INLINE_VISIBILITY dynamic_bitmap operator|(const dynamic_bitmap &__x, const dynamic_bitmap &__y) {
+    dynamic_bitmap __r(__x);
+    __r |= __y;
+    return __r;
+  }
+  friend _LIBCPP_INLINE_VISIBILITY dynamic_bitmap operator^(const dynamic_bitmap &__x, const dynamic_bitmap &__y) {
+    dynamic_bitmap __r(__x);
+    __r ^= __y;
+    return __r;
+  }
+};
+
+inline _LIBCPP_INLINE_VISIBILITY void swap(dynamic_bitmap &__x, dynamic_bitmap &__y) noexcept { __x.swap(__y); }
+
+_LIBCPP_END_NAMESPACE_STD
+
+#endif // _LIBCPP_STD_VER > 14
@@ -0,0 +1,1357 @@
+// -*- C++ -*-
+//===------------------------------ charconv ------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+/*
+    charconv synopsis
+
+namespace std {
+
+  // floating-point format for primitive numerical conversion
+  enum class chars_format {
+    scientific = unspecified,
+    fixed = unspecified,
+    hex = unspecified,
+    general = fixed | scientific
+  };
+
+  // 23.20.2, primitive numerical output conversion
+  struct to_chars_result {
+    char* ptr;
+    errc ec;
+    friend bool operator==(const to_chars_result&, const to_chars_result&) = default; // since C++20
+  };
+
+  to_chars_result to_chars(char* first, char* last, see below value,
+                           int base = 10);
+  to_chars_result to_chars(char* first, char* last, bool value,
+                           int base = 10) = delete;
+
+  // 23.20.3, primitive numerical input conversion
+  struct from_chars_result {
+    const char* ptr;
+    errc ec;
+    friend bool operator==(const from_chars_result&, const from_chars_result&) = default; // since C++20
+  };
+
+  from_chars_result from_chars(const char* first, const char* last,
+                               see below& value, int base = 10);
+
+  to_chars_result to_chars(char* first, char* last, float value);
+  to_chars_result to_chars(char* first, char* last, double value);
+  to_chars_result to_chars(char* first, char* last, float value, chars_format fmt);
+  to_chars_result to_chars(char* first, char* last, double value, chars_format fmt);
+  to_chars_result to_chars(char* first, char* last, float value, chars_format fmt,
+                           int precision);
+  to_chars_result to_chars(char* first, char* last, double value, chars_format fmt,
+                           int precision);
+
+  from_chars_result from_chars(const char* first, const char* last,
+                               float& value, chars_format fmt = chars_format::general);
+  from_chars_result from_chars(const char* first, const char* last,
+                               double& value, chars_format fmt = chars_format::general);
+
+} // namespace std
+
+    "see below" is every integral type other than bool, including the
+    character types and, unless _LIBCPP_HAS_NO_INT128 is defined, __int128_t
+    and __uint128_t. base must be in [2, 36].
+
+    The floating-point to_chars without a precision give the shortest
+    representation that from_chars reads back as the same value. With one,
+    they round the exact value as printf's %.*e, %.*f, %.*g and %.*a do, to
+    nearest with ties to even; a negative precision is 6, or the shortest
+    for hex. There are no long double overloads.
+
+*/
+
+#include "__charconv_tables.hh"
+#include "__config.hh"
+#include "__errc.hh"
+#include "cstddef.hh"
+#include "type_traits.hh"
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#pragma GCC system_header
+#endif
+
+#if _LIBCPP_STD_VER > 14
+
+#if defined(__SSE4_1__)
+#include <immintrin.h>
+#endif
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+enum class chars_format { scientific = 0x1, fixed = 0x2, hex = 0x4, general = fixed | scientific };
+
+struct _LIBCPP_TYPE_VIS to_chars_result {
+  char *ptr;
+  errc ec;
+#if _LIBCPP_STD_VER > 17
+  _LIBCPP_INLINE_VISIBILITY friend bool operator==(const to_chars_result &, const to_chars_result &) = default;
+#endif
+};
+
+struct _LIBCPP_TYPE_VIS from_chars_result {
+  const char *ptr;
+  errc ec;
+#if _LIBCPP_STD_VER > 17
+  _LIBCPP_INLINE_VISIBILITY friend bool operator==(const from_chars_result &, const from_chars_result &) = default;
+#endif
+};
+
+template <class _Tp>
+using __enable_if_charconv_integral _LIBCPP_NODEBUG_TYPE =
+    _EnableIf<is_integral<_Tp>::value && !_IsSame<typename remove_cv<_Tp>::type, bool>::value, int>;
+
+// Tables
+
+struct __charconv_digit_pairs {
+  char __c_[200];
+};
+
+inline constexpr __charconv_digit_pairs __charconv_make_digit_pairs() noexcept {
+  __charconv_digit_pairs __t{};
+  for (int __i = 0; __i != 100; ++__i) {
+    __t.__c_[2 * __i]     = static_cast<char>('0' + __i / 10);
+    __t.__c_[2 * __i + 1] = static_cast<char>('0' + __i % 10);
+  }
+  return __t;
+}
+
+// "00" "01" ... "99": two digits per division by 100.
+inline constexpr __charconv_digit_pairs __charconv_digit_pairs_table = _VSTD::__charconv_make_digit_pairs();
+
+inline constexpr char __charconv_digits[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+inline constexpr unsigned long long __charconv_pow10[20] = {
+    1ull,           10ull,           100ull,           1000ull,           10000ull,
+    100000ull,      1000000ull,      10000000ull,      100000000ull,      1000000000ull,
+    10000000000ull, 100000000000ull, 1000000000000ull, 10000000000000ull, 100000000000000ull,
+    1000000000000000ull, 10000000000000000ull, 100000000000000000ull, 1000000000000000000ull,
+    10000000000000000000ull};
+
+// The number of decimal digits of the largest value of _Up.
+template <class _Up> inline constexpr int __charconv_max_digits10() noexcept {
+  int __n = 0;
+  for (_Up __x = static_cast<_Up>(-1); __x != 0; __x /= 10)
+    ++__n;
+  return __n;
+}
+
+// to_chars
+
+// The number of decimal digits of __x, without a loop: the bit width times
+// log10(2) (1233 / 4096) is either right or one short, which a single
+// comparison with a power of ten settles. __x | 1 has the same number of
+// digits as __x, except for 0, where it gives the wanted 1.
+inline _LIBCPP_INLINE_VISIBILITY int __charconv_width10(unsigned long long __x) noexcept {
+  __x |= 1;
+  const int __t = ((64 - __builtin_clzll(__x)) * 1233) >> 12;
+  return __t + (__x >= __charconv_pow10[__t]);
+}
+
+// Writes __x backwards, ending at __end; returns where it starts.
+inline _LIBCPP_INLINE_VISIBILITY char *__charconv_write10(char *__end, unsigned long long __x) noexcept {
+  while (__x >= 100) {
+    const unsigned __r = static_cast<unsigned>(__x % 100);
+    __x /= 100;
+    __end -= 2;
+    __builtin_memcpy(__end, __charconv_digit_pairs_table.__c_ + 2 * __r, 2);
+  }
+  if (__x >= 10) {
+    __end -= 2;
+    __builtin_memcpy(__end, __charconv_digit_pairs_table.__c_ + 2 * __x, 2);
+  } else
+    *--__end = static_cast<char>('0' + __x);
+  return __end;
+}
+
+inline _LIBCPP_INLINE_VISIBILITY to_chars_result __to_chars_copy(char *__first, char *__last, const char *__p,
+                                                                 const char *__end) noexcept {
+  if (__last - __first < __end - __p)
+    return to_chars_result{__last, errc::value_too_large};
+  __builtin_memcpy(__first, __p, static_cast<size_t>(__end - __p));
+  return to_chars_result{__first + (__end - __p), errc()};
+}
+
+// Any base, through a buffer large enough for base 2.
+template <class _Up>
+inline _LIBCPP_INLINE_VISIBILITY to_chars_result __to_chars_base(char *__first, char *__last, _Up __x,
+                                                                 int __base) noexcept {
+  char __buf[sizeof(_Up) * __CHAR_BIT__];
+  char *const __end = __buf + sizeof(__buf);
+  char *__p         = __end;
+  if ((__base & (__base - 1)) == 0) {
+    const int __shift     = __builtin_ctz(static_cast<unsigned>(__base));
+    const unsigned __mask = static_cast<unsigned>(__base - 1);
+    do {
+      *--__p = __charconv_digits[static_cast<unsigned>(__x) & __mask];
+      __x >>= __shift;
+    } while (__x != 0);
+  } else {
+    const _Up __b = static_cast<_Up>(__base);
+    do {
+      *--__p = __charconv_digits[static_cast<unsigned>(__x % __b)];
+      __x /= __b;
+    } while (__x != 0);
+  }
+  return _VSTD::__to_chars_copy(__first, __last, __p, __end);
+}
+
+inline _LIBCPP_INLINE_VISIBILITY to_chars_result __to_chars_unsigned(char *__first, char *__last,
+                                                                     unsigned long long __x, int __base) noexcept {
+  if (__base != 10)
+    return _VSTD::__to_chars_base(__first, __last, __x, __base);
+  const int __n = _VSTD::__charconv_width10(__x);
+  if (__last - __first < __n)
+    return to_chars_result{__last, errc::value_too_large};
+  _VSTD::__charconv_write10(__first + __n, __x);
+  return to_chars_result{__first + __n, errc()};
+}
+
+#ifndef _LIBCPP_HAS_NO_INT128
+// Peels off 19 digits at a time until the rest fits in 64 bits.
+inline _LIBCPP_INLINE_VISIBILITY to_chars_result __to_chars_unsigned(char *__first, char *__last, __uint128_t __x,
+                                                                     int __base) noexcept {
+  if (__x <= static_cast<unsigned long long>(-1))
+    return _VSTD::__to_chars_unsigned(__first, __last, static_cast<unsigned long long>(__x), __base);
+  if (__base != 10)
+    return _VSTD::__to_chars_base(__first, __last, __x, __base);
+  char __buf[40];
+  char *const __end = __buf + sizeof(__buf);
+  char *__p         = __end;
+  do {
+    const unsigned long long __r = static_cast<unsigned long long>(__x % __charconv_pow10[19]);
+    __x /= __charconv_pow10[19];
+    char *const __q = __p - 19;
+    for (__p = _VSTD::__charconv_write10(__p, __r); __p != __q;)
+      *--__p = '0';
+  } while (__x > static_cast<unsigned long long>(-1));
+  __p = _VSTD::__charconv_write10(__p, static_cast<unsigned long long>(__x));
+  return _VSTD::__to_chars_copy(__first, __last, __p, __end);
+}
+#endif
+
+template <class _Tp, __enable_if_charconv_integral<_Tp> = 0>
+inline _LIBCPP_INLINE_VISIBILITY to_chars_result to_chars(char *__first, char *__last, _Tp __value,
+                                                          int __base = 10) {
+  typedef typename make_unsigned<_Tp>::type _Up;
+  _Up __x = static_cast<_Up>(__value);
+  if constexpr (is_signed<_Tp>::value)
+    if (__value < 0) {
+      if (__first == __last)
+        return to_chars_result{__last, errc::value_too_large};
+      *__first++ = '-';
+      __x        = static_cast<_Up>(_Up(0) - __x);
+    }
+  typedef _If<sizeof(_Up) <= sizeof(unsigned long long), unsigned long long, _Up> _Wp;
+  return _VSTD::__to_chars_unsigned(__first, __last, static_cast<_Wp>(__x), __base);
+}
+
+to_chars_result to_chars(char *, char *, bool, int = 10) = delete;
+
+// from_chars
+
+inline _LIBCPP_INLINE_VISIBILITY unsigned long long __charconv_load8(const char *__p) noexcept {
+  unsigned long long __v;
+  __builtin_memcpy(&__v, __p, 8);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  __v = __builtin_bswap64(__v);
+#endif
+  return __v;
+}
+
+// Whether all eight bytes are '0'...'9': the high nibble of each must be 3,
+// also after adding 6 (which carries out of anything above '9').
+inline _LIBCPP_INLINE_VISIBILITY bool __charconv_is_8_digits(unsigned long long __v) noexcept {
+  return ((__v & 0xf0f0f0f0f0f0f0f0ull) | (((__v + 0x0606060606060606ull) & 0xf0f0f0f0f0f0f0f0ull) >> 4)) ==
+         0x3333333333333333ull;
+}
+
+// Eight digits to their value in three multiplications, combining adjacent
+// digits, then pairs, then quadruples (Lemire).
+inline _LIBCPP_INLINE_VISIBILITY unsigned long long __charconv_parse_8_digits(const char *__p) noexcept {
+  unsigned long long __v = _VSTD::__charconv_load8(__p) - 0x3030303030303030ull;
+  __v                    = __v * 10 + (__v >> 8);
+  return (((__v & 0x000000ff000000ffull) * (100 + (1000000ull << 32))) +
+          (((__v >> 16) & 0x000000ff000000ffull) * (1 + (10000ull << 32)))) >>
+         32;
+}
+
+inline _LIBCPP_INLINE_VISIBILITY unsigned long long __charconv_parse_16_digits(const char *__p) noexcept {
+#if defined(__SSE4_1__)
+  __m128i __v = _mm_sub_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(__p)), _mm_set1_epi8('0'));
+  __v         = _mm_maddubs_epi16(__v, _mm_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1));
+  __v         = _mm_madd_epi16(__v, _mm_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1));
+  __v         = _mm_packus_epi32(__v, __v);
+  __v         = _mm_madd_epi16(__v, _mm_setr_epi16(10000, 1, 10000, 1, 10000, 1, 10000, 1));
+  const unsigned long long __r = static_cast<unsigned long long>(_mm_cvtsi128_si64(__v));
+  return (__r & 0xffffffffull) * 100000000ull + (__r >> 32);
+#else
+  return _VSTD::__charconv_parse_8_digits(__p) * 100000000ull + _VSTD::__charconv_parse_8_digits(__p + 8);
+#endif
+}
+
+// The value of the __n digits at __p, which must fit in _Wp.
+template <class _Wp>
+inline _LIBCPP_INLINE_VISIBILITY _Wp __charconv_parse_digits(const char *__p, size_t __n) noexcept {
+  _Wp __x = 0;
+  for (; __n >= 16; __n -= 16, __p += 16)
+    __x = __x * 10000000000000000ull + _VSTD::__charconv_parse_16_digits(__p);
+  if (__n >= 8) {
+    __x = __x * 100000000ull + _VSTD::__charconv_parse_8_digits(__p);
+    __p += 8;
+    __n -= 8;
+  }
+  for (; __n != 0; --__n, ++__p)
+    __x = __x * 10 + static_cast<unsigned>(*__p - '0');
+  return __x;
+}
+
+template <class _Up>
+inline _LIBCPP_INLINE_VISIBILITY from_chars_result __from_chars_unsigned10(const char *__p, const char *__last,
+                                                                           _Up &__value) noexcept {
+  // Find the run of digits first, eight at a time where possible.
+  const char *__e = __p;
+  while (__last - __e >= 8 && _VSTD::__charconv_is_8_digits(_VSTD::__charconv_load8(__e)))
+    __e += 8;
+  while (__e != __last && static_cast<unsigned char>(*__e - '0') < 10)
+    ++__e;
+  if (__e == __p)
+    return from_chars_result{__p, errc::invalid_argument};
+  while (__p != __e && *__p == '0')
+    ++__p;
+  const size_t __n   = static_cast<size_t>(__e - __p);
+  const size_t __max = static_cast<size_t>(_VSTD::__charconv_max_digits10<_Up>());
+  if (__n > __max)
+    return from_chars_result{__e, errc::result_out_of_range};
+  if constexpr (sizeof(_Up) < sizeof(unsigned long long)) {
+    // At most ten digits: no overflow in 64 bits.
+    const unsigned long long __x = _VSTD::__charconv_parse_digits<unsigned long long>(__p, __n);
+    if (__x > static_cast<_Up>(-1))
+      return from_chars_result{__e, errc::result_out_of_range};
+    __value = static_cast<_Up>(__x);
+  } else {
+    // Only a number with as many digits as the maximum can overflow, and
+    // only in its last digit.
+    _Up __x = _VSTD::__charconv_parse_digits<_Up>(__p, __n == __max ? __n - 1 : __n);
+    if (__n == __max && (__builtin_mul_overflow(__x, 10u, &__x) ||
+                         __builtin_add_overflow(__x, static_cast<unsigned>(__e[-1] - '0'), &__x)))
+      return from_chars_result{__e, errc::result_out_of_range};
+    __value = __x;
+  }
+  return from_chars_result{__e, errc()};
+}
+
+template <class _Up>
+inline _LIBCPP_INLINE_VISIBILITY from_chars_result __from_chars_unsigned(const char *__p, const char *__last,
+                                                                         _Up &__value, int __base) noexcept {
+  if (__base == 10)
+    return _VSTD::__from_chars_unsigned10(__p, __last, __value);
+  const char *const __first = __p;
+  const unsigned __b        = static_cast<unsigned>(__base);
+  _Up __x                   = 0;
+  bool __overflow           = false;
+  for (; __p != __last; ++__p) {
+    const unsigned __c = static_cast<unsigned char>(*__p);
+    const unsigned __d = __c - '0' < 10 ? __c - '0' : (__c | 0x20) - 'a' < 26 ? (__c | 0x20) - 'a' + 10 : 36;
+    if (__d >= __b)
+      break;
+    __overflow = __overflow || __builtin_mul_overflow(__x, __b, &__x) || __builtin_add_overflow(__x, __d, &__x);
+  }
+  if (__p == __first)
+    return from_chars_result{__p, errc::invalid_argument};
+  if (__overflow)
+    return from_chars_result{__p, errc::result_out_of_range};
+  __value = __x;
+  return from_chars_result{__p, errc()};
+}
+
+// On error __value is left alone: invalid_argument with ptr == __first if
+// there are no digits, result_out_of_range with ptr past them if they do
+// not fit.
+template <class _Tp, __enable_if_charconv_integral<_Tp> = 0>
+inline _LIBCPP_INLINE_VISIBILITY from_chars_result from_chars(const char *__first, const char *__last, _Tp &__value,
+                                                              int __base = 10) {
+  typedef typename make_unsigned<_Tp>::type _Up;
+  const char *__p = __first;
+  bool __neg      = false;
+  if constexpr (is_signed<_Tp>::value)
+    if (__p != __last && *__p == '-') {
+      __neg = true;
+      ++__p;
+    }
+  _Up __x                   = 0;
+  const from_chars_result __r = _VSTD::__from_chars_unsigned(__p, __last, __x, __base);
+  if (__r.ec == errc::invalid_argument)
+    return from_chars_result{__first, errc::invalid_argument};
+  if (__r.ec != errc())
+    return __r;
+  if constexpr (is_signed<_Tp>::value) {
+    // The magnitude may reach 2^(N-1) only when negative.
+    if (__x > static_cast<_Up>(static_cast<_Up>(-1) >> 1) + static_cast<_Up>(__neg))
+      return from_chars_result{__r.ptr, errc::result_out_of_range};
+    __value = static_cast<_Tp>(__neg ? static_cast<_Up>(_Up(0) - __x) : __x);
+  } else
+    __value = static_cast<_Tp>(__x);
+  return __r;
+}
+
+// Floating point
+
+template <class _Tp>
+using __enable_if_charconv_floating _LIBCPP_NODEBUG_TYPE =
+    _EnableIf<is_floating_point<_Tp>::value && !_IsSame<typename remove_cv<_Tp>::type, long double>::value, int>;
+
+template <class _Tp> struct __charconv_fp;
+
+template <> struct __charconv_fp<float> {
+  typedef unsigned __bits_type;
+  static constexpr int __mant_bits = 23; // stored, without the implicit one
+  static constexpr int __exp_bits  = 8;
+  static constexpr int __bias      = 127;
+  static constexpr int __digits10  = 6;
+  // Eisel-Lemire: w 10^q is zero below __min_pow10 and infinite above
+  // __max_pow10 for every 64-bit w; an exact tie needs q <= __max_tie.
+  static constexpr int __min_pow10 = -65;
+  static constexpr int __max_pow10 = 38;
+  static constexpr int __max_tie   = 10;
+  static constexpr float __exact_pow10[] = {1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f};
+};
+
+template <> struct __charconv_fp<double> {
+  typedef unsigned long long __bits_type;
+  static constexpr int __mant_bits   = 52;
+  static constexpr int __exp_bits    = 11;
+  static constexpr int __bias        = 1023;
+  static constexpr int __digits10    = 15;
+  static constexpr int __min_pow10   = -342;
+  static constexpr int __max_pow10   = 308;
+  static constexpr int __max_tie     = 23;
+  static constexpr double __exact_pow10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                             1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+};
+
+template <class _Tp>
+inline _LIBCPP_INLINE_VISIBILITY typename __charconv_fp<_Tp>::__bits_type __charconv_fp_bits(_Tp __x) noexcept {
+  typename __charconv_fp<_Tp>::__bits_type __b;
+  __builtin_memcpy(&__b, &__x, sizeof(__b));
+  return __b;
+}
+
+template <class _Tp>
+inline _LIBCPP_INLINE_VISIBILITY _Tp __charconv_fp_from_bits(typename __charconv_fp<_Tp>::__bits_type __b) noexcept {
+  _Tp __x;
+  __builtin_memcpy(&__x, &__b, sizeof(__x));
+  return __x;
+}
+
+inline _LIBCPP_INLINE_VISIBILITY __charconv_u128 __charconv_mul64(unsigned long long __a,
+                                                                  unsigned long long __b) noexcept {
+#ifndef _LIBCPP_HAS_NO_INT128
+  const __uint128_t __p = static_cast<__uint128_t>(__a) * __b;
+  return __charconv_u128{static_cast<unsigned long long>(__p >> 64), static_cast<unsigned long long>(__p)};
+#else
+  const unsigned long long __ll  = (__a & 0xffffffffull) * (__b & 0xffffffffull);
+  const unsigned long long __lh  = (__a & 0xffffffffull) * (__b >> 32);
+  const unsigned long long __hl  = (__a >> 32) * (__b & 0xffffffffull);
+  const unsigned long long __hh  = (__a >> 32) * (__b >> 32);
+  const unsigned long long __mid = (__ll >> 32) + (__lh & 0xffffffffull) + (__hl & 0xffffffffull);
+  return __charconv_u128{__hh + (__lh >> 32) + (__hl >> 32) + (__mid >> 32), (__mid << 32) | (__ll & 0xffffffffull)};
+#endif
+}
+
+// floor(log10(2^e)), floor(log10(3/4 2^e)) and floor(log2(10^e)), exact for
+// every exponent a double can have.
+inline _LIBCPP_INLINE_VISIBILITY int __charconv_floor_log10_pow2(int __e) noexcept { return (__e * 1262611) >> 22; }
+
+inline _LIBCPP_INLINE_VISIBILITY int __charconv_floor_log10_three_quarters_pow2(int __e) noexcept {
+  return (__e * 1262611 - 524031) >> 22;
+}
+
+inline _LIBCPP_INLINE_VISIBILITY int __charconv_floor_log2_pow10(int __e) noexcept { return (__e * 1741647) >> 19; }
+
+// The high 64 bits of __g __cp, with the bits below them folded into the
+// lowest one so that it is set if the product was inexact.
+inline _LIBCPP_INLINE_VISIBILITY unsigned long long __charconv_round_to_odd(__charconv_u128 __g,
+                                                                           unsigned long long __cp) noexcept {
+  const __charconv_u128 __x    = _VSTD::__charconv_mul64(__g.__lo, __cp);
+  const __charconv_u128 __y    = _VSTD::__charconv_mul64(__g.__hi, __cp);
+  const unsigned long long __l = __y.__lo + __x.__hi;
+  const unsigned long long __h = __y.__hi + (__l < __y.__lo);
+  return __h | (__l > 1);
+}
+
+struct __charconv_decimal {
+  unsigned long long __digits;
+  int __exp;
+};
+
+// Schubfach (Giulietti): the decimal with the fewest digits in the rounding
+// interval of __c 2^__q, the closest one if there are several. The bounds of
+// the interval are in it when __c is even. __lower_closer is for a power of
+// two, whose lower neighbour is half as far as the upper one.
+inline _LIBCPP_INLINE_VISIBILITY __charconv_decimal __charconv_shortest(unsigned long long __c, int __q,
+                                                                        bool __lower_closer) noexcept {
+  const bool __odd              = __c & 1;
+  const unsigned long long __cb = 4 * __c;
+  const int __k                 = __lower_closer ? _VSTD::__charconv_floor_log10_three_quarters_pow2(__q)
+                                                 : _VSTD::__charconv_floor_log10_pow2(__q);
+  const int __h                 = __q + _VSTD::__charconv_floor_log2_pow10(-__k) + 1;
+  const __charconv_u128 __g     = __charconv_pow10_128[-__k - __charconv_pow10_128_min];
+  const unsigned long long __vbl = _VSTD::__charconv_round_to_odd(__g, (__cb - 2 + __lower_closer) << __h);
+  const unsigned long long __vb  = _VSTD::__charconv_round_to_odd(__g, __cb << __h);
+  const unsigned long long __vbr = _VSTD::__charconv_round_to_odd(__g, (__cb + 2) << __h);
+  const unsigned long long __lower = __vbl + __odd;
+  const unsigned long long __upper = __vbr - __odd;
+  const unsigned long long __s     = __vb / 4;
+  if (__s >= 10) {
+    // One digit fewer, if only one of the two candidates is in the interval.
+    const unsigned long long __sp = __s / 10;
+    const bool __up_inside        = __lower <= 40 * __sp;
+    const bool __wp_inside        = 40 * __sp + 40 <= __upper;
+    if (__up_inside != __wp_inside)
+      return __charconv_decimal{__sp + __wp_inside, __k + 1};
+  }
+  const bool __u_inside = __lower <= 4 * __s;
+  const bool __w_inside = 4 * __s + 4 <= __upper;
+  if (__u_inside != __w_inside)
+    return __charconv_decimal{__s + __w_inside, __k};
+  const unsigned long long __mid = 4 * __s + 2;
+  return __charconv_decimal{__s + (__vb > __mid || (__vb == __mid && (__s & 1) != 0)), __k};
+}
+
+// __d 10^__k as printf's %f or %e would put it with just enough precision
+// for all of __d's digits. chars_format() is the plain overload: whichever
+// is shorter, fixed on a tie.
+inline _LIBCPP_INLINE_VISIBILITY to_chars_result __to_chars_decimal(char *__first, char *__last, unsigned long long __d,
+                                                                   int __k, chars_format __fmt) noexcept {
+  const int __n         = _VSTD::__charconv_width10(__d);
+  const int __x         = __k + __n - 1;
+  const int __ux        = __x < 0 ? -__x : __x;
+  const int __sci_len   = __n + (__n > 1) + 2 + (__ux >= 100 ? 3 : 2);
+  const int __fixed_len = __k >= 0 ? __n + __k : __n + __k > 0 ? __n + 1 : 2 - __k;
+  bool __fixed;
+  switch (__fmt) {
+  case chars_format::fixed:
+    __fixed = true;
+    break;
+  case chars_format::scientific:
+    __fixed = false;
+    break;
+  case chars_format::general:
+    // %g's choice at its default precision of 6.
+    __fixed = -4 <= __x && __x < 6;
+    break;
+  default:
+    __fixed = __fixed_len <= __sci_len;
+  }
+  if (__fixed) {
+    if (__last - __first < __fixed_len)
+      return to_chars_result{__last, errc::value_too_large};
+    if (__k >= 0) {
+      _VSTD::__charconv_write10(__first + __n, __d);
+      __builtin_memset(__first + __n, '0', static_cast<size_t>(__k));
+    } else if (__n + __k > 0) {
+      _VSTD::__charconv_write10(__first + __n + 1, __d);
+      __builtin_memmove(__first, __first + 1, static_cast<size_t>(__n + __k));
+      __first[__n + __k] = '.';
+    } else {
+      __first[0] = '0';
+      __first[1] = '.';
+      __builtin_memset(__first + 2, '0', static_cast<size_t>(-(__n + __k)));
+      _VSTD::__charconv_write10(__first + __fixed_len, __d);
+    }
+    return to_chars_result{__first + __fixed_len, errc()};
+  }
+  if (__last - __first < __sci_len)
+    return to_chars_result{__last, errc::value_too_large};
+  _VSTD::__charconv_write10(__first + __n + 1, __d);
+  __first[0] = __first[1];
+  if (__n > 1)
+    __first[1] = '.';
+  char *__p = __first + __n + (__n > 1);
+  *__p++    = 'e';
+  *__p++    = __x < 0 ? '-' : '+';
+  if (__ux >= 100)
+    *__p++ = static_cast<char>('0' + __ux / 100);
+  __builtin_memcpy(__p, __charconv_digit_pairs_table.__c_ + 2 * (__ux % 100), 2);
+  return to_chars_result{__p + 2, errc()};
+}
+
+// printf's %a without the "0x" and with only the hex digits needed: 1.8p+1,
+// 0.0000000000001p-1022 for the smallest subnormal double, 0p+0 for zero.
+// With __prec >= 0, %.*a: __prec digits, rounded to nearest with ties to
+// even, which can carry into the leading digit and make it 2.
+template <class _Tp>
+inline _LIBCPP_INLINE_VISIBILITY to_chars_result __to_chars_hex_float(char *__first, char *__last,
+                                                                     typename __charconv_fp<_Tp>::__bits_type __frac,
+                                                                     int __biased, int __prec = -1) noexcept {
+  typedef __charconv_fp<_Tp> _Fp;
+  constexpr int __digits = (_Fp::__mant_bits + 3) / 4;
+  unsigned long long __f = static_cast<unsigned long long>(__frac) << (4 * __digits - _Fp::__mant_bits);
+  unsigned __lead        = __biased != 0;
+  const int __e          = __biased != 0 ? __biased - _Fp::__bias : __frac != 0 ? 1 - _Fp::__bias : 0;
+  const int __ue         = __e < 0 ? -__e : __e;
+  int __m                = __digits; // after the point
+  int __nf               = __digits; // of them from __f, the rest zeros
+  if (__prec < 0) {
+    for (; __m != 0 && (__f & 0xf) == 0; --__m)
+      __f >>= 4;
+    __nf = __m;
+  } else {
+    if (__prec < __digits) {
+      const int __drop                = 4 * (__digits - __prec);
+      const unsigned long long __x    = static_cast<unsigned long long>(__lead) << (4 * __digits) | __f;
+      const unsigned long long __half = 1ull << (__drop - 1);
+      const unsigned long long __rest = __x & ((__half << 1) - 1);
+      unsigned long long __r          = __x >> __drop;
+      __r += __rest > __half || (__rest == __half && (__r & 1) != 0);
+      __lead = static_cast<unsigned>(__r >> (4 * __prec));
+      __f    = __r & ((1ull << (4 * __prec)) - 1);
+      __nf   = __prec;
+    }
+    __m = __prec;
+  }
+  const int __len = 1 + (__m != 0) + __m + 2 + _VSTD::__charconv_width10(static_cast<unsigned>(__ue));
+  if (__last - __first < __len)
+    return to_chars_result{__last, errc::value_too_large};
+  char *__p = __first;
+  *__p++    = static_cast<char>('0' + __lead);
+  if (__m != 0) {
+    *__p++ = '.';
+    for (int __i = __nf; __i-- != 0; __f >>= 4)
+      __p[__i] = __charconv_digits[__f & 0xf];
+    __builtin_memset(__p + __nf, '0', static_cast<size_t>(__m - __nf));
+    __p += __m;
+  }
+  *__p++ = 'p';
+  *__p++ = __e < 0 ? '-' : '+';
+  _VSTD::__charconv_write10(__first + __len, static_cast<unsigned>(__ue));
+  return to_chars_result{__first + __len, errc()};
+}
+
+template <class _Tp>
+inline _LIBCPP_INLINE_VISIBILITY to_chars_result __to_chars_floating(char *__first, char *__last, _Tp __value,
+                                                                    chars_format __fmt) noexcept {
+  typedef __charconv_fp<_Tp> _Fp;
+  typedef typename _Fp::__bits_type _Bits;
+  const _Bits __bits = _VSTD::__charconv_fp_bits(__value);
+  const _Bits __frac = __bits & ((_Bits(1) << _Fp::__mant_bits) - 1);
+  const int __biased = static_cast<int>((__bits >> _Fp::__mant_bits) & ((1u << _Fp::__exp_bits) - 1));
+  if (__bits >> (_Fp::__mant_bits + _Fp::__exp_bits)) {
+    if (__first == __last)
+      return to_chars_result{__last, errc::value_too_large};
+    *__first++ = '-';
+  }
+  if (__biased == (1 << _Fp::__exp_bits) - 1) {
+    const char *const __s = __frac != 0 ? "nan" : "inf";
+    return _VSTD::__to_chars_copy(__first, __last, __s, __s + 3);
+  }
+  if (__fmt == chars_format::hex)
+    return _VSTD::__to_chars_hex_float<_Tp>(__first, __last, __frac, __biased);
+  if (__biased == 0 && __frac == 0)
+    return _VSTD::__to_chars_decimal(__first, __last, 0, 0, __fmt);
+  const unsigned long long __c = __biased != 0 ? __frac | (_Bits(1) << _Fp::__mant_bits) : __frac;
+  const int __q                = (__biased != 0 ? __biased : 1) - _Fp::__bias - _Fp::__mant_bits;
+  __charconv_decimal __d       = _VSTD::__charconv_shortest(__c, __q, __frac == 0 && __biased > 1);
+  while (__d.__digits % 10 == 0) {
+    __d.__digits /= 10;
+    ++__d.__exp;
+  }
+  return _VSTD::__to_chars_decimal(__first, __last, __d.__digits, __d.__exp, __fmt);
+}
+
+// The shortest representation that from_chars reads back as __value.
+template <class _Tp, __enable_if_charconv_floating<_Tp> = 0>
+inline _LIBCPP_INLINE_VISIBILITY to_chars_result to_chars(char *__first, char *__last, _Tp __value) {
+  return _VSTD::__to_chars_floating(__first, __last, __value, chars_format());
+}
+
+template <class _Tp, __enable_if_charconv_floating<_Tp> = 0>
+inline _LIBCPP_INLINE_VISIBILITY to_chars_result to_chars(char *__first, char *__last, _Tp __value,
+                                                          chars_format __fmt) {
+  return _VSTD::__to_chars_floating(__first, __last, __value, __fmt);
+}
+
+// The significand field (with the implicit one, for a subnormal that rounds
+// up to the smallest normal) and the biased exponent; __e < 0 when that could
+// not be decided.
+struct __charconv_fp_parts {
+  unsigned long long __m;
+  int __e;
+};
+
+// Eisel-Lemire: __w 10^__q from the leading 128 bits of the power of ten.
+template <class _Tp>
+inline _LIBCPP_INLINE_VISIBILITY __charconv_fp_parts __charconv_eisel_lemire(unsigned long long __w,
+                                                                             long long __q) noexcept {
+  typedef __charconv_fp<_Tp> _Fp;
+  constexpr int __inf_exp = (1 << _Fp::__exp_bits) - 1;
+  if (__w == 0 || __q < _Fp::__min_pow10)
+    return __charconv_fp_parts{0, 0};
+  if (__q > _Fp::__max_pow10)
+    return __charconv_fp_parts{0, __inf_exp};
+  const int __lz = __builtin_clzll(__w);
+  __w <<= __lz;
+  const __charconv_u128 __t = __charconv_pow10_128[__q - __charconv_pow10_128_min];
+  const unsigned long long __t_lo = __t.__lo - 1;
+  const unsigned long long __t_hi = __t.__hi - (__t.__lo == 0);
+  __charconv_u128 __p             = _VSTD::__charconv_mul64(__w, __t_hi);
+  // The truncated power makes __p a lower bound, short of the product by less
+  // than one in its last bit. Only when the bits below the significand and
+  // its rounding bit are all ones can the low half of the power carry into
+  // them, and only when they still are can the exact product be a rounding
+  // boundary or beyond. 10^q is exact in the table for q in [0, 55].
+  constexpr unsigned long long __precision_mask = ~0ull >> (_Fp::__mant_bits + 3);
+  if ((__p.__hi & __precision_mask) == __precision_mask) {
+    const __charconv_u128 __p2 = _VSTD::__charconv_mul64(__w, __t_lo);
+    __p.__lo += __p2.__hi;
+    __p.__hi += __p2.__hi > __p.__lo;
+    if (__p.__lo == ~0ull && !(__q >= 0 && __q <= 55))
+      return __charconv_fp_parts{0, -1};
+  }
+  const int __upper_bit     = static_cast<int>(__p.__hi >> 63);
+  const int __shift         = __upper_bit + 64 - _Fp::__mant_bits - 3;
+  unsigned long long __m    = __p.__hi >> __shift;
+  int __e = static_cast<int>((((152170 + 65536) * __q) >> 16) + 63) + __upper_bit - __lz + _Fp::__bias;
+  if (__e <= 0) {
+    if (-__e + 1 >= 64)
+      return __charconv_fp_parts{0, 0};
+    __m >>= -__e + 1;
+    __m += __m & 1;
+    __m >>= 1;
+    return __charconv_fp_parts{__m, __m < (1ull << _Fp::__mant_bits) ? 0 : 1};
+  }
+  // A product that is exact and halfway between two values rounds to even.
+  // For q < 0 the product is not exact; a tie there was sent to the slow path.
+  if (__p.__lo <= 1 && __q >= 0 && __q <= _Fp::__max_tie && (__m & 3) == 1 &&
+      (__m << __shift) == __p.__hi)
+    __m &= ~1ull;
+  __m += __m & 1;
+  __m >>= 1;
+  if (__m >= (2ull << _Fp::__mant_bits)) {
+    __m = 1ull << _Fp::__mant_bits;
+    ++__e;
+  }
+  __m &= ~(1ull << _Fp::__mant_bits);
+  if (__e >= __inf_exp)
+    return __charconv_fp_parts{0, __inf_exp};
+  return __charconv_fp_parts{__m, __e};
+}
+
+// The slow path for what Eisel-Lemire cannot settle: the digits themselves,
+// as many as can decide a double, shifted by powers of two until they are in
+// [1/2, 1) (Tao's simple decimal conversion).
+struct __charconv_big_decimal {
+  static constexpr int __max_digits = 768;
+
+  int __n          = 0;     // The value is 0.__d_[0] __d_[1] ... 10^__point.
+  int __point      = 0;
+  bool __truncated = false; // Nonzero digits beyond __max_digits were dropped.
+  unsigned char __d_[__max_digits + 19];
+
+  _LIBCPP_INLINE_VISIBILITY void __parse(const char *__p, const char *__end, long long __exp10) noexcept {
+    bool __fraction = false;
+    for (; __p != __end; ++__p) {
+      if (*__p == '.') {
+        __fraction = true;
+        continue;
+      }
+      const unsigned char __v = static_cast<unsigned char>(*__p - '0');
+      if (__n == 0 && __v == 0) {
+        __point -= __fraction;
+        continue;
+      }
+      if (__n < __max_digits)
+        __d_[__n] = __v;
+      else
+        __truncated = __truncated || __v != 0;
+      ++__n;
+      __point += !__fraction;
+    }
+    if (__n > __max_digits)
+      __n = __max_digits;
+    __trim();
+    if (__n != 0)
+      __point += static_cast<int>(__exp10 < -100000 ? -100000 : __exp10 > 100000 ? 100000 : __exp10);
+  }
+
+  _LIBCPP_INLINE_VISIBILITY void __trim() noexcept {
+    while (__n != 0 && __d_[__n - 1] == 0)
+      --__n;
+  }
+
+  // Multiplies by 2^__s, __s <= 60, from the last digit to the first; the
+  // product has at most 19 digits more.
+  _LIBCPP_INLINE_VISIBILITY void __shift_left(int __s) noexcept {
+    if (__n == 0)
+      return;
+    int __r                    = __n;
+    int __w                    = __n + 19;
+    unsigned long long __carry = 0;
+    while (__r != 0) {
+      const unsigned long long __v = (static_cast<unsigned long long>(__d_[--__r]) << __s) + __carry;
+      __carry                      = __v / 10;
+      __d_[--__w]                  = static_cast<unsigned char>(__v % 10);
+    }
+    for (; __carry != 0; __carry /= 10)
+      __d_[--__w] = static_cast<unsigned char>(__carry % 10);
+    const int __m = __n + 19 - __w;
+    __builtin_memmove(__d_, __d_ + __w, static_cast<size_t>(__m));
+    __point += __m - __n;
+    __n = __m;
+    if (__n > __max_digits) {
+      for (int __i = __max_digits; __i != __n; ++__i)
+        __truncated = __truncated || __d_[__i] != 0;
+      __n = __max_digits;
+    }
+    __trim();
+  }
+
+  // Divides by 2^__s, __s <= 60, from the first digit to the last.
+  _LIBCPP_INLINE_VISIBILITY void __shift_right(int __s) noexcept {
+    int __r                = 0;
+    int __w                = 0;
+    unsigned long long __v = 0;
+    while ((__v >> __s) == 0) {
+      if (__r < __n)
+        __v = 10 * __v + __d_[__r++];
+      else if (__v == 0)
+        return;
+      else {
+        for (; (__v >> __s) == 0; ++__r)
+          __v *= 10;
+        break;
+      }
+    }
+    __point -= __r - 1;
+    const unsigned long long __mask = (1ull << __s) - 1;
+    while (__r < __n) {
+      const unsigned char __digit = static_cast<unsigned char>(__v >> __s);
+      __v                         = 10 * (__v & __mask) + __d_[__r++];
+      __d_[__w++]                 = __digit;
+    }
+    for (; __v != 0; __v = 10 * (__v & __mask)) {
+      const unsigned char __digit = static_cast<unsigned char>(__v >> __s);
+      if (__w < __max_digits)
+        __d_[__w++] = __digit;
+      else
+        __truncated = __truncated || __digit != 0;
+    }
+    __n = __w;
+    __trim();
+  }
+
+  // The integer part, rounded to nearest, ties to even.
+  _LIBCPP_INLINE_VISIBILITY unsigned long long __round() const noexcept {
+    if (__n == 0 || __point < 0)
+      return 0;
+    if (__point > 18)
+      return ~0ull;
+    unsigned long long __x = 0;
+    for (int __i = 0; __i != __point; ++__i)
+      __x = 10 * __x + (__i < __n ? __d_[__i] : 0);
+    bool __up = false;
+    if (__point < __n) {
+      __up = __d_[__point] >= 5;
+      if (__d_[__point] == 5 && __point + 1 == __n)
+        __up = __truncated || (__point > 0 && (__d_[__point - 1] & 1) != 0);
+    }
+    return __x + __up;
+  }
+};
+
+template <class _Tp>
+inline _LIBCPP_INLINE_VISIBILITY __charconv_fp_parts __charconv_decimal_to_binary(const char *__p, const char *__end,
+                                                                                  long long __exp10) noexcept {
+  typedef __charconv_fp<_Tp> _Fp;
+  constexpr int __inf_exp   = (1 << _Fp::__exp_bits) - 1;
+  constexpr int __max_shift = 60;
+  // The largest shift that keeps a digit count of __i above zero.
+  constexpr unsigned char __pow2_of_pow10[19] = {0, 3, 6, 9, 13, 16, 19, 23, 26, 29, 33, 36, 39, 43, 46, 49, 53, 56, 59};
+  __charconv_big_decimal __d;
+  __d.__parse(__p, __end, __exp10);
+  if (__d.__n == 0 || __d.__point < -324)
+    return __charconv_fp_parts{0, 0};
+  if (__d.__point >= 310)
+    return __charconv_fp_parts{0, __inf_exp};
+  int __e2 = 0;
+  while (__d.__point > 0) {
+    const int __s = __d.__point < 19 ? __pow2_of_pow10[__d.__point] : __max_shift;
+    __d.__shift_right(__s);
+    __e2 += __s;
+  }
+  while (__d.__point <= 0) {
+    int __s;
+    if (__d.__point == 0) {
+      if (__d.__d_[0] >= 5)
+        break;
+      __s = __d.__d_[0] < 2 ? 2 : 1;
+    } else
+      __s = -__d.__point < 19 ? __pow2_of_pow10[-__d.__point] : __max_shift;
+    __d.__shift_left(__s);
+    __e2 -= __s;
+  }
+  // [1/2, 1) to [1, 2), then down to the smallest normal exponent.
+  --__e2;
+  while (__e2 < 1 - _Fp::__bias) {
+    const int __s = 1 - _Fp::__bias - __e2 > __max_shift ? __max_shift : 1 - _Fp::__bias - __e2;
+    __d.__shift_right(__s);
+    __e2 += __s;
+  }
+  if (__e2 + _Fp::__bias >= __inf_exp)
+    return __charconv_fp_parts{0, __inf_exp};
+  __d.__shift_left(_Fp::__mant_bits + 1);
+  unsigned long long __m = __d.__round();
+  if (__m >= (2ull << _Fp::__mant_bits)) {
+    __d.__shift_right(1);
+    ++__e2;
+    __m = __d.__round();
+    if (__e2 + _Fp::__bias >= __inf_exp)
+      return __charconv_fp_parts{0, __inf_exp};
+  }
+  int __e = __e2 + _Fp::__bias;
+  if (__m < (1ull << _Fp::__mant_bits))
+    --__e;
+  return __charconv_fp_parts{__m & ((1ull << _Fp::__mant_bits) - 1), __e};
+}
+
+// (__m + a bit less if __sticky) 2^__e, __m != 0, rounded to nearest, ties to
+// even, as the bits of a _Tp without the sign.
+template <class _Tp>
+inline _LIBCPP_INLINE_VISIBILITY typename __charconv_fp<_Tp>::__bits_type
+__charconv_round_binary(unsigned long long __m, long long __e, bool __sticky) noexcept {
+  typedef __charconv_fp<_Tp> _Fp;
+  typedef typename _Fp::__bits_type _Bits;
+  constexpr _Bits __inf = static_cast<_Bits>((1u << _Fp::__exp_bits) - 1) << _Fp::__mant_bits;
+  constexpr int __emin  = 1 - _Fp::__bias;
+  const int __lz        = __builtin_clzll(__m);
+  __m <<= __lz;
+  long long __lead = __e - __lz + 63; // The exponent of the leading bit.
+  if (__lead > _Fp::__bias)
+    return __inf;
+  long long __drop = 63 - _Fp::__mant_bits;
+  if (__lead < __emin)
+    __drop += __emin - __lead;
+  unsigned long long __keep = 0;
+  bool __half = false, __rest = true;
+  if (__drop < 64) {
+    const unsigned long long __r = __m << (64 - __drop);
+    __keep                       = __m >> __drop;
+    __half                       = __r >> 63;
+    __rest                       = (__r << 1) != 0 || __sticky;
+  } else if (__drop == 64) {
+    __half = __m >> 63;
+    __rest = (__m << 1) != 0 || __sticky;
+  }
+  __keep += __half && (__rest || (__keep & 1));
+  // A subnormal that rounds up to the smallest normal carries into the
+  // exponent field by itself.
+  if (__lead < __emin)
+    return static_cast<_Bits>(__keep);
+  if (__keep >> (_Fp::__mant_bits + 1)) {
+    __keep >>= 1;
+    ++__lead;
+  }
+  if (__lead > _Fp::__bias)
+    return __inf;
+  return static_cast<_Bits>(static_cast<unsigned long long>(__lead + _Fp::__bias) << _Fp::__mant_bits |
+                            (__keep & ((1ull << _Fp::__mant_bits) - 1)));
+}
+
+// Case-insensitive match of the lower case __s.
+inline _LIBCPP_INLINE_VISIBILITY bool __charconv_match(const char *__p, const char *__last, const char *__s,
+                                                       size_t __n) noexcept {
+  if (static_cast<size_t>(__last - __p) < __n)
+    return false;
+  for (size_t __i = 0; __i != __n; ++__i)
+    if ((__p[__i] | 0x20) != __s[__i])
+      return false;
+  return true;
+}
+
+inline _LIBCPP_INLINE_VISIBILITY unsigned __charconv_hex_value(char __c) noexcept {
+  const unsigned __u = static_cast<unsigned char>(__c);
+  return __u - '0' < 10 ? __u - '0' : (__u | 0x20) - 'a' < 6 ? (__u | 0x20) - 'a' + 10 : 16;
+}
+
+// A decimal exponent: [+-] digits, saturated well beyond any that matters.
+// Returns __p if there are no digits.
+inline _LIBCPP_INLINE_VISIBILITY const char *__charconv_parse_exponent(const char *__p, const char *__last,
+                                                                      long long &__exp) noexcept {
+  const char *__e   = __p;
+  const bool __neg  = __e != __last && *__e == '-';
+  __e += __e != __last && (*__e == '-' || *__e == '+');
+  if (__e == __last || static_cast<unsigned char>(*__e - '0') >= 10)
+    return __p;
+  long long __x = 0;
+  for (; __e != __last && static_cast<unsigned char>(*__e - '0') < 10; ++__e)
+    if (__x < 100000000)
+      __x = __x * 10 + (*__e - '0');
+  __exp = __neg ? -__x : __x;
+  return __e;
+}
+
+template <class _Tp>
+inline _LIBCPP_INLINE_VISIBILITY from_chars_result
+__from_chars_special(const char *__first, const char *__p, const char *__last, _Tp &__value,
+                     typename __charconv_fp<_Tp>::__bits_type __sign) noexcept {
+  typedef __charconv_fp<_Tp> _Fp;
+  typedef typename _Fp::__bits_type _Bits;
+  constexpr _Bits __inf = static_cast<_Bits>((1u << _Fp::__exp_bits) - 1) << _Fp::__mant_bits;
+  if (_VSTD::__charconv_match(__p, __last, "inf", 3)) {
+    __p += 3;
+    if (_VSTD::__charconv_match(__p, __last, "inity", 5))
+      __p += 5;
+    __value = _VSTD::__charconv_fp_from_bits<_Tp>(__sign | __inf);
+    return from_chars_result{__p, errc()};
+  }
+  if (_VSTD::__charconv_match(__p, __last, "nan", 3)) {
+    __p += 3;
+    // An optional (n-char-sequence), taken only if it is closed.
+    if (__p != __last && *__p == '(') {
+      const char *__q = __p + 1;
+      while (__q != __last && (static_cast<unsigned char>(*__q - '0') < 10 ||
+                               static_cast<unsigned char>((*__q | 0x20) - 'a') < 26 || *__q == '_'))
+        ++__q;
+      if (__q != __last && *__q == ')')
+        __p = __q + 1;
+    }
+    __value = _VSTD::__charconv_fp_from_bits<_Tp>(__sign | __inf | (_Bits(1) << (_Fp::__mant_bits - 1)));
+    return from_chars_result{__p, errc()};
+  }
+  return from_chars_result{__first, errc::invalid_argument};
+}
+
+template <class _Tp>
+inline _LIBCPP_INLINE_VISIBILITY from_chars_result
+__from_chars_hex_float(const char *__first, const char *__p, const char *__last, _Tp &__value,
+                       typename __charconv_fp<_Tp>::__bits_type __sign) noexcept {
+  typedef __charconv_fp<_Tp> _Fp;
+  typedef typename _Fp::__bits_type _Bits;
+  constexpr _Bits __inf = static_cast<_Bits>((1u << _Fp::__exp_bits) - 1) << _Fp::__mant_bits;
+  // Sixty bits of significand and a sticky bit for the rest are plenty.
+  unsigned long long __m = 0;
+  long long __e2         = 0;
+  bool __sticky          = false;
+  const char *const __begin = __p;
+  for (; __p != __last && _VSTD::__charconv_hex_value(*__p) < 16; ++__p) {
+    const unsigned __v = _VSTD::__charconv_hex_value(*__p);
+    if ((__m >> 60) == 0)
+      __m = __m * 16 + __v;
+    else {
+      __sticky = __sticky || __v != 0;
+      __e2 += 4;
+    }
+  }
+  bool __any = __p != __begin;
+  if (__p != __last && *__p == '.') {
+    const char *__q = __p + 1;
+    for (; __q != __last && _VSTD::__charconv_hex_value(*__q) < 16; ++__q) {
+      const unsigned __v = _VSTD::__charconv_hex_value(*__q);
+      if ((__m >> 60) == 0) {
+        __m = __m * 16 + __v;
+        __e2 -= 4;
+      } else
+        __sticky = __sticky || __v != 0;
+    }
+    __any = __any || __q != __p + 1;
+    if (__any)
+      __p = __q;
+  }
+  if (!__any)
+    return from_chars_result{__first, errc::invalid_argument};
+  if (__p != __last && (*__p | 0x20) == 'p') {
+    long long __exp = 0;
+    const char *const __e = _VSTD::__charconv_parse_exponent(__p + 1, __last, __exp);
+    if (__e != __p + 1) {
+      __p = __e;
+      __e2 += __exp;
+    }
+  }
+  if (__m == 0) {
+    __value = _VSTD::__charconv_fp_from_bits<_Tp>(__sign);
+    return from_chars_result{__p, errc()};
+  }
+  const _Bits __bits = _VSTD::__charconv_round_binary<_Tp>(__m, __e2, __sticky);
+  if (__bits == 0 || __bits == __inf)
+    return from_chars_result{__p, errc::result_out_of_range};
+  __value = _VSTD::__charconv_fp_from_bits<_Tp>(__sign | __bits);
+  return from_chars_result{__p, errc()};
+}
+
+template <class _Tp>
+inline _LIBCPP_INLINE_VISIBILITY from_chars_result __from_chars_floating(const char *__first, const char *__last,
+                                                                        _Tp &__value, chars_format __fmt) noexcept {
+  typedef __charconv_fp<_Tp> _Fp;
+  typedef typename _Fp::__bits_type _Bits;
+  constexpr int __inf_exp = (1 << _Fp::__exp_bits) - 1;
+  const char *__p         = __first;
+  const bool __neg        = __p != __last && *__p == '-';
+  __p += __neg;
+  const _Bits __sign = static_cast<_Bits>(__neg) << (_Fp::__mant_bits + _Fp::__exp_bits);
+  if (__p != __last && ((*__p | 0x20) == 'i' || (*__p | 0x20) == 'n'))
+    return _VSTD::__from_chars_special(__first, __p, __last, __value, __sign);
+  if (__fmt == chars_format::hex)
+    return _VSTD::__from_chars_hex_float(__first, __p, __last, __value, __sign);
+
+  // The significand, into __w while it fits.
+  const char *const __begin = __p;
+  unsigned long long __w    = 0;
+  for (; __p != __last && static_cast<unsigned char>(*__p - '0') < 10; ++__p)
+    __w = __w * 10 + static_cast<unsigned>(*__p - '0');
+  const char *const __int_end = __p;
+  const char *__frac_begin    = __p;
+  if (__p != __last && *__p == '.') {
+    __frac_begin = ++__p;
+    for (; __p != __last && static_cast<unsigned char>(*__p - '0') < 10; ++__p)
+      __w = __w * 10 + static_cast<unsigned>(*__p - '0');
+  }
+  const char *const __end = __p;
+  long long __digits      = (__int_end - __begin) + (__end - __frac_begin);
+  if (__digits == 0)
+    return from_chars_result{__first, errc::invalid_argument};
+
+  // The exponent: required by scientific, not read by fixed.
+  const bool __scientific = (static_cast<int>(__fmt) & static_cast<int>(chars_format::scientific)) != 0;
+  const bool __fixed      = (static_cast<int>(__fmt) & static_cast<int>(chars_format::fixed)) != 0;
+  long long __exp10       = 0;
+  if (__scientific && __p != __last && (*__p | 0x20) == 'e') {
+    const char *const __e = _VSTD::__charconv_parse_exponent(__p + 1, __last, __exp10);
+    if (__e != __p + 1)
+      __p = __e;
+  }
+  if (!__fixed && __p == __end)
+    return from_chars_result{__first, errc::invalid_argument};
+  long long __exp = __exp10 - (__end - __frac_begin);
+
+  // With more than 19 significant digits, __w wrapped: take the first 19,
+  // and see below whether the rest can matter.
+  bool __many = false;
+  if (__digits > 19) {
+    for (const char *__s = __begin; __s != __end && (*__s == '0' || *__s == '.'); ++__s)
+      __digits -= *__s == '0';
+    if (__digits > 19) {
+      __many                           = true;
+      constexpr unsigned long long __e18 = 1000000000000000000ull;
+      __w                              = 0;
+      const char *__s                  = __begin;
+      for (; __w < __e18 && __s != __int_end; ++__s)
+        __w = __w * 10 + static_cast<unsigned>(*__s - '0');
+      if (__w >= __e18)
+        __exp = (__int_end - __s) + __exp10;
+      else {
+        for (__s = __frac_begin; __w < __e18 && __s != __end; ++__s)
+          __w = __w * 10 + static_cast<unsigned>(*__s - '0');
+        __exp = (__frac_begin - __s) + __exp10;
+      }
+    }
+  }
+
+#if defined(__FLT_EVAL_METHOD__) && __FLT_EVAL_METHOD__ == 0
+  // Clinger: both the significand and the power of ten are exact, so one
+  // correctly rounded operation gives the answer.
+  constexpr long long __max_exact = sizeof(_Fp::__exact_pow10) / sizeof(_Fp::__exact_pow10[0]) - 1;
+  if (!__many && __exp >= -__max_exact && __exp <= __max_exact && __w <= (2ull << _Fp::__mant_bits)) {
+    _Tp __x = static_cast<_Tp>(__w);
+    __x     = __exp < 0 ? __x / _Fp::__exact_pow10[-__exp] : __x * _Fp::__exact_pow10[__exp];
+    __value = __neg ? -__x : __x;
+    return from_chars_result{__p, errc()};
+  }
+#endif
+
+  __charconv_fp_parts __r = _VSTD::__charconv_eisel_lemire<_Tp>(__w, __exp);
+  // The dropped digits can matter only if __w + 1 rounds differently.
+  if (__many && __r.__e >= 0) {
+    const __charconv_fp_parts __r1 = _VSTD::__charconv_eisel_lemire<_Tp>(__w + 1, __exp);
+    if (__r1.__m != __r.__m || __r1.__e != __r.__e)
+      __r.__e = -1;
+  }
+  if (__r.__e < 0)
+    __r = _VSTD::__charconv_decimal_to_binary<_Tp>(__begin, __end, __exp10);
+  if (__r.__e == __inf_exp || (__r.__e == 0 && __r.__m == 0 && __w != 0))
+    return from_chars_result{__p, errc::result_out_of_range};
+  __value = _VSTD::__charconv_fp_from_bits<_Tp>(
+      __sign | static_cast<_Bits>(__r.__m | static_cast<unsigned long long>(__r.__e) << _Fp::__mant_bits));
+  return from_chars_result{__p, errc()};
+}
+
+// As strtod in the "C" locale, less the leading whitespace, the '+' and the
+// "0x", and with fmt deciding which exponent is allowed. Out of range means
+// overflow or a nonzero value that rounds to zero; __value is then left alone.
+template <class _Tp, __enable_if_charconv_floating<_Tp> = 0>
+inline _LIBCPP_INLINE_VISIBILITY from_chars_result from_chars(const char *__first, const char *__last, _Tp &__value,
+                                                              chars_format __fmt = chars_format::general) {
+  return _VSTD::__from_chars_floating(__first, __last, __value, __fmt);
+}
+
+// to_chars with a precision, on the same decimal digits as the slow path of
+// from_chars.
+
+// Rounds __d to its first __keep digits, to nearest with ties to even; a
+// carry out of the first digit leaves the single digit 1.
+inline _LIBCPP_INLINE_VISIBILITY void __charconv_round_digits(__charconv_big_decimal &__d, int __keep) noexcept {
+  if (__keep >= __d.__n)
+    return;
+  if (__keep < 0) {
+    __d.__n = 0;
+    return;
+  }
+  const unsigned char __r = __d.__d_[__keep];
+  const bool __up =
+      __r > 5 || (__r == 5 && (__keep + 1 < __d.__n || __d.__truncated || (__keep > 0 && (__d.__d_[__keep - 1] & 1))));
+  __d.__n = __keep;
+  if (__up) {
+    int __i = __keep;
+    while (__i != 0 && __d.__d_[__i - 1] == 9)
+      --__i;
+    if (__i == 0) {
+      __d.__d_[0] = 1;
+      __d.__n     = 1;
+      ++__d.__point;
+      return;
+    }
+    ++__d.__d_[__i - 1];
+    __d.__n = __i;
+  }
+  __d.__trim();
+}
+
+// The digits of __x, which has __n of them, as 0.__x 10^__n.
+inline _LIBCPP_INLINE_VISIBILITY void __charconv_set_digits(__charconv_big_decimal &__d, unsigned long long __x,
+                                                           int __n) noexcept {
+  for (int __i = __n; __i-- != 0; __x /= 10)
+    __d.__d_[__i] = static_cast<unsigned char>(__x % 10);
+  __d.__n     = __n;
+  __d.__point = __n;
+  __d.__trim();
+}
+
+// printf's %.*e (__fixed false) or %.*f of __d; __strip drops the trailing
+// zeros of the fraction, and the point if none is left, as %g does.
+inline _LIBCPP_INLINE_VISIBILITY to_chars_result __to_chars_digits(char *__first, char *__last,
+                                                                  const __charconv_big_decimal &__d, bool __fixed,
+                                                                  int __prec, bool __strip) noexcept {
+  const int __x = __d.__n != 0 ? __d.__point - 1 : 0;
+  // The digit at __i, counting from the first significant one.
+  auto __digit = [&](int __i) { return static_cast<char>('0' + (__i >= 0 && __i < __d.__n ? __d.__d_[__i] : 0)); };
+  const int __first_frac = __fixed ? __x + 1 : 1; // the index of the first digit after the point
+  if (__strip) {
+    const int __nonzero = __d.__n - __first_frac;
+    __prec              = __nonzero < __prec ? (__nonzero > 0 ? __nonzero : 0) : __prec;
+  }
+  const int __ux        = __x < 0 ? -__x : __x;
+  const long long __int = __fixed && __x > 0 ? __x + 1 : 1;
+  const long long __len = __int + (__prec != 0) + __prec + (__fixed ? 0 : __ux >= 100 ? 5 : 4);
+  if (__last - __first < __len)
+    return to_chars_result{__last, errc::value_too_large};
+  char *__p = __first;
+  for (int __i = __first_frac - static_cast<int>(__int); __i != __first_frac; ++__i)
+    *__p++ = __digit(__i);
+  if (__prec != 0) {
+    *__p++ = '.';
+    for (int __i = 0; __i != __prec; ++__i)
+      *__p++ = __digit(__first_frac + __i);
+  }
+  if (!__fixed) {
+    *__p++ = 'e';
+    *__p++ = __x < 0 ? '-' : '+';
+    if (__ux >= 100)
+      *__p++ = static_cast<char>('0' + __ux / 100);
+    __builtin_memcpy(__p, __charconv_digit_pairs_table.__c_ + 2 * (__ux % 100), 2);
+    __p += 2;
+  }
+  return to_chars_result{__p, errc()};
+}
+
+template <class _Tp>
+inline _LIBCPP_INLINE_VISIBILITY to_chars_result __to_chars_floating(char *__first, char *__last, _Tp __value,
+                                                                    chars_format __fmt, int __prec) noexcept {
+  typedef __charconv_fp<_Tp> _Fp;
+  typedef typename _Fp::__bits_type _Bits;
+  const _Bits __bits = _VSTD::__charconv_fp_bits(__value);
+  const _Bits __frac = __bits & ((_Bits(1) << _Fp::__mant_bits) - 1);
+  const int __biased = static_cast<int>((__bits >> _Fp::__mant_bits) & ((1u << _Fp::__exp_bits) - 1));
+  if (__fmt == chars_format::hex || __biased == (1 << _Fp::__exp_bits) - 1) {
+    if (__prec < 0 || __biased == (1 << _Fp::__exp_bits) - 1)
+      return _VSTD::__to_chars_floating(__first, __last, __value, __fmt);
+    if (__bits >> (_Fp::__mant_bits + _Fp::__exp_bits)) {
+      if (__first == __last)
+        return to_chars_result{__last, errc::value_too_large};
+      *__first++ = '-';
+    }
+    return _VSTD::__to_chars_hex_float<_Tp>(__first, __last, __frac, __biased, __prec);
+  }
+  if (__bits >> (_Fp::__mant_bits + _Fp::__exp_bits)) {
+    if (__first == __last)
+      return to_chars_result{__last, errc::value_too_large};
+    *__first++ = '-';
+  }
+  if (__prec < 0)
+    __prec = 6;
+  const bool __general = __fmt != chars_format::fixed && __fmt != chars_format::scientific;
+  if (__general && __prec == 0)
+    __prec = 1;
+
+  __charconv_big_decimal __d;
+  if (__biased != 0 || __frac != 0) {
+    const unsigned long long __c = __biased != 0 ? __frac | (_Bits(1) << _Fp::__mant_bits) : __frac;
+    const int __q                = (__biased != 0 ? __biased : 1) - _Fp::__bias - _Fp::__mant_bits;
+    const bool __lower_closer    = __frac == 0 && __biased > 1;
+    // The significant digits wanted, of the value as it stands in __d.
+    auto __keep = [&] {
+      return __fmt == chars_format::fixed        ? __d.__point + __prec
+             : __fmt == chars_format::scientific ? __prec + 1
+                                                 : __prec;
+    };
+    // The shortest digits round as the exact ones do when there are two or
+    // more to drop, or one that is not 5: a tie, or a value on the other
+    // side of one, would be a shorter or closer candidate in the rounding
+    // interval. With none to drop they are the nearest of their length,
+    // except next to a power of two, where the interval is lopsided, and
+    // padded with zeros they still are as long as no more digits are asked
+    // for than a normal value of the type always keeps.
+    const __charconv_decimal __s = _VSTD::__charconv_shortest(__c, __q, __lower_closer);
+    _VSTD::__charconv_set_digits(__d, __s.__digits, _VSTD::__charconv_width10(__s.__digits));
+    __d.__point += __s.__exp;
+    const int __k = __keep();
+    if (!(__d.__n >= __k + 2 || (__d.__n == __k + 1 && __d.__d_[__k] != 5) ||
+          (__d.__n <= __k && !__lower_closer && (__d.__n == __k || (__k <= _Fp::__digits10 && __biased != 0))))) {
+      // The exact value, which has at most 767 significant digits.
+      _VSTD::__charconv_set_digits(__d, __c, _VSTD::__charconv_width10(__c));
+      for (int __e = __q; __e > 0; __e -= 60)
+        __d.__shift_left(__e < 60 ? __e : 60);
+      for (int __e = -__q; __e > 0; __e -= 60)
+        __d.__shift_right(__e < 60 ? __e : 60);
+    }
+    _VSTD::__charconv_round_digits(__d, __keep());
+  }
+  if (!__general)
+    return _VSTD::__to_chars_digits(__first, __last, __d, __fmt == chars_format::fixed, __prec, false);
+  // %g: fixed when the exponent is in [-4, precision).
+  const int __x = __d.__n != 0 ? __d.__point - 1 : 0;
+  if (-4 <= __x && __x < __prec)
+    return _VSTD::__to_chars_digits(__first, __last, __d, true, __prec - 1 - __x, true);
+  return _VSTD::__to_chars_digits(__first, __last, __d, false, __prec - 1, true);
+}
+
+// printf's %.*e, %.*f, %.*g or %.*a, in the "C" locale and without the "0x".
+template <class _Tp, __enable_if_charconv_floating<_Tp> = 0>
+inline _LIBCPP_INLINE_VISIBILITY to_chars_result to_chars(char *__first, char *__last, _Tp __value, chars_format __fmt,
+                                                          int __precision) {
+  return _VSTD::__to_chars_floating(__first, __last, __value, __fmt, __precision);
+}
+
+_LIBCPP_END_NAMESPACE_STD
+
+#endif // _LIBCPP_STD_VER > 14
@@ -0,0 +1,308 @@
+// -*- C++ -*-
+//===---------------------------- deferred_log ----------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+/*
+    deferred_log synopsis (C++20, extension)
+
+namespace std
+{
+
+// What a consumer needs to decode the records of one call site, in or out
+// of the process.
+struct log_site
+{
+    const char* format;           // the format string, as for format_to_n
+    size_t args;
+    const char* arg_types;        // per argument: i (signed integer), u (unsigned
+                                  // integer), b (bool), c (char), f (float),
+                                  // d (double), s (string), p (pointer)
+    const unsigned char* arg_sizes;  // per argument, 0 for strings
+    format_to_n_result<char*> (*format_to)(const unsigned char* payload, char* out, ptrdiff_t n);
+};
+
+struct log_record
+{
+    const log_site* site;
+    const unsigned char* payload;  // the arguments, unaligned and in order; a
+    size_t size;                   // string is a 4-byte length, its bytes and a null
+
+    format_to_n_result<char*> format_to(char* out, ptrdiff_t n) const;
+};
+
+// A single-producer single-consumer ring of records: one per logging thread.
+template <size_t Bytes>  // a power of two
+class log_ring
+{
+public:
+    log_ring() noexcept;
+    log_ring(const log_ring&) = delete;
+    log_ring& operator=(const log_ring&) = delete;
+
+    template <class F> size_t consume(F&& f);  // consumer: f(const log_record&) for each, oldest first
+    size_t dropped() const noexcept;           // records the producer found no room for
+};
+
+template <fixed-string Fmt, class... Args>
+    bool deferred_log(log_ring<Bytes>& ring, const Args&... args);   // false if dropped
+
+}  // std
+
+    deferred_log stores the address of a static log_site for Fmt and Args,
+    and the argument bytes, and formats nothing. The format string is checked
+    against the arguments at compile time, as by format_to_n, and the
+    arguments are what format_to_n takes. Strings are copied, up to their
+    null or the end of their array; other arguments are copied bytewise.
+
+    The producer and the consumer may run concurrently. The consumer can
+    format the records (log_record::format_to) while they are in the ring,
+    or copy each site once and the payloads as they come for a decoder in
+    another process.
+
+*/
+
+#include "__atomic_support.hh"
+#include "__config.hh"
+#include "cstddef.hh"
+#include "format.hh"
+#include "type_traits.hh"
+#include "utility.hh"
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#pragma GCC system_header
+#endif
+
+#if _LIBCPP_STD_VER > 17 && defined(__cpp_nontype_template_args) && __cpp_nontype_template_args >= 201911L
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+struct _LIBCPP_TYPE_VIS log_site {
+  const char *format;
+  size_t args;
+  const char *arg_types;
+  const unsigned char *arg_sizes;
+  format_to_n_result<char *> (*format_to)(const unsigned char *__payload, char *__out, ptrdiff_t __n);
+};
+
+struct _LIBCPP_TYPE_VIS log_record {
+  const log_site *site;
+  const unsigned char *payload;
+  size_t size;
+
+  _LIBCPP_INLINE_VISIBILITY format_to_n_result<char *> format_to(char *__out, ptrdiff_t __n) const {
+    return site->format_to(payload, __out, __n);
+  }
+};
+
+// Encoding
+
+// What an argument is stored and decoded as.
+template <class _Tp>
+using __log_stored_t _LIBCPP_NODEBUG_TYPE = _If<_VSTD::__format_kind_of<_Tp>() == __format_kind::__string,
+                                                const char *, remove_cvref_t<_Tp>>;
+
+template <class _Tp> _LIBCPP_CONSTEVAL char __log_type_code() noexcept {
+  typedef remove_cvref_t<_Tp> _Dp;
+  if constexpr (is_enum<_Dp>::value)
+    return _VSTD::__log_type_code<underlying_type_t<_Dp>>();
+  else {
+    switch (_VSTD::__format_kind_of<_Dp>()) {
+    case __format_kind::__int:
+      return is_signed<_Dp>::value ? 'i' : 'u';
+    case __format_kind::__bool:
+      return 'b';
+    case __format_kind::__char:
+      return 'c';
+    case __format_kind::__float:
+      return sizeof(_Dp) == sizeof(float) ? 'f' : 'd';
+    case __format_kind::__string:
+      return 's';
+    case __format_kind::__pointer:
+      return 'p';
+    }
+    return 0;
+  }
+}
+
+template <class _Tp> _LIBCPP_CONSTEVAL unsigned char __log_fixed_size() noexcept {
+  return _VSTD::__format_kind_of<_Tp>() == __format_kind::__string
+             ? 0
+             : static_cast<unsigned char>(sizeof(__log_stored_t<_Tp>));
+}
+
+// The bytes of a string argument: up to the null, and never past the end
+// of an array. A null pointer is an empty string. Zero for the rest.
+template <class _Tp> inline _LIBCPP_INLINE_VISIBILITY size_t __log_strlen(const _Tp &__v) noexcept {
+  if constexpr (_VSTD::__format_kind_of<_Tp>() != __format_kind::__string)
+    return 0;
+  else if constexpr (is_array<_Tp>::value) {
+    const void *const __z = __builtin_memchr(__v, 0, sizeof(_Tp));
+    return __z != nullptr ? static_cast<size_t>(static_cast<const char *>(__z) - __v) : sizeof(_Tp);
+  } else
+    return __v != nullptr ? __builtin_strlen(__v) : 0;
+}
+
+template <class _Tp>
+inline _LIBCPP_INLINE_VISIBILITY unsigned char *__log_put(unsigned char *__p, const _Tp &__v, size_t __len) noexcept {
+  if constexpr (_VSTD::__format_kind_of<_Tp>() == __format_kind::__string) {
+    const unsigned __n = static_cast<unsigned>(__len);
+    __builtin_memcpy(__p, &__n, 4);
+    if (__n != 0)
+      __builtin_memcpy(__p + 4, __v, __n);
+    __p[4 + __n] = 0;
+    return __p + 5 + __n;
+  } else {
+    const __log_stored_t<_Tp> __x = __v;
+    __builtin_memcpy(__p, &__x, sizeof(__x));
+    return __p + sizeof(__x);
+  }
+}
+
+// Decoding: each argument is rebuilt in turn, then all go to format_to_n.
+template <__fixed_string _Fmt, class... _Rest> struct __log_decoder;
+
+template <__fixed_string _Fmt> struct __log_decoder<_Fmt> {
+  template <class... _Vs>
+  static _LIBCPP_INLINE_VISIBILITY format_to_n_result<char *> __run(const unsigned char *, char *__out, ptrdiff_t __n,
+                                                                    const _Vs &...__vs) {
+    return _VSTD::format_to_n<_Fmt>(__out, __n, __vs...);
+  }
+};
+
+template <__fixed_string _Fmt, class _Tp, class... _Rest> struct __log_decoder<_Fmt, _Tp, _Rest...> {
+  template <class... _Vs>
+  static _LIBCPP_INLINE_VISIBILITY format_to_n_result<char *> __run(const unsigned char *__p, char *__out,
+                                                                    ptrdiff_t __n, const _Vs &...__vs) {
+    if constexpr (_IsSame<__log_stored_t<_Tp>, const char *>::value) {
+      unsigned __len;
+      __builtin_memcpy(&__len, __p, 4);
+      const char *const __s = reinterpret_cast<const char *>(__p + 4);
+      return __log_decoder<_Fmt, _Rest...>::__run(__p + 5 + __len, __out, __n, __vs..., __s);
+    } else {
+      __log_stored_t<_Tp> __x;
+      __builtin_memcpy(&__x, __p, sizeof(__x));
+      return __log_decoder<_Fmt, _Rest...>::__run(__p + sizeof(__x), __out, __n, __vs..., __x);
+    }
+  }
+};
+
+template <__fixed_string _Fmt, class... _Args> struct __log_site_for {
+  static_assert((is_trivially_copyable<remove_cvref_t<_Args>>::value && ...),
+                "deferred_log: arguments must be trivially copyable");
+  // Checks the format string now, at the call site.
+  static constexpr size_t __segments = __format_parsed<_Fmt, __log_stored_t<_Args>...>::__size;
+
+  static constexpr char __types[]          = {_VSTD::__log_type_code<_Args>()..., 0};
+  static constexpr unsigned char __sizes[] = {_VSTD::__log_fixed_size<_Args>()..., 0};
+
+  static format_to_n_result<char *> __format_to(const unsigned char *__p, char *__out, ptrdiff_t __n) {
+    return __log_decoder<_Fmt, _Args...>::__run(__p, __out, __n);
+  }
+
+  static constexpr log_site __site = {_Fmt.__c_, sizeof...(_Args), __types, __sizes, &__format_to};
+};
+
+// The ring
+
+template <size_t _Bytes> class _LIBCPP_TEMPLATE_VIS log_ring {
+  static_assert(_Bytes >= 256 && (_Bytes & (_Bytes - 1)) == 0, "log_ring: the size must be a power of two");
+
+  // Records start on 16 bytes, so there is always room for a header before
+  // the end; one with no site pads the rest of the buffer.
+  struct __header {
+    const log_site *__site;
+    unsigned __size; // of the record, header and padding included
+    unsigned __payload;
+  };
+  static_assert(sizeof(__header) <= 16, "");
+  static constexpr size_t __align = 16;
+
+  alignas(64) size_t __head_ = 0; // written by the producer
+  size_t __tail_cache_       = 0; // the producer's last look at __tail_
+  size_t __dropped_          = 0;
+  alignas(64) size_t __tail_ = 0; // written by the consumer
+  alignas(64) unsigned char __buf_[_Bytes];
+
+public:
+  _LIBCPP_INLINE_VISIBILITY log_ring() noexcept {}
+  log_ring(const log_ring &)            = delete;
+  log_ring &operator=(const log_ring &) = delete;
+
+  // Producer: a record of __payload bytes, filled in by __fill(pointer).
+  template <class _Fill>
+  _LIBCPP_INLINE_VISIBILITY bool __push(const log_site *__site, size_t __payload, _Fill __fill) noexcept {
+    const size_t __size = (sizeof(__header) + __payload + __align - 1) & ~(__align - 1);
+    size_t __h          = __head_;
+    const size_t __off  = __h & (_Bytes - 1);
+    const size_t __skip = _Bytes - __off < __size ? _Bytes - __off : 0;
+    if (__h + __skip + __size - __tail_cache_ > _Bytes) {
+      __tail_cache_ = _VSTD::__libcpp_atomic_load(&__tail_, _AO_Acquire);
+      if (__h + __skip + __size - __tail_cache_ > _Bytes) {
+        _VSTD::__libcpp_relaxed_store(&__dropped_, __dropped_ + 1);
+        return false;
+      }
+    }
+    if (__skip != 0) {
+      const __header __pad = {nullptr, static_cast<unsigned>(__skip), 0};
+      __builtin_memcpy(__buf_ + __off, &__pad, sizeof(__pad));
+      __h += __skip;
+    }
+    unsigned char *const __r = __buf_ + (__h & (_Bytes - 1));
+    const __header __hd      = {__site, static_cast<unsigned>(__size), static_cast<unsigned>(__payload)};
+    __builtin_memcpy(__r, &__hd, sizeof(__hd));
+    __fill(__r + sizeof(__header));
+    _VSTD::__libcpp_atomic_store(&__head_, __h + __size, _AO_Release);
+    return true;
+  }
+
+  template <class _Fn> _LIBCPP_INLINE_VISIBILITY size_t consume(_Fn &&__f) {
+    size_t __t       = __tail_;
+    const size_t __h = _VSTD::__libcpp_atomic_load(&__head_, _AO_Acquire);
+    size_t __count   = 0;
+    while (__t != __h) {
+      const unsigned char *const __r = __buf_ + (__t & (_Bytes - 1));
+      __header __hd;
+      __builtin_memcpy(&__hd, __r, sizeof(__hd));
+      if (__hd.__site != nullptr) {
+        __f(log_record{__hd.__site, __r + sizeof(__header), __hd.__payload});
+        ++__count;
+      }
+      __t += __hd.__size;
+      // Hand each record back as soon as it is done with.
+      _VSTD::__libcpp_atomic_store(&__tail_, __t, _AO_Release);
+    }
+    return __count;
+  }
+
+  _LIBCPP_INLINE_VISIBILITY size_t dropped() const noexcept { return _VSTD::__libcpp_relaxed_load(&__dropped_); }
+};
+
+template <size_t... _Is, class... _Args>
+inline _LIBCPP_INLINE_VISIBILITY void __log_encode(unsigned char *__p, const size_t *__len, __index_sequence<_Is...>,
+                                                   const _Args &...__args) noexcept {
+  ((__p = _VSTD::__log_put(__p, __args, __len[_Is])), ...);
+}
+
+template <__fixed_string _Fmt, size_t _Bytes, class... _Args>
+inline _LIBCPP_INLINE_VISIBILITY bool deferred_log(log_ring<_Bytes> &__ring, const _Args &...__args) {
+  typedef __log_site_for<_Fmt, _Args...> _Site;
+  // The string lengths, each needed twice.
+  const size_t __len[sizeof...(_Args) + 1] = {_VSTD::__log_strlen(__args)..., 0};
+  size_t __payload = 0;
+  for (size_t __i = 0; __i != sizeof...(_Args); ++__i)
+    __payload += _Site::__sizes[__i] != 0 ? _Site::__sizes[__i] : 5 + __len[__i];
+  return __ring.__push(&_Site::__site, __payload, [&](unsigned char *__p) {
+    _VSTD::__log_encode(__p, __len, __make_index_sequence<sizeof...(_Args)>(), __args...);
+  });
+}
+
+_LIBCPP_END_NAMESPACE_STD
+
+#endif // _LIBCPP_STD_VER > 17 && defined(__cpp_nontype_template_args) && __cpp_nontype_template_args >= 201911L
@@ -0,0 +1,545 @@
+// -*- C++ -*-
+//===------------------------------- format -------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+/*
+    format synopsis (C++20, extension)
+
+namespace std
+{
+
+template <class Out>
+struct format_to_n_result
+{
+    Out out;
+    ptrdiff_t size;
+};
+
+// The format string is a template argument: it is parsed, and each field
+// checked against the type of its argument, at compile time. What is left
+// at run time is the copies of the literal text and a to_chars per field.
+template <fixed-string Fmt, class... Args>
+    format_to_n_result<char*> format_to_n(char* out, ptrdiff_t n, const Args&... args);
+template <fixed-string Fmt, class... Args>
+    size_t formatted_size(const Args&... args);
+
+}  // std
+
+    format_to_n writes at most n characters and does not append a null; size
+    is the length of the whole output. For example
+
+        auto r = std::format_to_n<"{}: {:>8.3}|{:#x}">(buf, sizeof(buf), name, 1.5, 255u);
+
+    Replacement fields are those of std::format, {[arg-id][:spec]} with
+    [[fill]align][sign][#][0][width][.precision][type], and {{ and }} stand
+    for braces. Arguments may be integers, bool, char, enumerations (as their
+    underlying type), float and double, null-terminated strings (const char*
+    and char arrays) and other pointers, but not function pointers. Width and precision must be
+    literals, and width counts bytes, not display columns. An integer with
+    type c is written as static_cast<char> of it, where std::format would
+    throw for a value out of range. Without a precision, floating-point
+    values are printed as the shortest representation that reads back as the
+    same value, in the style of the type (e, f, g or a, in upper case for E,
+    F, G and A). With a precision, at most 1000, they are rounded as printf
+    rounds them, and g is the default type.
+
+*/
+
+#include "__config.hh"
+#include "charconv.hh"
+#include "cstddef.hh"
+#include "type_traits.hh"
+#include "utility.hh"
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#pragma GCC system_header
+#endif
+
+#if _LIBCPP_STD_VER > 17 && defined(__cpp_nontype_template_args) && __cpp_nontype_template_args >= 201911L
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+template <class _Out> struct _LIBCPP_TEMPLATE_VIS format_to_n_result {
+  _Out out;
+  ptrdiff_t size;
+};
+
+// A string literal as a template argument.
+template <size_t _Np> struct __fixed_string {
+  char __c_[_Np];
+
+  _LIBCPP_CONSTEVAL __fixed_string(const char (&__s)[_Np]) noexcept {
+    for (size_t __i = 0; __i != _Np; ++__i)
+      __c_[__i] = __s[__i];
+  }
+
+  _LIBCPP_INLINE_VISIBILITY constexpr size_t __size() const noexcept { return _Np - 1; }
+};
+
+template <size_t _Np> __fixed_string(const char (&)[_Np]) -> __fixed_string<_Np>;
+
+// Parsing
+
+// Not constexpr: reaching it makes the format string a compile-time error,
+// with the message in the diagnostic.
+inline void __format_error(const char *) noexcept {}
+
+enum class __format_kind : unsigned char { __int, __bool, __char, __float, __string, __pointer };
+
+template <class _Tp> _LIBCPP_CONSTEVAL __format_kind __format_kind_of() noexcept {
+  typedef remove_cvref_t<_Tp> _Dp;
+  if constexpr (_IsSame<_Dp, bool>::value)
+    return __format_kind::__bool;
+  else if constexpr (_IsSame<_Dp, char>::value)
+    return __format_kind::__char;
+  else if constexpr (is_enum<_Dp>::value)
+    return _VSTD::__format_kind_of<underlying_type_t<_Dp>>();
+  else if constexpr (is_integral<_Dp>::value)
+    return __format_kind::__int;
+  else if constexpr (_IsSame<_Dp, float>::value || _IsSame<_Dp, double>::value)
+    return __format_kind::__float;
+  else if constexpr (_IsSame<decay_t<_Dp>, const char *>::value || _IsSame<decay_t<_Dp>, char *>::value)
+    return __format_kind::__string;
+  else if constexpr (is_pointer<_Dp>::value && is_function<remove_pointer_t<_Dp>>::value)
+    static_assert(!is_function<remove_pointer_t<_Dp>>::value,
+                  "format_to_n: a function pointer cannot be formatted; std::format rejects it too");
+  else if constexpr (is_pointer<_Dp>::value || _IsSame<_Dp, nullptr_t>::value)
+    return __format_kind::__pointer;
+  else
+    static_assert(_IsSame<_Dp, void>::value, "format_to_n: the argument type cannot be formatted");
+}
+
+struct __format_spec {
+  char __fill     = ' ';
+  char __align    = 0; // 0 for the default of the argument, or <, > or ^
+  char __sign     = 0; // 0, +, - or space
+  bool __alt      = false;
+  bool __zero     = false;
+  int __width     = 0;
+  int __precision = -1;
+  char __type     = 0;
+};
+
+// Literal text __fmt[__begin, __begin + __size) when __arg < 0, a field
+// otherwise.
+struct __format_segment {
+  size_t __begin = 0;
+  size_t __size  = 0;
+  int __arg      = -1;
+  __format_spec __spec;
+};
+
+template <size_t _Np> struct __format_plan {
+  __format_segment __seg_[_Np == 0 ? 1 : _Np];
+};
+
+_LIBCPP_CONSTEVAL bool __format_is_digit(char __c) noexcept { return __c >= '0' && __c <= '9'; }
+
+_LIBCPP_CONSTEVAL size_t __format_parse_number(const char *__f, size_t __n, size_t &__i) noexcept {
+  size_t __x = 0;
+  for (; __i != __n && _VSTD::__format_is_digit(__f[__i]); ++__i) {
+    __x = __x * 10 + static_cast<size_t>(__f[__i] - '0');
+    if (__x > 1000000)
+      _VSTD::__format_error("format_to_n: number too large in the format string");
+  }
+  return __x;
+}
+
+_LIBCPP_CONSTEVAL bool __format_type_in(char __t, const char *__allowed) noexcept {
+  for (; *__allowed; ++__allowed)
+    if (*__allowed == __t)
+      return true;
+  return false;
+}
+
+// The spec after the ':', up to the closing brace at __f[__i] on return.
+_LIBCPP_CONSTEVAL __format_spec __format_parse_spec(const char *__f, size_t __n, size_t &__i,
+                                                    __format_kind __k) noexcept {
+  __format_spec __s;
+  auto __is_align = [](char __c) { return __c == '<' || __c == '>' || __c == '^'; };
+  if (__i + 1 < __n && __is_align(__f[__i + 1]) && __f[__i] != '{' && __f[__i] != '}') {
+    __s.__fill  = __f[__i];
+    __s.__align = __f[__i + 1];
+    __i += 2;
+  } else if (__i < __n && __is_align(__f[__i]))
+    __s.__align = __f[__i++];
+  if (__i < __n && (__f[__i] == '+' || __f[__i] == '-' || __f[__i] == ' '))
+    __s.__sign = __f[__i++];
+  if (__i < __n && __f[__i] == '#') {
+    __s.__alt = true;
+    ++__i;
+  }
+  if (__i < __n && __f[__i] == '0') {
+    __s.__zero = true;
+    ++__i;
+  }
+  if (__i < __n && __f[__i] == '{')
+    _VSTD::__format_error("format_to_n: width and precision must be literals");
+  __s.__width = static_cast<int>(_VSTD::__format_parse_number(__f, __n, __i));
+  if (__i < __n && __f[__i] == '.') {
+    ++__i;
+    if (__i == __n || !_VSTD::__format_is_digit(__f[__i]))
+      _VSTD::__format_error("format_to_n: width and precision must be literals");
+    __s.__precision = static_cast<int>(_VSTD::__format_parse_number(__f, __n, __i));
+  }
+  if (__i < __n && __f[__i] != '}')
+    __s.__type = __f[__i++];
+  if (__i == __n || __f[__i] != '}')
+    _VSTD::__format_error("format_to_n: unterminated replacement field");
+
+  // Check the spec against the argument.
+  const bool __as_int = (__k == __format_kind::__int && __s.__type != 'c') ||
+                        ((__k == __format_kind::__bool || __k == __format_kind::__char) &&
+                         __s.__type != 0 && _VSTD::__format_type_in(__s.__type, "bBdoxX"));
+  const bool __numeric = __as_int || __k == __format_kind::__float;
+  switch (__k) {
+  case __format_kind::__int:
+    if (__s.__type != 0 && !_VSTD::__format_type_in(__s.__type, "bBcdoxX"))
+      _VSTD::__format_error("format_to_n: invalid type for an integer");
+    break;
+  case __format_kind::__bool:
+    if (__s.__type != 0 && !_VSTD::__format_type_in(__s.__type, "sbBcdoxX"))
+      _VSTD::__format_error("format_to_n: invalid type for bool");
+    break;
+  case __format_kind::__char:
+    if (__s.__type != 0 && !_VSTD::__format_type_in(__s.__type, "cbBdoxX"))
+      _VSTD::__format_error("format_to_n: invalid type for char");
+    break;
+  case __format_kind::__float:
+    if (__s.__type != 0 && !_VSTD::__format_type_in(__s.__type, "eEfFgGaA"))
+      _VSTD::__format_error("format_to_n: invalid type for a floating-point value");
+    if (__s.__alt)
+      _VSTD::__format_error("format_to_n: '#' is not supported for floating-point values");
+    if (__s.__precision > 1000)
+      _VSTD::__format_error("format_to_n: floating-point precision is at most 1000");
+    break;
+  case __format_kind::__string:
+    if (__s.__type != 0 && __s.__type != 's')
+      _VSTD::__format_error("format_to_n: invalid type for a string");
+    break;
+  case __format_kind::__pointer:
+    if (__s.__type != 0 && __s.__type != 'p')
+      _VSTD::__format_error("format_to_n: invalid type for a pointer");
+    break;
+  }
+  if (!__numeric && (__s.__sign != 0 || __s.__alt || __s.__zero))
+    _VSTD::__format_error("format_to_n: sign, '#' and '0' are for numbers");
+  if (__s.__precision >= 0 && __k != __format_kind::__string && __k != __format_kind::__float)
+    _VSTD::__format_error("format_to_n: precision is for strings and floating-point values");
+  return __s;
+}
+
+// Splits the format string into segments, into __out unless it is null;
+// returns how many.
+_LIBCPP_CONSTEVAL size_t __format_scan(const char *__f, size_t __n, const __format_kind *__kinds, size_t __nargs,
+                                       __format_segment *__out) noexcept {
+  size_t __count = 0;
+  size_t __next  = 0; // automatic numbering
+  bool __manual = false, __automatic = false;
+  size_t __i = 0;
+  auto __literal = [&](size_t __b, size_t __e) {
+    if (__b == __e)
+      return;
+    if (__out) {
+      __out[__count].__begin = __b;
+      __out[__count].__size  = __e - __b;
+    }
+    ++__count;
+  };
+  size_t __text = 0;
+  while (__i != __n) {
+    if (__f[__i] == '}') {
+      if (__i + 1 == __n || __f[__i + 1] != '}')
+        _VSTD::__format_error("format_to_n: unmatched '}' in the format string");
+      __literal(__text, __i + 1);
+      __text = __i += 2;
+      continue;
+    }
+    if (__f[__i] != '{') {
+      ++__i;
+      continue;
+    }
+    if (__i + 1 != __n && __f[__i + 1] == '{') {
+      __literal(__text, __i + 1);
+      __text = __i += 2;
+      continue;
+    }
+    __literal(__text, __i);
+    ++__i;
+    size_t __arg;
+    if (__i != __n && _VSTD::__format_is_digit(__f[__i])) {
+      __manual = true;
+      __arg    = _VSTD::__format_parse_number(__f, __n, __i);
+    } else {
+      __automatic = true;
+      __arg       = __next++;
+    }
+    if (__manual && __automatic)
+      _VSTD::__format_error("format_to_n: cannot mix automatic and manual argument numbering");
+    if (__arg >= __nargs)
+      _VSTD::__format_error("format_to_n: argument index out of range");
+    __format_spec __spec;
+    if (__i != __n && __f[__i] == ':') {
+      ++__i;
+      __spec = _VSTD::__format_parse_spec(__f, __n, __i, __kinds[__arg]);
+    } else if (__i == __n || __f[__i] != '}')
+      _VSTD::__format_error("format_to_n: invalid replacement field");
+    if (__out) {
+      __out[__count].__arg  = static_cast<int>(__arg);
+      __out[__count].__spec = __spec;
+    }
+    ++__count;
+    __text = ++__i;
+  }
+  __literal(__text, __n);
+  return __count;
+}
+
+template <__fixed_string _Fmt, class... _Args> struct __format_parsed {
+  static constexpr __format_kind __kinds[sizeof...(_Args) + 1] = {_VSTD::__format_kind_of<_Args>()...,
+                                                                  __format_kind::__int};
+  static constexpr size_t __size =
+      _VSTD::__format_scan(_Fmt.__c_, _Fmt.__size(), __kinds, sizeof...(_Args), nullptr);
+
+  static _LIBCPP_CONSTEVAL __format_plan<__size> __parse() noexcept {
+    __format_plan<__size> __p;
+    _VSTD::__format_scan(_Fmt.__c_, _Fmt.__size(), __kinds, sizeof...(_Args), __p.__seg_);
+    return __p;
+  }
+
+  static constexpr __format_plan<__size> __plan = __parse();
+};
+
+// Output
+
+// Counts everything and stores what fits.
+struct __format_sink {
+  char *__p;
+  char *__end;
+  ptrdiff_t __size;
+
+  _LIBCPP_INLINE_VISIBILITY void __put(const char *__s, size_t __n) noexcept {
+    const size_t __room = static_cast<size_t>(__end - __p);
+    const size_t __k    = __n < __room ? __n : __room;
+    if (__k != 0)
+      __builtin_memcpy(__p, __s, __k);
+    __p += __k;
+    __size += static_cast<ptrdiff_t>(__n);
+  }
+
+  _LIBCPP_INLINE_VISIBILITY void __fill(char __c, size_t __n) noexcept {
+    const size_t __room = static_cast<size_t>(__end - __p);
+    const size_t __k    = __n < __room ? __n : __room;
+    if (__k != 0)
+      __builtin_memset(__p, __c, __k);
+    __p += __k;
+    __size += static_cast<ptrdiff_t>(__n);
+  }
+};
+
+// __prefix (sign and base prefix) and __body, padded to the width.
+template <__format_spec _Sp, char _DefaultAlign>
+inline _LIBCPP_INLINE_VISIBILITY void __format_padded(__format_sink &__s, const char *__prefix, size_t __np,
+                                                      const char *__body, size_t __nb, bool __zero_ok = true) {
+  const size_t __len = __np + __nb;
+  if constexpr (_Sp.__width == 0) {
+    __s.__put(__prefix, __np);
+    __s.__put(__body, __nb);
+  } else {
+    const size_t __pad = static_cast<size_t>(_Sp.__width) > __len ? static_cast<size_t>(_Sp.__width) - __len : 0;
+    if (_Sp.__zero && _Sp.__align == 0 && __zero_ok) {
+      __s.__put(__prefix, __np);
+      __s.__fill('0', __pad);
+      __s.__put(__body, __nb);
+      return;
+    }
+    constexpr char __align = _Sp.__align != 0 ? _Sp.__align : _DefaultAlign;
+    const size_t __left    = __align == '>' ? __pad : __align == '^' ? __pad / 2 : 0;
+    __s.__fill(_Sp.__fill, __left);
+    __s.__put(__prefix, __np);
+    __s.__put(__body, __nb);
+    __s.__fill(_Sp.__fill, __pad - __left);
+  }
+}
+
+template <__format_spec _Sp>
+inline _LIBCPP_INLINE_VISIBILITY void __format_text(__format_sink &__s, const char *__p, size_t __n) {
+  _VSTD::__format_padded<_Sp, '<'>(__s, nullptr, 0, __p, __n);
+}
+
+template <__format_spec _Sp, class _Tp>
+inline _LIBCPP_INLINE_VISIBILITY void __format_int(__format_sink &__s, _Tp __v) {
+  constexpr int __base = _Sp.__type == 'b' || _Sp.__type == 'B' ? 2
+                       : _Sp.__type == 'o'                      ? 8
+                       : _Sp.__type == 'x' || _Sp.__type == 'X' ? 16
+                                                                : 10;
+  // The common {} straight into the output when it fits.
+  if constexpr (_Sp.__width == 0 && _Sp.__sign == 0 && !_Sp.__alt && __base == 10)
+    if (__s.__end - __s.__p >= static_cast<ptrdiff_t>(sizeof(_Tp) * 3 + 1)) {
+      char *const __e = _VSTD::to_chars(__s.__p, __s.__end, __v).ptr;
+      __s.__size += __e - __s.__p;
+      __s.__p = __e;
+      return;
+    }
+  typedef make_unsigned_t<_Tp> _Up;
+  _Up __u    = static_cast<_Up>(__v);
+  bool __neg = false;
+  if constexpr (is_signed<_Tp>::value)
+    if (__v < 0) {
+      __neg = true;
+      __u   = static_cast<_Up>(_Up(0) - __u);
+    }
+  char __digits[sizeof(_Tp) * __CHAR_BIT__];
+  const size_t __nd = static_cast<size_t>(_VSTD::to_chars(__digits, __digits + sizeof(__digits), __u, __base).ptr -
+                                          __digits);
+  if constexpr (_Sp.__type == 'X')
+    for (size_t __i = 0; __i != __nd; ++__i)
+      __digits[__i] = static_cast<char>(__digits[__i] >= 'a' ? __digits[__i] - 'a' + 'A' : __digits[__i]);
+  char __prefix[3];
+  size_t __np = 0;
+  if (__neg)
+    __prefix[__np++] = '-';
+  else if constexpr (_Sp.__sign == '+' || _Sp.__sign == ' ')
+    __prefix[__np++] = _Sp.__sign;
+  if constexpr (_Sp.__alt && __base != 10) {
+    if constexpr (__base == 8) {
+      if (__u != 0)
+        __prefix[__np++] = '0';
+    } else {
+      __prefix[__np++] = '0';
+      __prefix[__np++] = _Sp.__type;
+    }
+  }
+  _VSTD::__format_padded<_Sp, '>'>(__s, __prefix, __np, __digits, __nd);
+}
+
+template <__format_spec _Sp, class _Tp>
+inline _LIBCPP_INLINE_VISIBILITY void __format_float(__format_sink &__s, _Tp __v) {
+  constexpr char __t           = _Sp.__type;
+  constexpr chars_format __fmt = __t == 'e' || __t == 'E'   ? chars_format::scientific
+                               : __t == 'f' || __t == 'F'   ? chars_format::fixed
+                               : __t == 'g' || __t == 'G'   ? chars_format::general
+                               : __t == 'a' || __t == 'A'   ? chars_format::hex
+                                                            : chars_format();
+  // Fixed notation of the smallest subnormal double has 326 characters, and
+  // of the largest double 309 before the point.
+  constexpr int __prec = _Sp.__precision;
+  constexpr size_t __size = __prec < 0 ? (__fmt == chars_format::fixed ? 336 : 40)
+                                       : static_cast<size_t>((__fmt == chars_format::fixed ? 320 : 16) + __prec);
+  char __buf[__size];
+  char *__b = __buf + 1;
+  char *__e;
+  if constexpr (__prec < 0)
+    __e = _VSTD::__to_chars_floating(__b, __buf + sizeof(__buf), __v, __fmt).ptr;
+  else
+    __e = _VSTD::__to_chars_floating(__b, __buf + sizeof(__buf), __v, __fmt, __prec).ptr;
+  if constexpr (__t == 'E' || __t == 'F' || __t == 'G' || __t == 'A')
+    for (char *__p = __b; __p != __e; ++__p)
+      *__p = static_cast<char>(*__p >= 'a' && *__p <= 'z' ? *__p - 'a' + 'A' : *__p);
+  if constexpr (_Sp.__sign == '+' || _Sp.__sign == ' ')
+    if (*__b != '-')
+      *--__b = _Sp.__sign;
+  // The sign goes before zero padding, which is not for inf and nan.
+  const size_t __np    = *__b == '-' || *__b == '+' || *__b == ' ';
+  const bool __finite  = __v - __v == 0;
+  _VSTD::__format_padded<_Sp, '>'>(__s, __b, __np, __b + __np, static_cast<size_t>(__e - __b) - __np, __finite);
+}
+
+template <__format_spec _Sp, class _Tp>
+inline _LIBCPP_INLINE_VISIBILITY void __format_arg(__format_sink &__s, const _Tp &__v) {
+  typedef remove_cvref_t<_Tp> _Dp;
+  if constexpr (is_enum<_Dp>::value)
+    _VSTD::__format_arg<_Sp>(__s, static_cast<underlying_type_t<_Dp>>(__v));
+  else if constexpr (_IsSame<_Dp, bool>::value) {
+    if constexpr (_Sp.__type == 0 || _Sp.__type == 's')
+      _VSTD::__format_text<_Sp>(__s, __v ? "true" : "false", __v ? 4 : 5);
+    else if constexpr (_Sp.__type == 'c') {
+      const char __c = static_cast<char>(__v);
+      _VSTD::__format_text<_Sp>(__s, &__c, 1);
+    } else
+      _VSTD::__format_int<_Sp>(__s, static_cast<unsigned>(__v));
+  } else if constexpr (_IsSame<_Dp, char>::value) {
+    if constexpr (_Sp.__type == 0 || _Sp.__type == 'c')
+      _VSTD::__format_text<_Sp>(__s, &__v, 1);
+    else if constexpr (_Sp.__type == 'd')
+      _VSTD::__format_int<_Sp>(__s, static_cast<int>(__v));
+    else
+      _VSTD::__format_int<_Sp>(__s, static_cast<unsigned char>(__v));
+  } else if constexpr (is_integral<_Dp>::value) {
+    if constexpr (_Sp.__type == 'c') {
+      const char __c = static_cast<char>(__v);
+      _VSTD::__format_text<_Sp>(__s, &__c, 1);
+    } else
+      _VSTD::__format_int<_Sp>(__s, __v);
+  } else if constexpr (is_floating_point<_Dp>::value)
+    _VSTD::__format_float<_Sp>(__s, __v);
+  else if constexpr (_VSTD::__format_kind_of<_Dp>() == __format_kind::__string) {
+    // A char array is read no further than its end.
+    const char *const __p = __v;
+    constexpr size_t __max = _Sp.__precision >= 0 ? static_cast<size_t>(_Sp.__precision) : static_cast<size_t>(-1);
+    constexpr size_t __cap = is_array<_Dp>::value ? sizeof(_Dp) : static_cast<size_t>(-1);
+    size_t __n             = 0;
+    while (__n != __max && __n != __cap && __p[__n] != 0)
+      ++__n;
+    _VSTD::__format_text<_Sp>(__s, __p, __n);
+  } else {
+    constexpr __format_spec __sp = [] {
+      __format_spec __r = _Sp;
+      __r.__type        = 'x';
+      __r.__alt         = true;
+      return __r;
+    }();
+    _VSTD::__format_int<__sp>(__s, reinterpret_cast<__UINTPTR_TYPE__>(static_cast<const void *>(__v)));
+  }
+}
+
+template <size_t _Ip, class _Tp, class... _Rest>
+inline _LIBCPP_INLINE_VISIBILITY const auto &__format_get(const _Tp &__t, const _Rest &...__r) noexcept {
+  if constexpr (_Ip == 0)
+    return __t;
+  else
+    return _VSTD::__format_get<_Ip - 1>(__r...);
+}
+
+template <__fixed_string _Fmt, class _Parsed, size_t _Ip, class... _Args>
+inline _LIBCPP_INLINE_VISIBILITY void __format_segment_out(__format_sink &__s, const _Args &...__args) {
+  constexpr __format_segment __seg = _Parsed::__plan.__seg_[_Ip];
+  if constexpr (__seg.__arg < 0)
+    __s.__put(_Fmt.__c_ + __seg.__begin, __seg.__size);
+  else
+    _VSTD::__format_arg<__seg.__spec>(__s, _VSTD::__format_get<static_cast<size_t>(__seg.__arg)>(__args...));
+}
+
+template <__fixed_string _Fmt, class _Parsed, size_t... _Is, class... _Args>
+inline _LIBCPP_INLINE_VISIBILITY void __format_out(__format_sink &__s, __index_sequence<_Is...>,
+                                                   const _Args &...__args) {
+  (_VSTD::__format_segment_out<_Fmt, _Parsed, _Is>(__s, __args...), ...);
+}
+
+template <__fixed_string _Fmt, class... _Args>
+inline _LIBCPP_INLINE_VISIBILITY format_to_n_result<char *> format_to_n(char *__out, ptrdiff_t __n,
+                                                                        const _Args &...__args) {
+  typedef __format_parsed<_Fmt, _Args...> _Parsed;
+  __format_sink __s{__out, __out + (__n > 0 ? __n : 0), 0};
+  _VSTD::__format_out<_Fmt, _Parsed>(__s, __make_index_sequence<_Parsed::__size>(), __args...);
+  return format_to_n_result<char *>{__s.__p, __s.__size};
+}
+
+template <__fixed_string _Fmt, class... _Args>
+inline _LIBCPP_INLINE_VISIBILITY size_t formatted_size(const _Args &...__args) {
+  typedef __format_parsed<_Fmt, _Args...> _Parsed;
+  __format_sink __s{nullptr, nullptr, 0};
+  _VSTD::__format_out<_Fmt, _Parsed>(__s, __make_index_sequence<_Parsed::__size>(), __args...);
+  return static_cast<size_t>(__s.__size);
+}
+
+_LIBCPP_END_NAMESPACE_STD
+
+#endif // _LIBCPP_STD_VER > 17 && defined(__cpp_nontype_template_args) && __cpp_nontype_template_args >= 201911L
@@ -0,0 +1,238 @@
+// -*- C++ -*-
+//===------------------------ functional ----------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+/*
+    functional synopsis
+
+namespace std
+{
+
+template <class T>
+class reference_wrapper
+{
+public:
+    typedef T type;
+
+    template <class U>
+        reference_wrapper(U&&) noexcept(see below);  // binds to lvalues only
+    reference_wrapper(const reference_wrapper&) noexcept;
+    reference_wrapper& operator=(const reference_wrapper&) noexcept;
+
+    operator T&() const noexcept;
+    T& get() const noexcept;
+
+    template <class... ArgTypes>
+        typename result_of<T&(ArgTypes&&...)>::type
+        operator()(ArgTypes&&...) const;
+};
+
+template <class T> reference_wrapper<T> ref(T& t) noexcept;
+template <class T> void ref(const T&& t) = delete;
+template <class T> reference_wrapper<T> ref(reference_wrapper<T>t) noexcept;
+
+template <class T> reference_wrapper<const T> cref(const T& t) noexcept;
+template <class T> void cref(const T&& t) = delete;
+template <class T> reference_wrapper<const T> cref(reference_wrapper<T> t) noexcept;
+
+// extensions
+size_t __hash_memory(const void* p, size_t n, size_t seed = 0) noexcept;
+
+template <class T>
+  size_t __hash_object(const T& x, size_t seed = 0) noexcept;                        // C++17
+template <class T>
+  size_t __hash_object_range(const T* first, size_t n, size_t seed = 0) noexcept;   // C++17
+template <class T> struct __object_hash;                                             // C++17
+
+}  // std
+
+*/
+
+#include "__config.hh"
+#include "cstddef.hh"
+#include "type_traits.hh"
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#pragma GCC system_header
+#endif
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+// reference_wrapper
+
+template <class _Tp> class _LIBCPP_TEMPLATE_VIS reference_wrapper {
+public:
+  typedef _Tp type;
+
+private:
+  type *__f_;
+
+  static void __fun(_Tp &) _NOEXCEPT;
+  static void __fun(_Tp &&) = delete;
+
+public:
+  template <class _Up, class = _EnableIf<!is_same<__uncvref_t<_Up>, reference_wrapper>::value,
+                                         decltype(__fun(_VSTD::declval<_Up>()))> >
+  _LIBCPP_INLINE_VISIBILITY reference_wrapper(_Up &&__u) _NOEXCEPT_(noexcept(__fun(_VSTD::declval<_Up>()))) {
+    type &__f = static_cast<_Up &&>(__u);
+    __f_      = _VSTD::addressof(__f);
+  }
+
+  _LIBCPP_INLINE_VISIBILITY operator type &() const _NOEXCEPT { return *__f_; }
+  _LIBCPP_INLINE_VISIBILITY type &get() const _NOEXCEPT { return *__f_; }
+
+  template <class... _ArgTypes>
+  _LIBCPP_INLINE_VISIBILITY typename __invoke_of<type &, _ArgTypes...>::type operator()(_ArgTypes &&...__args) const {
+    return _VSTD::__invoke(get(), _VSTD::forward<_ArgTypes>(__args)...);
+  }
+};
+
+template <class _Tp> inline _LIBCPP_INLINE_VISIBILITY reference_wrapper<_Tp> ref(_Tp &__t) _NOEXCEPT {
+  return reference_wrapper<_Tp>(__t);
+}
+
+template <class _Tp> inline _LIBCPP_INLINE_VISIBILITY reference_wrapper<_Tp> ref(reference_wrapper<_Tp> __t) _NOEXCEPT {
+  return _VSTD::ref(__t.get());
+}
+
+template <class _Tp> inline _LIBCPP_INLINE_VISIBILITY reference_wrapper<const _Tp> cref(const _Tp &__t) _NOEXCEPT {
+  return reference_wrapper<const _Tp>(__t);
+}
+
+template <class _Tp>
+inline _LIBCPP_INLINE_VISIBILITY reference_wrapper<const _Tp> cref(reference_wrapper<_Tp> __t) _NOEXCEPT {
+  return _VSTD::cref(__t.get());
+}
+
+template <class _Tp> void ref(const _Tp &&) = delete;
+template <class _Tp> void cref(const _Tp &&) = delete;
+
+// __hash_memory
+
+// A wyhash-style 64-bit hash over a byte span. Inputs longer than 48 bytes are
+// consumed by three independent multiply-mix lanes so the loop is bound by
+// multiplier throughput rather than latency. The result depends on the host
+// byte order and is not meant to be persisted.
+struct __hash_memory_impl {
+  typedef unsigned long long __u64;
+
+  static _LIBCPP_CONSTEXPR const __u64 __p0 = 0xa0761d6478bd642fULL;
+  static _LIBCPP_CONSTEXPR const __u64 __p1 = 0xe7037ed1a0b428dbULL;
+  static _LIBCPP_CONSTEXPR const __u64 __p2 = 0x8ebc6af09c88c6e3ULL;
+  static _LIBCPP_CONSTEXPR const __u64 __p3 = 0x589965cc75374cc3ULL;
+
+  _LIBCPP_INLINE_VISIBILITY static __u64 __mix(__u64 __a, __u64 __b) _NOEXCEPT {
+#ifdef __SIZEOF_INT128__
+    unsigned __int128 __r = static_cast<unsigned __int128>(__a) * __b;
+    return static_cast<__u64>(__r) ^ static_cast<__u64>(__r >> 64);
+#else
+    __u64 __ha = __a >> 32, __la = static_cast<unsigned>(__a);
+    __u64 __hb = __b >> 32, __lb = static_cast<unsigned>(__b);
+    __u64 __hh = __ha * __hb, __hl = __ha * __lb, __lh = __la * __hb, __ll = __la * __lb;
+    __u64 __t = __ll + (__hl << 32);
+    __u64 __lo = __t + (__lh << 32);
+    __u64 __hi = __hh + (__hl >> 32) + (__lh >> 32) + (__t < __ll) + (__lo < __t);
+    return __lo ^ __hi;
+#endif
+  }
+
+  _LIBCPP_INLINE_VISIBILITY static __u64 __load64(const unsigned char *__p) _NOEXCEPT {
+    __u64 __v;
+    __builtin_memcpy(&__v, __p, sizeof(__v));
+    return __v;
+  }
+
+  _LIBCPP_INLINE_VISIBILITY static __u64 __load32(const unsigned char *__p) _NOEXCEPT {
+    unsigned __v;
+    __builtin_memcpy(&__v, __p, sizeof(__v));
+    return __v;
+  }
+
+  _LIBCPP_INLINE_VISIBILITY static __u64 __hash(const unsigned char *__p, size_t __n, __u64 __seed) _NOEXCEPT {
+    __seed ^= __mix(__seed ^ __p0, __p1);
+    __u64 __a, __b;
+    if (__n <= 16) {
+      if (__n >= 4) {
+        const size_t __k = (__n >> 3) << 2;
+        __a = (__load32(__p) << 32) | __load32(__p + __k);
+        __b = (__load32(__p + __n - 4) << 32) | __load32(__p + __n - 4 - __k);
+      } else if (__n > 0) {
+        __a = (__u64(__p[0]) << 16) | (__u64(__p[__n >> 1]) << 8) | __p[__n - 1];
+        __b = 0;
+      } else {
+        __a = __b = 0;
+      }
+    } else {
+      size_t __i = __n;
+      if (__i > 48) {
+        __u64 __s1 = __seed, __s2 = __seed;
+        do {
+          __seed = __mix(__load64(__p) ^ __p1, __load64(__p + 8) ^ __seed);
+          __s1   = __mix(__load64(__p + 16) ^ __p2, __load64(__p + 24) ^ __s1);
+          __s2   = __mix(__load64(__p + 32) ^ __p3, __load64(__p + 40) ^ __s2);
+          __p += 48;
+          __i -= 48;
+        } while (__i > 48);
+        __seed ^= __s1 ^ __s2;
+      }
+      while (__i > 16) {
+        __seed = __mix(__load64(__p) ^ __p1, __load64(__p + 8) ^ __seed);
+        __p += 16;
+        __i -= 16;
+      }
+      __a = __load64(__p + __i - 16);
+      __b = __load64(__p + __i - 8);
+    }
+    return __mix(__p1 ^ __n, __mix(__a ^ __p1, __b ^ __seed));
+  }
+};
+
+inline _LIBCPP_INLINE_VISIBILITY size_t __hash_memory(const void *__p, size_t __n, size_t __seed = 0) _NOEXCEPT {
+  return static_cast<size_t>(__hash_memory_impl::__hash(static_cast<const unsigned char *>(__p), __n, __seed));
+}
+
+#if _LIBCPP_STD_VER > 14 && defined(_LIBCPP_HAS_UNIQUE_OBJECT_REPRESENTATIONS)
+
+// __hash_object
+
+// Hashes the object representation of __x in a single pass. Two objects of a
+// type with unique object representations compare equal exactly when their
+// bytes do, so no per-member mixing is needed. Arrays of such types qualify
+// as a whole and are hashed as one span.
+template <class _Tp>
+inline _LIBCPP_INLINE_VISIBILITY size_t __hash_object(const _Tp &__x, size_t __seed = 0) _NOEXCEPT {
+  static_assert(has_unique_object_representations_v<_Tp>,
+                "__hash_object requires a type with unique object representations (no padding bits, no floating "
+                "point members)");
+  return _VSTD::__hash_memory(_VSTD::addressof(__x), sizeof(_Tp), __seed);
+}
+
+template <class _Tp>
+inline _LIBCPP_INLINE_VISIBILITY size_t __hash_object_range(const _Tp *__first, size_t __n,
+                                                            size_t __seed = 0) _NOEXCEPT {
+  static_assert(has_unique_object_representations_v<_Tp>,
+                "__hash_object_range requires a type with unique object representations (no padding bits, no "
+                "floating point members)");
+  return _VSTD::__hash_memory(__first, __n * sizeof(_Tp), __seed);
+}
+
+// A hasher for unordered containers keyed on such types.
+template <class _Tp> struct _LIBCPP_TEMPLATE_VIS __object_hash {
+  static_assert(has_unique_object_representations_v<_Tp>,
+                "__object_hash requires a type with unique object representations");
+
+  _LIBCPP_INLINE_VISIBILITY size_t operator()(const _Tp &__x) const _NOEXCEPT {
+    return _VSTD::__hash_object(__x);
+  }
+};
+
+#endif // _LIBCPP_STD_VER > 14 && defined(_LIBCPP_HAS_UNIQUE_OBJECT_REPRESENTATIONS)
+
+_LIBCPP_END_NAMESPACE_STD
@@ -0,0 +1,136 @@
+// -*- C++ -*-
+//===---------------------------- memory ----------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+/*
+    memory synopsis
+
+namespace std
+{
+
+template <size_t N, class T>
+  [[nodiscard]] constexpr T* assume_aligned(T* ptr);  // C++20
+
+template <class T, class... Args>
+  constexpr T* construct_at(T* location, Args&&... args);  // C++20
+template <class T>
+  void destroy_at(T* location);                            // C++17, constexpr in C++20
+
+template <class T, size_t N> struct __uninitialized_buffer;  // extension
+template <class T> struct __libcpp_is_trivially_relocatable;   // extension
+
+}  // std
+
+*/
+
+#include "__config.hh"
+#include "new.hh"
+#include "type_traits.hh"
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#pragma GCC system_header
+#endif
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+// __libcpp_prefetch
+
+// _Rw is 0 to prepare for a read and 1 to prepare for a write. _Locality goes
+// from 0 (no temporal locality) to 3 (keep the line in every cache level).
+template <int _Rw = 0, int _Locality = 3>
+inline _LIBCPP_INLINE_VISIBILITY void __libcpp_prefetch(const void *__addr) _NOEXCEPT {
+  static_assert(_Rw == 0 || _Rw == 1, "__libcpp_prefetch: _Rw must be 0 or 1");
+  static_assert(_Locality >= 0 && _Locality <= 3, "__libcpp_prefetch: _Locality must be in [0, 3]");
+#if __has_builtin(__builtin_prefetch) || defined(_LIBCPP_COMPILER_GCC)
+  __builtin_prefetch(__addr, _Rw, _Locality);
+#else
+  (void)__addr;
+#endif
+}
+
+// assume_aligned
+
+template <size_t _Np, class _Tp>
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX14 _Tp *__assume_aligned(_Tp *__ptr) _NOEXCEPT {
+  static_assert(_Np != 0 && (_Np & (_Np - 1)) == 0, "assume_aligned requires a power of two alignment");
+  static_assert(!is_function<_Tp>::value, "assume_aligned requires a pointer to an object type");
+#if __has_builtin(__builtin_assume_aligned) || defined(_LIBCPP_COMPILER_GCC)
+  if (__libcpp_is_constant_evaluated())
+    return __ptr;
+  return static_cast<_Tp *>(__builtin_assume_aligned(__ptr, _Np));
+#else
+  return __ptr;
+#endif
+}
+
+#if _LIBCPP_STD_VER > 17
+template <size_t _Np, class _Tp>
+[[nodiscard]] inline _LIBCPP_INLINE_VISIBILITY constexpr _Tp *assume_aligned(_Tp *__ptr) {
+  return _VSTD::__assume_aligned<_Np>(__ptr);
+}
+#endif
+
+// construct_at, destroy_at
+
+#if _LIBCPP_STD_VER > 17
+template <class _Tp, class... _Args, class = decltype(::new (declval<void *>()) _Tp(declval<_Args>()...))>
+inline _LIBCPP_INLINE_VISIBILITY constexpr _Tp *construct_at(_Tp *__location, _Args &&...__args) {
+  return ::new (static_cast<void *>(__location)) _Tp(_VSTD::forward<_Args>(__args)...);
+}
+#endif
+
+// Usable in every dialect; in C++20 it goes through construct_at, which is
+// the one spelling of placement new allowed in constant evaluation.
+template <class _Tp, class... _Args, class = decltype(::new (declval<void *>()) _Tp(declval<_Args>()...))>
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 _Tp *__construct_at(_Tp *__location, _Args &&...__args) {
+#if _LIBCPP_STD_VER > 17
+  return _VSTD::construct_at(__location, _VSTD::forward<_Args>(__args)...);
+#else
+  return ::new (static_cast<void *>(__location)) _Tp(_VSTD::forward<_Args>(__args)...);
+#endif
+}
+
+template <class _Tp> inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 void __destroy_at(_Tp *__loc) _NOEXCEPT {
+  __loc->~_Tp();
+}
+
+#if _LIBCPP_STD_VER > 14
+template <class _Tp> inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 void destroy_at(_Tp *__loc) {
+  _VSTD::__destroy_at(__loc);
+}
+#endif
+
+// __uninitialized_buffer
+
+// Raw storage for _Np objects of type _Tp, suitably aligned and never
+// constructed or destroyed by the buffer itself. Intended as the inline
+// storage of small-buffer containers, which track the live range themselves.
+template <class _Tp, size_t _Np> struct __uninitialized_buffer {
+  static_assert(!is_reference<_Tp>::value && !is_function<_Tp>::value && !is_void<_Tp>::value,
+                "__uninitialized_buffer requires an object type");
+
+  static _LIBCPP_CONSTEXPR const size_t __capacity = _Np;
+
+  _LIBCPP_INLINE_VISIBILITY _Tp *__data() _NOEXCEPT { return reinterpret_cast<_Tp *>(__bytes_); }
+  _LIBCPP_INLINE_VISIBILITY const _Tp *__data() const _NOEXCEPT { return reinterpret_cast<const _Tp *>(__bytes_); }
+
+  alignas(_Tp) unsigned char __bytes_[sizeof(_Tp) * (_Np == 0 ? 1 : _Np)];
+};
+
+// __libcpp_is_trivially_relocatable
+
+// Whether moving an object to new storage and ending the old object's
+// lifetime may be done by copying its bytes. Containers relocate such
+// elements with memcpy/memmove and never run the destructor on the source.
+// Trivially copyable types qualify; a type that owns a resource through a
+// pointer to elsewhere (not to itself) may specialize this to true_type.
+template <class _Tp> struct __libcpp_is_trivially_relocatable : is_trivially_copyable<_Tp> {};
+
+_LIBCPP_END_NAMESPACE_STD
@@ -0,0 +1,197 @@
+// -*- C++ -*-
+//===----------------------------- new ------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+/*
+    new synopsis
+
+namespace std
+{
+
+struct nothrow_t { explicit nothrow_t() = default; };
+extern const nothrow_t nothrow;
+enum class align_val_t : size_t {}; // C++17
+
+template <class T> [[nodiscard]] constexpr T* launder(T* p) noexcept; // C++17
+
+// extensions
+void* __libcpp_allocate(size_t size, size_t align);
+void  __libcpp_deallocate(void* ptr, size_t size, size_t align) noexcept;
+
+}  // std
+
+void* operator new(std::size_t size);                                   // replaceable
+void* operator new(std::size_t size, std::align_val_t alignment);       // replaceable, C++17
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept;   // replaceable
+void* operator new(std::size_t size, std::align_val_t alignment,
+                   const std::nothrow_t&) noexcept;                     // replaceable, C++17
+void  operator delete(void* ptr) noexcept;                              // replaceable
+void  operator delete(void* ptr, std::size_t size) noexcept;            // replaceable, C++14
+void  operator delete(void* ptr, std::align_val_t alignment) noexcept;  // replaceable, C++17
+void  operator delete(void* ptr, std::size_t size,
+                      std::align_val_t alignment) noexcept;             // replaceable, C++17
+void  operator delete(void* ptr, const std::nothrow_t&) noexcept;       // replaceable
+void  operator delete(void* ptr, std::align_val_t alignment,
+                      const std::nothrow_t&) noexcept;                  // replaceable, C++17
+
+void* operator new[](std::size_t size);                                 // replaceable
+... and the same array forms as above
+
+void* operator new  (std::size_t size, void* ptr) noexcept;
+void* operator new[](std::size_t size, void* ptr) noexcept;
+void  operator delete  (void* ptr, void*) noexcept;
+void  operator delete[](void* ptr, void*) noexcept;
+
+*/
+
+#include "__config.hh"
+#include "cstddef.hh"
+#include "type_traits.hh"
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#pragma GCC system_header
+#endif
+
+namespace std // purposefully not using versioning namespace
+{
+
+struct _LIBCPP_TYPE_VIS nothrow_t {
+#ifndef _LIBCPP_CXX03_LANG
+  explicit nothrow_t() = default;
+#endif
+};
+extern _LIBCPP_FUNC_VIS const nothrow_t nothrow;
+
+#if !defined(_LIBCPP_HAS_NO_ALIGNED_ALLOCATION)
+enum class _LIBCPP_ENUM_VIS align_val_t : size_t {};
+#endif
+
+} // namespace std
+
+_LIBCPP_FUNC_VIS void *operator new(std::size_t __sz);
+_LIBCPP_FUNC_VIS void *operator new(std::size_t __sz, const std::nothrow_t &) _NOEXCEPT;
+_LIBCPP_FUNC_VIS void operator delete(void *__p) _NOEXCEPT;
+_LIBCPP_FUNC_VIS void operator delete(void *__p, const std::nothrow_t &) _NOEXCEPT;
+#ifndef _LIBCPP_HAS_NO_SIZED_DEALLOCATION
+_LIBCPP_FUNC_VIS void operator delete(void *__p, std::size_t __sz) _NOEXCEPT;
+#endif
+
+_LIBCPP_FUNC_VIS void *operator new[](std::size_t __sz);
+_LIBCPP_FUNC_VIS void *operator new[](std::size_t __sz, const std::nothrow_t &) _NOEXCEPT;
+_LIBCPP_FUNC_VIS void operator delete[](void *__p) _NOEXCEPT;
+_LIBCPP_FUNC_VIS void operator delete[](void *__p, const std::nothrow_t &) _NOEXCEPT;
+#ifndef _LIBCPP_HAS_NO_SIZED_DEALLOCATION
+_LIBCPP_FUNC_VIS void operator delete[](void *__p, std::size_t __sz) _NOEXCEPT;
+#endif
+
+#ifndef _LIBCPP_HAS_NO_ALIGNED_ALLOCATION
+_LIBCPP_FUNC_VIS void *operator new(std::size_t __sz, std::align_val_t);
+_LIBCPP_FUNC_VIS void *operator new(std::size_t __sz, std::align_val_t, const std::nothrow_t &) _NOEXCEPT;
+_LIBCPP_FUNC_VIS void operator delete(void *__p, std::align_val_t) _NOEXCEPT;
+_LIBCPP_FUNC_VIS void operator delete(void *__p, std::align_val_t, const std::nothrow_t &) _NOEXCEPT;
+#ifndef _LIBCPP_HAS_NO_SIZED_DEALLOCATION
+_LIBCPP_FUNC_VIS void operator delete(void *__p, std::size_t __sz, std::align_val_t) _NOEXCEPT;
+#endif
+
+_LIBCPP_FUNC_VIS void *operator new[](std::size_t __sz, std::align_val_t);
+_LIBCPP_FUNC_VIS void *operator new[](std::size_t __sz, std::align_val_t, const std::nothrow_t &) _NOEXCEPT;
+_LIBCPP_FUNC_VIS void operator delete[](void *__p, std::align_val_t) _NOEXCEPT;
+_LIBCPP_FUNC_VIS void operator delete[](void *__p, std::align_val_t, const std::nothrow_t &) _NOEXCEPT;
+#ifndef _LIBCPP_HAS_NO_SIZED_DEALLOCATION
+_LIBCPP_FUNC_VIS void operator delete[](void *__p, std::size_t __sz, std::align_val_t) _NOEXCEPT;
+#endif
+#endif
+
+inline _LIBCPP_INLINE_VISIBILITY void *operator new(std::size_t, void *__p) _NOEXCEPT { return __p; }
+inline _LIBCPP_INLINE_VISIBILITY void *operator new[](std::size_t, void *__p) _NOEXCEPT { return __p; }
+inline _LIBCPP_INLINE_VISIBILITY void operator delete(void *, void *) _NOEXCEPT {}
+inline _LIBCPP_INLINE_VISIBILITY void operator delete[](void *, void *) _NOEXCEPT {}
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+// __libcpp_allocate, __libcpp_deallocate
+
+#ifdef __STDCPP_DEFAULT_NEW_ALIGNMENT__
+static const size_t __libcpp_default_new_alignment = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+#else
+static const size_t __libcpp_default_new_alignment = alignof(long double);
+#endif
+
+_LIBCPP_CONSTEXPR inline _LIBCPP_INLINE_VISIBILITY bool __is_overaligned_for_new(size_t __align) _NOEXCEPT {
+  return __align > __libcpp_default_new_alignment;
+}
+
+// The builtins let the optimizer elide or merge allocations that the
+// replaceable operator calls would otherwise pin down.
+template <class... _Args> inline _LIBCPP_INLINE_VISIBILITY void *__libcpp_operator_new(_Args... __args) {
+#if __has_builtin(__builtin_operator_new) && __has_builtin(__builtin_operator_delete)
+  return __builtin_operator_new(__args...);
+#else
+  return ::operator new(__args...);
+#endif
+}
+
+template <class... _Args> inline _LIBCPP_INLINE_VISIBILITY void __libcpp_operator_delete(_Args... __args) {
+#if __has_builtin(__builtin_operator_new) && __has_builtin(__builtin_operator_delete)
+  __builtin_operator_delete(__args...);
+#else
+  ::operator delete(__args...);
+#endif
+}
+
+inline _LIBCPP_INLINE_VISIBILITY void *__libcpp_allocate(size_t __size, size_t __align) {
+#ifndef _LIBCPP_HAS_NO_ALIGNED_ALLOCATION
+  if (__is_overaligned_for_new(__align))
+    return _VSTD::__libcpp_operator_new(__size, static_cast<align_val_t>(__align));
+#else
+  (void)__align;
+#endif
+  return _VSTD::__libcpp_operator_new(__size);
+}
+
+inline _LIBCPP_INLINE_VISIBILITY void __libcpp_deallocate(void *__ptr, size_t __size, size_t __align) _NOEXCEPT {
+#ifndef _LIBCPP_HAS_NO_ALIGNED_ALLOCATION
+  if (__is_overaligned_for_new(__align)) {
+#ifndef _LIBCPP_HAS_NO_SIZED_DEALLOCATION
+    return _VSTD::__libcpp_operator_delete(__ptr, __size, static_cast<align_val_t>(__align));
+#else
+    return _VSTD::__libcpp_operator_delete(__ptr, static_cast<align_val_t>(__align));
+#endif
+  }
+#else
+  (void)__align;
+#endif
+#ifndef _LIBCPP_HAS_NO_SIZED_DEALLOCATION
+  _VSTD::__libcpp_operator_delete(__ptr, __size);
+#else
+  (void)__size;
+  _VSTD::__libcpp_operator_delete(__ptr);
+#endif
+}
+
+// launder
+
+template <class _Tp> inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR _Tp *__launder(_Tp *__p) _NOEXCEPT {
+  static_assert(!(is_function<_Tp>::value), "can't launder functions");
+  static_assert(!(is_same<void, typename remove_cv<_Tp>::type>::value), "can't launder cv-void");
+#if __has_builtin(__builtin_launder) || _GNUC_VER >= 700
+  return __builtin_launder(__p);
+#else
+  return __p;
+#endif
+}
+
+#if _LIBCPP_STD_VER > 14
+template <class _Tp> [[nodiscard]] inline _LIBCPP_INLINE_VISIBILITY constexpr _Tp *launder(_Tp *__p) noexcept {
+  return _VSTD::__launder(__p);
+}
+#endif
+
+_LIBCPP_END_NAMESPACE_STD
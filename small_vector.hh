@@ -0,0 +1,594 @@
+// -*- C++ -*-
+//===------------------------ small_vector --------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+/*
+    small_vector synopsis (extension)
+
+namespace std
+{
+
+// A vector that keeps up to N elements in inline storage and only allocates
+// when it grows beyond that.
+template <class T, size_t N>
+class small_vector
+{
+public:
+    typedef T                 value_type;
+    typedef size_t            size_type;
+    typedef ptrdiff_t         difference_type;
+    typedef T&                reference;
+    typedef const T&          const_reference;
+    typedef T*                pointer;
+    typedef const T*          const_pointer;
+    typedef T*                iterator;
+    typedef const T*          const_iterator;
+
+    static constexpr size_type inline_capacity = N;
+
+    small_vector() noexcept;
+    explicit small_vector(size_type n);
+    small_vector(size_type n, const value_type& value);
+    template <class InputIterator>
+        small_vector(InputIterator first, InputIterator last);
+    small_vector(const small_vector& x);
+    small_vector(small_vector&& x) noexcept(is_nothrow_move_constructible<T>::value);
+    ~small_vector();
+    small_vector& operator=(const small_vector& x);
+    small_vector& operator=(small_vector&& x) noexcept(is_nothrow_move_constructible<T>::value);
+
+    void assign(size_type n, const value_type& value);
+    template <class InputIterator>
+        void assign(InputIterator first, InputIterator last);
+
+    iterator begin() noexcept;              const_iterator begin() const noexcept;
+    iterator end() noexcept;                const_iterator end() const noexcept;
+    pointer data() noexcept;                const_pointer data() const noexcept;
+
+    size_type size() const noexcept;
+    size_type capacity() const noexcept;
+    bool empty() const noexcept;
+    bool __is_inline() const noexcept;      // storage is the inline buffer
+    void reserve(size_type n);
+    void shrink_to_fit();                   // moves back inline when size() <= N
+
+    reference operator[](size_type i) noexcept;
+    const_reference operator[](size_type i) const noexcept;
+    reference front() noexcept;             const_reference front() const noexcept;
+    reference back() noexcept;              const_reference back() const noexcept;
+
+    void push_back(const value_type& x);
+    void push_back(value_type&& x);
+    template <class... Args> reference emplace_back(Args&&... args);
+    void pop_back() noexcept;
+
+    iterator insert(const_iterator position, const value_type& x);
+    iterator insert(const_iterator position, value_type&& x);
+    iterator insert(const_iterator position, size_type n, const value_type& x);
+    template <class InputIterator>
+        iterator insert(const_iterator position, InputIterator first, InputIterator last);
+    template <class... Args> iterator emplace(const_iterator position, Args&&... args);
+
+    iterator erase(const_iterator position);
+    iterator erase(const_iterator first, const_iterator last);
+
+    void resize(size_type n);
+    void resize(size_type n, const value_type& value);
+    void clear() noexcept;
+    void swap(small_vector& x);
+};
+
+template <class T, size_t N> bool operator==(const small_vector<T, N>& x, const small_vector<T, N>& y);
+template <class T, size_t N> bool operator!=(const small_vector<T, N>& x, const small_vector<T, N>& y);
+template <class T, size_t N> bool operator< (const small_vector<T, N>& x, const small_vector<T, N>& y);
+template <class T, size_t N> void swap(small_vector<T, N>& x, small_vector<T, N>& y);
+
+}  // std
+
+*/
+
+#include "__config.hh"
+#include "algorithm.hh"
+#include "cstddef.hh"
+#include "memory.hh"
+#include "new.hh"
+#include "type_traits.hh"
+#include "utility.hh"
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#pragma GCC system_header
+#endif
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+// __small_vector_ops
+
+// The element-management primitives, which depend only on _Tp. Relocation
+// moves elements to uninitialized storage: trivially relocatable types are
+// copied bytewise and their sources are not destroyed; other types are moved
+// when their move constructor cannot throw and copied otherwise, so a
+// throwing relocation leaves the source untouched.
+template <class _Tp> struct __small_vector_ops {
+  typedef __libcpp_is_trivially_relocatable<_Tp> __relocatable;
+  typedef is_trivially_destructible<_Tp> __trivially_destructible;
+
+  // Destroys [__first_, __cur_) unless released.
+  struct __destroy_guard {
+    _Tp *__first_;
+    _Tp *__cur_;
+
+    _LIBCPP_INLINE_VISIBILITY explicit __destroy_guard(_Tp *__p) _NOEXCEPT : __first_(__p), __cur_(__p) {}
+    _LIBCPP_INLINE_VISIBILITY ~__destroy_guard() {
+      if (__first_)
+        __small_vector_ops::__destroy(__first_, __cur_);
+    }
+    _LIBCPP_INLINE_VISIBILITY void __release() _NOEXCEPT { __first_ = nullptr; }
+  };
+
+  static _LIBCPP_INLINE_VISIBILITY void __destroy(_Tp *, _Tp *, true_type) _NOEXCEPT {}
+  static _LIBCPP_INLINE_VISIBILITY void __destroy(_Tp *__first, _Tp *__last, false_type) _NOEXCEPT {
+    for (; __first != __last; ++__first)
+      __first->~_Tp();
+  }
+  static _LIBCPP_INLINE_VISIBILITY void __destroy(_Tp *__first, _Tp *__last) _NOEXCEPT {
+    __destroy(__first, __last, __trivially_destructible());
+  }
+
+  // Constructs [__dst, __dst + __n) from the source; the source is left for
+  // __end_relocation.
+  static _LIBCPP_INLINE_VISIBILITY void __relocate(_Tp *__src, size_t __n, _Tp *__dst, true_type) _NOEXCEPT {
+    if (__n != 0)
+      __builtin_memcpy(static_cast<void *>(__dst), static_cast<const void *>(__src), __n * sizeof(_Tp));
+  }
+  static _LIBCPP_INLINE_VISIBILITY void __relocate(_Tp *__src, size_t __n, _Tp *__dst, false_type) {
+    __destroy_guard __g(__dst);
+    for (; __n != 0; --__n, ++__src, (void)++__g.__cur_)
+      ::new (static_cast<void *>(__g.__cur_)) _Tp(_VSTD::move_if_noexcept(*__src));
+    __g.__release();
+  }
+  static _LIBCPP_INLINE_VISIBILITY void __relocate(_Tp *__src, size_t __n, _Tp *__dst) {
+    __relocate(__src, __n, __dst, __relocatable());
+  }
+
+  // Ends the lifetime of relocated-from elements.
+  static _LIBCPP_INLINE_VISIBILITY void __end_relocation(_Tp *, _Tp *, true_type) _NOEXCEPT {}
+  static _LIBCPP_INLINE_VISIBILITY void __end_relocation(_Tp *__first, _Tp *__last, false_type) _NOEXCEPT {
+    __destroy(__first, __last);
+  }
+  static _LIBCPP_INLINE_VISIBILITY void __end_relocation(_Tp *__first, _Tp *__last) _NOEXCEPT {
+    __end_relocation(__first, __last, __relocatable());
+  }
+
+  static _LIBCPP_INLINE_VISIBILITY _Tp *__allocate(size_t __n) {
+    return static_cast<_Tp *>(_VSTD::__libcpp_allocate(__n * sizeof(_Tp), alignof(_Tp)));
+  }
+  static _LIBCPP_INLINE_VISIBILITY void __deallocate(_Tp *__p, size_t __n) _NOEXCEPT {
+    _VSTD::__libcpp_deallocate(__p, __n * sizeof(_Tp), alignof(_Tp));
+  }
+
+  // Frees a freshly allocated block unless released.
+  struct __deallocate_guard {
+    _Tp *__p_;
+    size_t __n_;
+
+    _LIBCPP_INLINE_VISIBILITY ~__deallocate_guard() {
+      if (__p_)
+        __small_vector_ops::__deallocate(__p_, __n_);
+    }
+    _LIBCPP_INLINE_VISIBILITY void __release() _NOEXCEPT { __p_ = nullptr; }
+  };
+
+  static _LIBCPP_INLINE_VISIBILITY void __reverse(_Tp *__first, _Tp *__last) {
+    using _VSTD::swap;
+    for (; __first != __last && __first != --__last; ++__first)
+      swap(*__first, *__last);
+  }
+
+  // [__first, __middle) + [__middle, __last) -> [__middle, __last) + [__first, __middle)
+  static _LIBCPP_INLINE_VISIBILITY void __rotate(_Tp *__first, _Tp *__middle, _Tp *__last) {
+    __reverse(__first, __middle);
+    __reverse(__middle, __last);
+    __reverse(__first, __last);
+  }
+};
+
+// small_vector
+
+template <class _Tp, size_t _Np> class _LIBCPP_TEMPLATE_VIS small_vector {
+  static_assert(is_object<_Tp>::value && !is_array<_Tp>::value && !is_const<_Tp>::value && !is_volatile<_Tp>::value,
+                "small_vector requires a cv-unqualified, non-array object type");
+
+  typedef __small_vector_ops<_Tp> __ops;
+  typedef typename __ops::__relocatable __relocatable;
+
+public:
+  typedef _Tp value_type;
+  typedef size_t size_type;
+  typedef ptrdiff_t difference_type;
+  typedef _Tp &reference;
+  typedef const _Tp &const_reference;
+  typedef _Tp *pointer;
+  typedef const _Tp *const_pointer;
+  typedef _Tp *iterator;
+  typedef const _Tp *const_iterator;
+
+  static _LIBCPP_CONSTEXPR const size_type inline_capacity = _Np;
+
+private:
+  _Tp *__begin_;
+  size_type __size_;
+  size_type __cap_;
+  // The inline slots are an __uninitialized_buffer rather than
+  // aligned_storage: the same alignas'd bytes, but sized exactly _Np
+  // elements, typed through __data(), and not deprecated as aligned_storage
+  // is in C++23.
+  __uninitialized_buffer<_Tp, _Np> __inline_;
+
+  _LIBCPP_INLINE_VISIBILITY _Tp *__inline_data() _NOEXCEPT { return __inline_.__data(); }
+
+  _LIBCPP_INLINE_VISIBILITY void __reset_to_inline() _NOEXCEPT {
+    __begin_ = __inline_data();
+    __size_  = 0;
+    __cap_   = _Np;
+  }
+
+  _LIBCPP_INLINE_VISIBILITY void __release_heap() _NOEXCEPT {
+    if (!__is_inline())
+      __ops::__deallocate(__begin_, __cap_);
+  }
+
+  _LIBCPP_INLINE_VISIBILITY size_type __recommend(size_type __new_size) const _NOEXCEPT {
+    const size_type __c = 2 * __cap_;
+    return __c < __new_size ? __new_size : __c;
+  }
+
+  // Moves the elements into a new block of __new_cap elements, or into the
+  // inline buffer when __new_cap is _Np and the storage is on the heap.
+  void __reallocate(size_type __new_cap) {
+    _Tp *__nb = __new_cap == _Np ? __inline_data() : __ops::__allocate(__new_cap);
+    typename __ops::__deallocate_guard __g = {__nb == __inline_data() ? nullptr : __nb, __new_cap};
+    __ops::__relocate(__begin_, __size_, __nb);
+    __g.__release();
+    __ops::__end_relocation(__begin_, __begin_ + __size_);
+    __release_heap();
+    __begin_ = __nb;
+    __cap_   = __new_cap;
+  }
+
+  template <class... _Args> _Tp *__emplace_back_slow(_Args &&...__args) {
+    const size_type __new_cap = __recommend(__size_ + 1);
+    _Tp *__nb                 = __ops::__allocate(__new_cap);
+    typename __ops::__deallocate_guard __g = {__nb, __new_cap};
+    // Construct first: the arguments may refer into the current elements.
+    ::new (static_cast<void *>(__nb + __size_)) _Tp(_VSTD::forward<_Args>(__args)...);
+    typename __ops::__destroy_guard __eg(__nb + __size_);
+    __eg.__cur_ = __nb + __size_ + 1;
+    __ops::__relocate(__begin_, __size_, __nb);
+    __eg.__release();
+    __g.__release();
+    __ops::__end_relocation(__begin_, __begin_ + __size_);
+    __release_heap();
+    __begin_ = __nb;
+    __cap_   = __new_cap;
+    return __begin_ + __size_++;
+  }
+
+  template <class... _Args> iterator __emplace_realloc(size_type __i, _Args &&...__args) {
+    const size_type __new_cap = __recommend(__size_ + 1);
+    _Tp *__nb                 = __ops::__allocate(__new_cap);
+    typename __ops::__deallocate_guard __g = {__nb, __new_cap};
+    ::new (static_cast<void *>(__nb + __i)) _Tp(_VSTD::forward<_Args>(__args)...);
+    typename __ops::__destroy_guard __eg(__nb + __i);
+    __eg.__cur_ = __nb + __i + 1;
+    __ops::__relocate(__begin_, __i, __nb);
+    typename __ops::__destroy_guard __pg(__nb);
+    __pg.__cur_ = __nb + __i;
+    __ops::__relocate(__begin_ + __i, __size_ - __i, __nb + __i + 1);
+    __pg.__release();
+    __eg.__release();
+    __g.__release();
+    __ops::__end_relocation(__begin_, __begin_ + __size_);
+    __release_heap();
+    __begin_ = __nb;
+    __cap_   = __new_cap;
+    ++__size_;
+    return __begin_ + __i;
+  }
+
+  // In-place insertion with spare capacity, __i < __size_.
+  template <class... _Args> void __emplace_shift(size_type __i, true_type, _Args &&...__args) {
+    // Build the new element off to the side, then open the gap and relocate
+    // it in, so a throwing constructor leaves the vector unchanged.
+    __uninitialized_buffer<_Tp, 1> __tmp;
+    ::new (static_cast<void *>(__tmp.__data())) _Tp(_VSTD::forward<_Args>(__args)...);
+    _Tp *__p = __begin_ + __i;
+    __builtin_memmove(static_cast<void *>(__p + 1), static_cast<const void *>(__p), (__size_ - __i) * sizeof(_Tp));
+    __builtin_memcpy(static_cast<void *>(__p), static_cast<const void *>(__tmp.__data()), sizeof(_Tp));
+    ++__size_;
+  }
+
+  template <class... _Args> void __emplace_shift(size_type __i, false_type, _Args &&...__args) {
+    _Tp __tmp(_VSTD::forward<_Args>(__args)...);
+    _Tp *__p    = __begin_ + __i;
+    _Tp *__last = __begin_ + __size_;
+    ::new (static_cast<void *>(__last)) _Tp(_VSTD::move(__last[-1]));
+    ++__size_;
+    for (_Tp *__d = __last - 1; __d != __p; --__d)
+      *__d = _VSTD::move(__d[-1]);
+    *__p = _VSTD::move(__tmp);
+  }
+
+  void __insert_n(size_type __i, size_type __n, const _Tp &__x, true_type) {
+    __uninitialized_buffer<_Tp, 1> __copy;
+    ::new (static_cast<void *>(__copy.__data())) _Tp(__x);
+    typename __ops::__destroy_guard __cg(__copy.__data());
+    __cg.__cur_ = __copy.__data() + 1;
+    if (__size_ + __n > __cap_)
+      __reallocate(__recommend(__size_ + __n));
+    _Tp *__p = __begin_ + __i;
+    const size_type __tail = (__size_ - __i) * sizeof(_Tp);
+    __builtin_memmove(static_cast<void *>(__p + __n), static_cast<const void *>(__p), __tail);
+    struct __close_gap {
+      _Tp *__p_;
+      size_type __n_, __tail_;
+      _Tp *__cur_;
+      ~__close_gap() {
+        if (__p_) {
+          __small_vector_ops<_Tp>::__destroy(__p_, __cur_);
+          __builtin_memmove(static_cast<void *>(__p_), static_cast<const void *>(__p_ + __n_), __tail_);
+        }
+      }
+    } __gap = {__p, __n, __tail, __p};
+    for (; __gap.__cur_ != __p + __n; ++__gap.__cur_)
+      ::new (static_cast<void *>(__gap.__cur_)) _Tp(*__copy.__data());
+    __gap.__p_ = nullptr;
+    __size_ += __n;
+  }
+
+  void __insert_n(size_type __i, size_type __n, const _Tp &__x, false_type) {
+    const size_type __old = __size_;
+    _Tp __copy(__x);
+    reserve(__size_ + __n);
+    for (size_type __k = 0; __k != __n; ++__k)
+      emplace_back(__copy);
+    __ops::__rotate(__begin_ + __i, __begin_ + __old, __begin_ + __size_);
+  }
+
+  void __erase(_Tp *__first, _Tp *__last, true_type) _NOEXCEPT {
+    _Tp *__end = __begin_ + __size_;
+    __ops::__destroy(__first, __last);
+    __builtin_memmove(static_cast<void *>(__first), static_cast<const void *>(__last),
+                      static_cast<size_t>(__end - __last) * sizeof(_Tp));
+  }
+
+  void __erase(_Tp *__first, _Tp *__last, false_type) {
+    _Tp *__end = __begin_ + __size_;
+    _Tp *__d   = __first;
+    for (_Tp *__s = __last; __s != __end; ++__s, (void)++__d)
+      *__d = _VSTD::move(*__s);
+    __ops::__destroy(__d, __end);
+  }
+
+  // Takes over __x's elements; *this must be empty and inline.
+  void __steal(small_vector &__x) {
+    if (__x.__is_inline()) {
+      __ops::__relocate(__x.__begin_, __x.__size_, __begin_);
+      __ops::__end_relocation(__x.__begin_, __x.__begin_ + __x.__size_);
+      __size_ = __x.__size_;
+    } else {
+      __begin_ = __x.__begin_;
+      __size_  = __x.__size_;
+      __cap_   = __x.__cap_;
+    }
+    __x.__reset_to_inline();
+  }
+
+public:
+  _LIBCPP_INLINE_VISIBILITY small_vector() _NOEXCEPT : __begin_(__inline_data()), __size_(0), __cap_(_Np) {}
+
+  explicit small_vector(size_type __n) : small_vector() { resize(__n); }
+
+  small_vector(size_type __n, const value_type &__x) : small_vector() { assign(__n, __x); }
+
+  template <class _InputIterator, class = _EnableIf<!is_integral<_InputIterator>::value>>
+  small_vector(_InputIterator __first, _InputIterator __last) : small_vector() {
+    for (; __first != __last; ++__first)
+      emplace_back(*__first);
+  }
+
+  small_vector(const small_vector &__x) : small_vector() {
+    reserve(__x.__size_);
+    for (const _Tp *__p = __x.begin(); __p != __x.end(); ++__p, (void)++__size_)
+      ::new (static_cast<void *>(__begin_ + __size_)) _Tp(*__p);
+  }
+
+  small_vector(small_vector &&__x) _NOEXCEPT_(is_nothrow_move_constructible<_Tp>::value) : small_vector() {
+    __steal(__x);
+  }
+
+  ~small_vector() {
+    __ops::__destroy(__begin_, __begin_ + __size_);
+    __release_heap();
+  }
+
+  small_vector &operator=(const small_vector &__x) {
+    if (this != &__x)
+      assign(__x.begin(), __x.end());
+    return *this;
+  }
+
+  small_vector &operator=(small_vector &&__x) _NOEXCEPT_(is_nothrow_move_constructible<_Tp>::value) {
+    if (this != &__x) {
+      clear();
+      __release_heap();
+      __reset_to_inline();
+      __steal(__x);
+    }
+    return *this;
+  }
+
+  void assign(size_type __n, const value_type &__x) {
+    _Tp __copy(__x);
+    clear();
+    reserve(__n);
+    for (; __size_ != __n; ++__size_)
+      ::new (static_cast<void *>(__begin_ + __size_)) _Tp(__copy);
+  }
+
+  template <class _InputIterator, class = _EnableIf<!is_integral<_InputIterator>::value>>
+  void assign(_InputIterator __first, _InputIterator __last) {
+    clear();
+    for (; __first != __last; ++__first)
+      emplace_back(*__first);
+  }
+
+  _LIBCPP_INLINE_VISIBILITY iterator begin() _NOEXCEPT { return __begin_; }
+  _LIBCPP_INLINE_VISIBILITY const_iterator begin() const _NOEXCEPT { return __begin_; }
+  _LIBCPP_INLINE_VISIBILITY iterator end() _NOEXCEPT { return __begin_ + __size_; }
+  _LIBCPP_INLINE_VISIBILITY const_iterator end() const _NOEXCEPT { return __begin_ + __size_; }
+  _LIBCPP_INLINE_VISIBILITY pointer data() _NOEXCEPT { return __begin_; }
+  _LIBCPP_INLINE_VISIBILITY const_pointer data() const _NOEXCEPT { return __begin_; }
+
+  _LIBCPP_INLINE_VISIBILITY size_type size() const _NOEXCEPT { return __size_; }
+  _LIBCPP_INLINE_VISIBILITY size_type capacity() const _NOEXCEPT { return __cap_; }
+  _LIBCPP_INLINE_VISIBILITY bool empty() const _NOEXCEPT { return __size_ == 0; }
+  _LIBCPP_INLINE_VISIBILITY bool __is_inline() const _NOEXCEPT { return __begin_ == __inline_.__data(); }
+
+  void reserve(size_type __n) {
+    if (__n > __cap_)
+      __reallocate(__n);
+  }
+
+  void shrink_to_fit() {
+    if (__is_inline() || __size_ == __cap_)
+      return;
+    __reallocate(__size_ <= _Np ? _Np : __size_);
+  }
+
+  _LIBCPP_INLINE_VISIBILITY reference operator[](size_type __i) _NOEXCEPT { return __begin_[__i]; }
+  _LIBCPP_INLINE_VISIBILITY const_reference operator[](size_type __i) const _NOEXCEPT { return __begin_[__i]; }
+  _LIBCPP_INLINE_VISIBILITY reference front() _NOEXCEPT { return __begin_[0]; }
+  _LIBCPP_INLINE_VISIBILITY const_reference front() const _NOEXCEPT { return __begin_[0]; }
+  _LIBCPP_INLINE_VISIBILITY reference back() _NOEXCEPT { return __begin_[__size_ - 1]; }
+  _LIBCPP_INLINE_VISIBILITY const_reference back() const _NOEXCEPT { return __begin_[__size_ - 1]; }
+
+  _LIBCPP_INLINE_VISIBILITY void push_back(const value_type &__x) { emplace_back(__x); }
+  _LIBCPP_INLINE_VISIBILITY void push_back(value_type &&__x) { emplace_back(_VSTD::move(__x)); }
+
+  template <class... _Args> _LIBCPP_INLINE_VISIBILITY reference emplace_back(_Args &&...__args) {
+    if (_LIBCPP_LIKELY(__size_ != __cap_)) {
+      ::new (static_cast<void *>(__begin_ + __size_)) _Tp(_VSTD::forward<_Args>(__args)...);
+      return __begin_[__size_++];
+    }
+    return *__emplace_back_slow(_VSTD::forward<_Args>(__args)...);
+  }
+
+  _LIBCPP_INLINE_VISIBILITY void pop_back() _NOEXCEPT {
+    --__size_;
+    __ops::__destroy(__begin_ + __size_, __begin_ + __size_ + 1);
+  }
+
+  iterator insert(const_iterator __pos, const value_type &__x) { return emplace(__pos, __x); }
+  iterator insert(const_iterator __pos, value_type &&__x) { return emplace(__pos, _VSTD::move(__x)); }
+
+  iterator insert(const_iterator __pos, size_type __n, const value_type &__x) {
+    const size_type __i = static_cast<size_type>(__pos - __begin_);
+    if (__n != 0)
+      __insert_n(__i, __n, __x, __relocatable());
+    return __begin_ + __i;
+  }
+
+  template <class _InputIterator, class = _EnableIf<!is_integral<_InputIterator>::value>>
+  iterator insert(const_iterator __pos, _InputIterator __first, _InputIterator __last) {
+    const size_type __i   = static_cast<size_type>(__pos - __begin_);
+    const size_type __old = __size_;
+    for (; __first != __last; ++__first)
+      emplace_back(*__first);
+    __ops::__rotate(__begin_ + __i, __begin_ + __old, __begin_ + __size_);
+    return __begin_ + __i;
+  }
+
+  template <class... _Args> iterator emplace(const_iterator __pos, _Args &&...__args) {
+    const size_type __i = static_cast<size_type>(__pos - __begin_);
+    if (__size_ == __cap_)
+      return __emplace_realloc(__i, _VSTD::forward<_Args>(__args)...);
+    if (__i == __size_)
+      return &emplace_back(_VSTD::forward<_Args>(__args)...);
+    __emplace_shift(__i, __relocatable(), _VSTD::forward<_Args>(__args)...);
+    return __begin_ + __i;
+  }
+
+  iterator erase(const_iterator __pos) { return erase(__pos, __pos + 1); }
+
+  iterator erase(const_iterator __first, const_iterator __last) {
+    _Tp *__f = __begin_ + (__first - __begin_);
+    _Tp *__l = __begin_ + (__last - __begin_);
+    if (__f != __l) {
+      __erase(__f, __l, __relocatable());
+      __size_ -= static_cast<size_type>(__l - __f);
+    }
+    return __f;
+  }
+
+  void resize(size_type __n) {
+    if (__n <= __size_) {
+      __ops::__destroy(__begin_ + __n, __begin_ + __size_);
+      __size_ = __n;
+      return;
+    }
+    reserve(__n);
+    for (; __size_ != __n; ++__size_)
+      ::new (static_cast<void *>(__begin_ + __size_)) _Tp();
+  }
+
+  void resize(size_type __n, const value_type &__x) {
+    if (__n <= __size_) {
+      __ops::__destroy(__begin_ + __n, __begin_ + __size_);
+      __size_ = __n;
+      return;
+    }
+    insert(end(), __n - __size_, __x);
+  }
+
+  _LIBCPP_INLINE_VISIBILITY void clear() _NOEXCEPT {
+    __ops::__destroy(__begin_, __begin_ + __size_);
+    __size_ = 0;
+  }
+
+  void swap(small_vector &__x) {
+    small_vector __tmp(_VSTD::move(__x));
+    __x   = _VSTD::move(*this);
+    *this = _VSTD::move(__tmp);
+  }
+};
+
+template <class _Tp, size_t _Np> _LIBCPP_CONSTEXPR const size_t small_vector<_Tp, _Np>::inline_capacity;
+
+template <class _Tp, size_t _Np>
+inline _LIBCPP_INLINE_VISIBILITY bool operator==(const small_vector<_Tp, _Np> &__x, const small_vector<_Tp, _Np> &__y) {
+  return __x.size() == __y.size() && _VSTD::equal(__x.begin(), __x.end(), __y.begin());
+}
+
+template <class _Tp, size_t _Np>
+inline _LIBCPP_INLINE_VISIBILITY bool operator!=(const small_vector<_Tp, _Np> &__x, const small_vector<_Tp, _Np> &__y) {
+  return !(__x == __y);
+}
+
+template <class _Tp, size_t _Np>
+inline _LIBCPP_INLINE_VISIBILITY bool operator<(const small_vector<_Tp, _Np> &__x, const small_vector<_Tp, _Np> &__y) {
+  return _VSTD::lexicographical_compare(__x.begin(), __x.end(), __y.begin(), __y.end());
+}
+
+template <class _Tp, size_t _Np>
+inline _LIBCPP_INLINE_VISIBILITY void swap(small_vector<_Tp, _Np> &__x, small_vector<_Tp, _Np> &__y) {
+  __x.swap(__y);
+}
+
+_LIBCPP_END_NAMESPACE_STD
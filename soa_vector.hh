@@ -0,0 +1,558 @@
+// -*- C++ -*-
+//===------------------------- soa_vector ---------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+/*
+    soa_vector synopsis (C++17, extension)
+
+namespace std
+{
+
+// A sequence of aggregates stored as one array per member ("struct of
+// arrays"). T must be an aggregate without base classes whose members are
+// non-const, non-reference, non-array object types that are nothrow move
+// constructible.
+template <class T>
+class soa_vector
+{
+public:
+    typedef T                                   value_type;
+    typedef size_t                              size_type;
+    typedef ptrdiff_t                           difference_type;
+    typedef __soa_reference<soa_vector, false>  reference;
+    typedef __soa_reference<soa_vector, true>   const_reference;
+    typedef __soa_iterator<soa_vector, false>   iterator;
+    typedef __soa_iterator<soa_vector, true>    const_iterator;
+
+    template <size_t I> using column_type = M_I;   // type of the I-th member
+    static constexpr size_t column_count;
+    static constexpr size_t column_alignment = 64; // alignment of every column
+
+    soa_vector() noexcept;
+    explicit soa_vector(size_type n);              // n value-initialized elements
+    soa_vector(const soa_vector&);
+    soa_vector(soa_vector&&) noexcept;
+    soa_vector& operator=(const soa_vector&);
+    soa_vector& operator=(soa_vector&&) noexcept;
+    ~soa_vector();
+
+    iterator begin() noexcept;       const_iterator begin() const noexcept;
+    iterator end() noexcept;         const_iterator end() const noexcept;
+
+    size_type size() const noexcept;
+    size_type capacity() const noexcept;
+    static constexpr size_type max_size() noexcept;
+    bool empty() const noexcept;
+    void reserve(size_type n);                     // bad_alloc if n > max_size()
+    void shrink_to_fit();
+
+    reference operator[](size_type i) noexcept;
+    const_reference operator[](size_type i) const noexcept;
+
+    template <size_t I> __soa_column_span<column_type<I>> column() noexcept;
+    template <size_t I> __soa_column_span<const column_type<I>> column() const noexcept;
+
+    void push_back(const value_type& x);
+    void push_back(value_type&& x);
+    template <class... Args> reference emplace_back(Args&&... args);  // one argument per member
+    void pop_back() noexcept;
+    void resize(size_type n);
+    void clear() noexcept;
+    void swap(soa_vector&) noexcept;
+};
+
+template <class T> void swap(soa_vector<T>&, soa_vector<T>&) noexcept;
+
+template <size_t I, class V, bool C> auto& get(const __soa_reference<V, C>&) noexcept;
+
+}  // std
+
+*/
+
+#include "__aggregate.hh"
+#include "__config.hh"
+#include "cstddef.hh"
+#include "iterator.hh"
+#include "new.hh"
+#include "type_traits.hh"
+#include "utility.hh"
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#pragma GCC system_header
+#endif
+
+#if _LIBCPP_STD_VER > 14
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+template <class _Tp> class soa_vector;
+
+// __soa_column_span
+
+// A contiguous view of one column. The data pointer is aligned to
+// soa_vector<T>::column_alignment, which lets vectorized loops skip the
+// unaligned prologue.
+template <class _Tp> class _LIBCPP_TEMPLATE_VIS __soa_column_span {
+  _Tp *__data_;
+  size_t __size_;
+
+public:
+  typedef _Tp element_type;
+  typedef remove_cv_t<_Tp> value_type;
+  typedef size_t size_type;
+  typedef _Tp *iterator;
+
+  constexpr __soa_column_span() noexcept : __data_(nullptr), __size_(0) {}
+  constexpr __soa_column_span(_Tp *__data, size_t __size) noexcept : __data_(__data), __size_(__size) {}
+
+  constexpr _Tp *data() const noexcept { return __data_; }
+  constexpr size_t size() const noexcept { return __size_; }
+  constexpr bool empty() const noexcept { return __size_ == 0; }
+  constexpr _Tp *begin() const noexcept { return __data_; }
+  constexpr _Tp *end() const noexcept { return __data_ + __size_; }
+  constexpr _Tp &operator[](size_t __i) const noexcept { return __data_[__i]; }
+};
+
+// __soa_reference
+
+// Stands in for value_type& / const value_type&. It reads and writes the
+// element's members in place; converting it to value_type gathers a copy.
+template <class _Vec, bool _Const> class _LIBCPP_TEMPLATE_VIS __soa_reference {
+  typedef conditional_t<_Const, const _Vec, _Vec> _VecT;
+  typedef typename _Vec::value_type _Tp;
+
+  _VecT *__v_;
+  size_t __i_;
+
+  template <class, bool> friend class __soa_reference;
+  template <class, bool> friend class __soa_iterator;
+  friend class soa_vector<_Tp>;
+
+  constexpr __soa_reference(_VecT *__v, size_t __i) noexcept : __v_(__v), __i_(__i) {}
+
+  template <size_t... _Ip> _Tp __gather(__index_sequence<_Ip...>) const { return _Tp{get<_Ip>()...}; }
+
+public:
+  __soa_reference(const __soa_reference &) = default;
+
+  template <bool _OtherConst, class = _EnableIf<_Const && !_OtherConst>>
+  constexpr __soa_reference(const __soa_reference<_Vec, _OtherConst> &__r) noexcept : __v_(__r.__v_), __i_(__r.__i_) {}
+
+  template <size_t _Ip> constexpr auto &get() const noexcept {
+    return __v_->template __column_data<_Ip>()[__i_];
+  }
+
+  operator _Tp() const { return __gather(__make_index_sequence<_Vec::column_count>()); }
+
+  template <bool _C = _Const, class = _EnableIf<!_C>> const __soa_reference &operator=(const _Tp &__x) const {
+    __assign(__x, __make_index_sequence<_Vec::column_count>());
+    return *this;
+  }
+
+  template <bool _C = _Const, class = _EnableIf<!_C>> const __soa_reference &operator=(_Tp &&__x) const {
+    __assign(_VSTD::move(__x), __make_index_sequence<_Vec::column_count>());
+    return *this;
+  }
+
+  // Assigns the referenced element, not the reference.
+  const __soa_reference &operator=(const __soa_reference &__r) const {
+    static_assert(!_Const, "cannot assign through a const_reference");
+    return *this = static_cast<_Tp>(__r);
+  }
+
+private:
+  template <class _Up, size_t... _Ip> void __assign(_Up &&__x, __index_sequence<_Ip...>) const {
+    ((get<_Ip>() = static_cast<conditional_t<is_lvalue_reference_v<_Up>, const typename _Vec::template column_type<_Ip> &,
+                                                                      typename _Vec::template column_type<_Ip> &&>>(
+          _VSTD::__aggregate_get<_Ip>(__x))),
+     ...);
+  }
+};
+
+template <size_t _Ip, class _Vec, bool _Const>
+inline _LIBCPP_INLINE_VISIBILITY constexpr auto &get(const __soa_reference<_Vec, _Const> &__r) noexcept {
+  return __r.template get<_Ip>();
+}
+
+// __soa_iterator
+
+template <class _Vec, bool _Const> class _LIBCPP_TEMPLATE_VIS __soa_iterator {
+  typedef conditional_t<_Const, const _Vec, _Vec> _VecT;
+
+  _VecT *__v_;
+  size_t __i_;
+
+  template <class, bool> friend class __soa_iterator;
+  friend class soa_vector<typename _Vec::value_type>;
+
+  constexpr __soa_iterator(_VecT *__v, size_t __i) noexcept : __v_(__v), __i_(__i) {}
+
+public:
+  // A random access iterator whose reference is a proxy, as for vector<bool>:
+  // there is no element object to point to.
+  typedef random_access_iterator_tag iterator_category;
+  typedef typename _Vec::value_type value_type;
+  typedef ptrdiff_t difference_type;
+  typedef void pointer;
+  typedef __soa_reference<_Vec, _Const> reference;
+
+  constexpr __soa_iterator() noexcept : __v_(nullptr), __i_(0) {}
+
+  template <bool _OtherConst, class = _EnableIf<_Const && !_OtherConst>>
+  constexpr __soa_iterator(const __soa_iterator<_Vec, _OtherConst> &__it) noexcept : __v_(__it.__v_), __i_(__it.__i_) {}
+
+  constexpr reference operator*() const noexcept { return reference(__v_, __i_); }
+  constexpr reference operator[](difference_type __n) const noexcept { return reference(__v_, __i_ + __n); }
+
+  constexpr __soa_iterator &operator++() noexcept {
+    ++__i_;
+    return *this;
+  }
+  constexpr __soa_iterator operator++(int) noexcept {
+    __soa_iterator __t(*this);
+    ++__i_;
+    return __t;
+  }
+  constexpr __soa_iterator &operator--() noexcept {
+    --__i_;
+    return *this;
+  }
+  constexpr __soa_iterator operator--(int) noexcept {
+    __soa_iterator __t(*this);
+    --__i_;
+    return __t;
+  }
+  constexpr __soa_iterator &operator+=(difference_type __n) noexcept {
+    __i_ += __n;
+    return *this;
+  }
+  constexpr __soa_iterator &operator-=(difference_type __n) noexcept {
+    __i_ -= __n;
+    return *this;
+  }
+
+  friend constexpr __soa_iterator operator+(__soa_iterator __it, difference_type __n) noexcept { return __it += __n; }
+  friend constexpr __soa_iterator operator+(difference_type __n, __soa_iterator __it) noexcept { return __it += __n; }
+  friend constexpr __soa_iterator operator-(__soa_iterator __it, difference_type __n) noexcept { return __it -= __n; }
+  friend constexpr difference_type operator-(const __soa_iterator &__x, const __soa_iterator &__y) noexcept {
+    return static_cast<difference_type>(__x.__i_ - __y.__i_);
+  }
+  friend constexpr bool operator==(const __soa_iterator &__x, const __soa_iterator &__y) noexcept {
+    return __x.__i_ == __y.__i_;
+  }
+  friend constexpr bool operator!=(const __soa_iterator &__x, const __soa_iterator &__y) noexcept {
+    return __x.__i_ != __y.__i_;
+  }
+  friend constexpr bool operator<(const __soa_iterator &__x, const __soa_iterator &__y) noexcept {
+    return __x.__i_ < __y.__i_;
+  }
+  friend constexpr bool operator>(const __soa_iterator &__x, const __soa_iterator &__y) noexcept {
+    return __y.__i_ < __x.__i_;
+  }
+  friend constexpr bool operator<=(const __soa_iterator &__x, const __soa_iterator &__y) noexcept {
+    return !(__y.__i_ < __x.__i_);
+  }
+  friend constexpr bool operator>=(const __soa_iterator &__x, const __soa_iterator &__y) noexcept {
+    return !(__x.__i_ < __y.__i_);
+  }
+};
+
+// soa_vector
+
+template <class _Tp> class _LIBCPP_TEMPLATE_VIS soa_vector {
+  static_assert(is_aggregate_v<_Tp> && !is_array_v<_Tp> && !is_const_v<_Tp> && !is_volatile_v<_Tp>,
+                "soa_vector requires a cv-unqualified aggregate class type");
+
+  typedef __aggregate_member_types_t<_Tp> __members;
+
+public:
+  typedef _Tp value_type;
+  typedef size_t size_type;
+  typedef ptrdiff_t difference_type;
+  typedef __soa_reference<soa_vector, false> reference;
+  typedef __soa_reference<soa_vector, true> const_reference;
+  typedef __soa_iterator<soa_vector, false> iterator;
+  typedef __soa_iterator<soa_vector, true> const_iterator;
+
+  template <size_t _Ip> using column_type = __type_list_element_t<_Ip, __members>;
+
+  static constexpr size_t column_count     = __members::size;
+  static constexpr size_t column_alignment = 64;
+
+private:
+  template <class _Seq> struct __check_columns;
+  template <size_t... _Ip> struct __check_columns<__index_sequence<_Ip...>> {
+    static constexpr bool value = (true && ... &&
+                                   (is_object_v<column_type<_Ip>> && !is_array_v<column_type<_Ip>> &&
+                                    !is_const_v<column_type<_Ip>> &&
+                                    is_nothrow_move_constructible_v<column_type<_Ip>>));
+  };
+  static_assert(column_count != 0, "soa_vector requires an aggregate with at least one member");
+  static_assert(__check_columns<__make_index_sequence<column_count>>::value,
+                "soa_vector members must be non-const, non-array object types that are nothrow move constructible");
+
+  typedef __make_index_sequence<column_count> _Indices;
+
+  void *__columns_[column_count] = {};
+  size_t __size_                 = 0;
+  size_t __cap_                  = 0;
+
+  template <class, bool> friend class __soa_reference;
+
+  template <size_t _Ip> column_type<_Ip> *__column_data() noexcept {
+    return static_cast<column_type<_Ip> *>(__columns_[_Ip]);
+  }
+  template <size_t _Ip> const column_type<_Ip> *__column_data() const noexcept {
+    return static_cast<const column_type<_Ip> *>(__columns_[_Ip]);
+  }
+
+  template <size_t... _Ip> static constexpr size_t __element_bytes(__index_sequence<_Ip...>) noexcept {
+    return (size_t(0) + ... + sizeof(column_type<_Ip>));
+  }
+
+  static constexpr size_t __column_bytes(size_t __cap, size_t __elem_size) noexcept {
+    return (__cap * __elem_size + column_alignment - 1) / column_alignment * column_alignment;
+  }
+
+  // Past max_size() the sum would wrap; the request becomes the largest
+  // multiple of column_alignment instead (an aligned operator new rounds the
+  // size up, so SIZE_MAX itself would wrap to 0 there). No allocation can
+  // satisfy it, and operator new reports bad_alloc.
+  template <size_t... _Ip> static constexpr size_t __block_bytes(size_t __cap, __index_sequence<_Ip...>) noexcept {
+    if (__cap > max_size())
+      return static_cast<size_t>(-1) / column_alignment * column_alignment;
+    return (size_t(0) + ... + __column_bytes(__cap, sizeof(column_type<_Ip>)));
+  }
+
+  // All columns share one allocation; each starts on a column_alignment
+  // boundary.
+  template <size_t... _Ip> static void __carve(void **__cols, void *__block, size_t __cap, __index_sequence<_Ip...>) {
+    unsigned char *__p = static_cast<unsigned char *>(__block);
+    ((__cols[_Ip] = __p, __p += __column_bytes(__cap, sizeof(column_type<_Ip>))), ...);
+  }
+
+  void __deallocate() noexcept {
+    if (__cap_ != 0)
+      _VSTD::__libcpp_deallocate(__columns_[0], __block_bytes(__cap_, _Indices()), column_alignment);
+  }
+
+  template <size_t _Ip> static void __destroy_column(column_type<_Ip> *__p, size_t __first, size_t __last) noexcept {
+    if constexpr (!is_trivially_destructible_v<column_type<_Ip>>)
+      for (; __first != __last; ++__first)
+        __p[__first].~column_type<_Ip>();
+  }
+
+  template <size_t... _Ip> void __destroy_range(size_t __first, size_t __last, __index_sequence<_Ip...>) noexcept {
+    (__destroy_column<_Ip>(__column_data<_Ip>(), __first, __last), ...);
+  }
+
+  // Destroys the members [0, __count) of the element at __i.
+  template <size_t... _Ip> void __destroy_prefix(size_t __i, size_t __count, __index_sequence<_Ip...>) noexcept {
+    ((_Ip < __count ? __destroy_column<_Ip>(__column_data<_Ip>(), __i, __i + 1) : void()), ...);
+  }
+
+  // Constructs the element at __size_ member by member; if a member's
+  // constructor throws, the members already built are destroyed.
+  struct __element_guard {
+    soa_vector *__v_;
+    size_t __done_ = 0;
+    ~__element_guard() {
+      if (__v_)
+        __v_->__destroy_prefix(__v_->__size_, __done_, _Indices());
+    }
+  };
+
+  template <size_t _Ip, class _Arg> void __construct_member(__element_guard &__g, _Arg &&__arg) {
+    ::new (static_cast<void *>(__column_data<_Ip>() + __size_)) column_type<_Ip>(_VSTD::forward<_Arg>(__arg));
+    ++__g.__done_;
+  }
+
+  template <class... _Args, size_t... _Ip> void __construct_at_end(__index_sequence<_Ip...>, _Args &&...__args) {
+    __element_guard __g{this};
+    (__construct_member<_Ip>(__g, _VSTD::forward<_Args>(__args)), ...);
+    __g.__v_ = nullptr;
+    ++__size_;
+  }
+
+  template <class _Up, size_t... _Ip> void __construct_from_value(_Up &&__x, __index_sequence<_Ip...> __seq) {
+    if constexpr (is_lvalue_reference_v<_Up>)
+      __construct_at_end(__seq, _VSTD::__aggregate_get<_Ip>(__x)...);
+    else
+      __construct_at_end(__seq, _VSTD::move(_VSTD::__aggregate_get<_Ip>(__x))...);
+  }
+
+  template <size_t... _Ip> void __construct_default(__index_sequence<_Ip...>) {
+    __element_guard __g{this};
+    ((::new (static_cast<void *>(__column_data<_Ip>() + __size_)) column_type<_Ip>(), ++__g.__done_), ...);
+    __g.__v_ = nullptr;
+    ++__size_;
+  }
+
+  template <size_t _Ip> static void __relocate_column(column_type<_Ip> *__dst, column_type<_Ip> *__src, size_t __n) noexcept {
+    if constexpr (is_trivially_copyable_v<column_type<_Ip>>) {
+      if (__n != 0)
+        __builtin_memcpy(__dst, __src, __n * sizeof(column_type<_Ip>));
+    } else {
+      for (size_t __i = 0; __i != __n; ++__i) {
+        ::new (static_cast<void *>(__dst + __i)) column_type<_Ip>(_VSTD::move(__src[__i]));
+        __src[__i].~column_type<_Ip>();
+      }
+    }
+  }
+
+  template <size_t... _Ip> void __reallocate(size_t __cap, __index_sequence<_Ip...> __seq) {
+    void *__cols[column_count] = {};
+    if (__cap != 0)
+      __carve(__cols, _VSTD::__libcpp_allocate(__block_bytes(__cap, __seq), column_alignment), __cap, __seq);
+    (__relocate_column<_Ip>(static_cast<column_type<_Ip> *>(__cols[_Ip]), __column_data<_Ip>(), __size_), ...);
+    __deallocate();
+    for (size_t __i = 0; __i != column_count; ++__i)
+      __columns_[__i] = __cols[__i];
+    __cap_ = __cap;
+  }
+
+  size_t __recommend(size_t __n) const noexcept {
+    const size_t __ms = max_size();
+    size_t __c        = __cap_ < 8 ? 8 : __cap_ >= __ms / 2 ? __ms : __cap_ * 2;
+    return __c < __n ? __n : __c;
+  }
+
+  void __grow_for_one_more() {
+    if (__size_ == __cap_)
+      __reallocate(__recommend(__size_ + 1), _Indices());
+  }
+
+public:
+  soa_vector() noexcept = default;
+
+  explicit soa_vector(size_type __n) : soa_vector() { resize(__n); }
+
+  soa_vector(const soa_vector &__other) : soa_vector() {
+    reserve(__other.__size_);
+    for (size_t __i = 0; __i != __other.__size_; ++__i)
+      push_back(static_cast<value_type>(__other[__i]));
+  }
+
+  soa_vector(soa_vector &&__other) noexcept : soa_vector() { swap(__other); }
+
+  soa_vector &operator=(const soa_vector &__other) {
+    if (this != &__other) {
+      soa_vector __tmp(__other);
+      swap(__tmp);
+    }
+    return *this;
+  }
+
+  soa_vector &operator=(soa_vector &&__other) noexcept {
+    soa_vector __tmp(_VSTD::move(__other));
+    swap(__tmp);
+    return *this;
+  }
+
+  ~soa_vector() {
+    clear();
+    __deallocate();
+  }
+
+  iterator begin() noexcept { return iterator(this, 0); }
+  const_iterator begin() const noexcept { return const_iterator(this, 0); }
+  iterator end() noexcept { return iterator(this, __size_); }
+  const_iterator end() const noexcept { return const_iterator(this, __size_); }
+
+  size_type size() const noexcept { return __size_; }
+  size_type capacity() const noexcept { return __cap_; }
+
+  // Each column may round up by less than column_alignment bytes; with those
+  // set aside the whole block still fits in a size_t.
+  static constexpr size_type max_size() noexcept {
+    return (static_cast<size_t>(-1) - column_count * column_alignment) / __element_bytes(_Indices());
+  }
+  bool empty() const noexcept { return __size_ == 0; }
+
+  void reserve(size_type __n) {
+    if (__n > __cap_)
+      __reallocate(__n, _Indices());
+  }
+
+  void shrink_to_fit() {
+    if (__size_ != __cap_)
+      __reallocate(__size_, _Indices());
+  }
+
+  reference operator[](size_type __i) noexcept { return reference(this, __i); }
+  const_reference operator[](size_type __i) const noexcept { return const_reference(this, __i); }
+
+  template <size_t _Ip> __soa_column_span<column_type<_Ip>> column() noexcept {
+    return __soa_column_span<column_type<_Ip>>(__column_data<_Ip>(), __size_);
+  }
+  template <size_t _Ip> __soa_column_span<const column_type<_Ip>> column() const noexcept {
+    return __soa_column_span<const column_type<_Ip>>(__column_data<_Ip>(), __size_);
+  }
+
+  void push_back(const value_type &__x) {
+    __grow_for_one_more();
+    __construct_from_value(__x, _Indices());
+  }
+
+  void push_back(value_type &&__x) {
+    __grow_for_one_more();
+    __construct_from_value(_VSTD::move(__x), _Indices());
+  }
+
+  template <class... _Args> reference emplace_back(_Args &&...__args) {
+    static_assert(sizeof...(_Args) == column_count, "soa_vector::emplace_back takes one argument per member");
+    __grow_for_one_more();
+    __construct_at_end(_Indices(), _VSTD::forward<_Args>(__args)...);
+    return reference(this, __size_ - 1);
+  }
+
+  void pop_back() noexcept {
+    __destroy_range(__size_ - 1, __size_, _Indices());
+    --__size_;
+  }
+
+  void resize(size_type __n) {
+    if (__n < __size_) {
+      __destroy_range(__n, __size_, _Indices());
+      __size_ = __n;
+      return;
+    }
+    reserve(__n);
+    while (__size_ != __n)
+      __construct_default(_Indices());
+  }
+
+  void clear() noexcept {
+    __destroy_range(0, __size_, _Indices());
+    __size_ = 0;
+  }
+
+  void swap(soa_vector &__other) noexcept {
+    for (size_t __i = 0; __i != column_count; ++__i) {
+      void *__t               = __columns_[__i];
+      __columns_[__i]         = __other.__columns_[__i];
+      __other.__columns_[__i] = __t;
+    }
+    size_t __s      = __size_;
+    __size_         = __other.__size_;
+    __other.__size_ = __s;
+    size_t __c      = __cap_;
+    __cap_          = __other.__cap_;
+    __other.__cap_  = __c;
+  }
+};
+
+template <class _Tp> inline _LIBCPP_INLINE_VISIBILITY void swap(soa_vector<_Tp> &__x, soa_vector<_Tp> &__y) noexcept {
+  __x.swap(__y);
+}
+
+_LIBCPP_END_NAMESPACE_STD
+
+#endif // _LIBCPP_STD_VER > 14
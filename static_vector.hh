@@ -0,0 +1,532 @@
+// -*- C++ -*-
+//===------------------------ static_vector -------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+/*
+    static_vector synopsis (extension)
+
+namespace std
+{
+
+// A vector with a fixed capacity of N elements held in the object itself.
+// It never allocates; growing past N is a precondition violation, which the
+// try_ operations turn into a null return instead. It is trivially copyable
+// and trivially destructible when T is, and constexpr in C++20.
+template <class T, size_t N>
+class static_vector
+{
+public:
+    typedef T                 value_type;
+    typedef size_t            size_type;
+    typedef ptrdiff_t         difference_type;
+    typedef T&                reference;
+    typedef const T&          const_reference;
+    typedef T*                pointer;
+    typedef const T*          const_pointer;
+    typedef T*                iterator;
+    typedef const T*          const_iterator;
+
+    constexpr static_vector() noexcept;
+    constexpr explicit static_vector(size_type n);                    // n <= N
+    constexpr static_vector(size_type n, const value_type& value);    // n <= N
+    template <class InputIterator>
+        constexpr static_vector(InputIterator first, InputIterator last);
+    constexpr static_vector(const static_vector& x);                  // trivial if T is
+    constexpr static_vector(static_vector&& x) noexcept(is_nothrow_move_constructible<T>::value);
+    constexpr ~static_vector();                                       // trivial if T is
+    constexpr static_vector& operator=(const static_vector& x);
+    constexpr static_vector& operator=(static_vector&& x) noexcept(...);
+
+    constexpr void assign(size_type n, const value_type& value);
+    template <class InputIterator>
+        constexpr void assign(InputIterator first, InputIterator last);
+
+    constexpr iterator begin() noexcept;    constexpr const_iterator begin() const noexcept;
+    constexpr iterator end() noexcept;      constexpr const_iterator end() const noexcept;
+    constexpr pointer data() noexcept;      constexpr const_pointer data() const noexcept;
+
+    constexpr size_type size() const noexcept;
+    static constexpr size_type capacity() noexcept;                   // N
+    static constexpr size_type max_size() noexcept;                   // N
+    constexpr bool empty() const noexcept;
+    constexpr bool full() const noexcept;
+
+    constexpr reference operator[](size_type i) noexcept;
+    constexpr const_reference operator[](size_type i) const noexcept;
+    constexpr reference front() noexcept;   constexpr const_reference front() const noexcept;
+    constexpr reference back() noexcept;    constexpr const_reference back() const noexcept;
+
+    constexpr void push_back(const value_type& x);                    // !full()
+    constexpr void push_back(value_type&& x);                         // !full()
+    template <class... Args> constexpr reference emplace_back(Args&&... args);
+    constexpr pointer try_push_back(const value_type& x);             // nullptr if full()
+    constexpr pointer try_push_back(value_type&& x);
+    template <class... Args> constexpr pointer try_emplace_back(Args&&... args);
+    constexpr void pop_back() noexcept;
+
+    constexpr iterator insert(const_iterator position, const value_type& x);
+    constexpr iterator insert(const_iterator position, value_type&& x);
+    constexpr iterator insert(const_iterator position, size_type n, const value_type& x);
+    template <class InputIterator>
+        constexpr iterator insert(const_iterator position, InputIterator first, InputIterator last);
+    template <class... Args> constexpr iterator emplace(const_iterator position, Args&&... args);
+
+    constexpr iterator erase(const_iterator position);
+    constexpr iterator erase(const_iterator first, const_iterator last);
+
+    constexpr void resize(size_type n);
+    constexpr void resize(size_type n, const value_type& value);
+    constexpr void clear() noexcept;
+    constexpr void swap(static_vector& x);
+};
+
+template <class T, size_t N> constexpr bool operator==(const static_vector<T, N>& x, const static_vector<T, N>& y);
+template <class T, size_t N> constexpr bool operator!=(const static_vector<T, N>& x, const static_vector<T, N>& y);
+template <class T, size_t N> constexpr bool operator< (const static_vector<T, N>& x, const static_vector<T, N>& y);
+template <class T, size_t N> constexpr void swap(static_vector<T, N>& x, static_vector<T, N>& y);
+
+}  // std
+
+*/
+
+#include "__config.hh"
+#include "algorithm.hh"
+#include "cstddef.hh"
+#include "memory.hh"
+#include "type_traits.hh"
+#include "utility.hh"
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#pragma GCC system_header
+#endif
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+// __static_vector_storage
+
+// Uninitialized room for _Np objects of type _Tp. Constant evaluation cannot
+// reinterpret raw bytes as objects, so in C++20 the storage is a union over
+// the element array, whose members are constructed one at a time with
+// construct_at; before that it is plain aligned_storage. Both have the size
+// and alignment of _Tp[_Np], and both are trivially copyable; the union only
+// grows a (constexpr, empty) destructor when _Tp needs one.
+#if _LIBCPP_STD_VER > 17
+template <class _Tp, size_t _Np, bool = is_trivially_destructible<_Tp>::value> union __static_vector_storage {
+  _Tp __elems_[_Np == 0 ? 1 : _Np];
+
+  _LIBCPP_INLINE_VISIBILITY constexpr __static_vector_storage() noexcept {}
+
+  _LIBCPP_INLINE_VISIBILITY constexpr _Tp *__data() noexcept { return __elems_; }
+  _LIBCPP_INLINE_VISIBILITY constexpr const _Tp *__data() const noexcept { return __elems_; }
+};
+
+template <class _Tp, size_t _Np> union __static_vector_storage<_Tp, _Np, false> {
+  _Tp __elems_[_Np == 0 ? 1 : _Np];
+
+  _LIBCPP_INLINE_VISIBILITY constexpr __static_vector_storage() noexcept {}
+  __static_vector_storage(const __static_vector_storage &) = default;
+  __static_vector_storage &operator=(const __static_vector_storage &) = default;
+  _LIBCPP_INLINE_VISIBILITY constexpr ~__static_vector_storage() {}
+
+  _LIBCPP_INLINE_VISIBILITY constexpr _Tp *__data() noexcept { return __elems_; }
+  _LIBCPP_INLINE_VISIBILITY constexpr const _Tp *__data() const noexcept { return __elems_; }
+};
+#else
+template <class _Tp, size_t _Np> struct __static_vector_storage {
+  typename aligned_storage<sizeof(_Tp) * (_Np == 0 ? 1 : _Np), alignof(_Tp)>::type __buf_;
+
+  _LIBCPP_INLINE_VISIBILITY _Tp *__data() _NOEXCEPT { return reinterpret_cast<_Tp *>(&__buf_); }
+  _LIBCPP_INLINE_VISIBILITY const _Tp *__data() const _NOEXCEPT { return reinterpret_cast<const _Tp *>(&__buf_); }
+};
+#endif
+
+// __static_vector_destruct_base
+
+// Holds the storage and the element count, stored in the narrowest unsigned
+// type that can count to _Np. The destructor is left trivial when _Tp's is.
+template <class _Tp, size_t _Np, bool = is_trivially_destructible<_Tp>::value>
+struct __static_vector_destruct_base {
+  typedef __uint_least_for<_Np> __size_type;
+
+  __static_vector_storage<_Tp, _Np> __s_;
+  __size_type __size_;
+
+  _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 __static_vector_destruct_base() _NOEXCEPT : __size_(0) {}
+
+  static _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 void __destroy(_Tp *, _Tp *) _NOEXCEPT {}
+};
+
+template <class _Tp, size_t _Np> struct __static_vector_destruct_base<_Tp, _Np, false> {
+  typedef __uint_least_for<_Np> __size_type;
+
+  __static_vector_storage<_Tp, _Np> __s_;
+  __size_type __size_;
+
+  _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 __static_vector_destruct_base() _NOEXCEPT : __size_(0) {}
+  __static_vector_destruct_base(const __static_vector_destruct_base &) = default;
+  __static_vector_destruct_base &operator=(const __static_vector_destruct_base &) = default;
+  _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 ~__static_vector_destruct_base() {
+    __destroy(__s_.__data(), __s_.__data() + __size_);
+  }
+
+  static _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 void __destroy(_Tp *__first, _Tp *__last) _NOEXCEPT {
+    for (; __first != __last; ++__first)
+      _VSTD::__destroy_at(__first);
+  }
+};
+
+// __static_vector_copy_base
+
+// Element-wise copy and move for types that are not trivially copyable; for
+// the rest the defaulted members copy the storage wholesale, which keeps
+// static_vector<_Tp, _Np> trivially copyable.
+template <class _Tp, size_t _Np, bool = is_trivially_copyable<_Tp>::value>
+struct __static_vector_copy_base : __static_vector_destruct_base<_Tp, _Np> {};
+
+template <class _Tp, size_t _Np>
+struct __static_vector_copy_base<_Tp, _Np, false> : __static_vector_destruct_base<_Tp, _Np> {
+  typedef __static_vector_destruct_base<_Tp, _Np> __base;
+  using __base::__destroy;
+  using __base::__s_;
+  using __base::__size_;
+
+  __static_vector_copy_base() = default;
+
+  _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17
+  __static_vector_copy_base(const __static_vector_copy_base &__x) : __base() {
+    __append(__x.__s_.__data(), __x.__size_);
+  }
+
+  _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 __static_vector_copy_base(__static_vector_copy_base &&__x)
+      _NOEXCEPT_(is_nothrow_move_constructible<_Tp>::value)
+      : __base() {
+    __append_move(__x.__s_.__data(), __x.__size_);
+  }
+
+  _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 __static_vector_copy_base &
+  operator=(const __static_vector_copy_base &__x) {
+    if (this != &__x)
+      __assign(__x.__s_.__data(), __x.__size_);
+    return *this;
+  }
+
+  _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 __static_vector_copy_base &
+  operator=(__static_vector_copy_base &&__x)
+      _NOEXCEPT_(is_nothrow_move_constructible<_Tp>::value &&is_nothrow_move_assignable<_Tp>::value) {
+    if (this != &__x)
+      __assign_move(__x.__s_.__data(), __x.__size_);
+    return *this;
+  }
+
+private:
+  _LIBCPP_CONSTEXPR_AFTER_CXX17 void __append(const _Tp *__src, size_t __n) {
+    for (_Tp *__d = __s_.__data() + __size_; __n != 0; --__n, ++__src, (void)++__d, ++__size_)
+      _VSTD::__construct_at(__d, *__src);
+  }
+
+  _LIBCPP_CONSTEXPR_AFTER_CXX17 void __append_move(_Tp *__src, size_t __n) {
+    for (_Tp *__d = __s_.__data() + __size_; __n != 0; --__n, ++__src, (void)++__d, ++__size_)
+      _VSTD::__construct_at(__d, _VSTD::move(*__src));
+  }
+
+  // Assigns over the common prefix, then constructs or destroys the rest.
+  _LIBCPP_CONSTEXPR_AFTER_CXX17 void __assign(const _Tp *__src, size_t __n) {
+    _Tp *__d          = __s_.__data();
+    const size_t __common = __n < __size_ ? __n : __size_;
+    for (size_t __i = 0; __i != __common; ++__i)
+      __d[__i] = __src[__i];
+    if (__n < __size_) {
+      __destroy(__d + __n, __d + __size_);
+      __size_ = static_cast<typename __base::__size_type>(__n);
+    } else
+      __append(__src + __common, __n - __common);
+  }
+
+  _LIBCPP_CONSTEXPR_AFTER_CXX17 void __assign_move(_Tp *__src, size_t __n) {
+    _Tp *__d          = __s_.__data();
+    const size_t __common = __n < __size_ ? __n : __size_;
+    for (size_t __i = 0; __i != __common; ++__i)
+      __d[__i] = _VSTD::move(__src[__i]);
+    if (__n < __size_) {
+      __destroy(__d + __n, __d + __size_);
+      __size_ = static_cast<typename __base::__size_type>(__n);
+    } else
+      __append_move(__src + __common, __n - __common);
+  }
+};
+
+// static_vector
+
+template <class _Tp, size_t _Np> class _LIBCPP_TEMPLATE_VIS static_vector : private __static_vector_copy_base<_Tp, _Np> {
+  static_assert(is_object<_Tp>::value && !is_array<_Tp>::value && !is_const<_Tp>::value && !is_volatile<_Tp>::value,
+                "static_vector requires a cv-unqualified, non-array object type");
+
+  typedef __static_vector_copy_base<_Tp, _Np> __base;
+  typedef typename __base::__size_type __size_type;
+  using __base::__destroy;
+  using __base::__s_;
+  using __base::__size_;
+
+public:
+  typedef _Tp value_type;
+  typedef size_t size_type;
+  typedef ptrdiff_t difference_type;
+  typedef _Tp &reference;
+  typedef const _Tp &const_reference;
+  typedef _Tp *pointer;
+  typedef const _Tp *const_pointer;
+  typedef _Tp *iterator;
+  typedef const _Tp *const_iterator;
+
+private:
+  _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 _Tp *__end() _NOEXCEPT { return __s_.__data() + __size_; }
+
+  template <class... _Args> _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 _Tp *__construct_back(_Args &&...__args) {
+    _Tp *__p = _VSTD::__construct_at(__end(), _VSTD::forward<_Args>(__args)...);
+    ++__size_;
+    return __p;
+  }
+
+  _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 void __truncate(size_type __n) _NOEXCEPT {
+    __destroy(__s_.__data() + __n, __end());
+    __size_ = static_cast<__size_type>(__n);
+  }
+
+  // [__first, __middle) + [__middle, __last) -> [__middle, __last) + [__first, __middle)
+  static _LIBCPP_CONSTEXPR_AFTER_CXX17 void __reverse(_Tp *__first, _Tp *__last) {
+    using _VSTD::swap;
+    for (; __first != __last && __first != --__last; ++__first)
+      swap(*__first, *__last);
+  }
+  static _LIBCPP_CONSTEXPR_AFTER_CXX17 void __rotate(_Tp *__first, _Tp *__middle, _Tp *__last) {
+    __reverse(__first, __middle);
+    __reverse(__middle, __last);
+    __reverse(__first, __last);
+  }
+
+public:
+  static_vector() = default;
+
+  _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 explicit static_vector(size_type __n) : __base() {
+    resize(__n);
+  }
+
+  _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 static_vector(size_type __n, const value_type &__x)
+      : __base() {
+    resize(__n, __x);
+  }
+
+  template <class _InputIterator, class = _EnableIf<!is_integral<_InputIterator>::value>>
+  _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 static_vector(_InputIterator __first, _InputIterator __last)
+      : __base() {
+    for (; __first != __last; ++__first)
+      emplace_back(*__first);
+  }
+
+  _LIBCPP_CONSTEXPR_AFTER_CXX17 void assign(size_type __n, const value_type &__x) {
+    _Tp *__p          = __s_.__data();
+    const size_type __common = __n < __size_ ? __n : __size_;
+    for (size_type __i = 0; __i != __common; ++__i)
+      __p[__i] = __x;
+    if (__n < __size_)
+      __truncate(__n);
+    else
+      while (__size_ != __n)
+        __construct_back(__x);
+  }
+
+  template <class _InputIterator, class = _EnableIf<!is_integral<_InputIterator>::value>>
+  _LIBCPP_CONSTEXPR_AFTER_CXX17 void assign(_InputIterator __first, _InputIterator __last) {
+    _Tp *__p = __s_.__data();
+    size_type __i = 0;
+    for (; __i != __size_ && __first != __last; ++__i, (void)++__first)
+      __p[__i] = *__first;
+    if (__i != __size_)
+      __truncate(__i);
+    else
+      for (; __first != __last; ++__first)
+        emplace_back(*__first);
+  }
+
+  _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 iterator begin() _NOEXCEPT { return __s_.__data(); }
+  _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 const_iterator begin() const _NOEXCEPT {
+    return __s_.__data();
+  }
+  _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 iterator end() _NOEXCEPT { return __end(); }
+  _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 const_iterator end() const _NOEXCEPT {
+    return __s_.__data() + __size_;
+  }
+  _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 pointer data() _NOEXCEPT { return __s_.__data(); }
+  _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 const_pointer data() const _NOEXCEPT {
+    return __s_.__data();
+  }
+
+  _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR size_type size() const _NOEXCEPT { return __size_; }
+  static _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR size_type capacity() _NOEXCEPT { return _Np; }
+  static _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR size_type max_size() _NOEXCEPT { return _Np; }
+  _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR bool empty() const _NOEXCEPT { return __size_ == 0; }
+  _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR bool full() const _NOEXCEPT { return __size_ == _Np; }
+
+  _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 reference operator[](size_type __i) _NOEXCEPT {
+    return __s_.__data()[__i];
+  }
+  _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 const_reference operator[](size_type __i) const _NOEXCEPT {
+    return __s_.__data()[__i];
+  }
+  _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 reference front() _NOEXCEPT { return __s_.__data()[0]; }
+  _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 const_reference front() const _NOEXCEPT {
+    return __s_.__data()[0];
+  }
+  _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 reference back() _NOEXCEPT {
+    return __s_.__data()[__size_ - 1];
+  }
+  _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 const_reference back() const _NOEXCEPT {
+    return __s_.__data()[__size_ - 1];
+  }
+
+  _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 void push_back(const value_type &__x) { __construct_back(__x); }
+  _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 void push_back(value_type &&__x) {
+    __construct_back(_VSTD::move(__x));
+  }
+
+  template <class... _Args>
+  _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 reference emplace_back(_Args &&...__args) {
+    return *__construct_back(_VSTD::forward<_Args>(__args)...);
+  }
+
+  _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 pointer try_push_back(const value_type &__x) {
+    return try_emplace_back(__x);
+  }
+  _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 pointer try_push_back(value_type &&__x) {
+    return try_emplace_back(_VSTD::move(__x));
+  }
+
+  template <class... _Args>
+  _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 pointer try_emplace_back(_Args &&...__args) {
+    if (_LIBCPP_UNLIKELY(full()))
+      return nullptr;
+    return __construct_back(_VSTD::forward<_Args>(__args)...);
+  }
+
+  _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 void pop_back() _NOEXCEPT { __truncate(__size_ - 1); }
+
+  _LIBCPP_CONSTEXPR_AFTER_CXX17 iterator insert(const_iterator __pos, const value_type &__x) {
+    return emplace(__pos, __x);
+  }
+  _LIBCPP_CONSTEXPR_AFTER_CXX17 iterator insert(const_iterator __pos, value_type &&__x) {
+    return emplace(__pos, _VSTD::move(__x));
+  }
+
+  _LIBCPP_CONSTEXPR_AFTER_CXX17 iterator insert(const_iterator __pos, size_type __n, const value_type &__x) {
+    const size_type __i   = static_cast<size_type>(__pos - begin());
+    const size_type __old = __size_;
+    for (; __n != 0; --__n)
+      __construct_back(__x);
+    __rotate(begin() + __i, begin() + __old, __end());
+    return begin() + __i;
+  }
+
+  template <class _InputIterator, class = _EnableIf<!is_integral<_InputIterator>::value>>
+  _LIBCPP_CONSTEXPR_AFTER_CXX17 iterator insert(const_iterator __pos, _InputIterator __first, _InputIterator __last) {
+    const size_type __i   = static_cast<size_type>(__pos - begin());
+    const size_type __old = __size_;
+    for (; __first != __last; ++__first)
+      emplace_back(*__first);
+    __rotate(begin() + __i, begin() + __old, __end());
+    return begin() + __i;
+  }
+
+  template <class... _Args> _LIBCPP_CONSTEXPR_AFTER_CXX17 iterator emplace(const_iterator __pos, _Args &&...__args) {
+    _Tp *__p = begin() + (__pos - begin());
+    if (__p == __end()) {
+      __construct_back(_VSTD::forward<_Args>(__args)...);
+      return __p;
+    }
+    // The arguments may refer into the vector, so build the new element
+    // before shifting anything.
+    _Tp __tmp(_VSTD::forward<_Args>(__args)...);
+    _Tp *__last = __end();
+    __construct_back(_VSTD::move(__last[-1]));
+    for (_Tp *__d = __last - 1; __d != __p; --__d)
+      *__d = _VSTD::move(__d[-1]);
+    *__p = _VSTD::move(__tmp);
+    return __p;
+  }
+
+  _LIBCPP_CONSTEXPR_AFTER_CXX17 iterator erase(const_iterator __pos) { return erase(__pos, __pos + 1); }
+
+  _LIBCPP_CONSTEXPR_AFTER_CXX17 iterator erase(const_iterator __first, const_iterator __last) {
+    _Tp *__p = begin() + (__first - begin());
+    if (__first != __last) {
+      _Tp *__d = __p;
+      for (_Tp *__s = begin() + (__last - begin()); __s != __end(); ++__s, (void)++__d)
+        *__d = _VSTD::move(*__s);
+      __truncate(static_cast<size_type>(__d - begin()));
+    }
+    return __p;
+  }
+
+  _LIBCPP_CONSTEXPR_AFTER_CXX17 void resize(size_type __n) {
+    if (__n < __size_)
+      __truncate(__n);
+    else
+      while (__size_ != __n)
+        __construct_back();
+  }
+
+  _LIBCPP_CONSTEXPR_AFTER_CXX17 void resize(size_type __n, const value_type &__x) {
+    if (__n < __size_)
+      __truncate(__n);
+    else
+      while (__size_ != __n)
+        __construct_back(__x);
+  }
+
+  _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 void clear() _NOEXCEPT { __truncate(0); }
+
+  _LIBCPP_CONSTEXPR_AFTER_CXX17 void swap(static_vector &__x)
+      _NOEXCEPT_(__is_nothrow_swappable<_Tp>::value &&is_nothrow_move_constructible<_Tp>::value) {
+    static_vector &__short = __size_ < __x.__size_ ? *this : __x;
+    static_vector &__long  = __size_ < __x.__size_ ? __x : *this;
+    using _VSTD::swap;
+    const size_type __n = __short.__size_;
+    for (size_type __i = 0; __i != __n; ++__i)
+      swap(__short[__i], __long[__i]);
+    for (size_type __i = __n; __i != __long.__size_; ++__i)
+      __short.__construct_back(_VSTD::move(__long[__i]));
+    __long.__truncate(__n);
+  }
+};
+
+template <class _Tp, size_t _Np>
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 bool operator==(const static_vector<_Tp, _Np> &__x,
+                                                                             const static_vector<_Tp, _Np> &__y) {
+  return __x.size() == __y.size() && _VSTD::equal(__x.begin(), __x.end(), __y.begin());
+}
+
+template <class _Tp, size_t _Np>
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 bool operator!=(const static_vector<_Tp, _Np> &__x,
+                                                                             const static_vector<_Tp, _Np> &__y) {
+  return !(__x == __y);
+}
+
+template <class _Tp, size_t _Np>
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 bool operator<(const static_vector<_Tp, _Np> &__x,
+                                                                            const static_vector<_Tp, _Np> &__y) {
+  return _VSTD::lexicographical_compare(__x.begin(), __x.end(), __y.begin(), __y.end());
+}
+
+template <class _Tp, size_t _Np>
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 void swap(static_vector<_Tp, _Np> &__x,
+                                                                        static_vector<_Tp, _Np> &__y) {
+  __x.swap(__y);
+}
+
+_LIBCPP_END_NAMESPACE_STD
@@ -0,0 +1,157 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <__aggregate>
+
+// template <class T> inline constexpr size_t __aggregate_field_count_v;
+// template <class T> using __aggregate_member_types_t = __type_list<M0, M1, ...>;
+// template <class T, class F> constexpr decltype(auto) __aggregate_apply(T& t, F&& f);
+// template <size_t I, class T> constexpr auto& __aggregate_get(T& t);
+
+// UNSUPPORTED: c++11, c++14
+
+#include "__aggregate.hh"
+
+#include <cassert>
+
+struct E {};
+struct A {
+  char __c;
+  double __d;
+  int __i;
+};
+struct In {
+  int __x, __y;
+};
+// Nested aggregates and arrays are one member each.
+struct N {
+  In __a;
+  char __b;
+  In __c;
+  int __arr[3];
+};
+struct R {
+  int &__r;
+  char __c;
+};
+struct Big {
+  int __a0, __a1, __a2, __a3, __a4, __a5, __a6, __a7, __a8, __a9, __a10, __a11;
+  int __a12, __a13, __a14, __a15, __a16, __a17, __a18, __a19, __a20, __a21, __a22, __a23;
+};
+// A braced {any} is ambiguous for a member with several constructors.
+struct Obj {
+  int __v;
+  Obj();
+  Obj(int);
+  Obj(const Obj &);
+  Obj(Obj &&) noexcept;
+};
+struct Mixed {
+  Obj __o;
+  long __n;
+};
+struct Mixed2 {
+  int __arr[2];
+  Obj __o;
+  In __i;
+  long __n;
+};
+// After a member that needs its own kind of probe, arrays and aggregates are
+// still one member each.
+struct P {
+  Obj __o;
+  int __arr[2];
+};
+struct P2 {
+  Obj __o;
+  In __i;
+  Obj __p[3];
+  char __c;
+};
+// Move-only and immovable members; members that cannot be left out after them.
+struct MO {
+  MO();
+  MO(MO &&);
+  MO(const MO &) = delete;
+  int __v;
+};
+struct NM {
+  NM();
+  NM(const NM &) = delete;
+  int __v;
+};
+struct M {
+  MO __p;
+  int __x;
+};
+struct M2 {
+  int __a;
+  MO __p[2];
+  NM __n;
+  Obj __o;
+  int &__r;
+  In __i;
+};
+struct NoDefault {
+  NoDefault(int);
+  NoDefault(const char *);
+  NoDefault(const NoDefault &);
+};
+struct M3 {
+  M __m;
+  NoDefault __d;
+  char __c;
+};
+
+using std::__aggregate_field_count_v;
+using std::__aggregate_member_types_t;
+using std::__type_list;
+using std::is_same_v;
+
+static_assert(__aggregate_field_count_v<E> == 0);
+static_assert(__aggregate_field_count_v<A> == 3);
+static_assert(__aggregate_field_count_v<N> == 4);
+static_assert(__aggregate_field_count_v<R> == 2);
+static_assert(__aggregate_field_count_v<Big> == 24);
+static_assert(__aggregate_field_count_v<Mixed> == 2);
+static_assert(__aggregate_field_count_v<Mixed2> == 4);
+static_assert(__aggregate_field_count_v<P> == 2);
+static_assert(__aggregate_field_count_v<P2> == 4);
+static_assert(__aggregate_field_count_v<M> == 2);
+static_assert(__aggregate_field_count_v<M2> == 6);
+static_assert(__aggregate_field_count_v<M3> == 3);
+
+static_assert(is_same_v<__aggregate_member_types_t<A>, __type_list<char, double, int>>);
+static_assert(is_same_v<__aggregate_member_types_t<N>, __type_list<In, char, In, int[3]>>);
+static_assert(is_same_v<__aggregate_member_types_t<R>, __type_list<int &, char>>);
+static_assert(is_same_v<__aggregate_member_types_t<Mixed2>, __type_list<int[2], Obj, In, long>>);
+static_assert(is_same_v<__aggregate_member_types_t<P>, __type_list<Obj, int[2]>>);
+static_assert(is_same_v<__aggregate_member_types_t<M2>, __type_list<int, MO[2], NM, Obj, int &, In>>);
+
+constexpr int sum() {
+  A __a{1, 2.0, 3};
+  return std::__aggregate_get<0>(__a) + static_cast<int>(std::__aggregate_get<1>(__a)) + std::__aggregate_get<2>(__a);
+}
+static_assert(sum() == 6);
+
+int main() {
+  A __a{1, 2.5, 3};
+  std::__aggregate_get<1>(__a) = 7.5;
+  assert(__a.__d == 7.5);
+  const A &__ca = __a;
+  static_assert(is_same_v<decltype(std::__aggregate_get<2>(__ca)), const int &>);
+
+  int __s = 0;
+  std::__aggregate_apply(__a, [&](auto &...__m) { ((__s += static_cast<int>(__m)), ...); });
+  assert(__s == 11);
+
+  Big __b{};
+  __b.__a23 = 5;
+  assert(std::__aggregate_get<23>(__b) == 5);
+  return 0;
+}
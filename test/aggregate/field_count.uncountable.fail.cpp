@@ -0,0 +1,35 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <__aggregate>
+
+// A member of a class constructible from another class type besides its own
+// makes both braced probes ambiguous; the count is refused rather than cut
+// short there.
+
+// UNSUPPORTED: c++11, c++14
+
+#include "__aggregate.hh"
+
+struct In {
+  int __x;
+};
+struct FromIn {
+  FromIn();
+  FromIn(const In &);
+  FromIn(const FromIn &);
+  FromIn(FromIn &&);
+};
+struct S {
+  int __a;
+  FromIn __f;
+  int __b;
+};
+
+// EXPECTED-ERROR: __aggregate_field_count cannot count a member
+constexpr std::size_t __n = std::__aggregate_field_count_v<S>;
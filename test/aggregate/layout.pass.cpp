@@ -0,0 +1,65 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <__aggregate>
+
+// template <class T> struct __aggregate_layout;
+// template <class... T> struct __layout_report;
+
+// UNSUPPORTED: c++11, c++14
+
+#include "__aggregate.hh"
+
+struct E {};
+struct A {
+  char __c;
+  double __d;
+  int __i;
+};
+struct Tight {
+  double __d;
+  int __i;
+  char __c;
+};
+struct In {
+  int __x, __y;
+};
+struct N {
+  In __a;
+  char __b;
+  In __c;
+  int __arr[3];
+};
+struct R {
+  int &__r;
+  char __c;
+};
+
+using std::__aggregate_layout;
+
+static_assert(__aggregate_layout<A>::__field_count == 3);
+static_assert(__aggregate_layout<A>::__size == 24 && __aggregate_layout<A>::__alignment == 8);
+static_assert(__aggregate_layout<A>::__member_bytes == 13 && __aggregate_layout<A>::__padding == 11);
+static_assert(__aggregate_layout<A>::__suggested_order[0] == 1);
+static_assert(__aggregate_layout<A>::__suggested_order[1] == 2);
+static_assert(__aggregate_layout<A>::__suggested_order[2] == 0);
+static_assert(__aggregate_layout<A>::__reordered_size == 16 && __aggregate_layout<A>::__reordered_padding == 3);
+static_assert(!__aggregate_layout<A>::__is_optimal);
+
+static_assert(__aggregate_layout<Tight>::__is_optimal && __aggregate_layout<Tight>::__padding == 3);
+static_assert(__aggregate_layout<E>::__size == 1 && __aggregate_layout<E>::__reordered_size == 1);
+static_assert(__aggregate_layout<R>::__member_bytes == sizeof(void *) + 1);
+static_assert(__aggregate_layout<N>::__reordered_size == sizeof(N));
+
+using Report = std::__layout_report<A, Tight, N>;
+static_assert(Report::__entries[0].__size == 24 && Report::__entries[0].__reordered_size == 16);
+static_assert(Report::__entries[1].__field_count == 3 && Report::__entries[2].__alignment == 4);
+static_assert(Report::__total_padding == 11 + 3 + 3);
+static_assert(Report::__total_savings == 8);
+
+int main() { return 0; }
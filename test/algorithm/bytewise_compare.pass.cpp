@@ -0,0 +1,83 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <algorithm>
+
+// equal and lexicographical_compare through memcmp when the elements compare
+// as their bytes, and element by element when they do not.
+
+#include "algorithm.hh"
+
+#include <cassert>
+
+// Opts in, but its padding must keep it out.
+struct P {
+  char __c;
+  int __i;
+  bool operator==(const P &__o) const { return __c == __o.__c && __i == __o.__i; }
+};
+namespace std {
+inline namespace __1 {
+template <> struct __enable_bytewise_equality<P> : true_type {};
+} // namespace __1
+} // namespace std
+
+// Equality that ignores a member.
+struct U {
+  int __a, __b;
+  bool operator==(const U &__o) const { return __a == __o.__a; }
+};
+
+static_assert(std::__is_bytewise_equality_comparable<int, const int>::value, "");
+static_assert(!std::__is_bytewise_equality_comparable<double, double>::value, "");
+static_assert(!std::__is_bytewise_equality_comparable<U, U>::value, "");
+static_assert(!std::__is_bytewise_equality_comparable<P, P>::value, "");
+static_assert(!std::__is_bytewise_equality_comparable<volatile int, volatile int>::value, "");
+static_assert(!std::__is_bytewise_less_comparable<signed char, signed char>::value, "");
+
+#if _LIBCPP_STD_VER > 17
+constexpr int ca[] = {1, 2}, cb[] = {1, 2};
+static_assert(std::equal(ca, ca + 2, cb), "");
+constexpr unsigned char cu[] = {1}, cv[] = {2};
+static_assert(std::lexicographical_compare(cu, cu + 1, cv, cv + 1), "");
+static_assert(std::__object_equal(3, 3), "");
+#endif
+
+int main() {
+  int __a[] = {1, 2, 3}, __b[] = {1, 2, 3}, __c[] = {1, 2, 4};
+  assert(std::equal(__a, __a + 3, __b));
+  assert(!std::equal(__a, __a + 3, __c));
+  assert(std::equal(__a, __a, __c));
+  const int *__pa = __a;
+  assert(std::equal(__pa, __pa + 3, __b));
+#if _LIBCPP_STD_VER > 11
+  assert(std::equal(__a, __a + 3, __b, __b + 3));
+  assert(!std::equal(__a, __a + 3, __b, __b + 2));
+#endif
+
+  U __u[] = {{1, 2}}, __v[] = {{1, 3}};
+  assert(std::equal(__u, __u + 1, __v));
+  assert(std::__object_equal(__u[0], __v[0]));
+  P __p[] = {{'a', 1}}, __q[] = {{'a', 1}};
+  assert(std::equal(__p, __p + 1, __q));
+
+  unsigned char __x[] = {1, 200}, __y[] = {1, 100};
+  assert(std::lexicographical_compare(__y, __y + 2, __x, __x + 2));
+  assert(!std::lexicographical_compare(__x, __x + 2, __y, __y + 2));
+  assert(std::lexicographical_compare(__x, __x + 1, __x, __x + 2));
+  assert(!std::lexicographical_compare(__x, __x + 2, __x, __x + 2));
+  signed char __s1[] = {-1}, __s2[] = {1};
+  assert(std::lexicographical_compare(__s1, __s1 + 1, __s2, __s2 + 1));
+
+#if _LIBCPP_STD_VER > 14
+  std::byte __b1[] = {std::byte{1}}, __b2[] = {std::byte{2}};
+  assert(std::lexicographical_compare(__b1, __b1 + 1, __b2, __b2 + 1));
+  static_assert(std::__is_bytewise_equality_comparable<std::byte, std::byte>::value, "");
+#endif
+  return 0;
+}
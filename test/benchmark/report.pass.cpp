@@ -0,0 +1,71 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <__benchmark>
+
+// char* __benchmark_csv_header(char* first, char* last) noexcept;
+// char* __benchmark_csv_row(char* first, char* last, const __benchmark_stats& s) noexcept;
+// char* __benchmark_json(char* first, char* last, const __benchmark_stats* s, size_t n) noexcept;
+
+// UNSUPPORTED: c++11, c++14
+
+#include "__benchmark.hh"
+
+#include <cassert>
+#include <cstring>
+
+static std::__benchmark_stats stats(const char *__name, bool __cycles) {
+  std::__benchmark_stats __s;
+  __s.__name       = __name;
+  __s.__iterations = 1000;
+  __s.__samples    = 31;
+  __s.__cycles     = __cycles;
+  __s.__min        = 1.004;
+  __s.__median     = 1.5;
+  __s.__mad        = 0.125;
+  __s.__p90        = 2;
+  __s.__p99        = 2.999;
+  __s.__max        = 3;
+  __s.__mean       = 1.75;
+  return __s;
+}
+
+static bool written(char *__buf, char *__end, const char *__expected) {
+  assert(__end != nullptr);
+  *__end = 0;
+  return std::strcmp(__buf, __expected) == 0;
+}
+
+int main() {
+  char __buf[512];
+  char *const __last = __buf + sizeof __buf - 1;
+
+  assert(written(__buf, std::__benchmark_csv_header(__buf, __last),
+                 "name,unit,iterations,samples,min,median,mad,p90,p99,max,mean\n"));
+  assert(written(__buf, std::__benchmark_csv_row(__buf, __last, stats("swap", false)),
+                 "\"swap\",ns,1000,31,1.00,1.50,0.13,2.00,3.00,3.00,1.75\n"));
+  assert(written(__buf, std::__benchmark_csv_row(__buf, __last, stats("say \"hi\", \\", true)),
+                 "\"say \"\"hi\"\", \\\",cycles,1000,31,1.00,1.50,0.13,2.00,3.00,3.00,1.75\n"));
+
+  const std::__benchmark_stats __s[] = {stats("a", false), stats("q\"b\\s\n", true)};
+  assert(written(__buf, std::__benchmark_json(__buf, __last, __s, 2),
+                 "{\"benchmarks\":["
+                 "{\"name\":\"a\",\"unit\":\"ns\",\"iterations\":1000,\"samples\":31,\"min\":1.00,\"median\":1.50,"
+                 "\"mad\":0.13,\"p90\":2.00,\"p99\":3.00,\"max\":3.00,\"mean\":1.75},"
+                 "{\"name\":\"q\\\"b\\\\s\\u000a\",\"unit\":\"cycles\",\"iterations\":1000,\"samples\":31,"
+                 "\"min\":1.00,\"median\":1.50,\"mad\":0.13,\"p90\":2.00,\"p99\":3.00,\"max\":3.00,\"mean\":1.75}"
+                 "]}\n"));
+
+  // Too small: nullptr, whatever the place it runs out.
+  for (size_t __n = 0; __n != 50; ++__n) {
+    assert(std::__benchmark_csv_row(__buf, __buf + __n, stats("say \"hi\"", false)) == nullptr);
+    assert(std::__benchmark_json(__buf, __buf + __n, __s, 2) == nullptr);
+  }
+  assert(std::__benchmark_json(__buf, __buf + 40, __s, 2) == nullptr);
+  return 0;
+}
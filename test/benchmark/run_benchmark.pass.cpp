@@ -0,0 +1,64 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <__benchmark>
+
+// template <class F>
+//     __benchmark_stats __run_benchmark(const char* name, F&& f, const __benchmark_options& = {});
+
+// UNSUPPORTED: c++11, c++14
+
+#include "__benchmark.hh"
+
+#include <cassert>
+#include <ctime>
+
+static unsigned long long now_ns() {
+  timespec __ts;
+  clock_gettime(CLOCK_MONOTONIC, &__ts);
+  return static_cast<unsigned long long>(__ts.tv_sec) * 1000000000ull + static_cast<unsigned long long>(__ts.tv_nsec);
+}
+
+static bool ordered(const std::__benchmark_stats &__s) {
+  return __s.__min <= __s.__median && __s.__median <= __s.__p90 && __s.__p90 <= __s.__p99 && __s.__p99 <= __s.__max &&
+         __s.__min <= __s.__mean && __s.__mean <= __s.__max && __s.__mad >= 0;
+}
+
+int main() {
+  std::__calibrate_cycle_counter(now_ns);
+
+  double __q[] = {1, 2, 3, 4, 5};
+  assert(std::__benchmark_quantile(__q, 5, 0.5) == 3);
+  assert(std::__benchmark_quantile(__q, 5, 0.9) == 4.6);
+  assert(std::__benchmark_quantile(__q, 1, 0.5) == 1);
+
+  int __a = 1, __b = 2;
+  std::__benchmark_stats __s = std::__run_benchmark("swap", [&] {
+    std::swap(__a, __b);
+    std::__do_not_optimize(__a);
+    std::__do_not_optimize(__b);
+  });
+  assert(__s.__samples == 31 && __s.__iterations >= 1 && !__s.__cycles);
+  assert(ordered(__s));
+
+  std::__benchmark_options __o;
+  __o.__samples       = 1000;
+  __o.__min_sample_ns = 100000;
+  __s                 = std::__run_benchmark(
+      "spin",
+      [] {
+        for (int __i = 0; __i != 100; ++__i)
+          std::__do_not_optimize(__i);
+      },
+      __o);
+  assert(__s.__samples == std::__benchmark_max_samples);
+  assert(ordered(__s));
+  // The batch was sized to fill a sample; allow for the first batches being slow.
+  assert(__s.__median * static_cast<double>(__s.__iterations) >= 100000 / 4);
+  return 0;
+}
@@ -0,0 +1,53 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <bit>
+
+// has_single_bit, bit_width, countl_zero, countl_one, countr_zero, countr_one,
+// popcount (C++20); __libcpp_select64.
+
+#include "bit.hh"
+
+#include <cassert>
+
+#if __cplusplus > 201703L
+static_assert(std::popcount(0xF0u) == 4 && std::popcount(0ull) == 0 && std::popcount(~0ull) == 64);
+static_assert(std::countr_zero(8u) == 3 && std::countr_zero(0u) == 32);
+static_assert(std::countl_zero(static_cast<unsigned char>(1)) == 7 && std::countl_zero(0ull) == 64);
+static_assert(std::countr_one(7u) == 3 && std::countl_one(~0u) == 32 && std::countl_one(0x80000000u) == 1);
+static_assert(std::bit_width(5u) == 3 && std::bit_width(0u) == 0);
+static_assert(std::has_single_bit(64u) && !std::has_single_bit(0u) && !std::has_single_bit(6u));
+#ifdef __SIZEOF_INT128__
+static_assert(std::countl_zero(static_cast<unsigned __int128>(1)) == 127);
+static_assert(std::countr_zero(static_cast<unsigned __int128>(1) << 100) == 100);
+#endif
+#endif
+
+static unsigned long long __state = 88172645463325252ull;
+static unsigned long long __random() {
+  __state ^= __state << 13;
+  __state ^= __state >> 7;
+  __state ^= __state << 17;
+  return __state;
+}
+
+int main(int, char **) {
+  assert(std::__libcpp_select64(1, 0) == 0);
+  assert(std::__libcpp_select64(1ull << 63, 0) == 63);
+  assert(std::__libcpp_select64(~0ull, 63) == 63);
+  for (int __t = 0; __t < 2000; ++__t) {
+    const unsigned long long __w = __random() & __random();
+    const int __c                = __builtin_popcountll(__w);
+    for (int __k = 0; __k < __c; ++__k) {
+      const unsigned __s = std::__libcpp_select64(__w, static_cast<unsigned>(__k));
+      assert((__w >> __s) & 1);
+      assert(__builtin_popcountll(__w & ((1ull << __s) - 1)) == __k);
+    }
+  }
+  return 0;
+}
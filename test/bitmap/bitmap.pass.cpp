@@ -0,0 +1,52 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <bitmap>
+
+// template <size_t N> class bitmap;
+
+// UNSUPPORTED: c++11, c++14
+
+#include "bitmap.hh"
+
+#include <cassert>
+
+static_assert(std::is_trivially_copyable<std::bitmap<100> >::value, "");
+static_assert(sizeof(std::bitmap<64>) == 8 && sizeof(std::bitmap<65>) == 16, "");
+static_assert(std::bitmap<100>::size() == 100, "");
+
+// Bits past N are dropped.
+constexpr std::bitmap<10> __cb(0xFFFF);
+
+int main(int, char **) {
+  std::bitmap<100> __x(0x5555), __y;
+  assert(__x.count() == 8 && __y.none());
+  assert(__x[0] && !__x[1] && __x.test(14) && !__x.test(16));
+  __y.set();
+  assert(__y.count() == 100 && __y.all());
+  assert((__x & __y) == __x && (__x | __y) == __y);
+  assert((__x ^ __y).count() == 92 && (~__x).count() == 92);
+  __y.reset(3).flip(4);
+  assert(!__y[3] && !__y[4] && __y.count() == 98);
+  __y[3] = true;
+  assert(__y[3] && __y.count() == 99);
+  assert(__cb.count() == 10 && __cb.all());
+  assert(std::bitmap<64>(~0ull).all());
+
+  assert(__x.find_first() == 0 && __x.find_next(0) == 2 && __x.find_next(14) == 100);
+  assert(__x.rank(5) == 3 && __x.select(3) == 6 && __x.select(8) == 100);
+  assert(__x.count_and(__y) == 7);
+
+  // Views share the storage.
+  std::bitmap_view __v = __x.view();
+  __v.set(99);
+  assert(__x.test(99) && __x.count() == 9);
+  std::const_bitmap_view __cv = __x;
+  assert(__cv.size() == 100 && __cv.count() == 9);
+  return 0;
+}
@@ -0,0 +1,140 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <bitmap>
+
+// class dynamic_bitmap; class bitmap_view; class const_bitmap_view;
+
+// Every operation against a bool array, over sizes around the word and
+// vector boundaries and densities from empty to full, with a view over an
+// unaligned buffer whose bits past size() must survive.
+
+// UNSUPPORTED: c++11, c++14
+
+#include "bitmap.hh"
+
+#include <cassert>
+#include <stddef.h>
+
+static unsigned long long __state = 88172645463325252ull;
+static unsigned long long __random() {
+  __state ^= __state << 13;
+  __state ^= __state >> 7;
+  __state ^= __state << 17;
+  return __state;
+}
+
+static void __test(size_t __n, int __density) {
+  static bool __ref[5000], __ref2[5000];
+  std::dynamic_bitmap __a(__n), __b(__n, true);
+  assert(__b.count() == __n && __b.all());
+
+  // Offset by one byte to be unaligned, with garbage past __n.
+  unsigned char __raw[700];
+  for (unsigned char &__c : __raw)
+    __c = static_cast<unsigned char>(__random());
+  std::bitmap_view __v(reinterpret_cast<std::byte *>(__raw + 1), __n);
+  const unsigned char __last = __n % 8 ? __raw[1 + __n / 8] : 0;
+  for (size_t __i = 0; __i < __n; ++__i) {
+    const bool __x = __density == 0 ? false : __density == 3 ? true : __random() % (__density == 1 ? 50 : 2) == 0;
+    __ref[__i]     = __x;
+    __a[__i]       = __x;
+    __ref2[__i]    = __random() & 1;
+    __v.set(__i, __ref2[__i]);
+  }
+
+  size_t __cnt = 0;
+  for (size_t __i = 0; __i < __n; ++__i)
+    __cnt += __ref[__i];
+  assert(__a.count() == __cnt);
+  assert(__a.any() == (__cnt != 0) && __a.none() == (__cnt == 0) && __a.all() == (__cnt == __n));
+
+  size_t __r = 0, __k = 0;
+  for (size_t __i = 0; __i < __n; ++__i) {
+    assert(__a.rank(__i) == __r);
+    assert(__a.test(__i) == __ref[__i]);
+    if (__ref[__i])
+      assert(__a.select(__k++) == __i);
+    __r += __ref[__i];
+  }
+  assert(__a.rank(__n) == __cnt && __a.select(__cnt) == __n);
+
+  size_t __expect = 0;
+  while (__expect < __n && !__ref[__expect])
+    ++__expect;
+  size_t __p = __a.find_first();
+  assert(__p == __expect);
+  while (__p != __n) {
+    size_t __q = __p + 1;
+    while (__q < __n && !__ref[__q])
+      ++__q;
+    __p = __a.find_next(__p);
+    assert(__p == __q);
+  }
+
+  size_t __ca = 0;
+  for (size_t __i = 0; __i < __n; ++__i)
+    __ca += __ref[__i] && __ref2[__i];
+  assert(__a.count_and(__v) == __ca && __v.count_and(__a) == __ca);
+  std::dynamic_bitmap __c(__a);
+  __c &= __v;
+  std::dynamic_bitmap __d(__a);
+  __d |= __v;
+  std::dynamic_bitmap __e(__a);
+  __e ^= __v;
+  std::dynamic_bitmap __f(__a);
+  __f.and_not(__v);
+  assert(__c.count() == __ca);
+  for (size_t __i = 0; __i < __n; ++__i) {
+    assert(__c[__i] == (__ref[__i] && __ref2[__i]));
+    assert(__d[__i] == (__ref[__i] || __ref2[__i]));
+    assert(__e[__i] == (__ref[__i] != __ref2[__i]));
+    assert(__f[__i] == (__ref[__i] && !__ref2[__i]));
+  }
+
+  std::dynamic_bitmap __g(__v);
+  assert(__g == __v && __g.count() == __v.count());
+  __v.flip();
+  for (size_t __i = 0; __i < __n; ++__i)
+    assert(__v[__i] == !__ref2[__i]);
+  assert(__g != __v || __n == 0);
+  __v ^= __g;
+  assert(__v.all());
+  __v.reset();
+  assert(__v.none());
+  if (__n % 8) {
+    const unsigned __past = ~((1u << (__n % 8)) - 1);
+    assert((__raw[1 + __n / 8] & __past) == (__last & __past));
+  }
+
+  std::dynamic_bitmap __h = ~__a;
+  assert(__h.count() == __n - __cnt);
+
+  std::dynamic_bitmap __z(__a);
+  __z.resize(__n + 70, true);
+  assert(__z.count() == __cnt + 70 && __z.rank(__n) == __cnt);
+  __z.resize(__n / 2);
+  size_t __half = 0;
+  for (size_t __i = 0; __i < __n / 2; ++__i)
+    __half += __ref[__i];
+  assert(__z.count() == __half);
+  __z.resize(__n);
+  assert(__z.rank(__n) == __half);
+  __z = __a;
+  assert(__z == __a);
+  __z = static_cast<std::dynamic_bitmap &&>(__h);
+  assert(__z.count() == __n - __cnt);
+}
+
+int main(int, char **) {
+  static const size_t __sizes[] = {0, 1, 7, 8, 9, 63, 64, 65, 127, 200, 511, 512, 513, 1000, 4099};
+  for (size_t __n : __sizes)
+    for (int __density = 0; __density < 4; ++__density)
+      __test(__n, __density);
+  return 0;
+}
@@ -0,0 +1,148 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <__byte_codec>
+
+// constexpr size_t __base64_encoded_size(size_t n) noexcept;
+// constexpr size_t __base64_max_decoded_size(size_t n) noexcept;
+// template <class CharT> size_t __base64_encode(const byte* src, size_t n, CharT* dst) noexcept;
+// template <class CharT> __codec_result __base64_decode(const CharT* src, size_t n, byte* dst) noexcept;
+
+// The RFC 4648 test vectors, padding and non-canonical input, then random
+// data of every length up to 200 and beyond against a reference encoder,
+// with and without padding and with one character corrupted. The vector
+// paths are built by the -mssse3 and -mavx2 variants of this test.
+
+// UNSUPPORTED: c++11, c++14
+
+#include "__byte_codec.hh"
+
+#include <cassert>
+#include <stddef.h>
+
+using std::byte;
+
+static_assert(std::__base64_encoded_size(0) == 0);
+static_assert(std::__base64_encoded_size(1) == 4);
+static_assert(std::__base64_encoded_size(3) == 4);
+static_assert(std::__base64_encoded_size(4) == 8);
+static_assert(std::__base64_max_decoded_size(4) == 3);
+static_assert(std::__base64_max_decoded_size(6) == 4);
+
+static const char __alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+static size_t __reference(const unsigned char *__s, size_t __n, char *__d) {
+  size_t __o = 0;
+  for (size_t __i = 0; __i < __n; __i += 3) {
+    const unsigned __w = static_cast<unsigned>(__s[__i]) << 16 |
+                         (__i + 1 < __n ? static_cast<unsigned>(__s[__i + 1]) << 8 : 0) |
+                         (__i + 2 < __n ? __s[__i + 2] : 0);
+    __d[__o++] = __alphabet[__w >> 18];
+    __d[__o++] = __alphabet[(__w >> 12) & 63];
+    __d[__o++] = __i + 1 < __n ? __alphabet[(__w >> 6) & 63] : '=';
+    __d[__o++] = __i + 2 < __n ? __alphabet[__w & 63] : '=';
+  }
+  return __o;
+}
+
+static bool __in_alphabet(char __c) {
+  for (int __i = 0; __i < 64; ++__i)
+    if (__alphabet[__i] == __c)
+      return true;
+  return false;
+}
+
+static bool __equal(const void *__a, const void *__b, size_t __n) { return __builtin_memcmp(__a, __b, __n) == 0; }
+
+static unsigned long long __state = 88172645463325252ull;
+static unsigned __random() {
+  __state ^= __state << 13;
+  __state ^= __state >> 7;
+  __state ^= __state << 17;
+  return static_cast<unsigned>(__state);
+}
+
+static byte *__bytes(unsigned char *__p) { return reinterpret_cast<byte *>(__p); }
+
+int main(int, char **) {
+  static unsigned char __src[3000], __dec[3000];
+  static char __enc[5000], __ref[5000];
+
+  struct {
+    const char *__in;
+    const char *__out;
+  } const __vectors[] = {{"", ""},         {"f", "Zg=="},         {"fo", "Zm8="},        {"foo", "Zm9v"},
+                         {"foob", "Zm9vYg=="}, {"fooba", "Zm9vYmE="}, {"foobar", "Zm9vYmFy"}};
+  for (const auto &__v : __vectors) {
+    const size_t __n = __builtin_strlen(__v.__in);
+    const size_t __m = std::__base64_encode(reinterpret_cast<const byte *>(__v.__in), __n, __enc);
+    assert(__m == __builtin_strlen(__v.__out) && __equal(__enc, __v.__out, __m));
+    const std::__codec_result __r = std::__base64_decode(__v.__out, __m, __bytes(__dec));
+    assert(__r.__in == __m && __r.__out == __n && __equal(__dec, __v.__in, __n));
+  }
+
+  // Unpadded input; a lone sixth bit, nonzero unused bits, padding in the
+  // middle.
+  assert(std::__base64_decode("Zm8", 3, __bytes(__dec)).__out == 2);
+  assert(std::__base64_decode("Zg", 2, __bytes(__dec)).__in == 2);
+  assert(std::__base64_decode("Zh==", 4, __bytes(__dec)).__in == 1);
+  assert(std::__base64_decode("Zm9=", 4, __bytes(__dec)).__in == 2);
+  assert(std::__base64_decode("Z===", 4, __bytes(__dec)).__in == 1);
+  assert(std::__base64_decode("Zm9vZ", 5, __bytes(__dec)).__in == 4);
+  assert(std::__base64_decode("Zm=v", 4, __bytes(__dec)).__in == 2);
+  assert(std::__base64_decode("Zg==Zg==", 8, __bytes(__dec)).__in == 2);
+
+  // Other character types.
+  unsigned char __u[8];
+  assert(std::__base64_encode(reinterpret_cast<const byte *>("foo"), 3, __u) == 4 && __u[3] == 'v');
+#if __cplusplus > 201703L
+  const char8_t __u8[] = u8"Zm9v";
+  assert(std::__base64_decode(__u8, 4, __bytes(__dec)).__out == 3 && __dec[2] == 'o');
+#endif
+
+  for (int __it = 0; __it < 20000; ++__it) {
+    const size_t __n = __it < 200 ? static_cast<size_t>(__it) : __random() % 2000;
+    for (size_t __i = 0; __i < __n; ++__i)
+      __src[__i] = static_cast<unsigned char>(__random());
+    const size_t __m = std::__base64_encode(__bytes(__src), __n, __enc);
+    assert(__m == __reference(__src, __n, __ref) && __m == std::__base64_encoded_size(__n));
+    assert(__equal(__enc, __ref, __m));
+    std::__codec_result __r = std::__base64_decode(__enc, __m, __bytes(__dec));
+    assert(__r.__in == __m && __r.__out == __n && __equal(__dec, __src, __n));
+    assert(__n <= std::__base64_max_decoded_size(__m));
+
+    size_t __unpadded = __m;
+    while (__unpadded != 0 && __enc[__unpadded - 1] == '=')
+      --__unpadded;
+    __r = std::__base64_decode(__enc, __unpadded, __bytes(__dec));
+    assert(__r.__in == __unpadded && __r.__out == __n && __equal(__dec, __src, __n));
+    assert(std::__base64_max_decoded_size(__unpadded) == __n);
+
+    if (__m != 0) {
+      const size_t __p = __random() % __m;
+      const char __old = __enc[__p];
+      char __bad;
+      do
+        __bad = static_cast<char>(__random());
+      while (__in_alphabet(__bad) || __bad == '=');
+      __enc[__p] = __bad;
+      // Padding before it in its quantum is where decoding stops.
+      size_t __e = __p;
+      for (size_t __q = __p / 4 * 4; __q < __p; ++__q)
+        if (__enc[__q] == '=') {
+          __e = __q;
+          break;
+        }
+      __r = std::__base64_decode(__enc, __m, __bytes(__dec));
+      assert(__r.__in == __e && __r.__out == __p / 4 * 3);
+      __enc[__p] = __old;
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,16 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <__byte_codec>
+
+// hex.pass.cpp with the AVX2 kernels.
+
+// UNSUPPORTED: c++11, c++14
+// ADDITIONAL_COMPILE_FLAGS: -mavx2
+
+#include "hex.pass.cpp"
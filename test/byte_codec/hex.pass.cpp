@@ -0,0 +1,89 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <__byte_codec>
+
+// constexpr size_t __hex_encoded_size(size_t n) noexcept;
+// constexpr size_t __hex_max_decoded_size(size_t n) noexcept;
+// template <class CharT> size_t __hex_encode(const byte* src, size_t n, CharT* dst, bool uppercase = false) noexcept;
+// template <class CharT> __codec_result __hex_decode(const CharT* src, size_t n, byte* dst) noexcept;
+
+// Random data of every length up to 200 and beyond in either case, decoded
+// back, and with one character corrupted. The vector paths are built by the
+// -mssse3 and -mavx2 variants of this test.
+
+// UNSUPPORTED: c++11, c++14
+
+#include "__byte_codec.hh"
+
+#include <cassert>
+#include <stddef.h>
+
+using std::byte;
+
+static_assert(std::__hex_encoded_size(5) == 10);
+static_assert(std::__hex_max_decoded_size(11) == 5);
+
+static bool __is_hex(char __c) {
+  return (__c >= '0' && __c <= '9') || ((__c | 0x20) >= 'a' && (__c | 0x20) <= 'f');
+}
+
+static unsigned long long __state = 88172645463325252ull;
+static unsigned __random() {
+  __state ^= __state << 13;
+  __state ^= __state >> 7;
+  __state ^= __state << 17;
+  return static_cast<unsigned>(__state);
+}
+
+static byte *__bytes(unsigned char *__p) { return reinterpret_cast<byte *>(__p); }
+
+int main(int, char **) {
+  static unsigned char __src[3000], __dec[3000];
+  static char __hex[7000];
+
+  // A trailing odd digit is not consumed; mixed case decodes.
+  std::__codec_result __r = std::__hex_decode("0aF", 3, __bytes(__dec));
+  assert(__r.__in == 2 && __r.__out == 1 && __dec[0] == 0x0a);
+  assert(std::__hex_decode("0g", 2, __bytes(__dec)).__in == 1);
+  __r = std::__hex_decode("DeadBEEF", 8, __bytes(__dec));
+  assert(__r.__out == 4 && __dec[0] == 0xde && __dec[3] == 0xef);
+
+  unsigned char __u[8];
+  assert(std::__hex_encode(reinterpret_cast<const byte *>("\x01\xab"), 2, __u) == 4 && __u[2] == 'a');
+  assert(std::__hex_encode(reinterpret_cast<const byte *>("\x01\xab"), 2, __u, true) == 4 && __u[3] == 'B');
+
+  for (int __it = 0; __it < 20000; ++__it) {
+    const size_t __n = __it < 200 ? static_cast<size_t>(__it) : __random() % 2000;
+    for (size_t __i = 0; __i < __n; ++__i)
+      __src[__i] = static_cast<unsigned char>(__random());
+    const bool __upper  = __it & 1;
+    const size_t __h    = std::__hex_encode(__bytes(__src), __n, __hex, __upper);
+    const char *__digits = __upper ? "0123456789ABCDEF" : "0123456789abcdef";
+    assert(__h == std::__hex_encoded_size(__n));
+    for (size_t __i = 0; __i < __n; ++__i)
+      assert(__hex[2 * __i] == __digits[__src[__i] >> 4] && __hex[2 * __i + 1] == __digits[__src[__i] & 15]);
+    __r = std::__hex_decode(__hex, __h, __bytes(__dec));
+    assert(__r.__in == __h && __r.__out == __n && __builtin_memcmp(__dec, __src, __n) == 0);
+
+    if (__h != 0) {
+      const size_t __p = __random() % __h;
+      const char __old = __hex[__p];
+      char __bad;
+      do
+        __bad = static_cast<char>(__random());
+      while (__is_hex(__bad));
+      __hex[__p] = __bad;
+      __r = std::__hex_decode(__hex, __h, __bytes(__dec));
+      assert(__r.__in == __p && __r.__out == __p / 2);
+      __hex[__p] = __old;
+    }
+  }
+
+  return 0;
+}
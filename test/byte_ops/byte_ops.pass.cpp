@@ -0,0 +1,97 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <__byte_ops>
+
+// __byte_and, __byte_or, __byte_xor, __byte_not, __byte_shift_left,
+// __byte_shift_right, __byte_fill
+
+// Against a byte loop, at random lengths and misalignments, in place and
+// not, and checking that nothing outside the range is written.
+
+// UNSUPPORTED: c++11, c++14
+
+#include "__byte_ops.hh"
+
+#include <cassert>
+#include <stddef.h>
+
+using std::byte;
+
+#if __cplusplus > 201703L
+constexpr int __constant() {
+  byte __a[5] = {byte{1}, byte{2}, byte{3}, byte{0xF0}, byte{0xFF}};
+  byte __b[5] = {byte{3}, byte{3}, byte{3}, byte{0x0F}, byte{1}};
+  byte __d[5] = {};
+  std::__byte_xor(__d, __a, __b, 5);
+  int __r = static_cast<int>(__d[0]) + static_cast<int>(__d[3]); // 2 + 0xFF
+  std::__byte_shift_left(__d, __a, 5, 4);
+  __r += static_cast<int>(__d[1]); // 0x20
+  std::__byte_not(__d, __d, 5);
+  __r += static_cast<int>(__d[4]); // ~0xF0
+  std::__byte_fill(__d, 5, byte{7});
+  return __r + static_cast<int>(__d[2]);
+}
+static_assert(__constant() == 2 + 255 + 32 + 15 + 7);
+#endif
+
+static unsigned long long __state = 88172645463325252ull;
+static unsigned __random() {
+  __state ^= __state << 13;
+  __state ^= __state >> 7;
+  __state ^= __state << 17;
+  return static_cast<unsigned>(__state);
+}
+
+int main(int, char **) {
+  static unsigned char __A[5000], __B[5000], __D[5000], __R[5000];
+  for (int __t = 0; __t < 3000; ++__t) {
+    const size_t __n  = __t % 50 == 0 ? 4000 : __random() % 300;
+    const size_t __oa = __random() % 70, __ob = __random() % 70, __od = __random() % 70;
+    for (size_t __i = 0; __i < __n + 70; ++__i) {
+      __A[__i] = static_cast<unsigned char>(__random());
+      __B[__i] = static_cast<unsigned char>(__random());
+      __D[__i] = __R[__i] = static_cast<unsigned char>(__random());
+    }
+    const int __op         = static_cast<int>(__random() % 7);
+    const unsigned __shift = __random() % 10;
+    const bool __in_place  = __random() % 3 == 0;
+    unsigned char *__dst   = __D + __od;
+    const unsigned char *__a = __in_place ? __dst : __A + __oa, *__b = __B + __ob;
+
+    for (size_t __i = 0; __i < __n; ++__i) {
+      const unsigned __x = __in_place ? __R[__od + __i] : __a[__i], __y = __b[__i];
+      unsigned __r       = 0;
+      switch (__op) {
+      case 0: __r = __x & __y; break;
+      case 1: __r = __x | __y; break;
+      case 2: __r = __x ^ __y; break;
+      case 3: __r = ~__x; break;
+      case 4: __r = __shift >= 8 ? 0 : __x << __shift; break;
+      case 5: __r = __shift >= 8 ? 0 : __x >> __shift; break;
+      case 6: __r = 0x5a; break;
+      }
+      __R[__od + __i] = static_cast<unsigned char>(__r);
+    }
+
+    byte *__bd       = reinterpret_cast<byte *>(__dst);
+    const byte *__ba = reinterpret_cast<const byte *>(__a), *__bb = reinterpret_cast<const byte *>(__b);
+    switch (__op) {
+    case 0: std::__byte_and(__bd, __ba, __bb, __n); break;
+    case 1: std::__byte_or(__bd, __ba, __bb, __n); break;
+    case 2: std::__byte_xor(__bd, __ba, __bb, __n); break;
+    case 3: std::__byte_not(__bd, __ba, __n); break;
+    case 4: std::__byte_shift_left(__bd, __ba, __n, __shift); break;
+    case 5: std::__byte_shift_right(__bd, __ba, __n, __shift); break;
+    case 6: std::__byte_fill(__bd, __n, byte{0x5a}); break;
+    }
+    for (size_t __i = 0; __i < __n + 70; ++__i)
+      assert(__D[__i] == __R[__i]);
+  }
+  return 0;
+}
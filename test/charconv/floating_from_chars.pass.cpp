@@ -0,0 +1,207 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <charconv>
+
+// from_chars_result from_chars(const char* first, const char* last, float& value,
+//                              chars_format fmt = chars_format::general);
+// from_chars_result from_chars(const char* first, const char* last, double& value,
+//                              chars_format fmt = chars_format::general);
+
+// The syntax of each format and where parsing stops, then against strtod:
+// random decimals of up to 40 digits, 1500-digit inputs, and the exact
+// midpoints between neighbouring values, where the Eisel-Lemire fast path
+// has to give way to the exact fallback.
+
+// UNSUPPORTED: c++11, c++14
+
+#include "charconv.hh"
+
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+#include <stddef.h>
+
+using std::chars_format;
+using std::errc;
+
+static unsigned long long __state = 88172645463325252ull;
+static unsigned long long __random() {
+  __state ^= __state << 13;
+  __state ^= __state >> 7;
+  __state ^= __state << 17;
+  return __state;
+}
+
+template <class _Tp>
+static _Tp __read(const char *__s);
+template <>
+double __read<double>(const char *__s) {
+  return std::strtod(__s, nullptr);
+}
+template <>
+float __read<float>(const char *__s) {
+  return std::strtof(__s, nullptr);
+}
+
+template <class _Tp>
+static bool __same(_Tp __a, _Tp __b) {
+  return std::memcmp(&__a, &__b, sizeof(_Tp)) == 0;
+}
+
+// from_chars of the whole of __s, which must consume __used characters
+// (all of them if -1) with __ec, and on success give __want.
+template <class _Tp>
+static void __parse(const char *__s, _Tp __want, errc __ec = errc(), int __used = -1,
+                    chars_format __fmt = chars_format::general) {
+  _Tp __v                          = _Tp(12345);
+  const size_t __n                 = std::strlen(__s);
+  const std::from_chars_result __r = std::from_chars(__s, __s + __n, __v, __fmt);
+  assert(__r.ec == __ec);
+  assert(__r.ptr - __s == (__used < 0 ? static_cast<long>(__n) : __used));
+  if (__ec == errc())
+    assert(__same(__v, __want));
+}
+
+// from_chars agrees with strtod, or strtof, on __s.
+template <class _Tp>
+static void __agrees(const char *__s) {
+  const _Tp __want = __read<_Tp>(__s);
+  _Tp __v;
+  const std::from_chars_result __r = std::from_chars(__s, __s + std::strlen(__s), __v);
+  if (__want - __want != 0 || (__want == 0 && __s[0] != '0'))
+    assert(__r.ec == errc::result_out_of_range);
+  else
+    assert(__r.ec == errc() && __same(__v, __want));
+}
+
+// Writes the exact decimal expansion of (2 * __m + 1) / 2^(__k + 1), the
+// midpoint between __m / 2^__k and the next multiple of 2^-__k.
+static void __midpoint(unsigned long long __m, int __k, char *__out) {
+  __uint128_t __x = 2 * static_cast<__uint128_t>(__m) + 1;
+  for (int __i = 0; __i <= __k; ++__i)
+    __x *= 5;
+  char __digits[48];
+  const size_t __n    = static_cast<size_t>(std::to_chars(__digits, __digits + 48, __x).ptr - __digits);
+  const size_t __frac = static_cast<size_t>(__k + 1);
+  if (__n <= __frac) {
+    *__out++ = '0';
+    *__out++ = '.';
+    for (size_t __i = __n; __i != __frac; ++__i)
+      *__out++ = '0';
+    std::memcpy(__out, __digits, __n);
+    __out += __n;
+  } else {
+    std::memcpy(__out, __digits, __n - __frac);
+    __out += __n - __frac;
+    *__out++ = '.';
+    std::memcpy(__out, __digits + __n - __frac, __frac);
+    __out += __frac;
+  }
+  *__out = '\0';
+}
+
+int main(int, char **) {
+  __parse("1", 1.0);
+  __parse("-0", -0.0);
+  __parse(".5", 0.5);
+  __parse("5.", 5.0);
+  __parse("1e", 1.0, errc(), 1);
+  __parse("1e+", 1.0, errc(), 1);
+  __parse("1e5x", 1e5, errc(), 3);
+  __parse("0e999", 0.0);
+  __parse("1e5", 1.0, errc(), 1, chars_format::fixed);
+  __parse("15", 0.0, errc::invalid_argument, 0, chars_format::scientific);
+  __parse("1.5E-3", 1.5e-3, errc(), 6, chars_format::scientific);
+  __parse(".", 0.0, errc::invalid_argument, 0);
+  __parse("e5", 0.0, errc::invalid_argument, 0);
+  __parse("+1", 0.0, errc::invalid_argument, 0);
+  __parse("1e400", 0.0, errc::result_out_of_range);
+  __parse("1e-400", 0.0, errc::result_out_of_range);
+  __parse("1e-46", 0.0f, errc::result_out_of_range);
+  __parse("inf", __builtin_inf());
+  __parse("-InFiNiTy", -__builtin_inf());
+  __parse("infin", __builtin_inf(), errc(), 3);
+
+  __parse("1.8p+1", 3.0, errc(), 6, chars_format::hex);
+  __parse("ff.8", 255.5, errc(), 4, chars_format::hex);
+  __parse("0x1p0", 0.0, errc(), 1, chars_format::hex);
+  __parse("1fffffffffffff8p-57", 1.0, errc(), -1, chars_format::hex);
+  __parse("1.000000000000000000001p-1074", 5e-324, errc(), -1, chars_format::hex);
+  __parse("1p-1075", 0.0, errc::result_out_of_range, 7, chars_format::hex);
+
+  // Ties to even, the subnormal boundary, and the edges of the range.
+  __parse("9007199254740993", 9007199254740992.0);
+  __parse("9007199254740993.0000000000000000000000000001", 9007199254740994.0);
+  __parse("2.4703282292062327e-324", 0.0, errc::result_out_of_range);
+  __parse("2.4703282292062328e-324", 5e-324);
+  __parse("1.7976931348623158e308", 1.7976931348623157e308);
+  __parse("1.7976931348623159e308", 0.0, errc::result_out_of_range);
+  __parse("0.000000000000000000000000000000000000000000001e45", 1.0);
+  __parse("3.4028235e38", 3.4028235e38f);
+  __agrees<double>("2.2250738585072011e-308");
+
+  {
+    float __f;
+    const char *__s            = "nan(abc_1)";
+    std::from_chars_result __r = std::from_chars(__s, __s + 10, __f);
+    assert(__r.ec == errc() && __r.ptr == __s + 10 && __f != __f);
+    __s = "nan(x";
+    __r = std::from_chars(__s, __s + 5, __f);
+    assert(__r.ptr == __s + 3 && __f != __f);
+  }
+
+  // Many more digits than any value needs.
+  static char __big[1600];
+  std::memcpy(__big, "0.", 2);
+  for (int __i = 0; __i != 1500; ++__i)
+    __big[2 + __i] = static_cast<char>('0' + (__i * 7 + 3) % 10);
+  __agrees<double>(__big);
+  __big[0] = '1';
+  __agrees<double>(__big);
+  __agrees<float>(__big);
+
+  // Random decimals of 1 to 40 digits with exponents across both ranges.
+  char __s[1200];
+  for (int __i = 0; __i != 200000; ++__i) {
+    char *__p            = __s;
+    const unsigned __n   = 1 + static_cast<unsigned>(__random() % 40);
+    const unsigned __dot = static_cast<unsigned>(__random() % (__n + 1));
+    for (unsigned __j = 0; __j != __n; ++__j) {
+      if (__j == __dot && __j != 0)
+        *__p++ = '.';
+      *__p++ = static_cast<char>('0' + (__j == 0 ? 1 + __random() % 9 : __random() % 10));
+    }
+    *__p++ = 'e';
+    __p    = std::to_chars(__p, __p + 8, static_cast<int>(__random() % 680) - 340).ptr;
+    *__p   = '\0';
+    __agrees<double>(__s);
+    __agrees<float>(__s);
+  }
+
+  // Midpoints between neighbouring doubles of 53 significant bits scaled
+  // by 2^0 to 2^-30, and the same for floats scaled by 2^0 to 2^-40,
+  // exactly and nudged either way.
+  for (int __i = 0; __i != 100000; ++__i) {
+    const unsigned long long __m = 1ull << 52 | __random() >> 12;
+    __midpoint(__m, static_cast<int>(__random() % 31), __s);
+    __agrees<double>(__s);
+    const size_t __n = std::strlen(__s);
+    __s[__n]         = '1';
+    __s[__n + 1]     = '\0';
+    __agrees<double>(__s);
+    __s[__n - 1] = static_cast<char>(__s[__n - 1] - 1);
+    __s[__n]     = '9';
+    __agrees<double>(__s);
+
+    const unsigned __mf = 1u << 23 | static_cast<unsigned>(__random() >> 41);
+    __midpoint(__mf, static_cast<int>(__random() % 41), __s);
+    __agrees<float>(__s);
+  }
+  return 0;
+}
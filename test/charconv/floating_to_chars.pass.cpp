@@ -0,0 +1,280 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <charconv>
+
+// to_chars_result to_chars(char* first, char* last, float value);
+// to_chars_result to_chars(char* first, char* last, double value);
+// to_chars_result to_chars(char* first, char* last, float value, chars_format fmt);
+// to_chars_result to_chars(char* first, char* last, double value, chars_format fmt);
+// to_chars_result to_chars(char* first, char* last, float value, chars_format fmt, int precision);
+// to_chars_result to_chars(char* first, char* last, double value, chars_format fmt, int precision);
+
+// Known outputs in each format, then random values of every exponent: the
+// shortest form reads back as the same value through strtod, and no form
+// with one digit fewer does. With a precision, known outputs of printf,
+// ties and values whose shortest digits round differently from their exact
+// ones among them.
+
+// UNSUPPORTED: c++11, c++14
+
+#include "charconv.hh"
+
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+#include <stddef.h>
+
+using std::chars_format;
+using std::errc;
+
+static unsigned long long __state = 88172645463325252ull;
+static unsigned long long __random() {
+  __state ^= __state << 13;
+  __state ^= __state >> 7;
+  __state ^= __state << 17;
+  return __state;
+}
+
+template <class _Tp>
+static bool __is(_Tp __v, const char *__want) {
+  char __buf[400];
+  const std::to_chars_result __r = std::to_chars(__buf, __buf + sizeof(__buf), __v);
+  assert(__r.ec == errc());
+  *__r.ptr = '\0';
+  return std::strcmp(__buf, __want) == 0;
+}
+
+template <class _Tp>
+static bool __is(_Tp __v, chars_format __fmt, const char *__want) {
+  char __buf[400];
+  const std::to_chars_result __r = std::to_chars(__buf, __buf + sizeof(__buf), __v, __fmt);
+  assert(__r.ec == errc());
+  *__r.ptr = '\0';
+  return std::strcmp(__buf, __want) == 0;
+}
+
+template <class _Tp>
+static bool __is(_Tp __v, chars_format __fmt, int __prec, const char *__want) {
+  char __buf[400];
+  const std::to_chars_result __r = std::to_chars(__buf, __buf + sizeof(__buf), __v, __fmt, __prec);
+  assert(__r.ec == errc());
+  assert(std::to_chars(__buf, __r.ptr - 1, __v, __fmt, __prec).ec == errc::value_too_large);
+  *__r.ptr = '\0';
+  return std::strcmp(__buf, __want) == 0;
+}
+
+// printf's output for random values.
+struct __printf_case {
+  double __v;
+  bool __float;
+  chars_format __fmt;
+  int __prec;
+  const char *__want;
+};
+
+static const __printf_case __printf_cases[] = {
+    {-0x0.3a6f252e6b438p-1022, false, chars_format::general, 1, "-5e-309"},
+    {0x1.c4bb280000000p+82, true, chars_format::scientific, 2, "8.55e+24"},
+    {-0x1.6aa4d6f03675ap-167, false, chars_format::scientific, 17, "-7.57235805319218488e-51"},
+    {0x1.0eedb6cad4a26p+45, false, chars_format::scientific, 20, "3.72361391868362968750e+13"},
+    {0x1.3eed6a0000000p-62, true, chars_format::scientific, 18, "2.701420144654573190e-19"},
+    {0x1.66d0a95e60af5p-54, false, chars_format::scientific, 17, "7.78056187968879582e-17"},
+    {-0x1.bdf56dbc496cbp-751, false, chars_format::scientific, 17, "-1.47071302061407425e-226"},
+    {0x1.3d0e000000000p-128, true, chars_format::general, 26, "3.6396093169724192761150539e-39"},
+    {-0x1.20ac5ae97ba94p-653, false, chars_format::general, 20, "-3.0170285936144302574e-197"},
+    {-0x0.ab901301850c5p-1022, false, chars_format::general, 2, "-1.5e-308"},
+    {-0x1.f4e1860000000p-95, true, chars_format::scientific, 15, "-4.939067504460172e-29"},
+    {0x1.f68b1ae2eb154p-6, false, chars_format::fixed, 18, "0.030672813659905998"},
+    {-0x1.1f218ec66a787p-95, false, chars_format::scientific, 25, "-2.8313310936473808905567796e-29"},
+    {0x1.0a63340000000p-35, true, chars_format::scientific, 2, "3.03e-11"},
+    {-0x1.25e7e49b64a08p-51, false, chars_format::fixed, 5, "-0.00000"},
+    {-0x1.a7f9fe0000000p+4, true, chars_format::fixed, 13, "-26.4985332489014"},
+    {-0x1.370fa0a097c97p+25, false, chars_format::general, 18, "-40771393.2546321675"},
+    {-0x1.44fe680000000p-128, true, chars_format::fixed, 2, "-0.00"},
+    {0x1.4040510a3d6b2p+33, false, chars_format::general, 18, "10745848340.4798317"},
+    {0x1.7712160000000p+125, true, chars_format::fixed, 9, "62319300746976044946623815422322933760.000000000"},
+    {0x1.19d27b774eb52p+53, false, chars_format::scientific, 30, "9.915737022518948000000000000000e+15"},
+    {-0x0.fd9147631a992p-1022, false, chars_format::scientific, 15, "-2.203931272161481e-308"},
+    {-0x1.2f46000000000p-97, true, chars_format::fixed, 4, "-0.0000"},
+    {-0x1.9143b72fdf202p+10, false, chars_format::scientific, 26, "-1.60505805584706877198186703e+03"},
+    {0x1.6d55600000000p+93, true, chars_format::fixed, 22, "14133155078330068631291953152.0000000000000000000000"},
+    {-0x1.f3e1526a2c0bdp-854, false, chars_format::scientific, 21, "-1.625584842470919103478e-257"},
+    {-0x1.df4f500000000p-128, true, chars_format::general, 5, "-5.5022e-39"},
+    {0x1.dde889c1caaf7p-20, false, chars_format::general, 27, "1.78034734727810827510511345e-06"},
+    {0x1.ee7e2c0000000p-120, true, chars_format::general, 21, "1.45318390535825120327e-36"},
+    {0x1.93d32bd628881p-2, false, chars_format::general, 25, "0.3943602418386334407252036"},
+    {-0x1.c19a160000000p-59, true, chars_format::scientific, 2, "-3.05e-18"},
+    {-0x1.8c085fc132d0dp-596, false, chars_format::scientific, 10, "-5.9650443607e-180"},
+    {-0x0.acc2e99c94309p-1022, false, chars_format::general, 4, "-1.502e-308"},
+    {-0x1.bfaf660000000p-109, true, chars_format::fixed, 19, "-0.0000000000000000000"},
+    {-0x1.019ce068739fap+51, false, chars_format::fixed, 4, "-2265986145426685.0000"},
+    {0x1.9fb6fa268aa87p-507, false, chars_format::general, 11, "3.8756778575e-153"},
+};
+
+template <class _Tp>
+static _Tp __read(const char *__s);
+template <>
+double __read<double>(const char *__s) {
+  return std::strtod(__s, nullptr);
+}
+template <>
+float __read<float>(const char *__s) {
+  return std::strtof(__s, nullptr);
+}
+
+// The digits of the scientific form __s with the last one dropped, rounded
+// down (__up false) or up, as "digitsE<exponent>".
+static void __one_fewer(const char *__s, bool __up, char *__out) {
+  const char *__p = __s;
+  if (*__p == '-')
+    *__out++ = *__p++;
+  char __digits[24];
+  size_t __n = 0;
+  for (; *__p != 'e'; ++__p)
+    if (*__p != '.')
+      __digits[__n++] = *__p;
+  const int __exp = std::atoi(__p + 1);
+  --__n;
+  if (__up) {
+    size_t __i = __n;
+    while (__i != 0 && __digits[__i - 1] == '9')
+      __digits[--__i] = '0';
+    if (__i == 0) {
+      *__out++ = '1';
+    } else
+      ++__digits[__i - 1];
+  }
+  std::memcpy(__out, __digits, __n);
+  __out += __n;
+  *__out++ = 'e';
+  int __e  = __exp - static_cast<int>(__n) + 1;
+  if (__e < 0) {
+    *__out++ = '-';
+    __e      = -__e;
+  }
+  __out  = std::to_chars(__out, __out + 8, __e).ptr;
+  *__out = '\0';
+}
+
+template <class _Tp>
+static void __check_shortest(_Tp __v) {
+  char __buf[400], __fewer[40];
+  std::to_chars_result __r = std::to_chars(__buf, __buf + sizeof(__buf), __v, chars_format::scientific);
+  assert(__r.ec == errc());
+  *__r.ptr = '\0';
+  assert(__read<_Tp>(__buf) == __v);
+  if (__buf[1 + (__v < 0)] == '.') {
+    __one_fewer(__buf, false, __fewer);
+    assert(__read<_Tp>(__fewer) != __v);
+    __one_fewer(__buf, true, __fewer);
+    assert(__read<_Tp>(__fewer) != __v);
+  }
+
+  // The other formats read back too, and fail one character short.
+  const chars_format __formats[] = {chars_format::general, chars_format::fixed, chars_format::scientific};
+  for (chars_format __fmt : __formats) {
+    __r = std::to_chars(__buf, __buf + sizeof(__buf), __v, __fmt);
+    assert(__r.ec == errc());
+    *__r.ptr = '\0';
+    assert(__read<_Tp>(__buf) == __v);
+    assert(std::to_chars(__buf, __r.ptr - 1, __v, __fmt).ec == errc::value_too_large);
+  }
+  __r = std::to_chars(__buf, __buf + sizeof(__buf), __v);
+  *__r.ptr = '\0';
+  assert(__read<_Tp>(__buf) == __v);
+
+  // Hex reads back as the same bits.
+  __r = std::to_chars(__buf, __buf + sizeof(__buf), __v, chars_format::hex);
+  assert(__r.ec == errc());
+  _Tp __w;
+  const char *__h = __buf + (__v < 0);
+  assert(std::from_chars(__h, __r.ptr, __w, chars_format::hex).ptr == __r.ptr);
+  assert(__w == (__v < 0 ? -__v : __v));
+}
+
+int main(int, char **) {
+  // Shortest: fixed up to the exponent where scientific is no longer.
+  assert(__is(1.0, "1"));
+  assert(__is(0.1, "0.1"));
+  assert(__is(0.3f, "0.3"));
+  assert(__is(-0.0, "-0"));
+  assert(__is(123456.0, "123456"));
+  assert(__is(0.001, "0.001"));
+  assert(__is(0.0001, "1e-04"));
+  assert(__is(2.5e-5, "2.5e-05"));
+  assert(__is(1e21, "1e+21"));
+  assert(__is(1e23, "1e+23"));
+  assert(__is(1e100, "1e+100"));
+  assert(__is(5e-324, "5e-324"));
+  assert(__is(1.7976931348623157e308, "1.7976931348623157e+308"));
+  assert(__is(3.4028235e38f, "3.4028235e+38"));
+  assert(__is(__builtin_inf(), "inf"));
+  assert(__is(-__builtin_inf(), "-inf"));
+  assert(__is(__builtin_nan(""), "nan"));
+
+  assert(__is(1e5, chars_format::general, "100000"));
+  assert(__is(1e6, chars_format::general, "1e+06"));
+  assert(__is(1234567.0, chars_format::general, "1.234567e+06"));
+  assert(__is(0.0001, chars_format::general, "0.0001"));
+  assert(__is(1e22, chars_format::fixed, "10000000000000000000000"));
+  assert(__is(1e-7, chars_format::fixed, "0.0000001"));
+  assert(__is(1.5, chars_format::scientific, "1.5e+00"));
+  assert(__is(0.0, chars_format::scientific, "0e+00"));
+  assert(__is(3.0, chars_format::hex, "1.8p+1"));
+  assert(__is(0.0, chars_format::hex, "0p+0"));
+  assert(__is(1.0f, chars_format::hex, "1p+0"));
+  assert(__is(0.1f, chars_format::hex, "1.99999ap-4"));
+  assert(__is(5e-324, chars_format::hex, "0.0000000000001p-1022"));
+
+  assert(__is(0.125, chars_format::fixed, 2, "0.12"));
+  assert(__is(0.375, chars_format::fixed, 2, "0.38"));
+  assert(__is(2.5, chars_format::fixed, 0, "2"));
+  assert(__is(2.675, chars_format::fixed, 2, "2.67"));
+  assert(__is(-0.001, chars_format::fixed, 1, "-0.0"));
+  assert(__is(0.0, chars_format::fixed, 3, "0.000"));
+  assert(__is(1e23, chars_format::fixed, 0, "99999999999999991611392"));
+  assert(__is(0.1, chars_format::fixed, 20, "0.10000000000000000555"));
+  assert(__is(9.5, chars_format::scientific, 0, "1e+01"));
+  assert(__is(5e-324, chars_format::scientific, 3, "4.941e-324"));
+  assert(__is(1.0, chars_format::scientific, -1, "1.000000e+00"));
+  assert(__is(0.0, chars_format::scientific, 2, "0.00e+00"));
+  assert(__is(1234.0, chars_format::general, 2, "1.2e+03"));
+  assert(__is(0.0001, chars_format::general, 3, "0.0001"));
+  assert(__is(100.0, chars_format::general, 0, "1e+02"));
+  assert(__is(0.5, chars_format::general, -1, "0.5"));
+  assert(__is(1.5, chars_format(), 3, "1.5"));
+  assert(__is(1.5, chars_format::hex, 0, "2p+0"));
+  assert(__is(1.0, chars_format::hex, 3, "1.000p+0"));
+  assert(__is(0.1f, chars_format::hex, 2, "1.9ap-4"));
+  assert(__is(-3.0, chars_format::hex, -1, "-1.8p+1"));
+  assert(__is(-__builtin_inf(), chars_format::fixed, 2, "-inf"));
+  for (const __printf_case &__c : __printf_cases)
+    assert(__c.__float ? __is(static_cast<float>(__c.__v), __c.__fmt, __c.__prec, __c.__want)
+                       : __is(__c.__v, __c.__fmt, __c.__prec, __c.__want));
+
+  char __b[4];
+  assert(std::to_chars(__b, __b + 4, 0.125).ec == errc::value_too_large);
+  assert(std::to_chars(__b, __b + 4, 0.25).ec == errc());
+
+  for (int __i = 0; __i != 200000; ++__i) {
+    unsigned long long __u = __random();
+    if (__i & 1)
+      __u >>= __random() % 64;
+    double __d;
+    std::memcpy(&__d, &__u, sizeof(__d));
+    if (__d - __d == 0)
+      __check_shortest(__d);
+    const unsigned __v = static_cast<unsigned>(__random());
+    float __f;
+    std::memcpy(&__f, &__v, sizeof(__f));
+    if (__f - __f == 0)
+      __check_shortest(__f);
+  }
+  return 0;
+}
@@ -0,0 +1,172 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <charconv>
+
+// to_chars_result to_chars(char* first, char* last, Integral value, int base = 10);
+// from_chars_result from_chars(const char* first, const char* last, Integral& value, int base = 10);
+
+// Random values of every integral type, 128-bit included, against a
+// reference formatter in several bases, read back, and written to a buffer
+// one character short; then the from_chars edge cases around overflow,
+// leading zeros, signs and the 8- and 16-digit chunks. The SSE4.1 digit
+// parse is built by the -msse4.1 variant of this test.
+
+// UNSUPPORTED: c++11, c++14
+
+#include "charconv.hh"
+
+#include <cassert>
+#include <stddef.h>
+
+using std::errc;
+
+static unsigned long long __state = 88172645463325252ull;
+static unsigned long long __random() {
+  __state ^= __state << 13;
+  __state ^= __state >> 7;
+  __state ^= __state << 17;
+  return __state;
+}
+
+// The digits of __v in __base, by repeated division of its magnitude.
+template <class _Tp>
+static size_t __reference(_Tp __v, int __base, char *__out) {
+  using _Up   = std::make_unsigned_t<_Tp>;
+  _Up __m     = static_cast<_Up>(__v);
+  size_t __n  = 0;
+  if (std::is_signed<_Tp>::value && __v < 0) {
+    __out[__n++] = '-';
+    __m          = static_cast<_Up>(_Up(0) - __m);
+  }
+  char __rev[130];
+  size_t __k = 0;
+  do {
+    __rev[__k++] = "0123456789abcdefghijklmnopqrstuvwxyz"[__m % static_cast<_Up>(__base)];
+    __m /= static_cast<_Up>(__base);
+  } while (__m != 0);
+  while (__k != 0)
+    __out[__n++] = __rev[--__k];
+  return __n;
+}
+
+template <class _Tp>
+static void __round_trip(_Tp __v, int __base) {
+  char __buf[140], __ref[140];
+  const std::to_chars_result __r = std::to_chars(__buf, __buf + sizeof(__buf), __v, __base);
+  assert(__r.ec == errc());
+  const size_t __n = __reference(__v, __base, __ref);
+  assert(static_cast<size_t>(__r.ptr - __buf) == __n);
+  for (size_t __i = 0; __i != __n; ++__i)
+    assert(__buf[__i] == __ref[__i]);
+
+  _Tp __w{};
+  const std::from_chars_result __p = std::from_chars(__buf, __r.ptr, __w, __base);
+  assert(__p.ec == errc() && __p.ptr == __r.ptr && __w == __v);
+
+  const std::to_chars_result __short = std::to_chars(__buf, __r.ptr - 1, __v, __base);
+  assert(__short.ec == errc::value_too_large && __short.ptr == __r.ptr - 1);
+}
+
+template <class _Tp>
+static void __test() {
+  static const int __radixes[] = {10, 10, 16, 2, 8, 36, 7};
+  for (int __i = 0; __i != 5000; ++__i) {
+    const unsigned long long __lo = __random();
+    _Tp __v                       = static_cast<_Tp>(__lo >> (__random() % 64));
+#ifndef _LIBCPP_HAS_NO_INT128
+    if (sizeof(_Tp) == 16)
+      __v = static_cast<_Tp>((static_cast<__uint128_t>(__random()) << 64 | __lo) >> (__random() % 128));
+#endif
+    for (int __b : __radixes)
+      __round_trip(__v, __b);
+  }
+  for (int __b : __radixes) {
+    __round_trip(_Tp(0), __b);
+    __round_trip(static_cast<_Tp>(~_Tp(0)), __b);
+    __round_trip(static_cast<_Tp>(static_cast<std::make_unsigned_t<_Tp>>(~_Tp(0)) >> 1), __b);
+    if (std::is_signed<_Tp>::value)
+      __round_trip(static_cast<_Tp>(static_cast<std::make_unsigned_t<_Tp>>(1) << (sizeof(_Tp) * 8 - 1)), __b);
+  }
+}
+
+// from_chars of the whole of __s into a variable holding __v, which must
+// consume __used characters with __ec; returns the variable.
+template <class _Tp>
+static _Tp __parse(const char *__s, _Tp __v, errc __ec, size_t __used, int __base = 10) {
+  const std::from_chars_result __r = std::from_chars(__s, __s + __builtin_strlen(__s), __v, __base);
+  assert(__r.ec == __ec && static_cast<size_t>(__r.ptr - __s) == __used);
+  return __v;
+}
+
+int main(int, char **) {
+  __test<char>();
+  __test<signed char>();
+  __test<unsigned char>();
+  __test<short>();
+  __test<unsigned short>();
+  __test<int>();
+  __test<unsigned>();
+  __test<long>();
+  __test<unsigned long>();
+  __test<long long>();
+  __test<unsigned long long>();
+  __test<wchar_t>();
+  __test<char16_t>();
+  __test<char32_t>();
+#ifndef _LIBCPP_HAS_NO_INT128
+  __test<__int128_t>();
+  __test<__uint128_t>();
+#endif
+
+  // Out of range consumes every digit and leaves the value alone.
+  assert(__parse("255", static_cast<unsigned char>(0), errc(), 3) == 255);
+  assert(__parse("256", static_cast<unsigned char>(7), errc::result_out_of_range, 3) == 7);
+  assert(__parse("-128", static_cast<signed char>(0), errc(), 4) == -128);
+  assert(__parse("-129", static_cast<signed char>(1), errc::result_out_of_range, 4) == 1);
+  assert(__parse("128", static_cast<signed char>(1), errc::result_out_of_range, 3) == 1);
+  assert(__parse("4294967296", 0u, errc::result_out_of_range, 10) == 0u);
+  assert(__parse("18446744073709551615", 0ull, errc(), 20) == ~0ull);
+  assert(__parse("18446744073709551616", 1ull, errc::result_out_of_range, 20) == 1);
+  assert(__parse("99999999999999999999", 1ull, errc::result_out_of_range, 20) == 1);
+  assert(__parse("123456789012345678901234567890", 1ull, errc::result_out_of_range, 30) == 1);
+  assert(__parse("-9223372036854775808", 0ll, errc(), 20) == -9223372036854775807ll - 1);
+  assert(__parse("-9223372036854775809", 0ll, errc::result_out_of_range, 20) == 0);
+#ifndef _LIBCPP_HAS_NO_INT128
+  assert(__parse("340282366920938463463374607431768211455", static_cast<__uint128_t>(0), errc(), 39) ==
+         ~static_cast<__uint128_t>(0));
+  assert(__parse("340282366920938463463374607431768211456", static_cast<__uint128_t>(0), errc::result_out_of_range,
+                 39) == 0);
+#endif
+
+  // No digits, or a sign the type cannot take, is invalid and consumes nothing.
+  assert(__parse("-", 5, errc::invalid_argument, 0) == 5);
+  assert(__parse("x1", 5, errc::invalid_argument, 0) == 5);
+  assert(__parse("+5", 5, errc::invalid_argument, 0) == 5);
+  assert(__parse("-5", 5u, errc::invalid_argument, 0) == 5u);
+
+  // Leading zeros do not count against the digit limit, and the chunked
+  // parse stops at the first non-digit.
+  assert(__parse("000000000000000000000000000000018446744073709551615xyz", 0ull, errc(), 51) == ~0ull);
+  assert(__parse("1234567890123456 ", 0ull, errc(), 16) == 1234567890123456ull);
+  assert(__parse("12345678,", 0u, errc(), 8) == 12345678u);
+  assert(__parse("123456781234567812345678x", 0ull, errc::result_out_of_range, 24) == 0);
+  assert(__parse("1234567812345678123", 0ull, errc(), 19) == 1234567812345678123ull);
+
+  // Other bases take either case.
+  assert(__parse("ffFFffFF", 0u, errc(), 8, 16) == 0xffffffffu);
+  assert(__parse("1ffFFffFF", 0u, errc::result_out_of_range, 9, 16) == 0u);
+  assert(__parse("-zz", 0, errc(), 3, 36) == -(35 * 36 + 35));
+  assert(__parse("1012", 0, errc(), 3, 2) == 5);
+
+  char __b[1];
+  const std::to_chars_result __r = std::to_chars(__b, __b, -1);
+  assert(__r.ec == errc::value_too_large && __r.ptr == __b);
+
+  return 0;
+}
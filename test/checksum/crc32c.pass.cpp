@@ -0,0 +1,80 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <__checksum>
+
+// unsigned __crc32c(const byte* p, size_t n, unsigned crc = 0) noexcept;
+
+// The check value, then every implementation against a bitwise reference at
+// all lengths up to 1000 and random ones beyond, misaligned, and continued.
+
+// UNSUPPORTED: c++11, c++14
+
+#include "__checksum.hh"
+
+#include <cassert>
+#include <stddef.h>
+
+using std::byte;
+
+#if __cplusplus > 201703L
+constexpr unsigned __constant() {
+  byte __b[9] = {};
+  for (int __i = 0; __i < 9; ++__i)
+    __b[__i] = byte('1' + __i);
+  return std::__crc32c(__b, 9);
+}
+static_assert(__constant() == 0xE3069283u);
+#endif
+
+static unsigned __reference(const unsigned char *__p, size_t __n, unsigned __c) {
+  __c = ~__c;
+  for (size_t __i = 0; __i < __n; ++__i) {
+    __c ^= __p[__i];
+    for (int __k = 0; __k < 8; ++__k)
+      __c = (__c >> 1) ^ ((__c & 1) ? 0x82f63b78u : 0);
+  }
+  return ~__c;
+}
+
+static unsigned long long __state = 88172645463325252ull;
+static unsigned __random() {
+  __state ^= __state << 13;
+  __state ^= __state >> 7;
+  __state ^= __state << 17;
+  return static_cast<unsigned>(__state);
+}
+
+int main(int, char **) {
+  assert(std::__crc32c(reinterpret_cast<const byte *>("123456789"), 9) == 0xE3069283u);
+  assert(std::__crc32c(nullptr, 0) == 0 && std::__crc32c(nullptr, 0, 42) == 42);
+
+  static unsigned char __buf[20000];
+  for (unsigned char &__c : __buf)
+    __c = static_cast<unsigned char>(__random());
+  for (int __it = 0; __it < 3000; ++__it) {
+    const size_t __off    = __random() % 64;
+    const size_t __n      = __it < 1000 ? static_cast<size_t>(__it) : __random() % (sizeof(__buf) - 64);
+    const unsigned __seed = __random();
+    const unsigned char *__p = __buf + __off;
+    const byte *__bp         = reinterpret_cast<const byte *>(__p);
+    const unsigned __r       = __reference(__p, __n, __seed);
+    assert(std::__crc32c(__bp, __n, __seed) == __r);
+    assert(std::__crc32c_impl::__software_entry(__p, __n, ~__seed) == ~__r);
+#ifdef _LIBCPP_HAS_CRC32C_X86
+    if (__builtin_cpu_supports("sse4.2")) {
+      assert(~std::__crc32c_impl::__sse42(__p, __n, ~__seed) == __r);
+      if (__builtin_cpu_supports("pclmul"))
+        assert(~std::__crc32c_impl::__sse42_pclmul(__p, __n, ~__seed) == __r);
+    }
+#endif
+    const size_t __k = __n / 3;
+    assert(std::__crc32c(__bp + __k, __n - __k, std::__crc32c(__bp, __k)) == std::__crc32c(__bp, __n));
+  }
+  return 0;
+}
@@ -0,0 +1,53 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <__checksum>
+
+// unsigned long long __xxhash64(const byte* p, size_t n, unsigned long long seed = 0) noexcept;
+
+// UNSUPPORTED: c++11, c++14
+
+#include "__checksum.hh"
+
+#include <cassert>
+#include <stddef.h>
+
+using std::byte;
+
+#if __cplusplus > 201703L
+constexpr unsigned long long __constant() {
+  byte __b[3] = {byte('a'), byte('b'), byte('c')};
+  return std::__xxhash64(__b, 3);
+}
+static_assert(__constant() == 0x44BC2CF5AD770999ull);
+#endif
+
+static const byte *__bytes(const char *__s) { return reinterpret_cast<const byte *>(__s); }
+
+int main(int, char **) {
+  // The reference implementation's values.
+  assert(std::__xxhash64(__bytes(""), 0) == 0xEF46DB3751D8E999ull);
+  assert(std::__xxhash64(__bytes("abc"), 3) == 0x44BC2CF5AD770999ull);
+
+  // Every tail length, through the 32-byte stripes: the hash does not depend
+  // on the alignment and changes with each byte and with the seed.
+  static unsigned char __buf[200], __moved[201];
+  for (int __i = 0; __i < 200; ++__i)
+    __buf[__i] = __moved[__i + 1] = static_cast<unsigned char>(__i * 37 + 11);
+  for (size_t __n = 1; __n <= 200; ++__n) {
+    const byte *__p         = reinterpret_cast<const byte *>(__buf);
+    const unsigned long long __h = std::__xxhash64(__p, __n);
+    assert(std::__xxhash64(reinterpret_cast<const byte *>(__moved + 1), __n) == __h);
+    assert(std::__xxhash64(__p, __n, 1) != __h);
+    assert(std::__xxhash64(__p, __n - 1) != __h);
+    __buf[__n - 1] ^= 1;
+    assert(std::__xxhash64(__p, __n) != __h);
+    __buf[__n - 1] ^= 1;
+  }
+  return 0;
+}
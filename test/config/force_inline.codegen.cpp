@@ -0,0 +1,42 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// _LIBCPP_FORCE_INLINE: swap, swap_ranges, iter_swap and __invoke leave no
+// call behind even at -O0.
+
+// UNSUPPORTED: c++11, c++14
+// CODEGEN_FLAGS: -O0
+
+#include "type_traits.hh"
+
+struct S {
+  int __v;
+  int get() const { return __v; }
+};
+
+// CHECK-LABEL: swap_ints
+// CHECK-NOT: call.*4swap
+extern "C" void swap_ints(int &__a, int &__b) { std::swap(__a, __b); }
+
+// CHECK-LABEL: swap_arrays
+// CHECK-NOT: call.*4swap
+// CHECK-NOT: call.*11swap_ranges
+extern "C" void swap_arrays(int (&__a)[4], int (&__b)[4]) { std::swap(__a, __b); }
+
+// CHECK-LABEL: iter_swap_ptrs
+// CHECK-NOT: call.*9iter_swap
+// CHECK-NOT: call.*4swap
+extern "C" void iter_swap_ptrs(long *__a, long *__b) { std::iter_swap(__a, __b); }
+
+// CHECK-LABEL: invoke_pmf
+// CHECK-NOT: call.*8__invoke
+extern "C" int invoke_pmf(const S &__s) { return std::__invoke(&S::get, __s); }
+
+// CHECK-LABEL: invoke_pmd
+// CHECK-NOT: call.*8__invoke
+extern "C" int invoke_pmd(S *__s) { return std::__invoke(&S::__v, __s); }
@@ -0,0 +1,41 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// The code generation hints reach the optimizer: prefetches are emitted,
+// __assume_aligned allows aligned vector loads, and swap_ranges over plain
+// pointers vectorizes without an overlap check.
+
+// UNSUPPORTED: c++11, c++14
+// CODEGEN_FLAGS: -O3 -fno-unroll-loops
+
+#include "memory.hh"
+#include "type_traits.hh"
+
+// CHECK-LABEL: prefetch_read
+// CHECK: prefetcht0
+extern "C" void prefetch_read(const int *__p) { std::__libcpp_prefetch<0, 3>(__p); }
+
+// CHECK-LABEL: prefetch_nta
+// CHECK: prefetchnta
+extern "C" void prefetch_nta(const int *__p) { std::__libcpp_prefetch<0, 0>(__p); }
+
+// CHECK-LABEL: sum_aligned
+// CHECK-NOT: movups
+// CHECK-NOT: movdqu
+// CHECK: (movaps|movdqa|paddd).*\(%
+extern "C" int sum_aligned(const int *__p) {
+  const int *__q = std::__assume_aligned<16>(__p);
+  int __s        = 0;
+  for (int __i = 0; __i != 64; ++__i)
+    __s += __q[__i];
+  return __s;
+}
+
+// CHECK-LABEL: swap_blocks
+// CHECK: xmm
+extern "C" void swap_blocks(int *__a, int *__b, int __n) { std::swap_ranges(__a, __a + __n, __b); }
@@ -0,0 +1,106 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <deferred_log>
+
+// template <fixed-string Fmt, class... Args>
+//     bool deferred_log(log_ring<Bytes>& ring, const Args&... args);
+// template <class F> size_t log_ring<Bytes>::consume(F&& f);
+// size_t log_ring<Bytes>::dropped() const noexcept;
+
+// Records of each kind of argument come back formatted as format_to_n
+// formats the arguments, with the site describing them; a full ring drops
+// and counts the record; records keep their order across the wrap.
+
+// UNSUPPORTED: c++11, c++14, c++17
+
+#include "deferred_log.hh"
+
+#include <cassert>
+#include <stddef.h>
+
+enum class __color : unsigned char { __red = 3 };
+
+static bool __is(const std::log_record &__rec, const char *__want) {
+  char __buf[256];
+  const std::format_to_n_result<char *> __r = __rec.format_to(__buf, sizeof(__buf));
+  const size_t __n                          = __builtin_strlen(__want);
+  return __r.size == static_cast<ptrdiff_t>(__n) && __builtin_memcmp(__buf, __want, __n) == 0;
+}
+
+template <std::__fixed_string _Fmt, class... _Args>
+static bool __is(const std::log_record &__rec, const _Args &...__args) {
+  char __want[256];
+  const std::format_to_n_result<char *> __w = std::format_to_n<_Fmt>(__want, sizeof(__want) - 1, __args...);
+  *__w.out                                  = 0;
+  return __builtin_strcmp(__rec.site->format, _Fmt.__c_) == 0 && __is(__rec, __want);
+}
+
+int main(int, char **) {
+  static std::log_ring<256> __ring;
+
+  // Each kind of argument; an array without a null, a null pointer.
+  {
+    const char __arr[4]  = {'x', 'y', 'z', 'w'};
+    const char *__none   = nullptr;
+    const char *__string = "abc";
+    assert((std::deferred_log<"{} {} {} {:>5}|{}|{}|{}|{}">(__ring, 42u, -7, true, 'c', __arr, __none, __color::__red,
+                                                          __string)));
+    assert(std::deferred_log<"x={:.3f}">(__ring, 3.25f));
+    int __k = 0;
+    assert(__ring.consume([&](const std::log_record &__rec) {
+      if (__k++ == 0) {
+        assert(__is(__rec, "42 -7 true     c|xyzw||3|abc"));
+        assert(__rec.site->args == 8);
+        assert(__builtin_strcmp(__rec.site->arg_types, "uibcssus") == 0);
+        assert(__rec.site->arg_sizes[0] == 4 && __rec.site->arg_sizes[1] == 4 && __rec.site->arg_sizes[2] == 1);
+        assert(__rec.site->arg_sizes[4] == 0 && __rec.site->arg_sizes[6] == 1);
+        // Five fixed-size arguments, then each string as a length, its bytes and a null.
+        assert(__rec.size == (4 + 4 + 1 + 1 + 1) + (4 + 4 + 1) + (4 + 0 + 1) + (4 + 3 + 1));
+      } else
+        assert(__is(__rec, "x=3.250"));
+    }) == 2);
+    assert(__ring.consume([](const std::log_record &) { assert(false); }) == 0);
+  }
+
+  // A string is cut at its null or the end of its array, whatever its length.
+  {
+    char __text[300];
+    for (size_t __i = 0; __i != sizeof(__text); ++__i)
+      __text[__i] = static_cast<char>('a' + __i % 26);
+    __text[100] = 0;
+    assert(std::deferred_log<"[{}]">(__ring, __text));
+    assert(__ring.consume([&](const std::log_record &__rec) { assert(__is<"[{}]">(__rec, __text)); }) == 1);
+    __text[100] = 'u';
+    assert(!std::deferred_log<"[{}]">(__ring, __text)); // more than the ring
+    assert(__ring.dropped() == 1);
+  }
+
+  // Fill the ring until a record is dropped, then go round it.
+  {
+    size_t __pushed = 0;
+    while (std::deferred_log<"{}">(__ring, 1234567890123ll))
+      ++__pushed;
+    assert(__pushed > 0 && __ring.dropped() == 2);
+    assert(__ring.consume([](const std::log_record &__rec) { assert(__is(__rec, "1234567890123")); }) == __pushed);
+    for (int __round = 0; __round != 100; ++__round) {
+      assert(std::deferred_log<"{}-{}">(__ring, __round, "hello world"));
+      assert(std::deferred_log<"{:x}">(__ring, __round));
+      int __k = 0;
+      assert(__ring.consume([&](const std::log_record &__rec) {
+        if (__k++ == 0)
+          assert((__is<"{}-{}">(__rec, __round, "hello world")));
+        else
+          assert(__is<"{:x}">(__rec, __round));
+      }) == 2);
+    }
+    assert(__ring.dropped() == 2);
+  }
+
+  return 0;
+}
@@ -0,0 +1,61 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <deferred_log>
+
+// template <fixed-string Fmt, class... Args>
+//     bool deferred_log(log_ring<Bytes>& ring, const Args&... args);
+// template <class F> size_t log_ring<Bytes>::consume(F&& f);
+
+// One thread logs into a small ring, retrying what is dropped, while this
+// one consumes: every record arrives once, whole and in order.
+
+// UNSUPPORTED: c++11, c++14, c++17
+// ADDITIONAL_COMPILE_FLAGS: -pthread
+
+#include "deferred_log.hh"
+
+#include <cassert>
+#include <pthread.h>
+#include <stddef.h>
+
+static const long __count = 300000;
+
+static std::log_ring<1 << 12> __ring;
+static int __done = 0;
+
+static void *__produce(void *) {
+  for (long __i = 0; __i != __count; ++__i)
+    while (!std::deferred_log<"i={} s={} d={}">(__ring, __i, __i % 3 == 0 ? "abc" : "de", 0.5))
+      ;
+  std::__libcpp_atomic_store(&__done, 1, std::_AO_Release);
+  return nullptr;
+}
+
+int main(int, char **) {
+  pthread_t __producer;
+  const int __created = pthread_create(&__producer, nullptr, &__produce, nullptr);
+  assert(__created == 0);
+
+  long __seen = 0;
+  char __buf[64], __want[64];
+  for (bool __last = false; !__last;) {
+    __last = std::__libcpp_atomic_load(&__done, std::_AO_Acquire) != 0;
+    __ring.consume([&](const std::log_record &__rec) {
+      const std::format_to_n_result<char *> __r = __rec.format_to(__buf, sizeof(__buf));
+      const std::format_to_n_result<char *> __w =
+          std::format_to_n<"i={} s={} d={}">(__want, sizeof(__want), __seen, __seen % 3 == 0 ? "abc" : "de", 0.5);
+      assert(__r.size == __w.size && __builtin_memcmp(__buf, __want, static_cast<size_t>(__w.size)) == 0);
+      ++__seen;
+    });
+  }
+  pthread_join(__producer, nullptr);
+  assert(__seen == __count);
+
+  return 0;
+}
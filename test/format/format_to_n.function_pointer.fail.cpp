@@ -0,0 +1,21 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <format>
+
+// A function pointer is not formatted as a pointer, as std::format does not
+// format it either; the error names the argument rather than a cast.
+
+// UNSUPPORTED: c++11, c++14, c++17
+
+#include "format.hh"
+
+void h();
+
+// EXPECTED-ERROR: a function pointer cannot be formatted
+void f(char *__b) { (void)std::format_to_n<"{}">(__b, 8, &h); }
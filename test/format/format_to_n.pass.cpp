@@ -0,0 +1,111 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <format>
+
+// template <fixed-string Fmt, class... Args>
+//     format_to_n_result<char*> format_to_n(char* out, ptrdiff_t n, const Args&... args);
+// template <fixed-string Fmt, class... Args>
+//     size_t formatted_size(const Args&... args);
+
+// Each kind of argument with each part of the spec, checked against the
+// text, the size format_to_n reports and formatted_size; then output cut
+// short by n.
+
+// UNSUPPORTED: c++11, c++14, c++17
+
+#include "format.hh"
+
+#include <cassert>
+#include <stddef.h>
+
+enum class __scoped : short { __a = -3 };
+enum __plain { __seven = 7 };
+
+template <std::__fixed_string _Fmt, class... _Args>
+static bool __is(const char *__want, const _Args &...__args) {
+  char __buf[512];
+  const std::format_to_n_result<char *> __r = std::format_to_n<_Fmt>(__buf, sizeof(__buf), __args...);
+  const size_t __n                          = __builtin_strlen(__want);
+  return __r.size == static_cast<ptrdiff_t>(__n) && __r.out == __buf + __n &&
+         __builtin_memcmp(__buf, __want, __n) == 0 && std::formatted_size<_Fmt>(__args...) == __n;
+}
+
+int main(int, char **) {
+  assert(__is<"plain">("plain"));
+  assert(__is<"{{}} a{{b}}c">("{} a{b}c"));
+  assert((__is<"x={} y={}">("x=42 y=-7", 42, -7)));
+  assert((__is<"{1} {0}">("2 1", 1, 2)));
+
+  // Integers.
+  assert((__is<"{:x} {:X} {:#x} {:#X} {:b} {:#b} {:#B} {:o} {:#o} {:#o}">("ff FF 0xff 0XFF 11 0b11 0B11 17 017 0", 255,
+                                                                           255, 255, 255, 3, 3, 3, 15, 15, 0)));
+  assert((__is<"{:+} {:+} {: } {:-}">("+5 -5  5 -5", 5, -5, 5, -5)));
+  assert((__is<"{:5}|{:<5}|{:^4}|{:06}|{:06}|{:#06x}">("   42|42   | 42 |000042|-00042|0x002a", 42, 42, 42, 42, -42,
+                                                        42)));
+  assert((__is<"{:*>4}|{:*<4}|{:*^5}">("**42|42**|*42**", 42, 42, 42)));
+  assert((__is<"{} {}">("-9223372036854775808 18446744073709551615", -9223372036854775807ll - 1, ~0ull)));
+  assert((__is<"{:c}{:c}|{:*^3c}|{:3c}|{:c}">("Az|*B*|C  |\xe9", 65, 'z', 66, 67u, 233)));
+
+  // bool, char and enumerations.
+  assert((__is<"{} {} {:d} {} {:d} {:x} {:4}|{:>3}">("true false 1 x 120 78 x   |  y", true, false, true, 'x', 'x', 'x',
+                                                      'x', 'y')));
+  assert((__is<"{} {} {:x}">("-3 7 7", __scoped::__a, __seven, __seven)));
+  assert((__is<"{:c}|{:<3c}|{:>2c}">("\x01|\x01  | \x01", true, true, true)));
+  {
+    char __b[4];
+    assert(std::format_to_n<"{:c}">(__b, sizeof(__b), false).size == 1 && __b[0] == 0);
+  }
+
+  // Floating point, shortest without a precision.
+  assert((__is<"{} {} {} {:e} {:f} {:g} {:a} {:E} {:F}">("1.5 0.1 1e+100 1.5e+00 0.001 1e+06 1.8p+1 1E+100 INF", 1.5,
+                                                          0.1, 1e100, 1.5, 0.001, 1e6, 3.0, 1e100,
+                                                          __builtin_inf())));
+  assert((__is<"{:5}|{:+}|{:05}|{:06}|{: }">("  1.5|+1.5|-01.5|   inf| 0.5", 1.5, 1.5, -1.5, __builtin_inf(), 0.5f)));
+
+  // and as printf with one, general when there is no type.
+  assert((__is<"{}: {:>8.3}|{:#x}">("id:      1.5|0xff", "id", 1.5, 255u)));
+  assert((__is<"{:.3f} {:.2f} {:.2f} {:.0f} {:.0f}">("2.675 2.67 0.12 2 4", 2.675, 2.675, 0.125, 2.5, 3.5)));
+  assert((__is<"{:.20f}|{:.10f}|{:.1f}">("0.10000000000000000555|0.1000000015|-0.0", 0.1, 0.1f, -0.01)));
+  assert((__is<"{:.0e} {:.3e} {:.2E} {:.3a} {:.0a}">("2e+01 1.235e+05 1.00E-300 1.000p+0 2p+0", 25.0, 123456.0,
+                                                     1e-300, 1.0, 1.5)));
+  assert((__is<"{:.2} {:.2g} {:.3G} {:.4} {:.1}">("1.2e+03 1.2e+03 1E-10 0.0001 0", 1234.0, 1234.0, 1e-10, 0.0001,
+                                                 0.0)));
+  assert((__is<"{:+010.2f}|{:<9.3e}|{:^9.1f}">("-000003.14|1.000e+00|   2.5   ", -3.14159, 1.0, 2.5)));
+  assert((__is<"{:.4f}|{:.2f}">("10000000000000000000000.0000|8589973504.00", 1e22, 8589973e3f)));
+
+  // Strings, with precision as the most to print, and pointers.
+  assert((__is<"{}|{:.3}|{:>4}|{:4}|{:^4}|{:.9}">("hello|hel|  hi|hi  | hi |hi", "hello", "hello", "hi", "hi", "hi",
+                                                 "hi")));
+  {
+    const char *__s = "str";
+    char __a[4]     = {'a', 'b', 'c', 'd'};
+    assert((__is<"{} {}">("str abcd", __s, __a)));
+  }
+  {
+    int __x;
+    void *__p = &__x;
+    char __want[64];
+    __builtin_memcpy(__want, "0x", 2);
+    char *__e = std::to_chars(__want + 2, __want + 60, reinterpret_cast<__UINTPTR_TYPE__>(__p), 16).ptr;
+    __builtin_memcpy(__e, "|0x0", 5);
+    assert((__is<"{}|{}">(__want, __p, nullptr)));
+  }
+
+  // Cut short, the size is still that of the whole output.
+  {
+    char __b[6]                               = "#####";
+    const std::format_to_n_result<char *> __r = std::format_to_n<"{}-{}">(__b, 4, 12345, "abc");
+    assert(__r.size == 9 && __r.out == __b + 4 && __builtin_memcmp(__b, "1234#", 5) == 0);
+    const std::format_to_n_result<char *> __z = std::format_to_n<"{:>10}">(__b, 0, 1);
+    assert(__z.size == 10 && __z.out == __b);
+    assert(std::format_to_n<"{:.3f}">(__b, -1, 1.0).size == 5);
+  }
+
+  return 0;
+}
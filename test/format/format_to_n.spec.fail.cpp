@@ -0,0 +1,22 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <format>
+
+// A spec that does not fit its argument is an error at compile time: a
+// precision on an integer, and a sign with type c.
+
+// UNSUPPORTED: c++11, c++14, c++17
+
+#include "format.hh"
+
+// EXPECTED-ERROR: precision is for strings and floating-point values
+void f(char *__b) { (void)std::format_to_n<"{:.2}">(__b, 8, 1); }
+
+// EXPECTED-ERROR: sign, '#' and '0' are for numbers
+void g(char *__b) { (void)std::format_to_n<"{:+c}">(__b, 8, 65); }
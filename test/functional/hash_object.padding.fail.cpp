@@ -0,0 +1,23 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <functional>
+
+// __hash_object rejects a type with padding: equal values could hash apart.
+
+// UNSUPPORTED: c++11, c++14
+
+#include "functional.hh"
+
+struct Padded {
+  char __c;
+  int __i;
+};
+
+// EXPECTED-ERROR: __hash_object requires a type with unique object representations
+void f(const Padded &__p) { (void)std::__hash_object(__p); }
@@ -0,0 +1,77 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <functional>
+
+// size_t __hash_memory(const void* p, size_t n, size_t seed = 0);
+// template <class T> size_t __hash_object(const T& v);                      // C++17
+// template <class T> size_t __hash_object_range(const T* p, size_t n);      // C++17
+// template <class T> struct __object_hash;                                 // C++17
+
+#include "functional.hh"
+
+#include <cassert>
+#include <stddef.h>
+
+typedef unsigned long long u64;
+
+// The 64x64->128 multiply, folded, done by hand in 32-bit halves.
+static u64 folded_multiply(u64 __a, u64 __b) {
+  const u64 __ha = __a >> 32, __la = static_cast<unsigned>(__a);
+  const u64 __hb = __b >> 32, __lb = static_cast<unsigned>(__b);
+  const u64 __hh = __ha * __hb, __hl = __ha * __lb, __lh = __la * __hb, __ll = __la * __lb;
+  const u64 __t  = __ll + (__hl << 32);
+  const u64 __lo = __t + (__lh << 32);
+  const u64 __hi = __hh + (__hl >> 32) + (__lh >> 32) + (__t < __ll) + (__lo < __t);
+  return __lo ^ __hi;
+}
+
+struct K {
+  int __a;
+  unsigned __b;
+  long long __c;
+};
+
+int main() {
+  u64 __x = 88172645463325252ULL;
+  for (int __i = 0; __i != 100000; ++__i) {
+    __x ^= __x << 13;
+    __x ^= __x >> 7;
+    __x ^= __x << 17;
+    const u64 __y = __x * 0x9E3779B97F4A7C15ULL;
+    assert(folded_multiply(__x, __y) == std::__hash_memory_impl::__mix(__x, __y));
+  }
+  assert(folded_multiply(~0ULL, ~0ULL) == std::__hash_memory_impl::__mix(~0ULL, ~0ULL));
+
+  // Every length, and every byte of the input, changes the hash.
+  unsigned char __buf[300];
+  for (int __i = 0; __i != 300; ++__i)
+    __buf[__i] = static_cast<unsigned char>(__i * 7);
+  static size_t __hs[301];
+  for (size_t __n = 0; __n <= 300; ++__n) {
+    __hs[__n] = std::__hash_memory(__buf, __n);
+    for (size_t __m = 0; __m != __n; ++__m)
+      assert(__hs[__n] != __hs[__m]);
+  }
+  for (size_t __n = 1; __n <= 200; ++__n)
+    for (size_t __j = 0; __j != __n; ++__j) {
+      __buf[__j] ^= 1;
+      assert(std::__hash_memory(__buf, __n) != __hs[__n]);
+      __buf[__j] ^= 1;
+    }
+  assert(std::__hash_memory(__buf, 10, 1) != std::__hash_memory(__buf, 10, 2));
+
+#if _LIBCPP_STD_VER > 14
+  K __k1{1, 2, 3}, __k2{1, 2, 3}, __k3{1, 2, 4}, __arr[2] = {{1, 2, 3}, {4, 5, 6}};
+  assert(std::__hash_object(__k1) == std::__hash_object(__k2));
+  assert(std::__hash_object(__k1) != std::__hash_object(__k3));
+  assert(std::__hash_object(__arr) == std::__hash_object_range(__arr, 2));
+  assert(std::__object_hash<K>()(__k1) == std::__hash_object(__k1));
+#endif
+  return 0;
+}
@@ -0,0 +1,61 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <functional>
+
+// template <class T> class reference_wrapper;
+// template <class T> reference_wrapper<T> ref(T& t) noexcept;
+// template <class T> reference_wrapper<const T> cref(const T& t) noexcept;
+
+// A wrapper binds to lvalues only, converts back to the reference, calls
+// through __invoke, and rebinds on assignment; ref and cref unwrap wrappers.
+
+#include "functional.hh"
+
+#include <cassert>
+
+struct Counter {
+  int __n = 0;
+  int bump(int __by) { return __n += __by; }
+  int operator()(int __x) const { return __x * 2; }
+};
+
+int twice(int __x) { return 2 * __x; }
+
+static_assert(std::is_constructible<std::reference_wrapper<int>, int &>::value, "");
+static_assert(!std::is_constructible<std::reference_wrapper<int>, int>::value, "");
+static_assert(!std::is_constructible<std::reference_wrapper<const int>, int &&>::value, "");
+static_assert(std::is_convertible<int &, std::reference_wrapper<int> >::value, "");
+static_assert(std::is_nothrow_constructible<std::reference_wrapper<int>, int &>::value, "");
+static_assert(std::is_trivially_copyable<std::reference_wrapper<Counter> >::value, "");
+static_assert(std::is_same<decltype(std::cref(std::declval<int &>())), std::reference_wrapper<const int> >::value,
+              "");
+
+int main(int, char **) {
+  int __i = 1, __j = 2;
+  std::reference_wrapper<int> __r = __i;
+  assert(&__r.get() == &__i && &static_cast<int &>(__r) == &__i);
+  __r.get() = 5;
+  assert(__i == 5);
+  __r = std::ref(__j);
+  assert(&__r.get() == &__j && __i == 5);
+
+  std::reference_wrapper<const int> __c = std::cref(__r);
+  assert(&__c.get() == &__j);
+  assert(&std::ref(__r).get() == &__j);
+
+  Counter __counter;
+  std::reference_wrapper<Counter> __w = std::ref(__counter);
+  assert(__w(21) == 42);
+  assert(std::__invoke(&Counter::bump, __w, 3) == 3 && __counter.__n == 3);
+  assert(std::__invoke(&Counter::__n, __w) == 3);
+
+  std::reference_wrapper<int(int)> __f = twice;
+  assert(__f(4) == 8);
+  return 0;
+}
@@ -0,0 +1,108 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <__hdr_histogram>
+
+// template <class T = unsigned long long, int Precision = 7> class __hdr_histogram;
+
+// Buckets tile the values: each holds what it says, the exact range is
+// exact and wider buckets stay within 1 + 2^-Precision. Both ways of
+// recording count the same; percentiles match a sorted copy of the values
+// to the bucket; __add, __reset, and negative values as 0.
+
+// UNSUPPORTED: c++11, c++14, c++17
+
+#include "__hdr_histogram.hh"
+
+#include <cassert>
+#include <cstdlib>
+#include <stddef.h>
+
+static unsigned long long __random() {
+  static unsigned long long __x = 88172645463325252ull;
+  __x ^= __x << 13;
+  __x ^= __x >> 7;
+  __x ^= __x << 17;
+  return __x;
+}
+
+template <class _Hist> static void __check_buckets() {
+  typedef typename _Hist::value_type _Tp;
+  assert(_Hist::__bucket_lowest(0) == 0);
+  for (size_t __i = 0; __i + 1 != _Hist::__buckets; ++__i) {
+    const _Tp __lo = _Hist::__bucket_lowest(__i), __hi = _Hist::__bucket_highest(__i);
+    assert(__lo <= __hi && _Hist::__bucket_lowest(__i + 1) == __hi + 1);
+    assert(_Hist::__bucket_of(__lo) == __i && _Hist::__bucket_of(__hi) == __i);
+  }
+  typedef std::make_unsigned_t<_Tp> _Up;
+  const _Tp __max = static_cast<_Tp>(static_cast<_Up>(~_Up(0)) >> (std::is_signed<_Tp>::value ? 1 : 0));
+  assert(_Hist::__bucket_highest(_Hist::__buckets - 1) == __max && _Hist::__bucket_of(__max) == _Hist::__buckets - 1);
+}
+
+static int __ascending(const void *__a, const void *__b) {
+  const unsigned long long __x = *static_cast<const unsigned long long *>(__a);
+  const unsigned long long __y = *static_cast<const unsigned long long *>(__b);
+  return __x < __y ? -1 : __x > __y;
+}
+
+int main(int, char **) {
+  typedef std::__hdr_histogram<unsigned long long, 7> _Hist;
+  __check_buckets<_Hist>();
+  __check_buckets<std::__hdr_histogram<unsigned, 3>>();
+  __check_buckets<std::__hdr_histogram<short, 2>>();
+  __check_buckets<std::__hdr_histogram<long long, 10>>();
+  static_assert(_Hist::__bucket_of(255) == 255 && _Hist::__bucket_of(256) == 256 && _Hist::__bucket_of(257) == 256);
+  for (size_t __i = 0; __i != _Hist::__buckets; ++__i)
+    assert(_Hist::__bucket_highest(__i) - _Hist::__bucket_lowest(__i) <= _Hist::__bucket_lowest(__i) >> 7);
+
+  static _Hist __a, __b;
+  assert(__a.__total() == 0 && __a.__percentile(50) == 0);
+
+  static unsigned long long __v[20000];
+  for (unsigned long long &__x : __v) {
+    const unsigned long long __r = __random();
+    __x                          = (__r >> 20) >> (__r & 63);
+  }
+  for (size_t __i = 0; __i != 20000; ++__i) {
+    if (__i % 2 == 0)
+      __a.__record(__v[__i]);
+    else
+      __a.__record_local(__v[__i]);
+    __b.__record_local(__v[__i]);
+  }
+  assert(__a.__total() == 20000);
+  for (size_t __i = 0; __i != _Hist::__buckets; ++__i)
+    assert(__a.__count(__i) == __b.__count(__i));
+
+  std::qsort(__v, 20000, sizeof(__v[0]), __ascending);
+  const double __p[] = {0, 0.005, 1, 25, 50, 90, 99, 99.99, 100};
+  unsigned long long __out[9];
+  __a.__percentiles(__p, __out, 9);
+  for (size_t __k = 0; __k != 9; ++__k) {
+    const unsigned long long __want = __v[std::__hdr_rank(__p[__k], 20000) - 1];
+    assert(__out[__k] == _Hist::__bucket_highest(_Hist::__bucket_of(__want)));
+    assert(__a.__percentile(__p[__k]) == __out[__k]);
+  }
+  assert(__a.__percentile(100) == _Hist::__bucket_highest(_Hist::__bucket_of(__v[19999])));
+
+  __a.__record(7, 5);
+  __a.__record_local(7, 5);
+  assert(__a.__count(7) == __b.__count(7) + 10);
+  __a.__add(__b);
+  assert(__a.__total() == 40010 && __a.__count(7) == 2 * __b.__count(7) + 10);
+  __a.__reset();
+  assert(__a.__total() == 0 && __a.__percentile(99) == 0);
+
+  std::__hdr_histogram<int, 4> __s;
+  __s.__record(-5);
+  __s.__record(-1000000);
+  __s.__record(3);
+  assert(__s.__count(0) == 2 && __s.__count(3) == 1 && __s.__percentile(50) == 0 && __s.__percentile(100) == 3);
+
+  return 0;
+}
@@ -0,0 +1,80 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <__hdr_histogram>
+
+// template <class Histogram, size_t N> class __sharded_hdr_histogram;
+
+// Four threads record with __record_local, each into a shard of its own,
+// and with __record into one they share; nothing is lost. The shards read
+// together as the histogram they merge into, and __shard(i) is shard i % N.
+
+// UNSUPPORTED: c++11, c++14, c++17
+// ADDITIONAL_COMPILE_FLAGS: -pthread
+
+#include "__hdr_histogram.hh"
+
+#include <cassert>
+#include <pthread.h>
+#include <stddef.h>
+
+typedef std::__hdr_histogram<unsigned, 5> _Hist;
+
+static const unsigned __per_thread = 200000;
+
+static std::__sharded_hdr_histogram<_Hist, 6> __sharded;
+
+static unsigned __value(unsigned __t, unsigned __i) { return (__i * 2654435761u + __t) >> (__i % 24); }
+
+static void *__produce(void *__arg) {
+  const unsigned __t = static_cast<unsigned>(reinterpret_cast<size_t>(__arg));
+  for (unsigned __i = 0; __i != __per_thread; ++__i) {
+    __sharded.__record_local(__t, __value(__t, __i));
+    __sharded.__record(5, __i % 1000, 2);
+  }
+  return nullptr;
+}
+
+int main(int, char **) {
+  assert(&__sharded.__shard(1) == &__sharded.__shard(7) && &__sharded.__shard(0) != &__sharded.__shard(1));
+
+  pthread_t __threads[4];
+  for (size_t __t = 0; __t != 4; ++__t) {
+    const int __created = pthread_create(&__threads[__t], nullptr, &__produce, reinterpret_cast<void *>(__t));
+    assert(__created == 0);
+  }
+  for (pthread_t __t : __threads)
+    pthread_join(__t, nullptr);
+
+  static _Hist __want[6], __merged;
+  for (unsigned __t = 0; __t != 4; ++__t)
+    for (unsigned __i = 0; __i != __per_thread; ++__i) {
+      __want[__t].__record_local(__value(__t, __i));
+      __want[5].__record_local(__i % 1000, 2);
+    }
+  for (size_t __s = 0; __s != 6; ++__s)
+    for (size_t __b = 0; __b != _Hist::__buckets; ++__b)
+      assert(__sharded.__shard(__s).__count(__b) == __want[__s].__count(__b));
+  assert(__sharded.__total() == 4 * __per_thread * 3);
+
+  __sharded.__merge_into(__merged);
+  assert(__merged.__total() == __sharded.__total());
+  for (size_t __b = 0; __b != _Hist::__buckets; ++__b)
+    assert(__merged.__count(__b) == __sharded.__count(__b));
+  const double __p[] = {0, 10, 50, 66.7, 99, 100};
+  unsigned __got[6], __from[6];
+  __sharded.__percentiles(__p, __got, 6);
+  __merged.__percentiles(__p, __from, 6);
+  for (size_t __k = 0; __k != 6; ++__k)
+    assert(__got[__k] == __from[__k] && __sharded.__percentile(__p[__k]) == __got[__k]);
+
+  __sharded.__reset();
+  assert(__sharded.__total() == 0 && __sharded.__percentile(50) == 0);
+
+  return 0;
+}
@@ -0,0 +1,41 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <memory>
+
+// template <size_t N, class T> T* __assume_aligned(T* ptr);
+// template <size_t N, class T> [[nodiscard]] constexpr T* assume_aligned(T* ptr);   // C++20
+// template <int Rw, int Locality> void __libcpp_prefetch(const void* addr);
+
+#include "memory.hh"
+
+#include <cassert>
+
+alignas(64) static double __d[8];
+
+#if _LIBCPP_STD_VER > 17
+constexpr bool test_constexpr() {
+  int __a[4] = {1, 2, 3, 4};
+  return std::assume_aligned<alignof(int)>(__a) == __a;
+}
+static_assert(test_constexpr(), "");
+#endif
+
+int main() {
+  double *__p = std::__assume_aligned<64>(__d);
+  assert(__p == __d);
+  std::__libcpp_prefetch<0, 3>(__p);
+  std::__libcpp_prefetch<1, 0>(__p + 4);
+#if _LIBCPP_STD_VER > 17
+  assert(std::assume_aligned<32>(__d + 4) == __d + 4);
+#endif
+  if (_LIBCPP_UNLIKELY(__p != __d))
+    return 1;
+  _LIBCPP_ASSUME(__p != nullptr);
+  return 0;
+}
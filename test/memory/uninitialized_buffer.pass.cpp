@@ -0,0 +1,48 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <memory>
+
+// template <class T, size_t N> struct __uninitialized_buffer;
+
+#include "memory.hh"
+
+#include <cassert>
+
+struct alignas(64) Big {
+  char __c[3];
+};
+
+static_assert(alignof(std::__uninitialized_buffer<Big, 3>) == 64, "");
+static_assert(sizeof(std::__uninitialized_buffer<Big, 3>) == 192, "");
+static_assert(sizeof(std::__uninitialized_buffer<int, 0>) == sizeof(int), "");
+
+struct Counted {
+  static int __live;
+  int __v;
+  explicit Counted(int __x) : __v(__x) { ++__live; }
+  ~Counted() { --__live; }
+};
+int Counted::__live = 0;
+
+int main() {
+  std::__uninitialized_buffer<double, 4> __b;
+  __b.__data()[3] = 1.5;
+  assert(__b.__data()[3] == 1.5);
+
+  // Nothing is constructed or destroyed by the buffer itself.
+  {
+    std::__uninitialized_buffer<Counted, 2> __c;
+    assert(Counted::__live == 0);
+    ::new (static_cast<void *>(__c.__data() + 1)) Counted(7);
+    assert(Counted::__live == 1 && __c.__data()[1].__v == 7);
+    __c.__data()[1].~Counted();
+  }
+  assert(Counted::__live == 0);
+  return 0;
+}
@@ -0,0 +1,75 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <__packed_tuple>
+
+// template <class... T> class __packed_tuple;
+
+// UNSUPPORTED: c++11, c++14
+
+#include "__packed_tuple.hh"
+
+#include <cassert>
+
+struct Empty {};
+struct Explicit {
+  int __v;
+  explicit Explicit(int __x) : __v(__x) {}
+  bool operator==(const Explicit &__o) const { return __v == __o.__v; }
+};
+
+template <class... _Tp> struct Declared;
+template <class _A, class _B, class _C, class _D> struct Declared<_A, _B, _C, _D> {
+  _A __a;
+  _B __b;
+  _C __c;
+  _D __d;
+};
+
+using T1 = std::__packed_tuple<char, double, char, int>;
+// Stored by descending alignment: double, int, char, char.
+static_assert(sizeof(T1) == 16 && sizeof(Declared<char, double, char, int>) == 24);
+static_assert(T1::__storage_order[0] == 1 && T1::__storage_order[1] == 3);
+static_assert(T1::__storage_order[2] == 0 && T1::__storage_order[3] == 2);
+static_assert(sizeof(std::__packed_tuple<char, void *, short, Empty, int>) == 16);
+static_assert(std::is_same_v<decltype(std::get<1>(T1{})), double &&>);
+
+constexpr std::__packed_tuple<char, int, char> c('x', 5, 'y');
+static_assert(std::get<0>(c) == 'x' && std::get<1>(c) == 5 && std::get<2>(c) == 'y' && sizeof(c) == 8);
+
+static_assert(!std::is_convertible_v<int, std::__packed_tuple<Explicit>>);
+static_assert(std::is_constructible_v<std::__packed_tuple<Explicit>, int>);
+static_assert(std::is_convertible_v<int, std::__packed_tuple<long>>);
+
+int main() {
+  T1 __t('a', 2.5, 'b', 7);
+  assert(std::get<0>(__t) == 'a' && std::get<1>(__t) == 2.5 && std::get<2>(__t) == 'b' && std::get<3>(__t) == 7);
+  // Back to back in storage order, as the header's static_assert on the size
+  // expects of the ABI.
+  const char *const __base = reinterpret_cast<const char *>(&__t);
+  assert(reinterpret_cast<const char *>(&std::get<1>(__t)) == __base);
+  assert(reinterpret_cast<const char *>(&std::get<3>(__t)) == __base + 8);
+  assert(reinterpret_cast<const char *>(&std::get<0>(__t)) == __base + 12);
+  assert(reinterpret_cast<const char *>(&std::get<2>(__t)) == __base + 13);
+
+  std::get<3>(__t) = 9;
+  T1 __u = __t;
+  assert(__u == __t);
+  std::get<0>(__u) = 'z';
+  assert(__u != __t);
+  swap(__t, __u);
+  assert(std::get<0>(__t) == 'z' && std::get<0>(__u) == 'a');
+  __t.swap(__u);
+  assert(std::get<0>(__t) == 'a');
+
+  std::__packed_tuple<Explicit, int> __e(Explicit(3), 4);
+  assert(std::get<0>(__e) == Explicit(3) && std::get<1>(__e) == 4);
+  std::__packed_tuple<> __z;
+  (void)__z;
+  return 0;
+}
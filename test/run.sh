@@ -0,0 +1,128 @@
+#!/bin/sh
+#===----------------------------------------------------------------------===##
+#
+# Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#
+#===----------------------------------------------------------------------===##
+#
+# Runs the tests under test/, or those whose path contains one of the
+# arguments, with ${CXX:-g++}:
+#
+#   *.pass.cpp     compiled and run at each standard in $STDS; must exit 0
+#   *.fail.cpp     must fail to compile at each standard in $STDS, with every
+#                  "// EXPECTED-ERROR: text" in the diagnostics
+#   *.codegen.cpp  compiled to assembly at the newest standard in $STDS and
+#                  checked function by function:
+#                    // CHECK-LABEL: f    the extern "C" function f
+#                    // CHECK: regex      lines matching in this order in f
+#                    // CHECK-NOT: regex  no line in f matches
+#
+# A test narrows this with
+#   // UNSUPPORTED: c++11, c++14
+#   // ADDITIONAL_COMPILE_FLAGS: -pthread
+#   // CODEGEN_FLAGS: -O2            (codegen tests; the default is -O2)
+# and $CXXFLAGS is added to every compile (e.g. sanitizers).
+
+root=$(cd "$(dirname "$0")/.." && pwd)
+CXX=${CXX:-g++}
+STDS=${STDS:-"c++11 c++14 c++17 c++20"}
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+directive() { sed -n "s|^// $1: *||p" "$2" | head -n 1; }
+
+supported() { # test, std
+  case ", $(directive UNSUPPORTED "$1"), " in
+  *", $2, "*) return 1 ;;
+  esac
+  return 0
+}
+
+compile() { # test, std, extra flags...
+  t=$1 s=$2
+  shift 2
+  # shellcheck disable=SC2086
+  $CXX -std="$s" -Wall -Wextra -I"$root" -I"$root/test/support" -include prelude.h \
+    $(directive ADDITIONAL_COMPILE_FLAGS "$t") $CXXFLAGS "$@" "$t"
+}
+
+run_pass() {
+  for s in $STDS; do
+    supported "$1" "$s" || continue
+    compile "$1" "$s" -O2 -o "$tmp/a.out" >"$tmp/log" 2>&1 || { echo "  $s: does not compile"; cat "$tmp/log"; return 1; }
+    "$tmp/a.out" >"$tmp/log" 2>&1 || { echo "  $s: exits with $?"; cat "$tmp/log"; return 1; }
+  done
+}
+
+run_fail() {
+  for s in $STDS; do
+    supported "$1" "$s" || continue
+    if compile "$1" "$s" -fsyntax-only >"$tmp/log" 2>&1; then
+      echo "  $s: compiles"
+      return 1
+    fi
+    sed -n 's|^// EXPECTED-ERROR: *||p' "$1" | while IFS= read -r e; do
+      grep -qF -- "$e" "$tmp/log" || { echo "  $s: no \"$e\" in the diagnostics"; exit 1; }
+    done || return 1
+  done
+}
+
+run_codegen() {
+  std=
+  for s in $STDS; do supported "$1" "$s" && std=$s; done
+  [ -n "$std" ] || return 0
+  flags=$(directive CODEGEN_FLAGS "$1")
+  # shellcheck disable=SC2086
+  compile "$1" "$std" ${flags:--O2} -S -o "$tmp/out.s" >"$tmp/log" 2>&1 || { cat "$tmp/log"; return 1; }
+  awk '
+    FNR == NR {
+      if (match($0, /^\/\/ CHECK(-LABEL|-NOT)?: /)) {
+        kind = substr($0, 9, RLENGTH - 10); arg = substr($0, RLENGTH + 1)
+        if (kind == "-LABEL") { nf++; fname[nf] = arg; nc[nf] = 0; nn[nf] = 0 }
+        else if (kind == "-NOT") nots[nf, ++nn[nf]] = arg
+        else checks[nf, ++nc[nf]] = arg
+      }
+      next
+    }
+    /^[A-Za-z_.$][A-Za-z0-9_.$]*:/ { label = substr($0, 1, index($0, ":") - 1); for (i = 1; i <= nf; i++) if (fname[i] == label) { cur = i; seen[i] = 1; pos[i] = 1 } }
+    cur && /^\t\.size\t/ { cur = 0 }
+    cur {
+      for (k = 1; k <= nn[cur]; k++) if ($0 ~ nots[cur, k]) { printf "  %s: \"%s\" matches \"%s\"\n", fname[cur], $0, nots[cur, k]; bad = 1 }
+      if (pos[cur] <= nc[cur] && $0 ~ checks[cur, pos[cur]]) pos[cur]++
+    }
+    END {
+      for (i = 1; i <= nf; i++) {
+        if (!seen[i]) { printf "  %s: no such function\n", fname[i]; bad = 1 }
+        else if (pos[i] <= nc[i]) { printf "  %s: nothing matches \"%s\"\n", fname[i], checks[i, pos[i]]; bad = 1 }
+      }
+      exit bad
+    }' "$1" "$tmp/out.s"
+}
+
+pass=0
+fail=0
+for t in $(find "$root/test" -path "$root/test/support" -prune -o -name '*.cpp' -print | sort); do
+  if [ $# -gt 0 ]; then
+    m=
+    for f in "$@"; do case $t in *"$f"*) m=1 ;; esac; done
+    [ -n "$m" ] || continue
+  fi
+  case $t in
+  *.pass.cpp) r=run_pass ;;
+  *.fail.cpp) r=run_fail ;;
+  *.codegen.cpp) r=run_codegen ;;
+  *) continue ;;
+  esac
+  name=${t#"$root"/}
+  if $r "$t" >"$tmp/report" 2>&1; then
+    pass=$((pass + 1))
+  else
+    fail=$((fail + 1))
+    echo "FAIL: $name"
+    cat "$tmp/report"
+  fi
+done
+echo "$pass passed, $fail failed"
+[ "$fail" -eq 0 ]
@@ -0,0 +1,44 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <small_vector>
+
+// The inline slots: N elements in the object, suitably aligned, used until
+// the size passes N.
+
+#include "small_vector.hh"
+
+#include <cassert>
+#include <stddef.h>
+#include <stdint.h>
+
+struct alignas(32) Wide {
+  char __c;
+};
+
+int main(int, char **) {
+  static_assert(alignof(std::small_vector<Wide, 3>) == 32, "");
+  static_assert(sizeof(std::small_vector<char, 64>) >= 64, "");
+  static_assert(std::small_vector<int, 16>::inline_capacity == 16, "");
+
+  std::small_vector<Wide, 3> __w(3);
+  assert(__w.__is_inline());
+  assert(reinterpret_cast<uintptr_t>(__w.data()) % 32 == 0);
+  const char *const __self = reinterpret_cast<const char *>(&__w);
+  assert(reinterpret_cast<const char *>(__w.data()) >= __self &&
+         reinterpret_cast<const char *>(__w.data() + 3) <= __self + sizeof(__w));
+
+  // Spilling and shrinking back.
+  std::small_vector<long, 4> __v(4, 7);
+  __v.push_back(8);
+  assert(!__v.__is_inline() && reinterpret_cast<uintptr_t>(__v.data()) % alignof(long) == 0);
+  __v.resize(3);
+  __v.shrink_to_fit();
+  assert(__v.__is_inline() && __v.capacity() == 4 && __v[2] == 7);
+  return 0;
+}
@@ -0,0 +1,149 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <small_vector>
+
+// template <class T, size_t N> class small_vector;
+
+#include "small_vector.hh"
+
+#include <cassert>
+#include <stddef.h>
+
+static int __live = 0, __throw_at = -1;
+
+// Copyable only: relocated by copying.
+struct Copied {
+  int __v;
+  Copied(int __x = 0) : __v(__x) {
+    if (__x == __throw_at)
+      throw 1;
+    ++__live;
+  }
+  Copied(const Copied &__o) : __v(__o.__v) {
+    if (__v == __throw_at)
+      throw 2;
+    ++__live;
+  }
+  Copied &operator=(const Copied &__o) {
+    __v = __o.__v;
+    return *this;
+  }
+  ~Copied() { --__live; }
+  explicit operator int() const { return __v; }
+  bool operator==(const Copied &__o) const { return __v == __o.__v; }
+};
+
+// Nothrow movable: relocated by moving.
+struct Moved {
+  int __v;
+  Moved(int __x = 0) : __v(__x) { ++__live; }
+  Moved(const Moved &__o) : __v(__o.__v) { ++__live; }
+  Moved(Moved &&__o) noexcept : __v(__o.__v) {
+    __o.__v = -1;
+    ++__live;
+  }
+  Moved &operator=(const Moved &) = default;
+  Moved &operator=(Moved &&)      = default;
+  ~Moved() { --__live; }
+  explicit operator int() const { return __v; }
+  bool operator==(const Moved &__o) const { return __v == __o.__v; }
+};
+
+template <class _Tp, size_t _Np> void __test() {
+  std::small_vector<_Tp, _Np> __v;
+  for (int __i = 0; __i < 10; ++__i)
+    __v.push_back(_Tp(__i));
+  assert(__v.size() == 10);
+  __v.insert(__v.begin() + 3, _Tp(100));
+  assert(int(__v[3]) == 100 && int(__v[4]) == 3 && __v.size() == 11);
+  __v.erase(__v.begin() + 3);
+  assert(int(__v[3]) == 3 && __v.size() == 10);
+  __v.erase(__v.begin() + 2, __v.begin() + 5);
+  assert(int(__v[2]) == 5 && __v.size() == 7);
+  __v.insert(__v.begin() + 1, 3, _Tp(7));
+  assert(int(__v[1]) == 7 && int(__v[3]) == 7 && int(__v[4]) == 1 && __v.size() == 10);
+  int __a[] = {40, 41};
+  __v.insert(__v.begin(), __a, __a + 2);
+  assert(int(__v[0]) == 40 && int(__v[2]) == 0 && __v.size() == 12);
+  // An element of the vector itself.
+  __v.insert(__v.begin() + 2, __v[0]);
+  assert(int(__v[2]) == 40);
+
+  std::small_vector<_Tp, _Np> __c(__v);
+  assert(__c == __v);
+  std::small_vector<_Tp, _Np> __m(static_cast<std::small_vector<_Tp, _Np> &&>(__c));
+  assert(__m == __v && __c.empty());
+  __m.resize(2);
+  assert(__m.size() == 2);
+  __m.shrink_to_fit();
+  assert(__m.__is_inline() == (2 <= _Np));
+  __m.resize(5, _Tp(9));
+  assert(int(__m[4]) == 9);
+  swap(__m, __v);
+  assert(__v.size() == 5 && __m.size() == 13);
+
+  std::small_vector<_Tp, _Np> __e;
+  __e = __m;
+  assert(__e == __m);
+  __e = std::small_vector<_Tp, _Np>(3, _Tp(1));
+  assert(__e.size() == 3);
+  while (!__e.empty())
+    __e.pop_back();
+
+  std::small_vector<_Tp, _Np> __f;
+  __f.emplace_back(1);
+  __f.emplace(__f.begin(), 0);
+  assert(int(__f[0]) == 0 && int(__f[1]) == 1);
+  for (int __i = 0; __i < 5; ++__i)
+    __f.insert(__f.begin(), __f.back());
+  assert(__f.size() == 7 && int(__f[0]) == 1);
+}
+
+int main(int, char **) {
+  __test<int, 0>();
+  __test<int, 4>();
+  __test<int, 16>();
+  __test<Copied, 4>();
+  __test<Copied, 64>();
+  assert(__live == 0);
+  __test<Moved, 4>();
+  __test<Moved, 16>();
+  assert(__live == 0);
+
+  // A copy that throws while growing leaves the vector as it was.
+  {
+    std::small_vector<Copied, 2> __v;
+    __v.push_back(Copied(1));
+    __v.push_back(Copied(2));
+    __throw_at = 2;
+    try {
+      __v.push_back(Copied(3));
+      assert(false);
+    } catch (int) {
+    }
+    assert(__v.size() == 2 && __v.__is_inline() && __live == 2);
+    assert(int(__v[0]) == 1 && int(__v[1]) == 2);
+    __throw_at = -1;
+  }
+  assert(__live == 0);
+
+  {
+    std::small_vector<int, 4> __s;
+    assert(__s.capacity() == 4 && __s.__is_inline());
+    for (int __i = 0; __i < 4; ++__i)
+      __s.push_back(__i);
+    assert(__s.__is_inline());
+    __s.push_back(4);
+    assert(!__s.__is_inline() && __s.capacity() >= 5);
+    std::small_vector<unsigned char, 8> __a(3, 1), __b(3, 1);
+    __b[2] = 2;
+    assert(__a < __b && __a != __b);
+  }
+  return 0;
+}
@@ -0,0 +1,77 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <soa_vector>
+
+// soa_vector<T>::iterator, const_iterator: random access, proxy reference
+
+// UNSUPPORTED: c++11, c++14, c++17
+
+#include "soa_vector.hh"
+
+#include <cassert>
+#include <stddef.h>
+
+struct Point {
+  int __x;
+  float __y;
+};
+
+typedef std::soa_vector<Point> Vec;
+
+static_assert(std::is_same_v<Vec::iterator::iterator_category, std::random_access_iterator_tag>);
+static_assert(std::is_same_v<Vec::const_iterator::iterator_category, std::random_access_iterator_tag>);
+static_assert(std::is_same_v<Vec::iterator::difference_type, ptrdiff_t>);
+static_assert(std::is_same_v<Vec::iterator::value_type, Point>);
+static_assert(std::is_same_v<Vec::iterator::pointer, void>);
+static_assert(std::is_same_v<Vec::iterator::reference, Vec::reference>);
+static_assert(std::is_same_v<Vec::const_iterator::reference, Vec::const_reference>);
+static_assert(std::is_convertible_v<Vec::iterator, Vec::const_iterator>);
+static_assert(!std::is_convertible_v<Vec::const_iterator, Vec::iterator>);
+
+template <class _It> void __check_order(_It __a, _It __b) {
+  // __a < __b
+  assert(__a < __b && !(__b < __a));
+  assert(__b > __a && !(__a > __b));
+  assert(__a <= __b && !(__b <= __a) && __a <= __a);
+  assert(__b >= __a && !(__a >= __b) && __a >= __a);
+  assert(__a != __b && !(__a == __b));
+}
+
+int main(int, char **) {
+  Vec __v;
+  for (int __i = 0; __i != 10; ++__i)
+    __v.push_back(Point{__i, __i * 2.0f});
+
+  Vec::iterator __b = __v.begin(), __e = __v.end();
+  assert(__e - __b == 10);
+  __check_order(__b, __e);
+  __check_order(__b + 2, __b + 3);
+
+  Vec::const_iterator __cb = __b, __ce = __e;
+  __check_order(__cb, __ce);
+  assert(__cb == __v.begin() && __ce - __cb == 10);
+
+  Vec::iterator __it = __b;
+  __it += 4;
+  assert(std::get<0>(*__it) == 4 && std::get<1>(__it[1]) == 10.0f);
+  __it -= 1;
+  assert(std::get<0>(*__it) == 3);
+  assert(std::get<0>(*(2 + __it)) == 5 && std::get<0>(*(__it - 3)) == 0);
+  assert(std::get<0>(*__it++) == 3 && std::get<0>(*__it) == 4);
+  assert(std::get<0>(*__it--) == 4 && std::get<0>(*__it) == 3);
+  assert(std::get<0>(*++__it) == 4 && std::get<0>(*--__it) == 3);
+
+  // Writing through the proxy.
+  for (auto __r : __v)
+    std::get<0>(__r) *= 10;
+  assert(std::get<0>(__v[9]) == 90);
+  *__b = Point{-1, -1.0f};
+  assert(__v.column<0>()[0] == -1 && __v.column<1>()[0] == -1.0f);
+  return 0;
+}
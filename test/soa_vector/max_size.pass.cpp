@@ -0,0 +1,50 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <soa_vector>
+
+// static constexpr size_type max_size() noexcept;
+// void reserve(size_type n);  // bad_alloc past max_size(), not a wrapped size
+
+// UNSUPPORTED: c++11, c++14, c++17
+
+#include "soa_vector.hh"
+
+#include <cassert>
+#include <stddef.h>
+
+struct Wide {
+  double __a;
+  double __b;
+  char __c;
+};
+
+typedef std::soa_vector<Wide> Vec;
+
+static_assert(noexcept(Vec::max_size()));
+static_assert(Vec::max_size() == (static_cast<size_t>(-1) - 3 * 64) / 17);
+static_assert(std::soa_vector<Wide>::max_size() * 17 + 3 * 64 > Vec::max_size());
+
+int main(int, char **) {
+  Vec __v;
+  __v.push_back(Wide{1, 2, 'x'});
+  // Without the check, (SIZE_MAX / 16 + 1) * 16 wraps to 0 and the block
+  // would be far too small.
+  const size_t __sizes[] = {Vec::max_size() + 1, static_cast<size_t>(-1) / 16 + 1, static_cast<size_t>(-1)};
+  for (size_t __n : __sizes) {
+    bool __threw = false;
+    try {
+      __v.reserve(__n);
+    } catch (...) { // bad_alloc, from the runtime's operator new
+      __threw = true;
+    }
+    assert(__threw);
+    assert(__v.size() == 1 && std::get<0>(__v[0]) == 1 && std::get<2>(__v[0]) == 'x');
+  }
+  return 0;
+}
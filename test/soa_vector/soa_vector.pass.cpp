@@ -0,0 +1,182 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <soa_vector>
+
+// template <class T> class soa_vector;
+
+// UNSUPPORTED: c++11, c++14, c++17
+
+#include "soa_vector.hh"
+
+#include <cassert>
+#include <stdint.h>
+
+struct Rec {
+  int __id;
+  double __price;
+  char __tag;
+};
+
+static int __live = 0;
+struct Obj {
+  int __v = 0;
+  Obj() { ++__live; }
+  Obj(int __x) : __v(__x) { ++__live; }
+  Obj(const Obj &__o) : __v(__o.__v) { ++__live; }
+  Obj(Obj &&__o) noexcept : __v(__o.__v) { ++__live; }
+  Obj &operator=(const Obj &) = default;
+  ~Obj() { --__live; }
+};
+struct Mixed {
+  Obj __o;
+  long __n;
+};
+
+static int __throw_at = -1;
+struct Thrower {
+  int __v;
+  Thrower(int __x) : __v(__x) {
+    if (__x == __throw_at)
+      throw 1;
+  }
+  Thrower(const Thrower &__t) : __v(__t.__v) {}
+  Thrower(Thrower &&) noexcept = default;
+};
+struct WithThrower {
+  Obj __o;
+  Thrower __t;
+};
+
+struct MoveOnly {
+  int *__p;
+  explicit MoveOnly(int *__q) : __p(__q) {}
+  MoveOnly(MoveOnly &&__m) noexcept : __p(__m.__p) { __m.__p = nullptr; }
+  MoveOnly &operator=(MoveOnly &&__m) noexcept {
+    __p     = __m.__p;
+    __m.__p = nullptr;
+    return *this;
+  }
+  ~MoveOnly() {
+    if (__p)
+      --*__p;
+  }
+};
+struct WithMoveOnly {
+  MoveOnly __m;
+  int __x;
+};
+
+static_assert(std::soa_vector<WithMoveOnly>::column_count == 2);
+static_assert(std::is_same_v<std::soa_vector<WithMoveOnly>::column_type<0>, MoveOnly>);
+
+static_assert(std::soa_vector<Rec>::column_count == 3);
+static_assert(std::is_same_v<std::soa_vector<Rec>::column_type<1>, double>);
+
+int main(int, char **) {
+  std::soa_vector<Rec> __v;
+  for (int __i = 0; __i < 1000; ++__i)
+    __v.push_back(Rec{__i, __i * 0.5, char('a' + __i % 26)});
+  assert(__v.size() == 1000 && __v.capacity() >= 1000);
+
+  // Every column starts on a column_alignment boundary.
+  assert(reinterpret_cast<uintptr_t>(__v.column<0>().data()) % 64 == 0);
+  assert(reinterpret_cast<uintptr_t>(__v.column<1>().data()) % 64 == 0);
+  assert(reinterpret_cast<uintptr_t>(__v.column<2>().data()) % 64 == 0);
+
+  double __s = 0;
+  for (double __d : __v.column<1>())
+    __s += __d;
+  assert(__s == 0.5 * 999 * 1000 / 2);
+
+  // Proxy references gather and scatter whole elements.
+  Rec __r = __v[10];
+  assert(__r.__id == 10 && __r.__price == 5.0 && __r.__tag == 'k');
+  __v[10] = Rec{-1, 1.0, 'z'};
+  assert(std::get<0>(__v[10]) == -1 && __v[10].get<2>() == 'z');
+  __v[11] = __v[10];
+  assert(__v.column<0>()[11] == -1);
+  std::get<1>(__v[12]) = 9.0;
+  assert(__v.column<1>()[12] == 9.0);
+
+  auto __ref = __v.emplace_back(7, 7.5, 'q');
+  assert(std::get<0>(__ref) == 7 && __v.size() == 1001);
+
+  const auto &__cv                             = __v;
+  std::soa_vector<Rec>::const_reference __cref = __cv[0];
+  assert(std::get<0>(__cref) == 0);
+  static_assert(std::is_same_v<decltype(std::get<0>(__cref)), const int &>);
+
+  std::soa_vector<Rec> __w = __v;
+  assert(__w.size() == 1001 && std::get<1>(__w[999]) == 499.5);
+  std::soa_vector<Rec> __m = static_cast<std::soa_vector<Rec> &&>(__w);
+  assert(__w.size() == 0 && __m.size() == 1001);
+  __m.resize(5);
+  assert(__m.size() == 5);
+  __m.resize(7);
+  assert(std::get<0>(__m[6]) == 0);
+  __m.shrink_to_fit();
+  assert(__m.capacity() == 7);
+  __m.pop_back();
+  assert(__m.size() == 6);
+  swap(__m, __v);
+  assert(__v.size() == 6 && __m.size() == 1001);
+
+  // Non-trivial members are constructed and destroyed once each.
+  {
+    std::soa_vector<Mixed> __mv;
+    for (int __i = 0; __i < 100; ++__i)
+      __mv.push_back(Mixed{Obj(__i), __i});
+    assert(__live == 100 && std::get<0>(__mv[50]).__v == 50);
+    std::soa_vector<Mixed> __c = __mv;
+    assert(__live == 200);
+    __c.clear();
+    assert(__live == 100);
+  }
+  assert(__live == 0);
+
+  // A member that throws while constructing leaves nothing behind.
+  {
+    std::soa_vector<WithThrower> __tv;
+    __throw_at = 5;
+    try {
+      __tv.emplace_back(Obj(1), 5);
+      assert(false);
+    } catch (int) {
+    }
+    assert(__live == 0 && __tv.size() == 0);
+    __tv.emplace_back(Obj(1), 4);
+    assert(__live == 1);
+  }
+  assert(__live == 0);
+
+  // A move-only member is moved in and across a reallocation, never copied.
+  {
+    int __owned = 0;
+    std::soa_vector<WithMoveOnly> __mo;
+    for (int __i = 0; __i < 100; ++__i) {
+      ++__owned;
+      if (__i % 2 == 0)
+        __mo.push_back(WithMoveOnly{MoveOnly(&__owned), __i});
+      else
+        __mo.emplace_back(MoveOnly(&__owned), __i);
+    }
+    assert(__owned == 100 && __mo.size() == 100);
+    for (int __i = 0; __i < 100; ++__i)
+      assert(std::get<0>(__mo[__i]).__p == &__owned && std::get<1>(__mo[__i]) == __i);
+    __mo.shrink_to_fit();
+    __mo.pop_back();
+    assert(__owned == 99);
+    std::soa_vector<WithMoveOnly> __other;
+    __other.swap(__mo);
+    assert(__mo.empty() && __other.size() == 99);
+    __other.clear();
+    assert(__owned == 0);
+  }
+  return 0;
+}
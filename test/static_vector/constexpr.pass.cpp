@@ -0,0 +1,61 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <static_vector>
+
+// static_vector is usable in constant expressions in C++20, including one
+// left partly filled, and for element types with non-trivial members.
+
+// UNSUPPORTED: c++11, c++14, c++17
+
+#include "static_vector.hh"
+
+constexpr std::static_vector<int, 16> __squares() {
+  std::static_vector<int, 16> __v;
+  for (int __i = 0; __i < 15; ++__i)
+    __v.push_back(__i * __i);
+  __v.erase(__v.begin() + 2);
+  __v.insert(__v.begin(), 99);
+  __v.emplace(__v.begin() + 3, 7);
+  __v.pop_back();
+  return __v;
+}
+
+// One slot short of full: the unused tail is part of the constant too.
+constexpr auto __sq = __squares();
+static_assert(__sq.size() == 15 && __sq[0] == 99 && __sq[1] == 0 && __sq[2] == 1 && __sq[3] == 7 && __sq[4] == 9);
+
+struct NonTrivial {
+  int __v;
+  constexpr NonTrivial(int __x) : __v(__x) {}
+  constexpr NonTrivial(const NonTrivial &__o) : __v(__o.__v) {}
+  constexpr NonTrivial &operator=(const NonTrivial &__o) {
+    __v = __o.__v;
+    return *this;
+  }
+  constexpr ~NonTrivial() {}
+};
+
+constexpr int __non_trivial() {
+  std::static_vector<NonTrivial, 4> __a;
+  __a.emplace_back(1);
+  __a.emplace_back(2);
+  std::static_vector<NonTrivial, 4> __b = __a;
+  __b.push_back(NonTrivial(3));
+  __a = __b;
+  __a.erase(__a.begin());
+  std::static_vector<NonTrivial, 4> __c(__a.begin(), __a.end());
+  __c.swap(__b);
+  // __a = {2, 3}, __b = {2, 3}, __c = {1, 2, 3}
+  return static_cast<int>(__a.size()) * 100 + __a[0].__v * 10 + __a[1].__v +
+         static_cast<int>(__b.size()) * 1000 + (__c.try_push_back(NonTrivial(0)) ? 0 : 10000) +
+         (__b.try_push_back(NonTrivial(0)) ? 0 : 20000);
+}
+static_assert(__non_trivial() == 2223);
+
+int main(int, char **) { return __sq[14] == 13 * 13 ? 0 : 1; }
@@ -0,0 +1,47 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <static_vector>
+
+// The size is stored in __uint_least_for<N>, the smallest unsigned type that
+// holds N, and the vector is trivially copyable and destructible when T is.
+
+#include "static_vector.hh"
+
+#include <cassert>
+#include <stddef.h>
+
+struct NonTrivial {
+  int __v;
+  NonTrivial(const NonTrivial &__o) : __v(__o.__v) {}
+  ~NonTrivial() {}
+};
+
+static_assert(std::is_same<std::__uint_least_for<255>, unsigned char>::value, "");
+static_assert(std::is_same<std::__uint_least_for<256>, unsigned short>::value, "");
+static_assert(std::is_same<std::__uint_least_for<65536>, unsigned int>::value, "");
+static_assert(std::is_same<std::static_vector<char, 200>::size_type, size_t>::value, "");
+
+static_assert(sizeof(std::static_vector<char, 200>) == 201, "");
+static_assert(sizeof(std::static_vector<char, 300>) == 302, "");
+static_assert(sizeof(std::static_vector<int, 4>) == 20, "");
+static_assert(alignof(std::static_vector<double, 3>) == alignof(double), "");
+
+static_assert(std::is_trivially_copyable<std::static_vector<int, 8> >::value, "");
+static_assert(std::is_trivially_destructible<std::static_vector<int, 8> >::value, "");
+static_assert(!std::is_trivially_copyable<std::static_vector<NonTrivial, 8> >::value, "");
+static_assert(!std::is_trivially_destructible<std::static_vector<NonTrivial, 8> >::value, "");
+
+int main(int, char **) {
+  std::static_vector<int, 4> __a(3, 5), __b;
+  __b = __a;
+  assert(__b == __a && __b.size() == 3 && __b.capacity() == 4 && __b.max_size() == 4);
+  std::static_vector<int, 0> __z;
+  assert(__z.full() && __z.try_push_back(1) == nullptr);
+  return 0;
+}
@@ -0,0 +1,75 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <static_vector>
+
+// template <class T, size_t N> class static_vector;
+
+#include "static_vector.hh"
+
+#include <cassert>
+
+static int __live = 0;
+
+struct Counted {
+  int __v;
+  Counted(int __x = 0) : __v(__x) { ++__live; }
+  Counted(const Counted &__o) : __v(__o.__v) { ++__live; }
+  Counted(Counted &&__o) noexcept : __v(__o.__v) {
+    __o.__v = -1;
+    ++__live;
+  }
+  Counted &operator=(const Counted &) = default;
+  Counted &operator=(Counted &&)      = default;
+  ~Counted() { --__live; }
+  bool operator==(const Counted &__o) const { return __v == __o.__v; }
+  bool operator<(const Counted &__o) const { return __v < __o.__v; }
+};
+
+int main(int, char **) {
+  {
+    std::static_vector<Counted, 10> __v;
+    for (int __i = 0; __i < 5; ++__i)
+      __v.emplace_back(__i);
+    assert(__live == 5);
+    __v.insert(__v.begin() + 1, 3, Counted(42));
+    assert(__v.size() == 8 && __v[1].__v == 42 && __v[3].__v == 42 && __v[4].__v == 1 && __v[7].__v == 4);
+    __v.erase(__v.begin() + 1, __v.begin() + 4);
+    assert(__v.size() == 5 && __v[1].__v == 1 && __live == 5);
+    int __arr[] = {7, 8, 9};
+    __v.insert(__v.end() - 1, __arr, __arr + 3);
+    assert(__v.size() == 8 && __v[4].__v == 7 && __v[7].__v == 4);
+    // An element of the vector itself.
+    __v.insert(__v.begin(), __v[3]);
+    assert(__v[0].__v == 3 && __v.size() == 9);
+    assert(__v.try_emplace_back(1) != nullptr);
+    assert(__v.full() && __v.try_push_back(Counted(5)) == nullptr);
+
+    std::static_vector<Counted, 10> __w(__v);
+    assert(__w == __v && __live == 20);
+    std::static_vector<Counted, 10> __m(static_cast<std::static_vector<Counted, 10> &&>(__w));
+    assert(__m == __v);
+    __w.resize(2);
+    __w = __v;
+    assert(__w == __v);
+    __v.resize(3);
+    assert(__live == 23);
+    __v.swap(__w);
+    assert(__v.size() == 10 && __w.size() == 3 && __live == 23);
+    assert(__w < __v || __v < __w);
+    __w.assign(4, Counted(1));
+    assert(__w.size() == 4 && __w[3].__v == 1);
+    __w.assign(__arr, __arr + 2);
+    assert(__w.size() == 2 && __w[1].__v == 8);
+    __w.clear();
+    __m = static_cast<std::static_vector<Counted, 10> &&>(__v);
+    assert(__m.size() == 10);
+  }
+  assert(__live == 0);
+  return 0;
+}
@@ -0,0 +1,30 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// Force-included ahead of every test and benchmark (-include prelude.h).
+// The headers leave ptrdiff_t, size_t and nullptr_t to the C library's
+// <stddef.h> and expect __config's compiler detection to have settled
+// __has_feature and char8_t; this supplies what that would have.
+
+#pragma once
+
+#ifndef __has_feature
+#define __has_feature(__x) 0
+#endif
+
+#if !defined(__cpp_char8_t) && !defined(_LIBCPP_NO_HAS_CHAR8_T)
+#define _LIBCPP_NO_HAS_CHAR8_T
+#endif
+
+namespace std {
+inline namespace __1 {
+using ptrdiff_t = decltype(static_cast<int *>(nullptr) - static_cast<int *>(nullptr));
+using size_t    = decltype(sizeof(0));
+using nullptr_t = decltype(nullptr);
+} // namespace __1
+} // namespace std
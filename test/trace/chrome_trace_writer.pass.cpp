@@ -0,0 +1,99 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <__trace>
+
+// template <size_t N> bool __trace_ring<N>::__record(const char* name, unsigned long long begin,
+//                                                    unsigned long long end) noexcept;
+// template <size_t N> template <class F> size_t __trace_ring<N>::__consume(F&& f);
+// __chrome_trace_writer(char* first, char* last, unsigned long long base = 0) noexcept;
+// template <size_t N> bool __chrome_trace_writer::__append(__trace_ring<N>& ring, unsigned tid) noexcept;
+// char* __chrome_trace_writer::__finish() noexcept;
+
+// A full ring drops and counts; __consume stops at the first false. The
+// writer puts events in microseconds at the frequency it was made with,
+// escapes names, and leaves in the ring what does not fit; the document it
+// finishes is whole either way. Untouched, the frequency is measured, so
+// times are never raw cycles.
+
+// UNSUPPORTED: c++11, c++14
+
+#include "__trace.hh"
+
+#include <cassert>
+#include <cstring>
+
+static bool __all(const std::__trace_event &) { return true; }
+
+int main(int, char **) {
+  static std::__trace_ring<4> __ring;
+
+  for (unsigned long long __i = 0; __i != 4; ++__i)
+    assert(__ring.__record("a", __i, __i + 1));
+  assert(!__ring.__record("a", 9, 10) && __ring.__dropped() == 1);
+  unsigned long long __k = 0;
+  assert(__ring.__consume([&](const std::__trace_event &__e) {
+    assert(__e.__begin == __k && __e.__end == __k + 1);
+    return ++__k < 2;
+  }) == 1);
+  assert(__ring.__consume(__all) == 3 && __ring.__consume(__all) == 0);
+
+#if defined(__x86_64__) || defined(__i386__) || defined(__aarch64__)
+  // A millisecond of cycles at whatever the frequency is found to be.
+  {
+    const unsigned long long __hz = std::__cycle_frequency();
+    assert(__ring.__record("ms", 0, __hz / 1000));
+    char __buf[128];
+    std::__chrome_trace_writer __w(__buf, __buf + sizeof(__buf));
+    assert(__w.__append(__ring, 1));
+    *__w.__finish() = 0;
+    assert(std::strstr(__buf, "\"dur\":999.") != nullptr || std::strstr(__buf, "\"dur\":1000.000,") != nullptr);
+  }
+#endif
+
+  std::__set_cycle_frequency(2000000000);
+  assert(__ring.__record("x", 3000, 5500));
+  assert(__ring.__record("y\\\"\n", 6000, 6000));
+  {
+    char __buf[512];
+    std::__chrome_trace_writer __w(__buf, __buf + sizeof(__buf), 2000);
+    assert(__w.__append(__ring, 7));
+    char *const __e = __w.__finish();
+    *__e            = 0;
+    const char __want[] = "{\"traceEvents\":["
+                          "{\"name\":\"x\",\"ph\":\"X\",\"ts\":0.500,\"dur\":1.250,\"pid\":0,\"tid\":7},"
+                          "{\"name\":\"y\\\\\\\"\\u000a\",\"ph\":\"X\",\"ts\":2.000,\"dur\":0.000,\"pid\":0,\"tid\":7}]}";
+    assert(std::strcmp(__buf, __want) == 0 && __e == __buf + sizeof(__want) - 1);
+  }
+
+  // Room for one event: the other stays for the next writer.
+  assert(__ring.__record("x", 3000, 5500) && __ring.__record("x", 3000, 5500));
+  {
+    char __buf[90];
+    std::__chrome_trace_writer __w(__buf, __buf + sizeof(__buf), 2000);
+    assert(!__w.__append(__ring, 1));
+    char *const __e = __w.__finish();
+    assert(__e != nullptr && __e[-2] == ']' && __e[-1] == '}');
+    assert(__ring.__consume(__all) == 1);
+  }
+  {
+    char __buf[32];
+    std::__chrome_trace_writer __w(__buf, __buf + sizeof(__buf));
+    char *const __e = __w.__finish();
+    assert(__e == __buf + 18 && std::memcmp(__buf, "{\"traceEvents\":[]}", 18) == 0);
+  }
+  {
+    char __buf[1];
+    std::__chrome_trace_writer __w(__buf, __buf + 1);
+    assert(__ring.__record("x", 0, 1));
+    assert(!__w.__append(__ring, 1) && __w.__finish() == nullptr);
+    assert(__ring.__consume(__all) == 1);
+  }
+
+  return 0;
+}
@@ -0,0 +1,69 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <__trace>
+
+// unsigned long long __cycle_frequency() noexcept;
+// void __set_cycle_frequency(unsigned long long hz) noexcept;
+// template <class Clock>
+//     unsigned long long __calibrate_cycle_counter(Clock now_ns, unsigned long long span_ns = 10000000);
+// unsigned long long __cycles_to_ns(unsigned long long cycles) noexcept;
+
+// Untouched, the frequency is known wherever there is a counter, whether the
+// CPU reports it or not, and converts a spin timed by the clock back to its
+// length; likewise after a calibration. A frequency set by hand converts
+// exactly, and 0 leaves cycles as they are.
+
+// UNSUPPORTED: c++11, c++14
+
+#include "__trace.hh"
+
+#include <cassert>
+#include <ctime>
+
+static unsigned long long now_ns() {
+  timespec __ts;
+  clock_gettime(CLOCK_MONOTONIC, &__ts);
+  return static_cast<unsigned long long>(__ts.tv_sec) * 1000000000ull + static_cast<unsigned long long>(__ts.tv_nsec);
+}
+
+// A 20 ms spin in cycles, converted, is 20 ms give or take 20%: wide enough
+// for a loaded machine or a frequency measured over only 2 ms, narrow enough
+// to catch a wrong scale.
+static bool __converts() {
+  const unsigned long long __t0 = now_ns(), __c0 = std::__cycle_count();
+  while (now_ns() - __t0 < 20000000)
+    ;
+  const unsigned long long __ns = std::__cycles_to_ns(std::__cycle_count() - __c0);
+  const unsigned long long __t  = now_ns() - __t0;
+  return __ns > __t / 10 * 8 && __ns < __t / 10 * 12;
+}
+
+int main(int, char **) {
+#if defined(__x86_64__) || defined(__i386__) || defined(__aarch64__)
+  const unsigned long long __hz = std::__cycle_frequency();
+  assert(__hz > 1000000 && __hz < 100000000000ull);
+  assert(std::__cycle_frequency() == __hz);
+  assert(__converts());
+
+  assert(std::__calibrate_cycle_counter(now_ns) == std::__cycle_frequency());
+  assert(std::__cycle_frequency() / 10 * 8 < __hz && __hz < std::__cycle_frequency() / 10 * 12);
+  assert(__converts());
+#endif
+
+  std::__set_cycle_frequency(1000000000);
+  assert(std::__cycles_to_ns(0) == 0 && std::__cycles_to_ns(123456789) == 123456789);
+  std::__set_cycle_frequency(2000000000);
+  assert(std::__cycles_to_ns(3) == 1 && std::__cycles_to_ns(4000000000ull) == 2000000000);
+  std::__set_cycle_frequency(500000000);
+  assert(std::__cycles_to_ns(1ull << 40) == 1ull << 41);
+  std::__set_cycle_frequency(0);
+  assert(std::__cycle_frequency() == 0 && std::__cycles_to_ns(987654321) == 987654321);
+
+  return 0;
+}
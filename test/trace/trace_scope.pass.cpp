@@ -0,0 +1,53 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <__trace>
+
+// explicit __scoped_timer(unsigned long long& cycles) noexcept;
+// template <size_t N> __trace_scope(__trace_ring<N>& ring, const char* name) noexcept;
+
+// Without _LIBCPP_ENABLE_INSTRUMENTATION neither records anything; see
+// trace_scope.instrumented.pass.cpp for the other side.
+
+// UNSUPPORTED: c++11, c++14
+
+#include "__trace.hh"
+
+#include <cassert>
+
+static std::__trace_ring<1024> __ring;
+static unsigned long long __total = 0;
+
+__attribute__((__noinline__)) static int __work(int __n) {
+  std::__scoped_timer __t(__total);
+  std::__trace_scope<1024> __s(__ring, "work");
+  int __x = 0;
+  for (int __i = 0; __i < __n; ++__i)
+    __x += __i * __i;
+  __asm__ __volatile__("" : "+r"(__x));
+  return __x;
+}
+
+int main(int, char **) {
+  for (int __i = 0; __i != 1000; ++__i)
+    __work(100);
+  const size_t __events = __ring.__consume([](const std::__trace_event &__e) {
+    assert(__e.__end >= __e.__begin && __e.__name[0] == 'w');
+    return true;
+  });
+#ifdef _LIBCPP_ENABLE_INSTRUMENTATION
+  assert(__events == 1000 && __ring.__dropped() == 0);
+#if defined(__x86_64__) || defined(__i386__) || defined(__aarch64__)
+  assert(__total >= 1000);
+#endif
+#else
+  assert(__events == 0 && __total == 0);
+#endif
+
+  return 0;
+}
@@ -0,0 +1,37 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <type_traits>
+
+// aligned_storage, aligned_union, __static_max
+
+#include "type_traits.hh"
+
+using std::aligned_storage;
+using std::aligned_union;
+
+// The default alignment is the largest power of two up to 16 that divides
+// into the size.
+static_assert(alignof(aligned_storage<1>::type) == 1 && sizeof(aligned_storage<1>::type) == 1, "");
+static_assert(alignof(aligned_storage<3>::type) == 2, "");
+static_assert(alignof(aligned_storage<8>::type) == 8, "");
+static_assert(alignof(aligned_storage<10>::type) == 8 && sizeof(aligned_storage<10>::type) == 16, "");
+static_assert(alignof(aligned_storage<100>::type) == 16, "");
+
+static_assert(alignof(aligned_storage<10, 4096>::type) == 4096 && sizeof(aligned_storage<10, 4096>::type) == 4096, "");
+static_assert(alignof(aligned_storage<10, 0x8000>::type) == 0x8000, "");
+static_assert(alignof(aligned_storage<5, 1>::type) == 1 && sizeof(aligned_storage<5, 1>::type) == 5, "");
+
+static_assert(alignof(aligned_union<0, char, double, short>::type) == 8, "");
+static_assert(sizeof(aligned_union<0, char, double>::type) == 8, "");
+static_assert(aligned_union<0, char, double, long double>::alignment_value == 16, "");
+static_assert(sizeof(aligned_union<40, char, double>::type) == 40, "");
+
+static_assert(std::__static_max<3, 9, 1, 7>::value == 9 && std::__static_max<4>::value == 4, "");
+
+int main() { return 0; }
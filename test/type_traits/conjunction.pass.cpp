@@ -0,0 +1,70 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <type_traits>
+
+// _And, _Or, conjunction, disjunction: short-circuiting, the deciding
+// predicate as the base, and a nesting depth that stays well under the
+// limit for 1024 predicates.
+
+// UNSUPPORTED: c++11
+// ADDITIONAL_COMPILE_FLAGS: -ftemplate-depth=300
+
+#include "type_traits.hh"
+#include "utility.hh"
+
+// Instantiating value is an error: the predicates after the deciding one
+// must not be looked at.
+template <class _Tp> struct Poison {
+  static_assert(sizeof(_Tp) == 0, "instantiated");
+  static const bool value = true;
+};
+template <int> struct T : std::true_type {};
+template <int> struct F : std::false_type {};
+
+static_assert(std::_And<>::value && !std::_Or<>::value, "");
+static_assert(!std::_And<T<0>, F<1>, Poison<int>>::value, "");
+static_assert(std::_Or<F<0>, T<1>, Poison<int>>::value, "");
+static_assert(std::_And<T<0>, T<1>>::value && !std::_Or<F<0>, F<1>>::value, "");
+static_assert(std::is_same<std::_And<T<0>>::type, std::true_type>::value, "");
+
+template <class _Seq> struct all;
+template <int... _Ip> struct all<std::integer_sequence<int, _Ip...>> {
+  static const bool __and = std::_And<T<_Ip>...>::value;
+  static const bool __or  = std::_Or<F<_Ip>...>::value;
+#if _LIBCPP_STD_VER > 14
+  using __conj = std::conjunction<T<_Ip>..., F<-1>, Poison<int>>;
+  using __disj = std::disjunction<F<_Ip>..., T<-1>, Poison<int>>;
+#endif
+};
+template <int _Np> using of = all<std::make_integer_sequence<int, _Np>>;
+
+static_assert(of<1024>::__and && !of<1024>::__or, "");
+
+#if _LIBCPP_STD_VER > 14
+// Every position in a block of eight, and past a few blocks.
+static_assert(!of<0>::__conj::value && of<0>::__disj::value, "");
+static_assert(!of<3>::__conj::value && of<3>::__disj::value, "");
+static_assert(!of<8>::__conj::value && of<8>::__disj::value, "");
+static_assert(!of<9>::__conj::value && of<9>::__disj::value, "");
+static_assert(!of<16>::__conj::value && of<16>::__disj::value, "");
+static_assert(!of<1024>::__conj::value && of<1024>::__disj::value, "");
+static_assert(std::is_base_of<F<-1>, of<9>::__conj>::value && std::is_base_of<T<-1>, of<9>::__disj>::value, "");
+static_assert(std::is_base_of<F<-1>, of<1024>::__conj>::value && std::is_base_of<T<-1>, of<1024>::__disj>::value, "");
+
+static_assert(std::is_base_of<T<5>, std::conjunction<T<1>, T<2>, T<3>, T<4>, T<6>, T<7>, T<8>, T<9>, T<5>>>::value,
+              "");
+static_assert(
+    std::is_base_of<F<3>, std::conjunction<T<1>, T<2>, F<3>, T<4>, T<5>, T<6>, T<7>, T<8>, T<9>, Poison<int>>>::value,
+    "");
+static_assert(std::is_same<std::conjunction<>::type, std::true_type>::value, "");
+static_assert(!std::disjunction_v<> && std::conjunction_v<>, "");
+static_assert(std::disjunction_v<F<0>, T<1>> && !std::conjunction_v<T<0>, F<1>>, "");
+#endif
+
+int main() { return 0; }
@@ -0,0 +1,69 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <type_traits>
+
+// __invoke, invoke_result, is_invocable, is_nothrow_invocable, is_invocable_r
+
+#include "type_traits.hh"
+#include "functional.hh"
+
+#include <cassert>
+
+struct B {
+  int __d = 3;
+  int f(int __x) & { return __x + __d; }
+  int g() const noexcept { return 7; }
+};
+struct D : B {};
+struct F {
+  int operator()(int __a, int __b) const { return __a * __b; }
+};
+int plain(int) noexcept { return 1; }
+
+#if _LIBCPP_STD_VER > 14
+static_assert(std::is_same<std::invoke_result_t<int (B::*)(int) &, B &, int>, int>::value, "");
+static_assert(!std::is_invocable_v<int (B::*)(int) &, B, int>, "");
+static_assert(std::is_same<std::invoke_result_t<int B::*, D &>, int &>::value, "");
+static_assert(std::is_same<std::invoke_result_t<int B::*, D &&>, int &&>::value, "");
+static_assert(std::is_same<std::invoke_result_t<int B::*, const B *>, const int &>::value, "");
+static_assert(std::is_same<std::invoke_result_t<int B::*, std::reference_wrapper<B>>, int &>::value, "");
+static_assert(std::is_nothrow_invocable_v<int (B::*)() const noexcept, const B *>, "");
+static_assert(!std::is_nothrow_invocable_v<F, int, int>, "");
+static_assert(std::is_nothrow_invocable_v<decltype(&plain), int>, "");
+static_assert(!std::is_invocable_v<int B::*>, "");
+static_assert(!std::is_invocable_v<int B::*, B &, int>, "");
+static_assert(std::is_invocable_r_v<long, F, int, int>, "");
+static_assert(!std::is_invocable_r_v<int *, F, int, int>, "");
+static_assert(!std::is_invocable_v<F, int>, "");
+
+constexpr int next(int __x) { return __x + 1; }
+static_assert(std::__invoke(next, 1) == 2, "");
+static_assert(std::__invoke_constexpr(next, 2) == 3, "");
+#endif
+
+int main() {
+  B __b;
+  D __d;
+  F __f;
+  std::reference_wrapper<B> __r(__b);
+  assert(std::__invoke(&B::f, __b, 1) == 4);
+  assert(std::__invoke(&B::f, &__d, 1) == 4);
+  assert(std::__invoke(&B::f, __r, 1) == 4);
+  assert(std::__invoke(&B::g, static_cast<const B *>(&__b)) == 7);
+  assert(std::__invoke(&B::__d, __b) == 3);
+  assert(std::__invoke(&B::__d, &__d) == 3);
+  assert(std::__invoke(&B::__d, __r) == 3);
+  assert(std::__invoke(__f, 2, 3) == 6);
+  assert(std::__invoke(plain, 0) == 1);
+  assert(std::__invoke([] { return 5; }) == 5);
+
+  std::__invoke(&B::__d, __b) = 4;
+  assert(__b.__d == 4);
+  return 0;
+}
@@ -0,0 +1,51 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <type_traits>
+
+// make_signed, make_unsigned, and the smallest/fastest unsigned type for a
+// value: __uint_least_for, __uint_fast_for
+
+#include "type_traits.hh"
+
+enum E1 : unsigned char {};
+enum E4 { x = 1 };
+enum class E8 : long long {};
+
+template <class _Tp, class _Up> constexpr bool same() { return std::is_same<_Tp, _Up>::value; }
+
+static_assert(same<std::make_signed<char>::type, signed char>(), "");
+static_assert(same<std::make_signed<signed char>::type, signed char>(), "");
+static_assert(same<std::make_signed<const unsigned>::type, const int>(), "");
+static_assert(same<std::make_signed<volatile unsigned long>::type, volatile long>(), "");
+static_assert(same<std::make_signed<E4>::type, int>(), "");
+static_assert(same<std::make_signed<unsigned __int128>::type, __int128>(), "");
+
+static_assert(same<std::make_unsigned<char>::type, unsigned char>(), "");
+static_assert(same<std::make_unsigned<const volatile long long>::type, const volatile unsigned long long>(), "");
+static_assert(same<std::make_unsigned<wchar_t>::type, unsigned int>(), "");
+static_assert(same<std::make_unsigned<char16_t>::type, unsigned short>(), "");
+static_assert(same<std::make_unsigned<char32_t>::type, unsigned int>(), "");
+static_assert(same<std::make_unsigned<E1>::type, unsigned char>(), "");
+static_assert(same<std::make_unsigned<E8>::type, unsigned long>(), "");
+static_assert(same<std::make_unsigned<__int128>::type, unsigned __int128>(), "");
+
+static_assert(same<std::__uint_least_for<0>, unsigned char>(), "");
+static_assert(same<std::__uint_least_for<255>, unsigned char>(), "");
+static_assert(same<std::__uint_least_for<256>, unsigned short>(), "");
+static_assert(same<std::__uint_least_for<65536>, unsigned int>(), "");
+static_assert(same<std::__uint_least_for<0x100000000ull>, unsigned long>(), "");
+static_assert(same<std::__uint_fast_for<3>, unsigned int>(), "");
+static_assert(same<std::__uint_fast_for<0x100000000ull>, unsigned long>(), "");
+
+#if _LIBCPP_STD_VER > 11
+static_assert(same<std::make_unsigned_t<short>, unsigned short>(), "");
+static_assert(same<std::make_signed_t<const unsigned char>, const signed char>(), "");
+#endif
+
+int main() { return 0; }
@@ -0,0 +1,56 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <type_traits>
+
+// swap, swap_ranges, iter_swap
+
+#include "type_traits.hh"
+
+#include <cassert>
+
+struct MoveOnly {
+  int __v;
+  explicit MoveOnly(int __x) : __v(__x) {}
+  MoveOnly(MoveOnly &&__o) : __v(__o.__v) { __o.__v = -1; }
+  MoveOnly &operator=(MoveOnly &&__o) {
+    __v     = __o.__v;
+    __o.__v = -1;
+    return *this;
+  }
+};
+
+#if _LIBCPP_STD_VER > 17
+constexpr bool test_constexpr() {
+  int __a[3] = {1, 2, 3}, __b[3] = {4, 5, 6};
+  std::swap(__a, __b);
+  std::iter_swap(__a, __a + 2);
+  return __a[0] == 6 && __a[2] == 4 && __b[0] == 1;
+}
+static_assert(test_constexpr(), "");
+#endif
+
+int main() {
+  int __a[5] = {1, 2, 3, 4, 5}, __b[5] = {6, 7, 8, 9, 10};
+  std::swap(__a, __b);
+  assert(__a[0] == 6 && __a[4] == 10 && __b[0] == 1 && __b[4] == 5);
+  int *__e = std::swap_ranges(__a, __a + 2, __b);
+  assert(__e == __b + 2);
+  assert(__a[0] == 1 && __a[1] == 2 && __a[2] == 8 && __b[0] == 6 && __b[2] == 3);
+
+  long __x = 1, __y = 2;
+  std::iter_swap(&__x, &__y);
+  assert(__x == 2 && __y == 1);
+
+  MoveOnly __m(1), __n(2);
+  std::swap(__m, __n);
+  assert(__m.__v == 2 && __n.__v == 1);
+  static_assert(noexcept(std::swap(__x, __y)), "");
+  static_assert(!noexcept(std::swap(__m, __n)), "");
+  return 0;
+}
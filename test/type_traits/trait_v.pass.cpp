@@ -0,0 +1,167 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <type_traits>
+
+// The *_v variable templates, which no longer go through the trait classes,
+// agree with them on a spread of types.
+
+// UNSUPPORTED: c++11, c++14
+
+#include "type_traits.hh"
+
+enum E {};
+enum class EC : unsigned char {};
+union U {
+  int __a;
+};
+struct S {
+  int __x;
+  void f();
+};
+struct P {
+  virtual ~P();
+};
+struct A {
+  virtual void g() = 0;
+};
+struct Fi final {};
+struct D : P {};
+struct NT {
+  NT(const NT &) noexcept(false);
+  NT &operator=(NT &&);
+  ~NT() noexcept(false);
+};
+
+#define TYPES(X)                                                                                                       \
+  X(void)                                                                                                              \
+  X(const void)                                                                                                        \
+  X(const volatile void)                                                                                               \
+  X(int)                                                                                                               \
+  X(const int)                                                                                                         \
+  X(volatile unsigned)                                                                                                 \
+  X(const volatile long)                                                                                               \
+  X(bool)                                                                                                              \
+  X(char)                                                                                                              \
+  X(unsigned char)                                                                                                     \
+  X(char16_t)                                                                                                          \
+  X(wchar_t)                                                                                                           \
+  X(long long)                                                                                                         \
+  X(unsigned __int128)                                                                                                 \
+  X(float)                                                                                                             \
+  X(const double)                                                                                                      \
+  X(volatile long double)                                                                                              \
+  X(std::nullptr_t)                                                                                                    \
+  X(const std::nullptr_t)                                                                                              \
+  X(int *)                                                                                                             \
+  X(int *const)                                                                                                        \
+  X(const int *const volatile)                                                                                         \
+  X(int &)                                                                                                             \
+  X(int &&)                                                                                                            \
+  X(const int &)                                                                                                       \
+  X(int[3])                                                                                                            \
+  X(int[])                                                                                                             \
+  X(const int[4])                                                                                                      \
+  X(E)                                                                                                                 \
+  X(EC)                                                                                                                \
+  X(U)                                                                                                                 \
+  X(S)                                                                                                                 \
+  X(P)                                                                                                                 \
+  X(A)                                                                                                                 \
+  X(Fi)                                                                                                                \
+  X(D)                                                                                                                 \
+  X(NT)                                                                                                                \
+  X(int())                                                                                                             \
+  X(int(int) const)                                                                                                    \
+  X(void (*)())                                                                                                        \
+  X(int S::*)                                                                                                          \
+  X(int S::*const)                                                                                                     \
+  X(int (S::*)())                                                                                                      \
+  X(int (S::*)() const)                                                                                                \
+  X(int (S::*const volatile)())
+
+#define PAIRS(X)                                                                                                       \
+  X(void, void)                                                                                                        \
+  X(int, int)                                                                                                          \
+  X(int, const int)                                                                                                    \
+  X(int &, int)                                                                                                        \
+  X(int &, double)                                                                                                     \
+  X(int, E)                                                                                                            \
+  X(E, int)                                                                                                            \
+  X(int[3], int *)                                                                                                     \
+  X(S, S)                                                                                                              \
+  X(S &, const S &)                                                                                                    \
+  X(D, P)                                                                                                              \
+  X(P, D)                                                                                                              \
+  X(D *, P *)                                                                                                          \
+  X(NT &, NT)
+
+#define SAME(__trait, ...) (std::__trait##_v<__VA_ARGS__> == std::__trait<__VA_ARGS__>::value)
+
+template <class _Tp> constexpr bool unary() {
+  return SAME(is_void, _Tp) && SAME(is_null_pointer, _Tp) && SAME(is_integral, _Tp) &&
+         SAME(is_floating_point, _Tp) && SAME(is_array, _Tp) && SAME(is_pointer, _Tp) &&
+         SAME(is_lvalue_reference, _Tp) && SAME(is_rvalue_reference, _Tp) && SAME(is_member_object_pointer, _Tp) &&
+         SAME(is_member_function_pointer, _Tp) && SAME(is_enum, _Tp) && SAME(is_union, _Tp) &&
+         SAME(is_class, _Tp) && SAME(is_function, _Tp) && SAME(is_reference, _Tp) && SAME(is_arithmetic, _Tp) &&
+         SAME(is_fundamental, _Tp) && SAME(is_object, _Tp) && SAME(is_scalar, _Tp) && SAME(is_compound, _Tp) &&
+         SAME(is_member_pointer, _Tp) && SAME(is_const, _Tp) && SAME(is_volatile, _Tp) && SAME(is_trivial, _Tp) &&
+         SAME(is_trivially_copyable, _Tp) && SAME(is_standard_layout, _Tp) && SAME(is_pod, _Tp) &&
+         SAME(is_empty, _Tp) && SAME(is_polymorphic, _Tp) && SAME(is_abstract, _Tp) && SAME(is_final, _Tp) &&
+         SAME(is_aggregate, _Tp) && SAME(is_signed, _Tp) && SAME(is_unsigned, _Tp) &&
+         SAME(is_constructible, _Tp) && SAME(is_default_constructible, _Tp) &&
+         SAME(is_copy_constructible, _Tp) && SAME(is_move_constructible, _Tp) && SAME(is_copy_assignable, _Tp) &&
+         SAME(is_move_assignable, _Tp) && SAME(is_destructible, _Tp) && SAME(is_trivially_constructible, _Tp) &&
+         SAME(is_trivially_default_constructible, _Tp) && SAME(is_trivially_copy_constructible, _Tp) &&
+         SAME(is_trivially_move_constructible, _Tp) && SAME(is_trivially_copy_assignable, _Tp) &&
+         SAME(is_trivially_move_assignable, _Tp) && SAME(is_trivially_destructible, _Tp) &&
+         SAME(is_nothrow_constructible, _Tp) && SAME(is_nothrow_default_constructible, _Tp) &&
+         SAME(is_nothrow_copy_constructible, _Tp) && SAME(is_nothrow_move_constructible, _Tp) &&
+         SAME(is_nothrow_copy_assignable, _Tp) && SAME(is_nothrow_move_assignable, _Tp) &&
+         SAME(is_nothrow_destructible, _Tp) && SAME(has_virtual_destructor, _Tp) && SAME(rank, _Tp) &&
+         SAME(extent, _Tp, 0) && SAME(extent, _Tp, 1) && SAME(extent, _Tp, 2)
+#if _LIBCPP_STD_VER > 17
+         && SAME(is_bounded_array, _Tp) && SAME(is_unbounded_array, _Tp)
+#endif
+      ;
+}
+
+template <class _Tp, class _Up> constexpr bool binary() {
+  return SAME(is_same, _Tp, _Up) && SAME(is_base_of, _Tp, _Up) && SAME(is_convertible, _Tp, _Up) &&
+         SAME(is_assignable, _Tp, _Up) && SAME(is_trivially_assignable, _Tp, _Up) &&
+         SAME(is_nothrow_assignable, _Tp, _Up) && SAME(is_constructible, _Tp, _Up) &&
+         SAME(is_trivially_constructible, _Tp, _Up) && SAME(is_nothrow_constructible, _Tp, _Up)
+#if _LIBCPP_STD_VER > 17
+         && SAME(is_nothrow_convertible, _Tp, _Up)
+#endif
+      ;
+}
+
+#define UNARY(...) static_assert(unary<__VA_ARGS__>(), #__VA_ARGS__);
+#define BINARY(...) static_assert(binary<__VA_ARGS__>(), #__VA_ARGS__);
+TYPES(UNARY)
+PAIRS(BINARY)
+
+// Spot checks of the values themselves. Arrays of arrays are only checked
+// here: the is_nothrow_constructible fallback does not handle them.
+static_assert(std::is_same_v<int, int> && !std::is_same_v<int, const int>, "");
+static_assert(std::is_const_v<const int> && !std::is_const_v<const int &> && !std::is_const_v<int() const>, "");
+static_assert(std::is_pointer_v<int *const> && !std::is_pointer_v<int S::*>, "");
+static_assert(std::rank_v<int[2][3]> == 2 && std::extent_v<int[2][3], 1> == 3 && std::extent_v<int[]> == 0, "");
+static_assert(std::is_signed_v<const int> && !std::is_signed_v<unsigned> && !std::is_signed_v<E>, "");
+static_assert(std::is_unsigned_v<bool> && !std::is_unsigned_v<float>, "");
+static_assert(std::is_copy_assignable_v<S> && !std::is_copy_assignable_v<NT> && std::is_move_assignable_v<NT>, "");
+static_assert(!std::is_nothrow_destructible_v<NT> && std::is_nothrow_destructible_v<S>, "");
+static_assert(std::alignment_of_v<double> == alignof(double), "");
+
+struct T1 : std::true_type {};
+struct F1 : std::false_type {};
+static_assert(std::conjunction_v<T1, T1> && !std::conjunction_v<T1, F1>, "");
+static_assert(std::disjunction_v<F1, T1> && std::negation_v<F1>, "");
+
+int main() { return 0; }
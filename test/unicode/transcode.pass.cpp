@@ -0,0 +1,218 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <__unicode>
+
+// template <class C8> size_t __utf8_first_invalid(const C8* p, size_t n) noexcept;
+// template <class C8> __utf_result __utf8_to_utf16(const C8* src, size_t n, char16_t* dst) noexcept;
+// template <class C8> __utf_result __utf8_to_utf32(const C8* src, size_t n, char32_t* dst) noexcept;
+// template <class C8> __utf_result __utf16_to_utf8(const char16_t* src, size_t n, C8* dst) noexcept;
+// template <class C8> __utf_result __utf32_to_utf8(const char32_t* src, size_t n, C8* dst) noexcept;
+
+// Random text of every mix of sequence lengths round trips through UTF-16
+// and UTF-32, and mutated text stops every function at the first ill-formed
+// sequence a bytewise reference finds. The vector paths are built by the
+// -mssse3 and -mavx2 variants of this test.
+
+// UNSUPPORTED: c++11, c++14
+
+#include "__unicode.hh"
+
+#include <cassert>
+#include <stddef.h>
+
+static size_t __reference(const unsigned char *__p, size_t __n) {
+  size_t __i = 0;
+  while (__i < __n) {
+    const unsigned __b = __p[__i];
+    size_t __len;
+    unsigned __lo = 0x80, __hi = 0xbf;
+    if (__b < 0x80) {
+      ++__i;
+      continue;
+    } else if (__b >= 0xc2 && __b <= 0xdf)
+      __len = 2;
+    else if (__b >= 0xe0 && __b <= 0xef) {
+      __len = 3;
+      __lo  = __b == 0xe0 ? 0xa0 : __lo;
+      __hi  = __b == 0xed ? 0x9f : __hi;
+    } else if (__b >= 0xf0 && __b <= 0xf4) {
+      __len = 4;
+      __lo  = __b == 0xf0 ? 0x90 : __lo;
+      __hi  = __b == 0xf4 ? 0x8f : __hi;
+    } else
+      return __i;
+    if (__n - __i < __len || __p[__i + 1] < __lo || __p[__i + 1] > __hi)
+      return __i;
+    for (size_t __k = 2; __k < __len; ++__k)
+      if ((__p[__i + __k] & 0xc0) != 0x80)
+        return __i;
+    __i += __len;
+  }
+  return __n;
+}
+
+static unsigned long long __state = 88172645463325252ull;
+static unsigned __random() {
+  __state ^= __state << 13;
+  __state ^= __state >> 7;
+  __state ^= __state << 17;
+  return static_cast<unsigned>(__state);
+}
+
+// Well-formed UTF-8 of at most __n bytes; __lengths has bit k - 1 set for
+// each sequence length k to draw from.
+static size_t __generate(unsigned char *__p, size_t __n, unsigned __lengths) {
+  size_t __i = 0;
+  while (__i + 4 <= __n) {
+    unsigned __len;
+    do
+      __len = 1 + __random() % 4;
+    while (!((__lengths >> (__len - 1)) & 1));
+    char32_t __cp;
+    switch (__len) {
+    case 1:
+      __cp = __random() % 0x80;
+      break;
+    case 2:
+      __cp = 0x80 + __random() % 0x780;
+      break;
+    case 3:
+      do
+        __cp = 0x800 + __random() % 0xf800;
+      while (__cp >= 0xd800 && __cp <= 0xdfff);
+      break;
+    default:
+      __cp = 0x10000 + __random() % 0x100000;
+    }
+    __i += std::__utf8_encode(__cp, __p + __i);
+  }
+  return __i;
+}
+
+#if __cplusplus > 201703L
+constexpr bool __constant() {
+  const char8_t __s[] = u8"héllo € \U0001F600";
+  char16_t __u16[32]  = {};
+  char32_t __u32[32]  = {};
+  char8_t __back[64]  = {};
+  const size_t __n    = sizeof(__s) - 1;
+  if (!std::__utf8_validate(__s, __n))
+    return false;
+  const std::__utf_result __r = std::__utf8_to_utf16(__s, __n, __u16);
+  if (__r.__in != __n || __r.__out != 10)
+    return false;
+  if (std::__utf16_to_utf8(__u16, __r.__out, __back).__out != __n)
+    return false;
+  for (size_t __i = 0; __i < __n; ++__i)
+    if (__back[__i] != __s[__i])
+      return false;
+  const std::__utf_result __r32 = std::__utf8_to_utf32(__s, __n, __u32);
+  if (__r32.__out != 9 || __u32[8] != 0x1F600)
+    return false;
+  const char __bad[] = "ab\xed\xa0\x80";
+  return std::__utf8_first_invalid(__bad, 5) == 2;
+}
+static_assert(__constant());
+#endif
+
+static unsigned char __text[4096], __mutated[4096];
+static char16_t __u16[4096];
+static char32_t __u32[4096];
+static unsigned char __back[4 * 4096];
+
+static void __round_trip(size_t __n) {
+  const char *__s = reinterpret_cast<const char *>(__text);
+  char *__b       = reinterpret_cast<char *>(__back);
+  assert(__reference(__text, __n) == __n);
+  assert(std::__utf8_first_invalid(__s, __n) == __n);
+
+  const std::__utf_result __r16 = std::__utf8_to_utf16(__s, __n, __u16);
+  assert(__r16.__in == __n);
+  const std::__utf_result __b16 = std::__utf16_to_utf8(__u16, __r16.__out, __b);
+  assert(__b16.__in == __r16.__out && __b16.__out == __n);
+  for (size_t __i = 0; __i < __n; ++__i)
+    assert(__back[__i] == __text[__i]);
+
+  const std::__utf_result __r32 = std::__utf8_to_utf32(__s, __n, __u32);
+  assert(__r32.__in == __n);
+  size_t __o = 0;
+  for (size_t __i = 0; __i < __r16.__out; ++__i, ++__o) {
+    char32_t __c = __u16[__i];
+    if (__c >= 0xd800 && __c <= 0xdbff)
+      __c = 0x10000 + ((__c - 0xd800) << 10) + (__u16[++__i] - 0xdc00);
+    assert(__u32[__o] == __c);
+  }
+  assert(__o == __r32.__out);
+  const std::__utf_result __b32 = std::__utf32_to_utf8(__u32, __r32.__out, __b);
+  assert(__b32.__in == __r32.__out && __b32.__out == __n);
+  for (size_t __i = 0; __i < __n; ++__i)
+    assert(__back[__i] == __text[__i]);
+}
+
+int main(int, char **) {
+  for (int __it = 0; __it < 20000; ++__it) {
+    // Every subset of the lengths: ASCII only, Latin, CJK and the mixes.
+    const size_t __n = __generate(__text, 1 + __random() % 1200, 1 + __it % 15);
+    __round_trip(__n);
+    if (__n == 0)
+      continue;
+
+    for (int __k = 0; __k < 4; ++__k) {
+      for (size_t __i = 0; __i < __n; ++__i)
+        __mutated[__i] = __text[__i];
+      for (unsigned __j = 1 + __random() % 3; __j != 0; --__j)
+        __mutated[__random() % __n] =
+            static_cast<unsigned char>(__random() % 3 == 0 ? __random() : 0x80 + __random() % 0x80);
+      const size_t __m = __k == 3 ? __random() % (__n + 1) : __n;
+      const size_t __e = __reference(__mutated, __m);
+      const char *__s  = reinterpret_cast<const char *>(__mutated);
+      assert(std::__utf8_first_invalid(__s, __m) == __e);
+      assert(std::__utf8_to_utf16(__s, __m, __u16).__in == __e);
+      assert(std::__utf8_to_utf32(__s, __m, __u32).__in == __e);
+    }
+  }
+
+  // Every sequence of up to three bytes, straddling a 64-byte block.
+  for (unsigned __a = 0; __a < 256; ++__a)
+    for (unsigned __b = 0; __b < 256; ++__b)
+      for (unsigned __c = 0; __c < 256; __c += __a >= 0xe0 ? 1 : 37) {
+        for (size_t __i = 0; __i < 200; ++__i)
+          __mutated[__i] = 'x';
+        const size_t __pos    = 62 + (__a + __b) % 3;
+        __mutated[__pos]     = static_cast<unsigned char>(__a);
+        __mutated[__pos + 1] = static_cast<unsigned char>(__b);
+        __mutated[__pos + 2] = static_cast<unsigned char>(__c);
+        __mutated[__pos + 3] = static_cast<unsigned char>(0x80 + (__c & 0x3f));
+        const char *__s      = reinterpret_cast<const char *>(__mutated);
+        const size_t __e     = __reference(__mutated, 200);
+        assert(std::__utf8_first_invalid(__s, 200) == __e);
+        assert(std::__utf8_to_utf16(__s, 200, __u16).__in == __e);
+      }
+
+  // Unpaired surrogates and code points past U+10FFFF, after enough text
+  // for the vector loops to have started.
+  char16_t __s16[64];
+  char32_t __s32[64];
+  for (size_t __at = 0; __at < 40; ++__at) {
+    for (size_t __i = 0; __i < 64; ++__i) {
+      __s16[__i] = static_cast<char16_t>(__i % 3 == 0 ? 'a' : 0x3b1 + __i);
+      __s32[__i] = __s16[__i];
+    }
+    __s16[__at] = 0xd800;
+    assert(std::__utf16_to_utf8(__s16, 64, reinterpret_cast<char *>(__back)).__in == __at);
+    __s16[__at] = 0xdc00;
+    assert(std::__utf16_to_utf8(__s16, 64, reinterpret_cast<char *>(__back)).__in == __at);
+    __s32[__at] = 0x110000;
+    assert(std::__utf32_to_utf8(__s32, 64, reinterpret_cast<char *>(__back)).__in == __at);
+    __s32[__at] = 0xdfff;
+    assert(std::__utf32_to_utf8(__s32, 64, reinterpret_cast<char *>(__back)).__in == __at);
+  }
+
+  return 0;
+}
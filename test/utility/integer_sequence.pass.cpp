@@ -0,0 +1,29 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <utility>
+
+// integer_sequence, __make_index_sequence, __type_pack_element_t, __type_list_element_t
+
+#include "utility.hh"
+
+using std::is_same;
+
+static_assert(is_same<std::__make_index_sequence<0>, std::__index_sequence<>>::value, "");
+static_assert(is_same<std::__make_index_sequence<7>, std::__index_sequence<0, 1, 2, 3, 4, 5, 6>>::value, "");
+static_assert(is_same<std::__type_pack_element_t<2, int, char, long, void>, long>::value, "");
+static_assert(is_same<std::__type_list_element_t<0, std::__type_list<int &>>, int &>::value, "");
+
+#if _LIBCPP_STD_VER > 11
+static_assert(is_same<std::make_integer_sequence<int, 3>, std::integer_sequence<int, 0, 1, 2>>::value, "");
+static_assert(is_same<std::make_index_sequence<0>, std::index_sequence<>>::value, "");
+static_assert(std::index_sequence_for<int, int>::size() == 2, "");
+static_assert(std::make_integer_sequence<long, 1000>::size() == 1000, "");
+#endif
+
+int main() { return 0; }
@@ -460,29 +460,32 @@ template <> struct _MetaBase<true> {
   template <class _First, class...> using _FirstImpl _LIBCPP_NODEBUG_TYPE          = _First;
   template <class, class _Second, class...> using _SecondImpl _LIBCPP_NODEBUG_TYPE = _Second;
   template <class _Tp = void> using _EnableIfImpl _LIBCPP_NODEBUG_TYPE             = _Tp;
-  template <class _Result, class _First, class... _Rest>
-  using _OrImpl _LIBCPP_NODEBUG_TYPE =
-      typename _MetaBase<_First::value != true && sizeof...(_Rest) != 0>::template _OrImpl<_First, _Rest...>;
-  template <class _Result, class _First, class... _Rest>
-  using _AndImpl _LIBCPP_NODEBUG_TYPE =
-      typename _MetaBase<_First::value == true && sizeof...(_Rest) != 0>::template _AndImpl<_First, _Rest...>;
 };
 
 template <> struct _MetaBase<false> {
   template <class _Tp, class _Up> using _SelectImpl _LIBCPP_NODEBUG_TYPE = _Up;
   template <template <class...> class, template <class...> class _SecondFn, class... _Args>
-  using _SelectApplyImpl _LIBCPP_NODEBUG_TYPE                            = _SecondFn<_Args...>;
-  template <class _Result, class...> using _OrImpl _LIBCPP_NODEBUG_TYPE  = _Result;
-  template <class _Result, class...> using _AndImpl _LIBCPP_NODEBUG_TYPE = _Result;
+  using _SelectApplyImpl _LIBCPP_NODEBUG_TYPE = _SecondFn<_Args...>;
 };
 template <bool _Cond, class _Ret = void>
 using _EnableIf _LIBCPP_NODEBUG_TYPE = typename _MetaBase<_Cond>::template _EnableIfImpl<_Ret>;
 template <bool _Cond, class _IfRes, class _ElseRes>
 using _If _LIBCPP_NODEBUG_TYPE = typename _MetaBase<_Cond>::template _SelectImpl<_IfRes, _ElseRes>;
-template <class... _Rest>
-using _Or _LIBCPP_NODEBUG_TYPE = typename _MetaBase<sizeof...(_Rest) != 0>::template _OrImpl<false_type, _Rest...>;
-template <class... _Rest>
-using _And _LIBCPP_NODEBUG_TYPE = typename _MetaBase<sizeof...(_Rest) != 0>::template _AndImpl<true_type, _Rest...>;
+
+// _And and _Or are computed in a single substitution rather than one nested
+// alias per predicate. Template arguments are substituted in order and
+// substitution stops at the first failure, so the predicates after the one
+// that decides the result are never instantiated.
+template <class... _Pred>
+auto __and_helper(int) -> typename _MetaBase<true>::template _FirstImpl<true_type, _EnableIf<bool(_Pred::value)>...>;
+template <class...> false_type __and_helper(...);
+
+template <class... _Pred>
+auto __or_helper(int) -> typename _MetaBase<true>::template _FirstImpl<false_type, _EnableIf<!bool(_Pred::value)>...>;
+template <class...> true_type __or_helper(...);
+
+template <class... _Rest> using _Or _LIBCPP_NODEBUG_TYPE  = decltype(__or_helper<_Rest...>(0));
+template <class... _Rest> using _And _LIBCPP_NODEBUG_TYPE = decltype(__and_helper<_Rest...>(0));
 template <class _Pred> struct _Not : _BoolConstant<!_Pred::value> {};
 template <class... _Args>
 using _FirstType _LIBCPP_NODEBUG_TYPE = typename _MetaBase<(sizeof...(_Args) >= 1)>::template _FirstImpl<_Args...>;
@@ -535,7 +538,8 @@ template <class _Tp, class _Up> struct _LIBCPP_TEMPLATE_VIS is_same : public fal
 template <class _Tp> struct _LIBCPP_TEMPLATE_VIS is_same<_Tp, _Tp> : public true_type {};
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
-template <class _Tp, class _Up> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_same_v = is_same<_Tp, _Up>::value;
+template <class _Tp, class _Up> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_same_v = false;
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_same_v<_Tp, _Tp> = true;
 #endif
 
 #endif // __is_same
@@ -628,7 +632,8 @@ template <class _Tp> struct _LIBCPP_TEMPLATE_VIS is_const : public false_type {}
 template <class _Tp> struct _LIBCPP_TEMPLATE_VIS is_const<_Tp const> : public true_type {};
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
-template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_const_v = is_const<_Tp>::value;
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_const_v = false;
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_const_v<_Tp const> = true;
 #endif
 
 #endif // __has_keyword(__is_const)
@@ -649,7 +654,8 @@ template <class _Tp> struct _LIBCPP_TEMPLATE_VIS is_volatile : public false_type
 template <class _Tp> struct _LIBCPP_TEMPLATE_VIS is_volatile<_Tp volatile> : public true_type {};
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
-template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_volatile_v = is_volatile<_Tp>::value;
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_volatile_v = false;
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_volatile_v<_Tp volatile> = true;
 #endif
 
 #endif // __has_keyword(__is_volatile)
@@ -730,7 +736,11 @@ template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_void_v = __is_
 template <class _Tp> struct _LIBCPP_TEMPLATE_VIS is_void : public is_same<typename remove_cv<_Tp>::type, void> {};
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
-template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_void_v = is_void<_Tp>::value;
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_void_v = false;
+template <> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_void_v<void> = true;
+template <> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_void_v<const void> = true;
+template <> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_void_v<volatile void> = true;
+template <> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_void_v<const volatile void> = true;
 #endif
 
 #endif // __has_keyword(__is_void)
@@ -748,7 +758,11 @@ template <class _Tp>
 struct _LIBCPP_TEMPLATE_VIS is_null_pointer : public __is_nullptr_t_impl<typename remove_cv<_Tp>::type> {};
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
-template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_null_pointer_v = is_null_pointer<_Tp>::value;
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_null_pointer_v = false;
+template <> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_null_pointer_v<nullptr_t> = true;
+template <> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_null_pointer_v<const nullptr_t> = true;
+template <> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_null_pointer_v<volatile nullptr_t> = true;
+template <> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_null_pointer_v<const volatile nullptr_t> = true;
 #endif
 #endif // _LIBCPP_STD_VER > 11
 
@@ -769,7 +783,10 @@ struct _LIBCPP_TEMPLATE_VIS is_integral
     : public _BoolConstant<__libcpp_is_integral<typename remove_cv<_Tp>::type>::value> {};
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
-template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_integral_v = is_integral<_Tp>::value;
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_integral_v = __libcpp_is_integral<_Tp>::value;
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_integral_v<const _Tp> = is_integral_v<_Tp>;
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_integral_v<volatile _Tp> = is_integral_v<_Tp>;
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_integral_v<const volatile _Tp> = is_integral_v<_Tp>;
 #endif
 
 #endif // __has_keyword(__is_integral)
@@ -785,7 +802,15 @@ template <class _Tp>
 struct _LIBCPP_TEMPLATE_VIS is_floating_point : public __libcpp_is_floating_point<typename remove_cv<_Tp>::type> {};
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
-template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_floating_point_v = is_floating_point<_Tp>::value;
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_floating_point_v = false;
+template <> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_floating_point_v<float> = true;
+template <> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_floating_point_v<double> = true;
+template <> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_floating_point_v<long double> = true;
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_floating_point_v<const _Tp> = is_floating_point_v<_Tp>;
+template <class _Tp>
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_floating_point_v<volatile _Tp> = is_floating_point_v<_Tp>;
+template <class _Tp>
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_floating_point_v<const volatile _Tp> = is_floating_point_v<_Tp>;
 #endif
 
 // is_array
@@ -805,7 +830,9 @@ template <class _Tp> struct _LIBCPP_TEMPLATE_VIS is_array<_Tp[]> : public true_t
 template <class _Tp, size_t _Np> struct _LIBCPP_TEMPLATE_VIS is_array<_Tp[_Np]> : public true_type {};
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
-template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_array_v = is_array<_Tp>::value;
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_array_v = false;
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_array_v<_Tp[]> = true;
+template <class _Tp, size_t _Np> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_array_v<_Tp[_Np]> = true;
 #endif
 
 #endif // __has_keyword(__is_array)
@@ -839,7 +866,15 @@ struct _LIBCPP_TEMPLATE_VIS is_pointer
     : public __libcpp_is_pointer<typename __libcpp_remove_objc_qualifiers<typename remove_cv<_Tp>::type>::type> {};
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
+#if defined(_LIBCPP_HAS_OBJC_ARC)
 template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_pointer_v = is_pointer<_Tp>::value;
+#else
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_pointer_v = false;
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_pointer_v<_Tp *> = true;
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_pointer_v<_Tp *const> = true;
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_pointer_v<_Tp *volatile> = true;
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_pointer_v<_Tp *const volatile> = true;
+#endif
 #endif
 
 #endif // __has_keyword(__is_pointer)
@@ -875,11 +910,15 @@ template <class _Tp> struct _LIBCPP_TEMPLATE_VIS is_reference<_Tp &> : public tr
 template <class _Tp> struct _LIBCPP_TEMPLATE_VIS is_reference<_Tp &&> : public true_type {};
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
-template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_reference_v = is_reference<_Tp>::value;
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_reference_v = false;
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_reference_v<_Tp &> = true;
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_reference_v<_Tp &&> = true;
 
-template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_lvalue_reference_v = is_lvalue_reference<_Tp>::value;
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_lvalue_reference_v = false;
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_lvalue_reference_v<_Tp &> = true;
 
-template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_rvalue_reference_v = is_rvalue_reference<_Tp>::value;
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_rvalue_reference_v = false;
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_rvalue_reference_v<_Tp &&> = true;
 #endif
 
 #endif // __has_keyword(__is_lvalue_reference) && etc...
@@ -890,23 +929,31 @@ template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_rvalue_referen
 
 template <class _Tp> struct _LIBCPP_TEMPLATE_VIS is_union : public integral_constant<bool, __is_union(_Tp)> {};
 
+#if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_union_v = __is_union(_Tp);
+#endif
+
 #else
 
 template <class _Tp> struct __libcpp_union : public false_type {};
 template <class _Tp> struct _LIBCPP_TEMPLATE_VIS is_union : public __libcpp_union<typename remove_cv<_Tp>::type> {};
 
-#endif
-
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
 template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_union_v = is_union<_Tp>::value;
 #endif
 
+#endif
+
 // is_class
 
 #if __has_feature(is_class) || defined(_LIBCPP_COMPILER_GCC)
 
 template <class _Tp> struct _LIBCPP_TEMPLATE_VIS is_class : public integral_constant<bool, __is_class(_Tp)> {};
 
+#if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_class_v = __is_class(_Tp);
+#endif
+
 #else
 
 namespace __is_class_imp {
@@ -918,10 +965,11 @@ template <class _Tp>
 struct _LIBCPP_TEMPLATE_VIS is_class
     : public integral_constant<bool, sizeof(__is_class_imp::__test<_Tp>(0)) == 1 && !is_union<_Tp>::value> {};
 
+#if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
+template <class _Tp>
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_class_v = sizeof(__is_class_imp::__test<_Tp>(0)) == 1 && !is_union_v<_Tp>;
 #endif
 
-#if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
-template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_class_v = is_class<_Tp>::value;
 #endif
 
 // is_function
@@ -937,7 +985,13 @@ struct _LIBCPP_TEMPLATE_VIS is_function : public _BoolConstant<
 };
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
-template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_function_v = is_function<_Tp>::value;
+template <class _Tp>
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_function_v =
+#ifdef __clang__
+    __is_function(_Tp);
+#else
+    !(is_reference_v<_Tp> || is_const_v<const _Tp>);
+#endif
 #endif
 
 template <class _Tp> struct __libcpp_is_member_pointer {
@@ -968,8 +1022,15 @@ struct _LIBCPP_TEMPLATE_VIS is_member_function_pointer
     : public _BoolConstant<__libcpp_is_member_pointer<typename remove_cv<_Tp>::type>::__is_func> {};
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
-template <class _Tp>
-_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_member_function_pointer_v = is_member_function_pointer<_Tp>::value;
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_member_function_pointer_v = false;
+template <class _Tp, class _Up>
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_member_function_pointer_v<_Tp _Up::*> = is_function_v<_Tp>;
+template <class _Tp, class _Up>
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_member_function_pointer_v<_Tp _Up::*const> = is_function_v<_Tp>;
+template <class _Tp, class _Up>
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_member_function_pointer_v<_Tp _Up::*volatile> = is_function_v<_Tp>;
+template <class _Tp, class _Up>
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_member_function_pointer_v<_Tp _Up::*const volatile> = is_function_v<_Tp>;
 #endif
 
 #endif // __has_keyword(__is_member_function_pointer)
@@ -991,7 +1052,12 @@ struct _LIBCPP_TEMPLATE_VIS is_member_pointer
     : public _BoolConstant<__libcpp_is_member_pointer<typename remove_cv<_Tp>::type>::__is_member> {};
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
-template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_member_pointer_v = is_member_pointer<_Tp>::value;
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_member_pointer_v = false;
+template <class _Tp, class _Up> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_member_pointer_v<_Tp _Up::*> = true;
+template <class _Tp, class _Up> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_member_pointer_v<_Tp _Up::*const> = true;
+template <class _Tp, class _Up> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_member_pointer_v<_Tp _Up::*volatile> = true;
+template <class _Tp, class _Up>
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_member_pointer_v<_Tp _Up::*const volatile> = true;
 #endif
 
 #endif // __has_keyword(__is_member_pointer)
@@ -1015,8 +1081,15 @@ struct _LIBCPP_TEMPLATE_VIS is_member_object_pointer
     : public _BoolConstant<__libcpp_is_member_pointer<typename remove_cv<_Tp>::type>::__is_obj> {};
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
-template <class _Tp>
-_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_member_object_pointer_v = is_member_object_pointer<_Tp>::value;
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_member_object_pointer_v = false;
+template <class _Tp, class _Up>
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_member_object_pointer_v<_Tp _Up::*> = !is_function_v<_Tp>;
+template <class _Tp, class _Up>
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_member_object_pointer_v<_Tp _Up::*const> = !is_function_v<_Tp>;
+template <class _Tp, class _Up>
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_member_object_pointer_v<_Tp _Up::*volatile> = !is_function_v<_Tp>;
+template <class _Tp, class _Up>
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_member_object_pointer_v<_Tp _Up::*const volatile> = !is_function_v<_Tp>;
 #endif
 
 #endif // __has_keyword(__is_member_object_pointer)
@@ -1042,7 +1115,10 @@ struct _LIBCPP_TEMPLATE_VIS is_enum
                                          !is_class<_Tp>::value && !is_function<_Tp>::value> {};
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
-template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_enum_v = is_enum<_Tp>::value;
+template <class _Tp>
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_enum_v =
+    !is_void_v<_Tp> && !is_integral_v<_Tp> && !is_floating_point_v<_Tp> && !is_array_v<_Tp> && !is_pointer_v<_Tp> &&
+    !is_reference_v<_Tp> && !is_member_pointer_v<_Tp> && !is_union_v<_Tp> && !is_class_v<_Tp> && !is_function_v<_Tp>;
 #endif
 
 #endif // __has_feature(is_enum) || defined(_LIBCPP_COMPILER_GCC)
@@ -1054,7 +1130,8 @@ struct _LIBCPP_TEMPLATE_VIS is_arithmetic
     : public integral_constant<bool, is_integral<_Tp>::value || is_floating_point<_Tp>::value> {};
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
-template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_arithmetic_v = is_arithmetic<_Tp>::value;
+template <class _Tp>
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_arithmetic_v = is_integral_v<_Tp> || is_floating_point_v<_Tp>;
 #endif
 
 // is_fundamental
@@ -1076,7 +1153,9 @@ struct _LIBCPP_TEMPLATE_VIS is_fundamental
     : public integral_constant<bool, is_void<_Tp>::value || __is_nullptr_t<_Tp>::value || is_arithmetic<_Tp>::value> {};
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
-template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_fundamental_v = is_fundamental<_Tp>::value;
+template <class _Tp>
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_fundamental_v =
+    is_void_v<_Tp> || is_null_pointer_v<_Tp> || is_arithmetic_v<_Tp>;
 #endif
 
 #endif // __has_keyword(__is_fundamental)
@@ -1108,7 +1187,13 @@ struct _LIBCPP_TEMPLATE_VIS is_scalar
 template <> struct _LIBCPP_TEMPLATE_VIS is_scalar<nullptr_t> : public true_type {};
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
+#if defined(_LIBCPP_HAS_EXTENSION_BLOCKS)
 template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_scalar_v = is_scalar<_Tp>::value;
+#else
+template <class _Tp>
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_scalar_v = is_arithmetic_v<_Tp> || is_member_pointer_v<_Tp> ||
+                                                        is_pointer_v<_Tp> || is_null_pointer_v<_Tp> || is_enum_v<_Tp>;
+#endif
 #endif
 
 #endif // __has_keyword(__is_scalar)
@@ -1131,7 +1216,9 @@ struct _LIBCPP_TEMPLATE_VIS is_object
                                          is_class<_Tp>::value> {};
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
-template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_object_v = is_object<_Tp>::value;
+template <class _Tp>
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_object_v =
+    is_scalar_v<_Tp> || is_array_v<_Tp> || is_union_v<_Tp> || is_class_v<_Tp>;
 #endif
 
 #endif // __has_keyword(__is_object)
@@ -1153,7 +1240,7 @@ template <class _Tp>
 struct _LIBCPP_TEMPLATE_VIS is_compound : public integral_constant<bool, !is_fundamental<_Tp>::value> {};
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
-template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_compound_v = is_compound<_Tp>::value;
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_compound_v = !is_fundamental_v<_Tp>;
 #endif
 
 #endif // __has_keyword(__is_compound)
@@ -1225,6 +1312,9 @@ template <class _Tp> struct _LIBCPP_TEMPLATE_VIS add_lvalue_reference {
 template <class _Tp> using add_lvalue_reference_t = typename add_lvalue_reference<_Tp>::type;
 #endif
 
+template <class _Tp>
+using __add_lvalue_reference_t _LIBCPP_NODEBUG_TYPE = typename __add_lvalue_reference_impl<_Tp>::type;
+
 template <class _Tp, bool = __is_referenceable<_Tp>::value> struct __add_rvalue_reference_impl {
   typedef _LIBCPP_NODEBUG_TYPE _Tp type;
 };
@@ -1238,6 +1328,9 @@ template <class _Tp> struct _LIBCPP_TEMPLATE_VIS add_rvalue_reference {
 template <class _Tp> using add_rvalue_reference_t = typename add_rvalue_reference<_Tp>::type;
 #endif
 
+template <class _Tp>
+using __add_rvalue_reference_t _LIBCPP_NODEBUG_TYPE = typename __add_rvalue_reference_impl<_Tp>::type;
+
 // Suppress deprecation notice for volatile-qualified return type resulting
 // from volatile-qualified types _Tp.
 _LIBCPP_SUPPRESS_DEPRECATED_PUSH
@@ -1341,7 +1434,14 @@ template <class _Tp> struct __libcpp_is_signed<_Tp, false> : public false_type {
 template <class _Tp> struct _LIBCPP_TEMPLATE_VIS is_signed : public __libcpp_is_signed<_Tp> {};
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
-template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_signed_v = is_signed<_Tp>::value;
+template <class _Tp> _LIBCPP_INLINE_VISIBILITY constexpr bool __libcpp_is_signed_v_imp() noexcept {
+  if constexpr (is_integral_v<_Tp>)
+    return _Tp(-1) < _Tp(0);
+  else
+    return is_floating_point_v<_Tp>;
+}
+
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_signed_v = __libcpp_is_signed_v_imp<_Tp>();
 #endif
 
 #endif // __has_keyword(__is_signed)
@@ -1371,7 +1471,14 @@ template <class _Tp> struct __libcpp_is_unsigned<_Tp, false> : public false_type
 template <class _Tp> struct _LIBCPP_TEMPLATE_VIS is_unsigned : public __libcpp_is_unsigned<_Tp> {};
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
-template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_unsigned_v = is_unsigned<_Tp>::value;
+template <class _Tp> _LIBCPP_INLINE_VISIBILITY constexpr bool __libcpp_is_unsigned_v_imp() noexcept {
+  if constexpr (is_integral_v<_Tp>)
+    return _Tp(0) < _Tp(-1);
+  else
+    return false;
+}
+
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_unsigned_v = __libcpp_is_unsigned_v_imp<_Tp>();
 #endif
 
 #endif // __has_keyword(__is_unsigned)
@@ -1385,7 +1492,9 @@ template <class _Tp, size_t _Np>
 struct _LIBCPP_TEMPLATE_VIS rank<_Tp[_Np]> : public integral_constant<size_t, rank<_Tp>::value + 1> {};
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
-template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR size_t rank_v = rank<_Tp>::value;
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR size_t rank_v = 0;
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR size_t rank_v<_Tp[]> = rank_v<_Tp> + 1;
+template <class _Tp, size_t _Np> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR size_t rank_v<_Tp[_Np]> = rank_v<_Tp> + 1;
 #endif
 
 // extent
@@ -1411,7 +1520,12 @@ template <class _Tp, size_t _Np, unsigned _Ip>
 struct _LIBCPP_TEMPLATE_VIS extent<_Tp[_Np], _Ip> : public integral_constant<size_t, extent<_Tp, _Ip - 1>::value> {};
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
-template <class _Tp, unsigned _Ip = 0> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR size_t extent_v = extent<_Tp, _Ip>::value;
+template <class _Tp, unsigned _Ip = 0> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR size_t extent_v = 0;
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR size_t extent_v<_Tp[], 0> = 0;
+template <class _Tp, unsigned _Ip> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR size_t extent_v<_Tp[], _Ip> = extent_v<_Tp, _Ip - 1>;
+template <class _Tp, size_t _Np> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR size_t extent_v<_Tp[_Np], 0> = _Np;
+template <class _Tp, size_t _Np, unsigned _Ip>
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR size_t extent_v<_Tp[_Np], _Ip> = extent_v<_Tp, _Ip - 1>;
 #endif
 
 #endif // __has_keyword(__array_extent)
@@ -1446,14 +1560,16 @@ template <class _Tp> using remove_all_extents_t = typename remove_all_extents<_T
 template <class> struct _LIBCPP_TEMPLATE_VIS is_bounded_array : false_type {};
 template <class _Tp, size_t _Np> struct _LIBCPP_TEMPLATE_VIS is_bounded_array<_Tp[_Np]> : true_type {};
 
-template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_bounded_array_v = is_bounded_array<_Tp>::value;
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_bounded_array_v = false;
+template <class _Tp, size_t _Np> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_bounded_array_v<_Tp[_Np]> = true;
 
 // is_unbounded_array
 
 template <class> struct _LIBCPP_TEMPLATE_VIS is_unbounded_array : false_type {};
 template <class _Tp> struct _LIBCPP_TEMPLATE_VIS is_unbounded_array<_Tp[]> : true_type {};
 
-template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_unbounded_array_v = is_unbounded_array<_Tp>::value;
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_unbounded_array_v = false;
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_unbounded_array_v<_Tp[]> = true;
 #endif
 
 // decay
@@ -1485,7 +1601,7 @@ template <class _Tp> using decay_t = typename decay<_Tp>::type;
 template <class _Tp> struct _LIBCPP_TEMPLATE_VIS is_abstract : public integral_constant<bool, __is_abstract(_Tp)> {};
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
-template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_abstract_v = is_abstract<_Tp>::value;
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_abstract_v = __is_abstract(_Tp);
 #endif
 
 // is_final
@@ -1497,7 +1613,7 @@ template <class _Tp> struct _LIBCPP_TEMPLATE_VIS is_final : public integral_cons
 #endif
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
-template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_final_v = is_final<_Tp>::value;
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_final_v = __is_final(_Tp);
 #endif
 
 // is_aggregate
@@ -1506,7 +1622,7 @@ template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_final_v = is_f
 template <class _Tp> struct _LIBCPP_TEMPLATE_VIS is_aggregate : public integral_constant<bool, __is_aggregate(_Tp)> {};
 
 #if !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
-template <class _Tp> _LIBCPP_INLINE_VAR constexpr bool is_aggregate_v = is_aggregate<_Tp>::value;
+template <class _Tp> _LIBCPP_INLINE_VAR constexpr bool is_aggregate_v = __is_aggregate(_Tp);
 #endif
 
 #endif // _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_IS_AGGREGATE)
@@ -1517,7 +1633,7 @@ template <class _Bp, class _Dp>
 struct _LIBCPP_TEMPLATE_VIS is_base_of : public integral_constant<bool, __is_base_of(_Bp, _Dp)> {};
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
-template <class _Bp, class _Dp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_base_of_v = is_base_of<_Bp, _Dp>::value;
+template <class _Bp, class _Dp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_base_of_v = __is_base_of(_Bp, _Dp);
 #endif
 
 // is_convertible
@@ -1527,6 +1643,11 @@ template <class _Bp, class _Dp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_bas
 template <class _T1, class _T2>
 struct _LIBCPP_TEMPLATE_VIS is_convertible : public integral_constant<bool, __is_convertible_to(_T1, _T2)> {};
 
+#if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
+template <class _From, class _To>
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_convertible_v = __is_convertible_to(_From, _To);
+#endif
+
 #else // __has_feature(is_convertible_to)
 
 namespace __is_convertible_imp {
@@ -1589,13 +1710,13 @@ template <class _T1, class _T2> struct _LIBCPP_TEMPLATE_VIS is_convertible : pub
   static const size_t __complete_check2 = __is_convertible_check<_T2>::__v;
 };
 
-#endif // __has_feature(is_convertible_to)
-
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
 template <class _From, class _To>
 _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_convertible_v = is_convertible<_From, _To>::value;
 #endif
 
+#endif // __has_feature(is_convertible_to)
+
 // is_nothrow_convertible
 
 #if _LIBCPP_STD_VER > 17
@@ -1624,6 +1745,10 @@ inline constexpr bool is_nothrow_convertible_v = is_nothrow_convertible<_Fm, _To
 
 template <class _Tp> struct _LIBCPP_TEMPLATE_VIS is_empty : public integral_constant<bool, __is_empty(_Tp)> {};
 
+#if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_empty_v = __is_empty(_Tp);
+#endif
+
 #else // __has_feature(is_empty)
 
 template <class _Tp> struct __is_empty1 : public _Tp { double __lx; };
@@ -1639,12 +1764,12 @@ template <class _Tp> struct __libcpp_empty<_Tp, false> : public false_type {};
 
 template <class _Tp> struct _LIBCPP_TEMPLATE_VIS is_empty : public __libcpp_empty<_Tp> {};
 
-#endif // __has_feature(is_empty)
-
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
 template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_empty_v = is_empty<_Tp>::value;
 #endif
 
+#endif // __has_feature(is_empty)
+
 // is_polymorphic
 
 #if __has_feature(is_polymorphic) || defined(_LIBCPP_COMPILER_MSVC)
@@ -1652,6 +1777,10 @@ template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_empty_v = is_e
 template <class _Tp>
 struct _LIBCPP_TEMPLATE_VIS is_polymorphic : public integral_constant<bool, __is_polymorphic(_Tp)> {};
 
+#if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_polymorphic_v = __is_polymorphic(_Tp);
+#endif
+
 #else
 
 template <typename _Tp>
@@ -1663,12 +1792,13 @@ template <class _Tp>
 struct _LIBCPP_TEMPLATE_VIS is_polymorphic
     : public integral_constant<bool, sizeof(__is_polymorphic_impl<_Tp>(0)) == 1> {};
 
-#endif // __has_feature(is_polymorphic)
-
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
-template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_polymorphic_v = is_polymorphic<_Tp>::value;
+template <class _Tp>
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_polymorphic_v = sizeof(__is_polymorphic_impl<_Tp>(0)) == 1;
 #endif
 
+#endif // __has_feature(is_polymorphic)
+
 // has_virtual_destructor
 
 #if __has_feature(has_virtual_destructor) || defined(_LIBCPP_COMPILER_GCC)
@@ -1676,15 +1806,19 @@ template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_polymorphic_v
 template <class _Tp>
 struct _LIBCPP_TEMPLATE_VIS has_virtual_destructor : public integral_constant<bool, __has_virtual_destructor(_Tp)> {};
 
+#if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
+template <class _Tp>
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool has_virtual_destructor_v = __has_virtual_destructor(_Tp);
+#endif
+
 #else
 
 template <class _Tp> struct _LIBCPP_TEMPLATE_VIS has_virtual_destructor : public false_type {};
 
+#if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool has_virtual_destructor_v = false;
 #endif
 
-#if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
-template <class _Tp>
-_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool has_virtual_destructor_v = has_virtual_destructor<_Tp>::value;
 #endif
 
 // has_unique_object_representations
@@ -1698,7 +1832,7 @@ struct _LIBCPP_TEMPLATE_VIS has_unique_object_representations
 #if !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
 template <class _Tp>
 _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool has_unique_object_representations_v =
-    has_unique_object_representations<_Tp>::value;
+    __has_unique_object_representations(remove_cv_t<remove_all_extents_t<_Tp>>);
 #endif
 
 #endif
@@ -1708,16 +1842,11 @@ _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool has_unique_object_representations_v =
 template <class _Tp> struct _LIBCPP_TEMPLATE_VIS alignment_of : public integral_constant<size_t, alignof(_Tp)> {};
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
-template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR size_t alignment_of_v = alignment_of<_Tp>::value;
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR size_t alignment_of_v = alignof(_Tp);
 #endif
 
 // aligned_storage
 
-template <class _Hp, class _Tp> struct __type_list {
-  typedef _Hp _Head;
-  typedef _Tp _Tail;
-};
-
 struct __nat {
 #ifndef _LIBCPP_CXX03_LANG
   __nat()              = delete;
@@ -1727,11 +1856,6 @@ struct __nat {
 #endif
 };
 
-template <class _Tp> struct __align_type {
-  static const size_t value = _LIBCPP_PREFERRED_ALIGNOF(_Tp);
-  typedef _Tp type;
-};
-
 struct __struct_double {
   long double __lx;
 };
@@ -1739,104 +1863,60 @@ struct __struct_double4 {
   double __lx[4];
 };
 
-typedef __type_list<
-    __align_type<unsigned char>,
-    __type_list<
-        __align_type<unsigned short>,
-        __type_list<
-            __align_type<unsigned int>,
-            __type_list<
-                __align_type<unsigned long>,
-                __type_list<
-                    __align_type<unsigned long long>,
-                    __type_list<__align_type<double>,
-                                __type_list<__align_type<long double>,
-                                            __type_list<__align_type<__struct_double>,
-                                                        __type_list<__align_type<__struct_double4>,
-                                                                    __type_list<__align_type<int *>, __nat>>>>>>>>>>
-    __all_types;
-
-template <size_t _Align> struct alignas(_Align) __fallback_overaligned {};
-
-template <class _TL, size_t _Align> struct __find_pod;
-
-template <class _Hp, size_t _Align> struct __find_pod<__type_list<_Hp, __nat>, _Align> {
-  typedef typename conditional<_Align == _Hp::value, typename _Hp::type, __fallback_overaligned<_Align>>::type type;
-};
-
-template <class _Hp, class _Tp, size_t _Align> struct __find_pod<__type_list<_Hp, _Tp>, _Align> {
-  typedef
-      typename conditional<_Align == _Hp::value, typename _Hp::type, typename __find_pod<_Tp, _Align>::type>::type type;
-};
-
-template <class _TL, size_t _Len> struct __find_max_align;
-
-template <class _Hp, size_t _Len>
-struct __find_max_align<__type_list<_Hp, __nat>, _Len> : public integral_constant<size_t, _Hp::value> {};
-
-template <size_t _Len, size_t _A1, size_t _A2> struct __select_align {
-private:
-  static const size_t __min = _A2 < _A1 ? _A2 : _A1;
-  static const size_t __max = _A1 < _A2 ? _A2 : _A1;
-
-public:
-  static const size_t value = _Len < __max ? __min : __max;
-};
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR size_t __select_align(size_t __len, size_t __a1, size_t __a2) {
+  return __len < (__a1 < __a2 ? __a2 : __a1) ? (__a2 < __a1 ? __a2 : __a1) : (__a1 < __a2 ? __a2 : __a1);
+}
 
-template <class _Hp, class _Tp, size_t _Len>
-struct __find_max_align<__type_list<_Hp, _Tp>, _Len>
-    : public integral_constant<size_t, __select_align<_Len, _Hp::value, __find_max_align<_Tp, _Len>::value>::value> {};
+// The default alignment of aligned_storage<_Len>: the strictest alignment of
+// the fundamental types below that does not exceed _Len, or the weakest one if
+// they all do.
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR size_t __aligned_storage_default_align(size_t __len) {
+  return __select_align(
+      __len, _LIBCPP_PREFERRED_ALIGNOF(unsigned char),
+      __select_align(
+          __len, _LIBCPP_PREFERRED_ALIGNOF(unsigned short),
+          __select_align(
+              __len, _LIBCPP_PREFERRED_ALIGNOF(unsigned int),
+              __select_align(
+                  __len, _LIBCPP_PREFERRED_ALIGNOF(unsigned long),
+                  __select_align(
+                      __len, _LIBCPP_PREFERRED_ALIGNOF(unsigned long long),
+                      __select_align(
+                          __len, _LIBCPP_PREFERRED_ALIGNOF(double),
+                          __select_align(
+                              __len, _LIBCPP_PREFERRED_ALIGNOF(long double),
+                              __select_align(__len, _LIBCPP_PREFERRED_ALIGNOF(__struct_double),
+                                             __select_align(__len, _LIBCPP_PREFERRED_ALIGNOF(__struct_double4),
+                                                            _LIBCPP_PREFERRED_ALIGNOF(int *))))))))));
+}
 
-template <size_t _Len, size_t _Align = __find_max_align<__all_types, _Len>::value>
+template <size_t _Len, size_t _Align = __aligned_storage_default_align(_Len)>
 struct _LIBCPP_TEMPLATE_VIS aligned_storage {
-  typedef typename __find_pod<__all_types, _Align>::type _Aligner;
-  union type {
-    _Aligner __align;
-    unsigned char __data[(_Len + _Align - 1) / _Align * _Align];
+  static_assert(_Align != 0 && (_Align & (_Align - 1)) == 0, "aligned_storage alignment must be a power of two");
+#if defined(_LIBCPP_OBJECT_FORMAT_COFF)
+  // PE/COFF does not support alignment beyond 8192 (=0x2000)
+  static_assert(_Align <= 0x2000, "aligned_storage alignment is limited to 8192 on PE/COFF");
+#endif
+  struct alignas(_Align) type {
+    unsigned char __lx[(_Len + _Align - 1) / _Align * _Align];
   };
 };
 
 #if _LIBCPP_STD_VER > 11
-template <size_t _Len, size_t _Align = __find_max_align<__all_types, _Len>::value>
+template <size_t _Len, size_t _Align = __aligned_storage_default_align(_Len)>
 using aligned_storage_t = typename aligned_storage<_Len, _Align>::type;
 #endif
 
-#define _CREATE_ALIGNED_STORAGE_SPECIALIZATION(n)                                                                      \
-  template <size_t _Len> struct _LIBCPP_TEMPLATE_VIS aligned_storage<_Len, n> {                                        \
-    struct alignas(n) type {                                                                                           \
-      unsigned char __lx[(_Len + n - 1) / n * n];                                                                      \
-    };                                                                                                                 \
-  }
-
-_CREATE_ALIGNED_STORAGE_SPECIALIZATION(0x1);
-_CREATE_ALIGNED_STORAGE_SPECIALIZATION(0x2);
-_CREATE_ALIGNED_STORAGE_SPECIALIZATION(0x4);
-_CREATE_ALIGNED_STORAGE_SPECIALIZATION(0x8);
-_CREATE_ALIGNED_STORAGE_SPECIALIZATION(0x10);
-_CREATE_ALIGNED_STORAGE_SPECIALIZATION(0x20);
-_CREATE_ALIGNED_STORAGE_SPECIALIZATION(0x40);
-_CREATE_ALIGNED_STORAGE_SPECIALIZATION(0x80);
-_CREATE_ALIGNED_STORAGE_SPECIALIZATION(0x100);
-_CREATE_ALIGNED_STORAGE_SPECIALIZATION(0x200);
-_CREATE_ALIGNED_STORAGE_SPECIALIZATION(0x400);
-_CREATE_ALIGNED_STORAGE_SPECIALIZATION(0x800);
-_CREATE_ALIGNED_STORAGE_SPECIALIZATION(0x1000);
-_CREATE_ALIGNED_STORAGE_SPECIALIZATION(0x2000);
-// PE/COFF does not support alignment beyond 8192 (=0x2000)
-#if !defined(_LIBCPP_OBJECT_FORMAT_COFF)
-_CREATE_ALIGNED_STORAGE_SPECIALIZATION(0x4000);
-#endif // !defined(_LIBCPP_OBJECT_FORMAT_COFF)
-
-#undef _CREATE_ALIGNED_STORAGE_SPECIALIZATION
-
 // aligned_union
 
-template <size_t _I0, size_t... _In> struct __static_max;
-
-template <size_t _I0> struct __static_max<_I0> { static const size_t value = _I0; };
+template <size_t _Np>
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR size_t __static_max_of(const size_t (&__values)[_Np], size_t __i = 0,
+                                                                          size_t __max = 0) {
+  return __i == _Np ? __max : __static_max_of(__values, __i + 1, __max < __values[__i] ? __values[__i] : __max);
+}
 
-template <size_t _I0, size_t _I1, size_t... _In> struct __static_max<_I0, _I1, _In...> {
-  static const size_t value = _I0 >= _I1 ? __static_max<_I0, _In...>::value : __static_max<_I1, _In...>::value;
+template <size_t _I0, size_t... _In> struct __static_max {
+  static const size_t value = __static_max_of({_I0, _In...});
 };
 
 template <size_t _Len, class _Type0, class... _Types> struct aligned_union {
@@ -1909,42 +1989,6 @@ template <class _A1, class _A2 = void, class _A3 = void> class __promote : publi
 
 // make_signed / make_unsigned
 
-typedef __type_list<
-    signed char,
-    __type_list<signed short, __type_list<signed int, __type_list<signed long, __type_list<signed long long,
-#ifndef _LIBCPP_HAS_NO_INT128
-                                                                                           __type_list<__int128_t,
-#endif
-                                                                                                       __nat
-#ifndef _LIBCPP_HAS_NO_INT128
-                                                                                                       >
-#endif
-                                                                                           >>>>>
-    __signed_types;
-
-typedef __type_list<
-    unsigned char, __type_list<unsigned short,
-                               __type_list<unsigned int, __type_list<unsigned long, __type_list<unsigned long long,
-#ifndef _LIBCPP_HAS_NO_INT128
-                                                                                                __type_list<__uint128_t,
-#endif
-                                                                                                            __nat
-#ifndef _LIBCPP_HAS_NO_INT128
-                                                                                                            >
-#endif
-                                                                                                >>>>>
-    __unsigned_types;
-
-template <class _TypeList, size_t _Size, bool = _Size <= sizeof(typename _TypeList::_Head)> struct __find_first;
-
-template <class _Hp, class _Tp, size_t _Size> struct __find_first<__type_list<_Hp, _Tp>, _Size, true> {
-  typedef _LIBCPP_NODEBUG_TYPE _Hp type;
-};
-
-template <class _Hp, class _Tp, size_t _Size> struct __find_first<__type_list<_Hp, _Tp>, _Size, false> {
-  typedef _LIBCPP_NODEBUG_TYPE typename __find_first<_Tp, _Size>::type type;
-};
-
 template <class _Tp, class _Up, bool = is_const<typename remove_reference<_Tp>::type>::value,
           bool = is_volatile<typename remove_reference<_Tp>::type>::value>
 struct __apply_cv {
@@ -1967,62 +2011,127 @@ template <class _Tp, class _Up> struct __apply_cv<_Tp &, _Up, false, true> { typ
 
 template <class _Tp, class _Up> struct __apply_cv<_Tp &, _Up, true, true> { typedef const volatile _Up &type; };
 
-template <class _Tp, bool = is_integral<_Tp>::value || is_enum<_Tp>::value> struct __make_signed {};
+#if __has_keyword(__make_signed)
 
-template <class _Tp> struct __make_signed<_Tp, true> {
-  typedef typename __find_first<__signed_types, sizeof(_Tp)>::type type;
-};
+template <class _Tp> struct _LIBCPP_TEMPLATE_VIS make_signed { typedef __make_signed(_Tp) type; };
+
+#if _LIBCPP_STD_VER > 11
+template <class _Tp> using make_signed_t = __make_signed(_Tp);
+#endif
 
-template <> struct __make_signed<bool, true> {};
-template <> struct __make_signed<signed short, true> { typedef short type; };
-template <> struct __make_signed<unsigned short, true> { typedef short type; };
-template <> struct __make_signed<signed int, true> { typedef int type; };
-template <> struct __make_signed<unsigned int, true> { typedef int type; };
-template <> struct __make_signed<signed long, true> { typedef long type; };
-template <> struct __make_signed<unsigned long, true> { typedef long type; };
-template <> struct __make_signed<signed long long, true> { typedef long long type; };
-template <> struct __make_signed<unsigned long long, true> { typedef long long type; };
+#else // __has_keyword(__make_signed)
+
+// The smallest standard signed and unsigned integer types at least _Size bytes
+// wide, picked without walking a type list.
+template <size_t _Size>
+using __signed_int_of_size _LIBCPP_NODEBUG_TYPE = _If<
+    _Size <= sizeof(signed char), signed char,
+    _If<_Size <= sizeof(short), short,
+        _If<_Size <= sizeof(int), int,
+            _If<_Size <= sizeof(long), long,
+                _If<_Size <= sizeof(long long), long long,
 #ifndef _LIBCPP_HAS_NO_INT128
-template <> struct __make_signed<__int128_t, true> { typedef __int128_t type; };
-template <> struct __make_signed<__uint128_t, true> { typedef __int128_t type; };
+                    __int128_t
+#else
+                    __nat
+#endif
+                    >>>>>;
+
+template <size_t _Size>
+using __unsigned_int_of_size _LIBCPP_NODEBUG_TYPE = _If<
+    _Size <= sizeof(unsigned char), unsigned char,
+    _If<_Size <= sizeof(unsigned short), unsigned short,
+        _If<_Size <= sizeof(unsigned int), unsigned int,
+            _If<_Size <= sizeof(unsigned long), unsigned long,
+                _If<_Size <= sizeof(unsigned long long), unsigned long long,
+#ifndef _LIBCPP_HAS_NO_INT128
+                    __uint128_t
+#else
+                    __nat
+#endif
+                    >>>>>;
+
+template <class _Tp, bool = is_integral<_Tp>::value || is_enum<_Tp>::value> struct __libcpp_make_signed {};
+
+template <class _Tp> struct __libcpp_make_signed<_Tp, true> { typedef __signed_int_of_size<sizeof(_Tp)> type; };
+
+template <> struct __libcpp_make_signed<bool, true> {};
+template <> struct __libcpp_make_signed<signed short, true> { typedef short type; };
+template <> struct __libcpp_make_signed<unsigned short, true> { typedef short type; };
+template <> struct __libcpp_make_signed<signed int, true> { typedef int type; };
+template <> struct __libcpp_make_signed<unsigned int, true> { typedef int type; };
+template <> struct __libcpp_make_signed<signed long, true> { typedef long type; };
+template <> struct __libcpp_make_signed<unsigned long, true> { typedef long type; };
+template <> struct __libcpp_make_signed<signed long long, true> { typedef long long type; };
+template <> struct __libcpp_make_signed<unsigned long long, true> { typedef long long type; };
+#ifndef _LIBCPP_HAS_NO_INT128
+template <> struct __libcpp_make_signed<__int128_t, true> { typedef __int128_t type; };
+template <> struct __libcpp_make_signed<__uint128_t, true> { typedef __int128_t type; };
 #endif
 
 template <class _Tp> struct _LIBCPP_TEMPLATE_VIS make_signed {
-  typedef typename __apply_cv<_Tp, typename __make_signed<typename remove_cv<_Tp>::type>::type>::type type;
+  typedef typename __apply_cv<_Tp, typename __libcpp_make_signed<typename remove_cv<_Tp>::type>::type>::type type;
 };
 
 #if _LIBCPP_STD_VER > 11
 template <class _Tp> using make_signed_t = typename make_signed<_Tp>::type;
 #endif
 
-template <class _Tp, bool = is_integral<_Tp>::value || is_enum<_Tp>::value> struct __make_unsigned {};
+#endif // __has_keyword(__make_signed)
 
-template <class _Tp> struct __make_unsigned<_Tp, true> {
-  typedef typename __find_first<__unsigned_types, sizeof(_Tp)>::type type;
-};
+#if __has_keyword(__make_unsigned)
+
+template <class _Tp> struct _LIBCPP_TEMPLATE_VIS make_unsigned { typedef __make_unsigned(_Tp) type; };
 
-template <> struct __make_unsigned<bool, true> {};
-template <> struct __make_unsigned<signed short, true> { typedef unsigned short type; };
-template <> struct __make_unsigned<unsigned short, true> { typedef unsigned short type; };
-template <> struct __make_unsigned<signed int, true> { typedef unsigned int type; };
-template <> struct __make_unsigned<unsigned int, true> { typedef unsigned int type; };
-template <> struct __make_unsigned<signed long, true> { typedef unsigned long type; };
-template <> struct __make_unsigned<unsigned long, true> { typedef unsigned long type; };
-template <> struct __make_unsigned<signed long long, true> { typedef unsigned long long type; };
-template <> struct __make_unsigned<unsigned long long, true> { typedef unsigned long long type; };
+#if _LIBCPP_STD_VER > 11
+template <class _Tp> using make_unsigned_t = __make_unsigned(_Tp);
+#endif
+
+#else // __has_keyword(__make_unsigned)
+
+template <class _Tp, bool = is_integral<_Tp>::value || is_enum<_Tp>::value> struct __libcpp_make_unsigned {};
+
+template <class _Tp> struct __libcpp_make_unsigned<_Tp, true> { typedef __unsigned_int_of_size<sizeof(_Tp)> type; };
+
+template <> struct __libcpp_make_unsigned<bool, true> {};
+template <> struct __libcpp_make_unsigned<signed short, true> { typedef unsigned short type; };
+template <> struct __libcpp_make_unsigned<unsigned short, true> { typedef unsigned short type; };
+template <> struct __libcpp_make_unsigned<signed int, true> { typedef unsigned int type; };
+template <> struct __libcpp_make_unsigned<unsigned int, true> { typedef unsigned int type; };
+template <> struct __libcpp_make_unsigned<signed long, true> { typedef unsigned long type; };
+template <> struct __libcpp_make_unsigned<unsigned long, true> { typedef unsigned long type; };
+template <> struct __libcpp_make_unsigned<signed long long, true> { typedef unsigned long long type; };
+template <> struct __libcpp_make_unsigned<unsigned long long, true> { typedef unsigned long long type; };
 #ifndef _LIBCPP_HAS_NO_INT128
-template <> struct __make_unsigned<__int128_t, true> { typedef __uint128_t type; };
-template <> struct __make_unsigned<__uint128_t, true> { typedef __uint128_t type; };
+template <> struct __libcpp_make_unsigned<__int128_t, true> { typedef __uint128_t type; };
+template <> struct __libcpp_make_unsigned<__uint128_t, true> { typedef __uint128_t type; };
 #endif
 
 template <class _Tp> struct _LIBCPP_TEMPLATE_VIS make_unsigned {
-  typedef typename __apply_cv<_Tp, typename __make_unsigned<typename remove_cv<_Tp>::type>::type>::type type;
+  typedef typename __apply_cv<_Tp, typename __libcpp_make_unsigned<typename remove_cv<_Tp>::type>::type>::type type;
 };
 
 #if _LIBCPP_STD_VER > 11
 template <class _Tp> using make_unsigned_t = typename make_unsigned<_Tp>::type;
 #endif
 
+#endif // __has_keyword(__make_unsigned)
+
+// __uint_least_for<_Np> is the smallest unsigned integer type that can hold
+// every value in [0, _Np]. __uint_fast_for<_Np> is the same but never narrower
+// than unsigned int, for values that are mostly used in arithmetic.
+
+template <unsigned long long _Np>
+using __uint_least_for _LIBCPP_NODEBUG_TYPE =
+    _If<_Np <= static_cast<unsigned char>(-1), unsigned char,
+        _If<_Np <= static_cast<unsigned short>(-1), unsigned short,
+            _If<_Np <= static_cast<unsigned int>(-1), unsigned int,
+                _If<_Np <= static_cast<unsigned long>(-1), unsigned long, unsigned long long>>>>;
+
+template <unsigned long long _Np>
+using __uint_fast_for _LIBCPP_NODEBUG_TYPE =
+    _If<_Np <= static_cast<unsigned int>(-1), unsigned int, __uint_least_for<_Np>>;
+
 #if _LIBCPP_STD_VER > 14
 template <class...> using void_t = void;
 #endif
@@ -2149,7 +2258,9 @@ struct _LIBCPP_TEMPLATE_VIS is_copy_assignable
                            typename add_lvalue_reference<typename add_const<_Tp>::type>::type> {};
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
-template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_copy_assignable_v = is_copy_assignable<_Tp>::value;
+template <class _Tp>
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_copy_assignable_v =
+    is_assignable_v<__add_lvalue_reference_t<_Tp>, __add_lvalue_reference_t<const _Tp>>;
 #endif
 
 // is_move_assignable
@@ -2159,7 +2270,9 @@ struct _LIBCPP_TEMPLATE_VIS is_move_assignable
     : public is_assignable<typename add_lvalue_reference<_Tp>::type, typename add_rvalue_reference<_Tp>::type> {};
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
-template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_move_assignable_v = is_move_assignable<_Tp>::value;
+template <class _Tp>
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_move_assignable_v =
+    is_assignable_v<__add_lvalue_reference_t<_Tp>, __add_rvalue_reference_t<_Tp>>;
 #endif
 
 // is_destructible
@@ -2531,14 +2644,19 @@ struct __libcpp_is_constructible<_Tp &&, _A0>
 #if __has_feature(is_constructible) || defined(_LIBCPP_GCC_SUPPORTS_IS_CONSTRUCTIBLE)
 template <class _Tp, class... _Args>
 struct _LIBCPP_TEMPLATE_VIS is_constructible : public integral_constant<bool, __is_constructible(_Tp, _Args...)> {};
+
+#if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
+template <class _Tp, class... _Args>
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_constructible_v = __is_constructible(_Tp, _Args...);
+#endif
 #else
 template <class _Tp, class... _Args>
 struct _LIBCPP_TEMPLATE_VIS is_constructible : public __libcpp_is_constructible<_Tp, _Args...>::type {};
-#endif
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
 template <class _Tp, class... _Args>
-_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_constructible_v = is_constructible<_Tp, _Args...>::value;
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_constructible_v = __libcpp_is_constructible<_Tp, _Args...>::type::value;
+#endif
 #endif
 
 // is_default_constructible
@@ -2547,7 +2665,7 @@ template <class _Tp> struct _LIBCPP_TEMPLATE_VIS is_default_constructible : publ
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
 template <class _Tp>
-_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_default_constructible_v = is_default_constructible<_Tp>::value;
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_default_constructible_v = is_constructible_v<_Tp>;
 #endif
 
 #ifndef _LIBCPP_CXX03_LANG
@@ -2577,7 +2695,8 @@ struct _LIBCPP_TEMPLATE_VIS is_copy_constructible
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
 template <class _Tp>
-_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_copy_constructible_v = is_copy_constructible<_Tp>::value;
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_copy_constructible_v =
+    is_constructible_v<_Tp, __add_lvalue_reference_t<const _Tp>>;
 #endif
 
 // is_move_constructible
@@ -2588,7 +2707,7 @@ struct _LIBCPP_TEMPLATE_VIS is_move_constructible
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
 template <class _Tp>
-_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_move_constructible_v = is_move_constructible<_Tp>::value;
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_move_constructible_v = is_constructible_v<_Tp, __add_rvalue_reference_t<_Tp>>;
 #endif
 
 // is_trivially_constructible
@@ -2599,6 +2718,11 @@ template <class _Tp, class... _Args>
 struct _LIBCPP_TEMPLATE_VIS is_trivially_constructible
     : integral_constant<bool, __is_trivially_constructible(_Tp, _Args...)> {};
 
+#if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
+template <class _Tp, class... _Args>
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_trivially_constructible_v = __is_trivially_constructible(_Tp, _Args...);
+#endif
+
 #else // !__has_feature(is_trivially_constructible)
 
 template <class _Tp, class... _Args> struct _LIBCPP_TEMPLATE_VIS is_trivially_constructible : false_type {};
@@ -2623,14 +2747,14 @@ struct _LIBCPP_TEMPLATE_VIS is_trivially_constructible<_Tp, const _Tp &>
 template <class _Tp>
 struct _LIBCPP_TEMPLATE_VIS is_trivially_constructible<_Tp, _Tp &> : integral_constant<bool, is_scalar<_Tp>::value> {};
 
-#endif // !__has_feature(is_trivially_constructible)
-
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
 template <class _Tp, class... _Args>
 _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_trivially_constructible_v =
     is_trivially_constructible<_Tp, _Args...>::value;
 #endif
 
+#endif // !__has_feature(is_trivially_constructible)
+
 // is_trivially_default_constructible
 
 template <class _Tp>
@@ -2638,8 +2762,7 @@ struct _LIBCPP_TEMPLATE_VIS is_trivially_default_constructible : public is_trivi
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
 template <class _Tp>
-_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_trivially_default_constructible_v =
-    is_trivially_default_constructible<_Tp>::value;
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_trivially_default_constructible_v = is_trivially_constructible_v<_Tp>;
 #endif
 
 // is_trivially_copy_constructible
@@ -2651,7 +2774,7 @@ struct _LIBCPP_TEMPLATE_VIS is_trivially_copy_constructible
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
 template <class _Tp>
 _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_trivially_copy_constructible_v =
-    is_trivially_copy_constructible<_Tp>::value;
+    is_trivially_constructible_v<_Tp, __add_lvalue_reference_t<const _Tp>>;
 #endif
 
 // is_trivially_move_constructible
@@ -2663,7 +2786,7 @@ struct _LIBCPP_TEMPLATE_VIS is_trivially_move_constructible
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
 template <class _Tp>
 _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_trivially_move_constructible_v =
-    is_trivially_move_constructible<_Tp>::value;
+    is_trivially_constructible_v<_Tp, __add_rvalue_reference_t<_Tp>>;
 #endif
 
 // is_trivially_assignable
@@ -2673,6 +2796,11 @@ _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_trivially_move_constructible_v =
 template <class _Tp, class _Arg>
 struct is_trivially_assignable : integral_constant<bool, __is_trivially_assignable(_Tp, _Arg)> {};
 
+#if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
+template <class _Tp, class _Arg>
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_trivially_assignable_v = __is_trivially_assignable(_Tp, _Arg);
+#endif
+
 #else // !__has_feature(is_trivially_assignable)
 
 template <class _Tp, class _Arg> struct is_trivially_assignable : public false_type {};
@@ -2686,13 +2814,13 @@ struct is_trivially_assignable<_Tp &, const _Tp &> : integral_constant<bool, is_
 
 template <class _Tp> struct is_trivially_assignable<_Tp &, _Tp &&> : integral_constant<bool, is_scalar<_Tp>::value> {};
 
-#endif // !__has_feature(is_trivially_assignable)
-
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
 template <class _Tp, class _Arg>
 _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_trivially_assignable_v = is_trivially_assignable<_Tp, _Arg>::value;
 #endif
 
+#endif // !__has_feature(is_trivially_assignable)
+
 // is_trivially_copy_assignable
 
 template <class _Tp>
@@ -2702,7 +2830,8 @@ struct _LIBCPP_TEMPLATE_VIS is_trivially_copy_assignable
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
 template <class _Tp>
-_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_trivially_copy_assignable_v = is_trivially_copy_assignable<_Tp>::value;
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_trivially_copy_assignable_v =
+    is_trivially_assignable_v<__add_lvalue_reference_t<_Tp>, __add_lvalue_reference_t<const _Tp>>;
 #endif
 
 // is_trivially_move_assignable
@@ -2714,7 +2843,8 @@ struct _LIBCPP_TEMPLATE_VIS is_trivially_move_assignable
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
 template <class _Tp>
-_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_trivially_move_assignable_v = is_trivially_move_assignable<_Tp>::value;
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_trivially_move_assignable_v =
+    is_trivially_assignable_v<__add_lvalue_reference_t<_Tp>, __add_rvalue_reference_t<_Tp>>;
 #endif
 
 // is_trivially_destructible
@@ -2725,12 +2855,23 @@ template <class _Tp>
 struct _LIBCPP_TEMPLATE_VIS is_trivially_destructible
     : public integral_constant<bool, __is_trivially_destructible(_Tp)> {};
 
+#if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
+template <class _Tp>
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_trivially_destructible_v = __is_trivially_destructible(_Tp);
+#endif
+
 #elif __has_feature(has_trivial_destructor) || defined(_LIBCPP_COMPILER_GCC)
 
 template <class _Tp>
 struct _LIBCPP_TEMPLATE_VIS is_trivially_destructible
     : public integral_constant<bool, is_destructible<_Tp>::value &&__has_trivial_destructor(_Tp)> {};
 
+#if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
+template <class _Tp>
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_trivially_destructible_v =
+    is_destructible_v<_Tp> && __has_trivial_destructor(_Tp);
+#endif
+
 #else
 
 template <class _Tp>
@@ -2743,13 +2884,13 @@ struct _LIBCPP_TEMPLATE_VIS is_trivially_destructible
 
 template <class _Tp> struct _LIBCPP_TEMPLATE_VIS is_trivially_destructible<_Tp[]> : public false_type {};
 
-#endif
-
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
 template <class _Tp>
 _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_trivially_destructible_v = is_trivially_destructible<_Tp>::value;
 #endif
 
+#endif
+
 // is_nothrow_constructible
 
 #if __has_keyword(__is_nothrow_constructible)
@@ -2758,6 +2899,11 @@ template <class _Tp, class... _Args>
 struct _LIBCPP_TEMPLATE_VIS is_nothrow_constructible
     : public integral_constant<bool, __is_nothrow_constructible(_Tp, _Args...)> {};
 
+#if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
+template <class _Tp, class... _Args>
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_nothrow_constructible_v = __is_nothrow_constructible(_Tp, _Args...);
+#endif
+
 #else
 
 template <bool, bool, class _Tp, class... _Args> struct __libcpp_is_nothrow_constructible;
@@ -2785,13 +2931,13 @@ template <class _Tp, size_t _Ns>
 struct _LIBCPP_TEMPLATE_VIS is_nothrow_constructible<_Tp[_Ns]>
     : __libcpp_is_nothrow_constructible<is_constructible<_Tp>::value, is_reference<_Tp>::value, _Tp> {};
 
-#endif // _LIBCPP_HAS_NO_NOEXCEPT
-
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
 template <class _Tp, class... _Args>
 _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_nothrow_constructible_v = is_nothrow_constructible<_Tp, _Args...>::value;
 #endif
 
+#endif // _LIBCPP_HAS_NO_NOEXCEPT
+
 // is_nothrow_default_constructible
 
 template <class _Tp>
@@ -2799,8 +2945,7 @@ struct _LIBCPP_TEMPLATE_VIS is_nothrow_default_constructible : public is_nothrow
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
 template <class _Tp>
-_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_nothrow_default_constructible_v =
-    is_nothrow_default_constructible<_Tp>::value;
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_nothrow_default_constructible_v = is_nothrow_constructible_v<_Tp>;
 #endif
 
 // is_nothrow_copy_constructible
@@ -2811,7 +2956,8 @@ struct _LIBCPP_TEMPLATE_VIS is_nothrow_copy_constructible
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
 template <class _Tp>
-_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_nothrow_copy_constructible_v = is_nothrow_copy_constructible<_Tp>::value;
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_nothrow_copy_constructible_v =
+    is_nothrow_constructible_v<_Tp, __add_lvalue_reference_t<const _Tp>>;
 #endif
 
 // is_nothrow_move_constructible
@@ -2822,7 +2968,8 @@ struct _LIBCPP_TEMPLATE_VIS is_nothrow_move_constructible
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
 template <class _Tp>
-_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_nothrow_move_constructible_v = is_nothrow_move_constructible<_Tp>::value;
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_nothrow_move_constructible_v =
+    is_nothrow_constructible_v<_Tp, __add_rvalue_reference_t<_Tp>>;
 #endif
 
 // is_nothrow_assignable
@@ -2833,6 +2980,11 @@ template <class _Tp, class _Arg>
 struct _LIBCPP_TEMPLATE_VIS is_nothrow_assignable : public integral_constant<bool, __is_nothrow_assignable(_Tp, _Arg)> {
 };
 
+#if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
+template <class _Tp, class _Arg>
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_nothrow_assignable_v = __is_nothrow_assignable(_Tp, _Arg);
+#endif
+
 #else
 
 template <bool, class _Tp, class _Arg> struct __libcpp_is_nothrow_assignable;
@@ -2847,13 +2999,14 @@ template <class _Tp, class _Arg>
 struct _LIBCPP_TEMPLATE_VIS is_nothrow_assignable
     : public __libcpp_is_nothrow_assignable<is_assignable<_Tp, _Arg>::value, _Tp, _Arg> {};
 
-#endif // _LIBCPP_HAS_NO_NOEXCEPT
-
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
 template <class _Tp, class _Arg>
-_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_nothrow_assignable_v = is_nothrow_assignable<_Tp, _Arg>::value;
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_nothrow_assignable_v =
+    __libcpp_is_nothrow_assignable<is_assignable_v<_Tp, _Arg>, _Tp, _Arg>::value;
 #endif
 
+#endif // _LIBCPP_HAS_NO_NOEXCEPT
+
 // is_nothrow_copy_assignable
 
 template <class _Tp>
@@ -2863,7 +3016,8 @@ struct _LIBCPP_TEMPLATE_VIS is_nothrow_copy_assignable
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
 template <class _Tp>
-_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_nothrow_copy_assignable_v = is_nothrow_copy_assignable<_Tp>::value;
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_nothrow_copy_assignable_v =
+    is_nothrow_assignable_v<__add_lvalue_reference_t<_Tp>, __add_lvalue_reference_t<const _Tp>>;
 #endif
 
 // is_nothrow_move_assignable
@@ -2875,7 +3029,8 @@ struct _LIBCPP_TEMPLATE_VIS is_nothrow_move_assignable
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
 template <class _Tp>
-_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_nothrow_move_assignable_v = is_nothrow_move_assignable<_Tp>::value;
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_nothrow_move_assignable_v =
+    is_nothrow_assignable_v<__add_lvalue_reference_t<_Tp>, __add_rvalue_reference_t<_Tp>>;
 #endif
 
 // is_nothrow_destructible
@@ -2926,6 +3081,10 @@ _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_nothrow_destructible_v = is_nothrow
 
 template <class _Tp> struct _LIBCPP_TEMPLATE_VIS is_pod : public integral_constant<bool, __is_pod(_Tp)> {};
 
+#if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_pod_v = __is_pod(_Tp);
+#endif
+
 #else
 
 template <class _Tp>
@@ -2934,10 +3093,13 @@ struct _LIBCPP_TEMPLATE_VIS is_pod
           bool, is_trivially_default_constructible<_Tp>::value && is_trivially_copy_constructible<_Tp>::value &&
                     is_trivially_copy_assignable<_Tp>::value && is_trivially_destructible<_Tp>::value> {};
 
+#if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
+template <class _Tp>
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_pod_v =
+    is_trivially_default_constructible_v<_Tp> && is_trivially_copy_constructible_v<_Tp> &&
+    is_trivially_copy_assignable_v<_Tp> && is_trivially_destructible_v<_Tp>;
 #endif
 
-#if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
-template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_pod_v = is_pod<_Tp>::value;
 #endif
 
 // is_literal_type;
@@ -2946,7 +3108,7 @@ template <class _Tp>
 struct _LIBCPP_TEMPLATE_VIS is_literal_type : public integral_constant<bool, __is_literal_type(_Tp)> {};
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
-template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_literal_type_v = is_literal_type<_Tp>::value;
+template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_literal_type_v = __is_literal_type(_Tp);
 #endif
 
 // is_standard_layout;
@@ -2962,7 +3124,13 @@ struct _LIBCPP_TEMPLATE_VIS is_standard_layout
 };
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
-template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_standard_layout_v = is_standard_layout<_Tp>::value;
+template <class _Tp>
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_standard_layout_v =
+#if __has_feature(is_standard_layout) || defined(_LIBCPP_COMPILER_GCC)
+    __is_standard_layout(_Tp);
+#else
+    is_scalar_v<remove_all_extents_t<_Tp>>;
+#endif
 #endif
 
 // is_trivially_copyable;
@@ -2981,7 +3149,14 @@ struct _LIBCPP_TEMPLATE_VIS is_trivially_copyable
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
 template <class _Tp>
-_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_trivially_copyable_v = is_trivially_copyable<_Tp>::value;
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_trivially_copyable_v =
+#if __has_feature(is_trivially_copyable)
+    __is_trivially_copyable(_Tp);
+#elif _GNUC_VER >= 501
+    !is_volatile_v<_Tp> && __is_trivially_copyable(_Tp);
+#else
+    is_scalar_v<remove_all_extents_t<_Tp>>;
+#endif
 #endif
 
 // is_trivial;
@@ -2997,7 +3172,13 @@ struct _LIBCPP_TEMPLATE_VIS is_trivial
 };
 
 #if _LIBCPP_STD_VER > 14 && !defined(_LIBCPP_HAS_NO_VARIABLE_TEMPLATES)
-template <class _Tp> _LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_trivial_v = is_trivial<_Tp>::value;
+template <class _Tp>
+_LIBCPP_INLINE_VAR _LIBCPP_CONSTEXPR bool is_trivial_v =
+#if __has_feature(is_trivial) || defined(_LIBCPP_COMPILER_GCC)
+    __is_trivial(_Tp);
+#else
+    is_trivially_copyable_v<_Tp> && is_trivially_default_constructible_v<_Tp>;
+#endif
 #endif
 
 template <class _Tp> struct __is_reference_wrapper_impl : public false_type {};
@@ -3007,6 +3188,158 @@ struct __is_reference_wrapper : public __is_reference_wrapper_impl<typename remo
 
 #ifndef _LIBCPP_CXX03_LANG
 
+#if _LIBCPP_STD_VER > 14
+
+// __invoke
+//
+// The callable is classified once, and a single overload of __invoke picks the
+// INVOKE bullet with if constexpr. __invoke is constexpr, so __invoke_constexpr
+// only forwards to it.
+
+enum class __invoke_kind : unsigned char {
+  __pmf_object,  // (a0.*f)(args...)
+  __pmf_refwrap, // (a0.get().*f)(args...)
+  __pmf_pointer, // ((*a0).*f)(args...)
+  __pmd_object,  // a0.*f
+  __pmd_refwrap, // a0.get().*f
+  __pmd_pointer, // (*a0).*f
+  __callable     // f(args...)
+};
+
+// Member pointers are never arrays or functions, so remove_cvref gives the
+// same answer as decay here without instantiating decay.
+template <class _Fp, class _A0 = void, class...> constexpr __invoke_kind __classify_invoke() noexcept {
+  using _DecayFp = __uncvref_t<_Fp>;
+  if constexpr (!is_member_pointer_v<_DecayFp> || is_void_v<_A0>) {
+    return __invoke_kind::__callable;
+  } else {
+    using _DecayA0 = __uncvref_t<_A0>;
+    using _ClassT  = typename __member_pointer_class_type<_DecayFp>::type;
+    if constexpr (is_member_function_pointer_v<_DecayFp>) {
+      if constexpr (is_base_of_v<_ClassT, _DecayA0>)
+        return __invoke_kind::__pmf_object;
+      else if constexpr (__is_reference_wrapper<_DecayA0>::value)
+        return __invoke_kind::__pmf_refwrap;
+      else
+        return __invoke_kind::__pmf_pointer;
+    } else {
+      if constexpr (is_base_of_v<_ClassT, _DecayA0>)
+        return __invoke_kind::__pmd_object;
+      else if constexpr (__is_reference_wrapper<_DecayA0>::value)
+        return __invoke_kind::__pmd_refwrap;
+      else
+        return __invoke_kind::__pmd_pointer;
+    }
+  }
+}
+
+// __invoke_expr_imp provides `type` and `__nothrow` for the selected bullet
+// only when the call expression is well-formed, so __invoke stays SFINAE
+// friendly.
+template <__invoke_kind, class, class _Fp, class... _Args> struct __invoke_expr_imp {};
+
+template <class _Fp, class _A0, class... _Args>
+struct __invoke_expr_imp<
+    __invoke_kind::__pmf_object,
+    void_t<decltype((_VSTD::declval<_A0>().*_VSTD::declval<_Fp>())(_VSTD::declval<_Args>()...))>, _Fp, _A0,
+    _Args...> {
+  using type = decltype((_VSTD::declval<_A0>().*_VSTD::declval<_Fp>())(_VSTD::declval<_Args>()...));
+  static constexpr bool __nothrow =
+      noexcept((_VSTD::declval<_A0>().*_VSTD::declval<_Fp>())(_VSTD::declval<_Args>()...));
+};
+
+template <class _Fp, class _A0, class... _Args>
+struct __invoke_expr_imp<
+    __invoke_kind::__pmf_refwrap,
+    void_t<decltype((_VSTD::declval<_A0>().get().*_VSTD::declval<_Fp>())(_VSTD::declval<_Args>()...))>, _Fp, _A0,
+    _Args...> {
+  using type = decltype((_VSTD::declval<_A0>().get().*_VSTD::declval<_Fp>())(_VSTD::declval<_Args>()...));
+  static constexpr bool __nothrow =
+      noexcept((_VSTD::declval<_A0>().get().*_VSTD::declval<_Fp>())(_VSTD::declval<_Args>()...));
+};
+
+template <class _Fp, class _A0, class... _Args>
+struct __invoke_expr_imp<
+    __invoke_kind::__pmf_pointer,
+    void_t<decltype(((*_VSTD::declval<_A0>()).*_VSTD::declval<_Fp>())(_VSTD::declval<_Args>()...))>, _Fp, _A0,
+    _Args...> {
+  using type = decltype(((*_VSTD::declval<_A0>()).*_VSTD::declval<_Fp>())(_VSTD::declval<_Args>()...));
+  static constexpr bool __nothrow =
+      noexcept(((*_VSTD::declval<_A0>()).*_VSTD::declval<_Fp>())(_VSTD::declval<_Args>()...));
+};
+
+template <class _Fp, class _A0>
+struct __invoke_expr_imp<__invoke_kind::__pmd_object, void_t<decltype(_VSTD::declval<_A0>().*_VSTD::declval<_Fp>())>,
+                         _Fp, _A0> {
+  using type                      = decltype(_VSTD::declval<_A0>().*_VSTD::declval<_Fp>());
+  static constexpr bool __nothrow = noexcept(_VSTD::declval<_A0>().*_VSTD::declval<_Fp>());
+};
+
+template <class _Fp, class _A0>
+struct __invoke_expr_imp<__invoke_kind::__pmd_refwrap,
+                         void_t<decltype(_VSTD::declval<_A0>().get().*_VSTD::declval<_Fp>())>, _Fp, _A0> {
+  using type                      = decltype(_VSTD::declval<_A0>().get().*_VSTD::declval<_Fp>());
+  static constexpr bool __nothrow = noexcept(_VSTD::declval<_A0>().get().*_VSTD::declval<_Fp>());
+};
+
+template <class _Fp, class _A0>
+struct __invoke_expr_imp<__invoke_kind::__pmd_pointer,
+                         void_t<decltype((*_VSTD::declval<_A0>()).*_VSTD::declval<_Fp>())>, _Fp, _A0> {
+  using type                      = decltype((*_VSTD::declval<_A0>()).*_VSTD::declval<_Fp>());
+  static constexpr bool __nothrow = noexcept((*_VSTD::declval<_A0>()).*_VSTD::declval<_Fp>());
+};
+
+template <class _Fp, class... _Args>
+struct __invoke_expr_imp<__invoke_kind::__callable, void_t<decltype(_VSTD::declval<_Fp>()(_VSTD::declval<_Args>()...))>,
+                         _Fp, _Args...> {
+  using type                      = decltype(_VSTD::declval<_Fp>()(_VSTD::declval<_Args>()...));
+  static constexpr bool __nothrow = noexcept(_VSTD::declval<_Fp>()(_VSTD::declval<_Args>()...));
+};
+
+template <class _Fp, class... _Args>
+using __invoke_expr _LIBCPP_NODEBUG_TYPE =
+    __invoke_expr_imp<_VSTD::__classify_invoke<_Fp, _Args...>(), void, _Fp, _Args...>;
+
+// fall back - none of the bullets
+
+template <class... _Args> auto __invoke(__any, _Args &&...__args) -> __nat;
+
+template <class... _Args> auto __invoke_constexpr(__any, _Args &&...__args) -> __nat;
+
+template <class _Fp>
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_FORCE_INLINE constexpr typename __invoke_expr<_Fp>::type
+__invoke(_Fp &&__f) noexcept(__invoke_expr<_Fp>::__nothrow) {
+  return _VSTD::forward<_Fp>(__f)();
+}
+
+template <class _Fp, class _A0, class... _Args>
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_FORCE_INLINE constexpr typename __invoke_expr<_Fp, _A0, _Args...>::type
+__invoke(_Fp &&__f, _A0 &&__a0, _Args &&...__args) noexcept(__invoke_expr<_Fp, _A0, _Args...>::__nothrow) {
+  constexpr __invoke_kind __kind = _VSTD::__classify_invoke<_Fp, _A0, _Args...>();
+  if constexpr (__kind == __invoke_kind::__callable)
+    return _VSTD::forward<_Fp>(__f)(_VSTD::forward<_A0>(__a0), _VSTD::forward<_Args>(__args)...);
+  else if constexpr (__kind == __invoke_kind::__pmf_object)
+    return (_VSTD::forward<_A0>(__a0).*__f)(_VSTD::forward<_Args>(__args)...);
+  else if constexpr (__kind == __invoke_kind::__pmf_refwrap)
+    return (__a0.get().*__f)(_VSTD::forward<_Args>(__args)...);
+  else if constexpr (__kind == __invoke_kind::__pmf_pointer)
+    return ((*_VSTD::forward<_A0>(__a0)).*__f)(_VSTD::forward<_Args>(__args)...);
+  else if constexpr (__kind == __invoke_kind::__pmd_object)
+    return _VSTD::forward<_A0>(__a0).*__f;
+  else if constexpr (__kind == __invoke_kind::__pmd_refwrap)
+    return __a0.get().*__f;
+  else
+    return (*_VSTD::forward<_A0>(__a0)).*__f;
+}
+
+template <class _Fp, class... _Args>
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_FORCE_INLINE constexpr typename __invoke_expr<_Fp, _Args...>::type
+__invoke_constexpr(_Fp &&__f, _Args &&...__args) noexcept(__invoke_expr<_Fp, _Args...>::__nothrow) {
+  return _VSTD::__invoke(_VSTD::forward<_Fp>(__f), _VSTD::forward<_Args>(__args)...);
+}
+
+#else // _LIBCPP_STD_VER > 14
+
 template <class _Fp, class _A0, class _DecayFp = typename decay<_Fp>::type, class _DecayA0 = typename decay<_A0>::type,
           class _ClassT = typename __member_pointer_class_type<_DecayFp>::type>
 using __enable_if_bullet1 =
@@ -3114,11 +3447,17 @@ inline _LIBCPP_INLINE_VISIBILITY auto __invoke(_Fp &&__f, _A0 &&__a0, _Args &&..
 
 #undef _LIBCPP_INVOKE_RETURN
 
+#endif // _LIBCPP_STD_VER > 14
+
     // __invokable
     template <class _Ret, class _Fp, class... _Args>
     struct __invokable_r {
   template <class _XFp, class... _XArgs>
+#if _LIBCPP_STD_VER > 14
+  static auto __try_call(int) -> typename __invoke_expr<_XFp, _XArgs...>::type;
+#else
   static auto __try_call(int) -> decltype(_VSTD::__invoke(_VSTD::declval<_XFp>(), _VSTD::declval<_XArgs>()...));
+#endif
   template <class _XFp, class... _XArgs> static __nat __try_call(...);
 
   // FIXME: Check that _Ret, _Fp, and _Args... are all complete types, cv void,
@@ -3157,9 +3496,13 @@ using __nothrow_invokable_r =
 template <class _Fp, class... _Args>
 using __nothrow_invokable = __nothrow_invokable_r_imp<__invokable<_Fp, _Args...>::value, true, void, _Fp, _Args...>;
 
+#if _LIBCPP_STD_VER > 14
+template <class _Fp, class... _Args> struct __invoke_of : public __invoke_expr<_Fp, _Args...> {};
+#else
 template <class _Fp, class... _Args>
 struct __invoke_of
     : public enable_if<__invokable<_Fp, _Args...>::value, typename __invokable_r<void, _Fp, _Args...>::_Result> {};
+#endif
 
 #endif // _LIBCPP_CXX03_LANG
 
@@ -3244,10 +3587,10 @@ template <class _Ret, class _Fn, class... _Args>
 struct _LIBCPP_TEMPLATE_VIS is_invocable_r : integral_constant<bool, __invokable_r<_Ret, _Fn, _Args...>::value> {};
 
 template <class _Fn, class... _Args>
-_LIBCPP_INLINE_VAR constexpr bool is_invocable_v = is_invocable<_Fn, _Args...>::value;
+_LIBCPP_INLINE_VAR constexpr bool is_invocable_v = __invokable<_Fn, _Args...>::value;
 
 template <class _Ret, class _Fn, class... _Args>
-_LIBCPP_INLINE_VAR constexpr bool is_invocable_r_v = is_invocable_r<_Ret, _Fn, _Args...>::value;
+_LIBCPP_INLINE_VAR constexpr bool is_invocable_r_v = __invokable_r<_Ret, _Fn, _Args...>::value;
 
 // is_nothrow_invocable
 
@@ -3260,10 +3603,10 @@ struct _LIBCPP_TEMPLATE_VIS is_nothrow_invocable_r
     : integral_constant<bool, __nothrow_invokable_r<_Ret, _Fn, _Args...>::value> {};
 
 template <class _Fn, class... _Args>
-_LIBCPP_INLINE_VAR constexpr bool is_nothrow_invocable_v = is_nothrow_invocable<_Fn, _Args...>::value;
+_LIBCPP_INLINE_VAR constexpr bool is_nothrow_invocable_v = __nothrow_invokable<_Fn, _Args...>::value;
 
 template <class _Ret, class _Fn, class... _Args>
-_LIBCPP_INLINE_VAR constexpr bool is_nothrow_invocable_r_v = is_nothrow_invocable_r<_Ret, _Fn, _Args...>::value;
+_LIBCPP_INLINE_VAR constexpr bool is_nothrow_invocable_r_v = __nothrow_invokable_r<_Ret, _Fn, _Args...>::value;
 
 #endif // _LIBCPP_STD_VER > 14
 
@@ -3273,11 +3616,11 @@ template <class _Tp> struct __is_nothrow_swappable;
 // swap, swap_ranges
 
 template <class _ForwardIterator1, class _ForwardIterator2>
-inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 _ForwardIterator2
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_FORCE_INLINE _LIBCPP_CONSTEXPR_AFTER_CXX17 _ForwardIterator2
 swap_ranges(_ForwardIterator1 __first1, _ForwardIterator1 __last1, _ForwardIterator2 __first2);
 
 template <class _Tp>
-inline _LIBCPP_INLINE_VISIBILITY
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_FORCE_INLINE
 #ifndef _LIBCPP_CXX03_LANG
     typename enable_if<is_move_constructible<_Tp>::value && is_move_assignable<_Tp>::value>::type
 #else
@@ -3292,24 +3635,41 @@ inline _LIBCPP_INLINE_VISIBILITY
 }
 
 template <class _Tp, size_t _Np>
-inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 typename enable_if<__is_swappable<_Tp>::value>::type
-swap(_Tp (&__a)[_Np], _Tp (&__b)[_Np]) _NOEXCEPT_(__is_nothrow_swappable<_Tp>::value) {
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_FORCE_INLINE _LIBCPP_CONSTEXPR_AFTER_CXX17
+    typename enable_if<__is_swappable<_Tp>::value>::type
+    swap(_Tp (&__a)[_Np], _Tp (&__b)[_Np]) _NOEXCEPT_(__is_nothrow_swappable<_Tp>::value) {
   _VSTD::swap_ranges(__a, __a + _Np, __b);
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2>
 inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 _ForwardIterator2
-swap_ranges(_ForwardIterator1 __first1, _ForwardIterator1 __last1, _ForwardIterator2 __first2) {
+__swap_ranges(_ForwardIterator1 __first1, _ForwardIterator1 __last1, _ForwardIterator2 __first2) {
   for (; __first1 != __last1; ++__first1, (void)++__first2)
     swap(*__first1, *__first2);
   return __first2;
 }
 
+// The two ranges given to swap_ranges are not allowed to overlap, so plain
+// pointers can be passed on as restrict, which lets the loop be vectorized.
+template <class _Tp>
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 _Tp *
+__swap_ranges(_Tp *_LIBCPP_RESTRICT __first1, _Tp *__last1, _Tp *_LIBCPP_RESTRICT __first2) {
+  for (; __first1 != __last1; ++__first1, (void)++__first2)
+    swap(*__first1, *__first2);
+  return __first2;
+}
+
+template <class _ForwardIterator1, class _ForwardIterator2>
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_FORCE_INLINE _LIBCPP_CONSTEXPR_AFTER_CXX17 _ForwardIterator2
+swap_ranges(_ForwardIterator1 __first1, _ForwardIterator1 __last1, _ForwardIterator2 __first2) {
+  return _VSTD::__swap_ranges(__first1, __last1, __first2);
+}
+
 // iter_swap
 
 template <class _ForwardIterator1, class _ForwardIterator2>
-inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 void iter_swap(_ForwardIterator1 __a,
-                                                                              _ForwardIterator2 __b)
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_FORCE_INLINE _LIBCPP_CONSTEXPR_AFTER_CXX17 void
+iter_swap(_ForwardIterator1 __a, _ForwardIterator2 __b)
     //                                  _NOEXCEPT_(_NOEXCEPT_(swap(*__a, *__b)))
     _NOEXCEPT_(_NOEXCEPT_(swap(*_VSTD::declval<_ForwardIterator1>(), *_VSTD::declval<_ForwardIterator2>()))) {
   swap(*__a, *__b);
@@ -3473,14 +3833,74 @@ struct __has_operator_addressof : public integral_constant<bool, __has_operator_
 
 #if _LIBCPP_STD_VER > 14
 
-template <class... _Args> struct conjunction : _And<_Args...> {};
-template <class... _Args> _LIBCPP_INLINE_VAR constexpr bool conjunction_v = conjunction<_Args...>::value;
+// conjunction and disjunction must derive from the predicate that decides the
+// result. Predicates are consumed in blocks of eight: a block that does not
+// decide the result is skipped after one _And/_Or, and only the deciding block
+// is scanned one predicate at a time. The nesting depth is therefore N / 8 + 8
+// instead of N.
+
+template <class...> struct __conjunction_imp {
+  using type = true_type;
+};
+
+template <class _B0> struct __conjunction_imp<_B0> {
+  using type = _B0;
+};
+
+template <class _B0, class _B1, class... _Rest>
+struct __conjunction_imp<_B0, _B1, _Rest...>
+    : _If<bool(_B0::value), __conjunction_imp<_B1, _Rest...>, __conjunction_imp<_B0>> {};
+
+template <bool _BlockTrue, class... _Bp> struct __conjunction_block;
+
+template <class _B0, class _B1, class _B2, class _B3, class _B4, class _B5, class _B6, class _B7, class... _Rest>
+struct __conjunction_block<true, _B0, _B1, _B2, _B3, _B4, _B5, _B6, _B7, _Rest...> : __conjunction_imp<_Rest...> {};
+
+template <class _B0, class _B1, class _B2, class _B3, class _B4, class _B5, class _B6, class _B7, class... _Rest>
+struct __conjunction_block<false, _B0, _B1, _B2, _B3, _B4, _B5, _B6, _B7, _Rest...>
+    : __conjunction_imp<_B0, _B1, _B2, _B3, _B4, _B5, _B6, _B7> {};
+
+template <class _B0, class _B1, class _B2, class _B3, class _B4, class _B5, class _B6, class _B7, class _B8,
+          class... _Rest>
+struct __conjunction_imp<_B0, _B1, _B2, _B3, _B4, _B5, _B6, _B7, _B8, _Rest...>
+    : __conjunction_block<_And<_B0, _B1, _B2, _B3, _B4, _B5, _B6, _B7>::value, _B0, _B1, _B2, _B3, _B4, _B5, _B6, _B7,
+                          _B8, _Rest...> {};
+
+template <class...> struct __disjunction_imp {
+  using type = false_type;
+};
+
+template <class _B0> struct __disjunction_imp<_B0> {
+  using type = _B0;
+};
+
+template <class _B0, class _B1, class... _Rest>
+struct __disjunction_imp<_B0, _B1, _Rest...>
+    : _If<bool(_B0::value), __disjunction_imp<_B0>, __disjunction_imp<_B1, _Rest...>> {};
+
+template <bool _BlockFalse, class... _Bp> struct __disjunction_block;
+
+template <class _B0, class _B1, class _B2, class _B3, class _B4, class _B5, class _B6, class _B7, class... _Rest>
+struct __disjunction_block<true, _B0, _B1, _B2, _B3, _B4, _B5, _B6, _B7, _Rest...> : __disjunction_imp<_Rest...> {};
+
+template <class _B0, class _B1, class _B2, class _B3, class _B4, class _B5, class _B6, class _B7, class... _Rest>
+struct __disjunction_block<false, _B0, _B1, _B2, _B3, _B4, _B5, _B6, _B7, _Rest...>
+    : __disjunction_imp<_B0, _B1, _B2, _B3, _B4, _B5, _B6, _B7> {};
+
+template <class _B0, class _B1, class _B2, class _B3, class _B4, class _B5, class _B6, class _B7, class _B8,
+          class... _Rest>
+struct __disjunction_imp<_B0, _B1, _B2, _B3, _B4, _B5, _B6, _B7, _B8, _Rest...>
+    : __disjunction_block<!_Or<_B0, _B1, _B2, _B3, _B4, _B5, _B6, _B7>::value, _B0, _B1, _B2, _B3, _B4, _B5, _B6, _B7,
+                          _B8, _Rest...> {};
+
+template <class... _Args> struct conjunction : __conjunction_imp<_Args...>::type {};
+template <class... _Args> _LIBCPP_INLINE_VAR constexpr bool conjunction_v = _And<_Args...>::value;
 
-template <class... _Args> struct disjunction : _Or<_Args...> {};
-template <class... _Args> _LIBCPP_INLINE_VAR constexpr bool disjunction_v = disjunction<_Args...>::value;
+template <class... _Args> struct disjunction : __disjunction_imp<_Args...>::type {};
+template <class... _Args> _LIBCPP_INLINE_VAR constexpr bool disjunction_v = _Or<_Args...>::value;
 
 template <class _Tp> struct negation : _Not<_Tp> {};
-template <class _Tp> _LIBCPP_INLINE_VAR constexpr bool negation_v = negation<_Tp>::value;
+template <class _Tp> _LIBCPP_INLINE_VAR constexpr bool negation_v = !bool(_Tp::value);
 #endif // _LIBCPP_STD_VER > 14
 
 // These traits are used in __tree and __hash_table
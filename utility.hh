@@ -0,0 +1,169 @@
+// -*- C++ -*-
+//===-------------------------- utility -----------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+/*
+    utility synopsis
+
+namespace std
+{
+
+template<class T, T... I>
+struct integer_sequence                                                  // C++14
+{
+    typedef T value_type;
+
+    static constexpr size_t size() noexcept;
+};
+
+template<size_t... I>
+    using index_sequence = integer_sequence<size_t, I...>;              // C++14
+
+template<class T, T N>
+    using make_integer_sequence = integer_sequence<T, 0, 1, ..., N-1>;  // C++14
+template<size_t N>
+    using make_index_sequence = make_integer_sequence<size_t, N>;       // C++14
+
+template<class... T>
+    using index_sequence_for = make_index_sequence<sizeof...(T)>;       // C++14
+
+template <class T>
+    typename conditional
+    <
+        !is_nothrow_move_constructible<T>::value && is_copy_constructible<T>::value,
+        const T&,
+        T&&
+    >::type
+    move_if_noexcept(T& x) noexcept;                                    // constexpr in C++14
+
+// extensions
+template <class... T> struct __type_list;
+template <size_t I, class... T> using __type_pack_element_t = ...;
+template <size_t I, class L>    using __type_list_element_t = ...;
+
+}  // std
+
+*/
+
+#include "__config.hh"
+#include "cstddef.hh"
+#include "type_traits.hh"
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#pragma GCC system_header
+#endif
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+// integer_sequence
+
+template <class _Tp, _Tp... _Ip> struct _LIBCPP_TEMPLATE_VIS __integer_sequence {
+  typedef _Tp value_type;
+  static_assert(is_integral<_Tp>::value, "std::integer_sequence can only be instantiated with an integral type");
+  static _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR size_t size() _NOEXCEPT { return sizeof...(_Ip); }
+};
+
+#if __has_builtin(__make_integer_seq)
+template <class _Tp, _Tp _Ep>
+using __make_integer_sequence_imp = __make_integer_seq<__integer_sequence, _Tp, _Ep>;
+#elif defined(_LIBCPP_COMPILER_GCC) && _GNUC_VER >= 800
+template <class _Tp, _Tp _Ep>
+using __make_integer_sequence_imp = __integer_sequence<_Tp, __integer_pack(_Ep)...>;
+#else
+// Doubling construction: O(log N) instantiation depth.
+template <class _Tp, class _Seq, bool _Odd> struct __integer_sequence_double;
+
+template <class _Tp, _Tp... _Ip> struct __integer_sequence_double<_Tp, __integer_sequence<_Tp, _Ip...>, false> {
+  typedef __integer_sequence<_Tp, _Ip..., (sizeof...(_Ip) + _Ip)...> type;
+};
+
+template <class _Tp, _Tp... _Ip> struct __integer_sequence_double<_Tp, __integer_sequence<_Tp, _Ip...>, true> {
+  typedef __integer_sequence<_Tp, _Ip..., (sizeof...(_Ip) + _Ip)..., 2 * sizeof...(_Ip)> type;
+};
+
+template <class _Tp, size_t _Np> struct __make_integer_sequence_unchecked {
+  typedef typename __integer_sequence_double<_Tp, typename __make_integer_sequence_unchecked<_Tp, _Np / 2>::type,
+                                             _Np % 2 != 0>::type type;
+};
+template <class _Tp> struct __make_integer_sequence_unchecked<_Tp, 0> { typedef __integer_sequence<_Tp> type; };
+template <class _Tp> struct __make_integer_sequence_unchecked<_Tp, 1> { typedef __integer_sequence<_Tp, 0> type; };
+
+template <class _Tp, _Tp _Ep>
+using __make_integer_sequence_imp = typename __make_integer_sequence_unchecked<_Tp, size_t(_Ep)>::type;
+#endif
+
+template <size_t... _Ip> using __index_sequence = __integer_sequence<size_t, _Ip...>;
+
+template <size_t _Np> using __make_index_sequence = __make_integer_sequence_imp<size_t, _Np>;
+
+#if _LIBCPP_STD_VER > 11
+
+template <class _Tp, _Tp... _Ip> using integer_sequence = __integer_sequence<_Tp, _Ip...>;
+
+template <size_t... _Ip> using index_sequence = integer_sequence<size_t, _Ip...>;
+
+template <class _Tp, _Tp _Ep> struct __make_integer_sequence_checked {
+  static_assert(is_integral<_Tp>::value, "std::make_integer_sequence can only be instantiated with an integral type");
+  static_assert(0 <= _Ep, "std::make_integer_sequence must have a non-negative sequence length");
+  typedef __make_integer_sequence_imp<_Tp, 0 <= _Ep ? _Ep : 0> type;
+};
+
+template <class _Tp, _Tp _Np>
+using make_integer_sequence = typename __make_integer_sequence_checked<_Tp, _Np>::type;
+
+template <size_t _Np> using make_index_sequence = make_integer_sequence<size_t, _Np>;
+
+template <class... _Tp> using index_sequence_for = make_index_sequence<sizeof...(_Tp)>;
+
+#endif // _LIBCPP_STD_VER > 11
+
+// move_if_noexcept
+
+template <class _Tp>
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX11
+    typename conditional<!is_nothrow_move_constructible<_Tp>::value && is_copy_constructible<_Tp>::value,
+                         const _Tp &, _Tp &&>::type
+    move_if_noexcept(_Tp &__x) _NOEXCEPT {
+  return _VSTD::move(__x);
+}
+
+// __type_list
+
+template <class... _Tp> struct __type_list {
+  static _LIBCPP_CONSTEXPR const size_t size = sizeof...(_Tp);
+};
+
+#if __has_builtin(__type_pack_element)
+template <size_t _Ip, class... _Tp> using __type_pack_element_t = __type_pack_element<_Ip, _Tp...>;
+#else
+// Select by overload resolution against an indexed base: a single
+// instantiation regardless of _Ip, instead of _Ip levels of recursion.
+template <size_t _Ip, class _Tp> struct __indexed_type { typedef _Tp type; };
+
+template <class _Seq, class... _Tp> struct __indexed_types;
+template <size_t... _Ip, class... _Tp>
+struct __indexed_types<__index_sequence<_Ip...>, _Tp...> : __indexed_type<_Ip, _Tp>... {};
+
+template <size_t _Ip, class _Tp> __indexed_type<_Ip, _Tp> __select_indexed_type(const __indexed_type<_Ip, _Tp> &);
+
+template <size_t _Ip, class... _Tp>
+using __type_pack_element_t = typename decltype(
+    _VSTD::__select_indexed_type<_Ip>(__indexed_types<__make_index_sequence<sizeof...(_Tp)>, _Tp...>()))::type;
+#endif
+
+template <size_t _Ip, class _List> struct __type_list_element;
+template <size_t _Ip, class... _Tp> struct __type_list_element<_Ip, __type_list<_Tp...>> {
+  static_assert(_Ip < sizeof...(_Tp), "__type_list index out of range");
+  typedef __type_pack_element_t<_Ip, _Tp...> type;
+};
+
+template <size_t _Ip, class _List> using __type_list_element_t = typename __type_list_element<_Ip, _List>::type;
+
+_LIBCPP_END_NAMESPACE_STD